@@ -27,10 +27,12 @@ else()
     set(GRPC_VERSION 1.65.0)
 endif()
 set(GOOGLETEST_VERSION 1.12.1)
+set(GBENCHMARK_VERSION 1.8.3)
 Set(FETCHCONTENT_QUIET FALSE)
 
 set(GRPC_SRC_URL https://github.com/grpc/grpc.git)
 set(GTEST_SRC_URL https://github.com/google/googletest.git)
+set(GBENCHMARK_SRC_URL https://github.com/google/benchmark.git)
 
 # grpc
 FetchContent_Declare(
@@ -50,6 +52,15 @@ FetchContent_Declare(
     GIT_PROGRESS      TRUE
 )
 
+# google benchmark
+FetchContent_Declare(
+    googlebenchmark
+    GIT_REPOSITORY    ${GBENCHMARK_SRC_URL}
+    GIT_TAG           v${GBENCHMARK_VERSION}
+    GIT_SHALLOW       TRUE
+    GIT_PROGRESS      TRUE
+)
+
 # grpc
 if ("${MILVUS_WITH_GRPC}" STREQUAL "package")
     message(STATUS "Finding gRPC lib from specified path: ${GRPC_PATH}")
@@ -135,3 +146,23 @@ else()
         add_library(GTest::gmock_main ALIAS gmock_main)
     endif()
 endif()
+
+# google benchmark, only fetched when the benchmarks are built
+if (MILVUS_BUILD_BENCHMARK)
+    if ("${MILVUS_WITH_BENCHMARK}" STREQUAL "package")
+        find_package(benchmark CONFIG REQUIRED)
+    else()
+        if (NOT googlebenchmark_POPULATED)
+            message(STATUS "Downloading google benchmark source code from: ${GBENCHMARK_SRC_URL}")
+            FetchContent_Populate(googlebenchmark)
+            set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+            set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+            set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+            set(_MILVUS_BUILD_SHARED_LIBS "${BUILD_SHARED_LIBS}")
+            set(BUILD_SHARED_LIBS OFF)
+            add_subdirectory(${googlebenchmark_SOURCE_DIR} ${googlebenchmark_BINARY_DIR} EXCLUDE_FROM_ALL)
+            set(BUILD_SHARED_LIBS "${_MILVUS_BUILD_SHARED_LIBS}")
+            unset(_MILVUS_BUILD_SHARED_LIBS)
+        endif()
+    endif()
+endif()
@@ -19,11 +19,13 @@ class MilvusSdkCppConan(ConanFile):
         "shared": [True, False],
         "fPIC": [True, False],
         "with_tests": [True, False],  # Explicit option for tests
+        "with_benchmark": [True, False],  # Explicit option for benchmarks
     }
     default_options = {
         "shared": False,
         "fPIC": True,
         "with_tests": False,  # Explicit default for tests
+        "with_benchmark": False,  # Explicit default for benchmarks
 
         # gRPC pulls a lot of deps; keep it lean enough to be usable.
         "grpc/*:shared": False,
@@ -56,6 +58,8 @@ class MilvusSdkCppConan(ConanFile):
 
         if self.options.with_tests:
             self.requires("gtest/1.12.1")
+        if self.options.with_benchmark:
+            self.requires("benchmark/1.8.3")
 
     def layout(self):
         cmake_layout(self)
@@ -69,12 +73,14 @@ class MilvusSdkCppConan(ConanFile):
 
         # Map upstream options
         tc.variables["MILVUS_BUILD_TEST"] = bool(self.options.with_tests)
+        tc.variables["MILVUS_BUILD_BENCHMARK"] = bool(self.options.with_benchmark)
         tc.variables["MILVUS_BUILD_EXAMPLES"] = False
         tc.variables["BUILD_FROM_CONAN"] = "ON"
 
         # Disable the legacy thirdparty switches. We'll use Conan targets.
         tc.variables["MILVUS_WITH_GRPC"] = "package"
         tc.variables["MILVUS_WITH_GTEST"] = "package"
+        tc.variables["MILVUS_WITH_BENCHMARK"] = "package"
 
         # GRPC_PATH is only relevant for their custom prebuilt tree; keep empty.
         tc.variables["GRPC_PATH"] = ""
@@ -21,6 +21,7 @@ BUILD_TYPE="Debug"
 UNIT_TEST="OFF"
 SYS_TEST="OFF"
 BUILD_TEST="OFF"
+BUILD_BENCHMARK="OFF"
 MAKE_CLEAN="OFF"
 RUN_FORMAT="ON"
 RUN_CPPLINT="OFF"
@@ -44,7 +45,7 @@ if [ ${JOBS} -gt 10 ] ; then
     JOBS=10
 fi
 
-while getopts "t:v:ulrcsphizf" arg; do
+while getopts "t:v:ulrcsbphizf" arg; do
   case $arg in
   t)
     BUILD_TYPE=$OPTARG # BUILD_TYPE
@@ -69,6 +70,9 @@ while getopts "t:v:ulrcsphizf" arg; do
   c)
     BUILD_COVERAGE="ON"
     ;;
+  b)
+    BUILD_BENCHMARK="ON"
+    ;;
   s)
     SYS_TEST="ON"
     BUILD_TEST="ON"
@@ -103,6 +107,7 @@ parameter:
 -u: build with unit testing(default: OFF)
 -r: clean before build
 -s: build with system testing(default: OFF)
+-b: build and run benchmarks, results are written to benchmark.json(default: OFF)
 -c: build with coverage
 -p: build with production(-t RelWithDebInfo -r)
 -i: do install
@@ -111,7 +116,7 @@ parameter:
 -h: help
 
 usage:
-./build.sh -t \${BUILD_TYPE} -v \${MILVUS_SDK_VERSION} [-l] [-r] [-r] [-s] [-p] [-h]"
+./build.sh -t \${BUILD_TYPE} -v \${MILVUS_SDK_VERSION} [-l] [-r] [-r] [-s] [-b] [-p] [-h]"
     exit 0
     ;;
   ?)
@@ -165,6 +170,11 @@ if [[ "${BUILD_FROM_CONAN}" == "ON" ]]; then
   else
     CONAN_WITH_TESTS=False
   fi
+  if [[ "${BUILD_BENCHMARK}" == "ON" ]]; then
+    CONAN_WITH_BENCHMARK=True
+  else
+    CONAN_WITH_BENCHMARK=False
+  fi
 
   # Build folder layout follows Conan 2 CMakeToolchain defaults:
   #   cmake_build/build/<BuildType>/generators/conan_toolchain.cmake
@@ -180,6 +190,7 @@ if [[ "${BUILD_FROM_CONAN}" == "ON" ]]; then
     -s:b build_type=${BUILD_TYPE} \
     -s:b compiler.cppstd=${BUILD_CPPSTD} \
     -o "&:with_tests=${CONAN_WITH_TESTS}" \
+    -o "&:with_benchmark=${CONAN_WITH_BENCHMARK}" \
     -c tools.build:jobs=${JOBS} \
     --build=missing || exit 1
 
@@ -241,6 +252,7 @@ CMAKE_CMD="cmake \
 -DCMAKE_CXX_STANDARD=${CPPSTD} \
 -DMILVUS_BUILD_TEST=${BUILD_TEST} \
 -DMILVUS_BUILD_COVERAGE=${BUILD_COVERAGE} \
+-DMILVUS_BUILD_BENCHMARK=${BUILD_BENCHMARK} \
 -DMILVUS_BUILD_EXAMPLES=${CMAKE_BUILD_EXAMPLES} \
 -DMILVUS_ENABLE_PCH=${MILVUS_ENABLE_PCH} \
 ${CMAKE_VERSION_ARG} \
@@ -309,6 +321,11 @@ if [[ "${SYS_TEST}" == "ON" ]]; then
   GRPC_VERBOSITY=ERROR ./test/testing-st || exit 1
 fi
 
+if [[ "${BUILD_BENCHMARK}" == "ON" ]]; then
+  make -j ${JOBS}  || exit 1
+  ./test/bench/benchmark-sdk --benchmark_out=benchmark.json --benchmark_out_format=json || exit 1
+fi
+
 if [[ "${DO_INSTALL}" == "ON" ]]; then
   make install || exit 1
 fi
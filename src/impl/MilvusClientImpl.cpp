@@ -228,6 +228,7 @@ MilvusClientImpl::DescribeCollection(const std::string& collection_name, Collect
 
         collection_desc.SetAlias(std::move(aliases));
         collection_desc.SetCreatedTime(response.created_timestamp());
+        collection_desc.SetUpdateTime(response.update_timestamp());
         return Status::OK();
     };
 
@@ -17,22 +17,30 @@
 #include "MilvusClientV2Impl.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <limits>
 #include <milvus/thirdparty/nlohmann/json.hpp>
+#include <mutex>
 #include <set>
-#include <thread>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 #include "MilvusClientV2SessionImpl.h"
 #include "rg.pb.h"
 #include "types/QueryIteratorImpl.h"
 #include "types/SearchIteratorImpl.h"
 #include "types/SearchIteratorV2Impl.h"
+#include "utils/AllocationTracker.h"
+#include "utils/CallTimer.h"
+#include "utils/ConcurrencyUtils.h"
 #include "utils/Constants.h"
 #include "utils/DmlUtils.h"
 #include "utils/DqlUtils.h"
 #include "utils/FieldDataSchema.h"
+#include "utils/IDsEncodingUtils.h"
 #include "utils/MiscUtils.h"
 #include "utils/TypeUtils.h"
 #include "utils/cache/CollectionTsCache.h"
@@ -40,11 +48,120 @@
 
 namespace milvus {
 
+namespace {
+
+// wait more 1 second to make sure the flushed segments are visible.
+// there might be a small delay(on server-side) between the flush_ts and the time when the segments are actually
+// flushed, if user calls createSnapshot immediately after flush returns, it might not find the flushed segments.
+constexpr uint32_t kFlushSettleMs = 1000;
+
+// ProgressMonitor timeout unit is second, it is a history problem.
+// timeout_ms 0ms is treated as 0 second, which means "forever".
+// timeout_ms in [1, 1000] is treated as 1 second, timeout_ms in [1001, 2000] is treated as 2 seconds, etc.
+ProgressMonitor
+WaitMonitor(int64_t timeout_ms) {
+    if (timeout_ms > 0) {
+        return ProgressMonitor{static_cast<uint32_t>(timeout_ms + 999) / 1000};
+    }
+    return ProgressMonitor::Forever();
+}
+
+void
+FlushSegments(const proto::milvus::FlushResponse& response, std::map<std::string, std::vector<int64_t>>& segments,
+              std::map<std::string, uint64_t>& flush_tss) {
+    for (const auto& iter : response.coll_segids()) {
+        const auto& ids = iter.second.data();
+        if (ids.empty()) {
+            continue;
+        }
+        segments.emplace(iter.first, std::vector<int64_t>(ids.begin(), ids.end()));
+    }
+    for (const auto& iter : response.coll_flush_ts()) {
+        flush_tss.emplace(iter.first, iter.second);
+    }
+}
+
+// Done when every query is, a query is not called again once it reported done.
+StatusWaiter::QueryFunction
+AllQueries(std::vector<StatusWaiter::QueryFunction> queries) {
+    auto finished = std::make_shared<std::vector<bool>>(queries.size(), false);
+    return [queries, finished](Progress& progress, uint64_t rpc_timeout_ms) -> Status {
+        progress.total_ = static_cast<uint32_t>(queries.size());
+        progress.finished_ = 0;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            if (!(*finished)[i]) {
+                Progress one;
+                auto status = queries[i](one, rpc_timeout_ms);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                (*finished)[i] = one.Done();
+            }
+            progress.finished_ += (*finished)[i] ? 1 : 0;
+        }
+        return Status::OK();
+    };
+}
+
+Status
+ReadyStatus(std::future<Status>& done) {
+    std::promise<Status> ready;
+    ready.set_value(Status::OK());
+    done = ready.get_future();
+    return Status::OK();
+}
+
+// An asynchronous call answered without an rpc, such as from the result cache, is done at once.
+Status
+CompleteWithoutRpc(const MilvusConnection::AsyncDone& done) {
+    if (done) {
+        done(Status::OK());
+    }
+    return Status::OK();
+}
+
+Status
+EmptyAsyncDone() {
+    return {StatusCode::INVALID_ARGUMENT, "The done callback of an asynchronous call cannot be empty"};
+}
+
+}  // namespace
+
 std::shared_ptr<MilvusClientV2>
 MilvusClientV2::Create() {
     return std::make_shared<MilvusClientV2Impl>();
 }
 
+std::shared_ptr<MilvusClientV2>
+MilvusClientV2::Create(ExecutorPtr executor) {
+    return std::make_shared<MilvusClientV2Impl>(std::move(executor));
+}
+
+void
+MilvusClientV2::SetAllocationCounter(AllocationCounter counter) {
+    AllocationTracker::GetInstance().SetCounter(std::move(counter));
+}
+
+MilvusClientV2Impl::MilvusClientV2Impl(ExecutorPtr executor)
+    : schema_loader_(
+          [this](const std::string& database_name, const std::string& collection_name, CollectionDescPtr& desc) {
+              auto request =
+                  DescribeCollectionRequest().WithDatabaseName(database_name).WithCollectionName(collection_name);
+              DescribeCollectionResponse response;
+              auto status = describeCollection(request, response);
+              if (status.IsOk()) {
+                  desc = std::make_shared<CollectionDesc>(response.Desc());
+              }
+              return status;
+          },
+          [this](const std::string& database_name, const std::vector<std::string>& collection_names,
+                 std::vector<Status>& statuses, std::vector<CollectionDescPtr>& descs) {
+              return describeCollections(database_name, collection_names, statuses, descs);
+          }),
+      waiter_(StatusWaiter::GetInstance()),
+      executor_(executor ? std::move(executor) : Executor::Default()) {
+}
+
 MilvusClientV2Impl::~MilvusClientV2Impl() {
     Disconnect();
 }
@@ -66,12 +183,33 @@ MilvusClientV2Impl::Session(const std::string& cluster_id, MilvusClientV2Session
 
 Status
 MilvusClientV2Impl::Connect(const ConnectParam& param) {
-    return connection_.Connect(param);
+    auto status = connection_.Connect(param);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    PersistentSchemaCachePtr schema_file;
+    if (!param.SchemaCacheFile().empty()) {
+        schema_file = PersistentSchemaCache::Open(param.SchemaCacheFile());
+    }
+    auto previous = std::atomic_exchange(&schema_file_, schema_file);
+    if (previous != nullptr && previous != schema_file) {
+        return previous->Save();
+    }
+    return Status::OK();
 }
 
 Status
 MilvusClientV2Impl::Disconnect() {
-    return connection_.Disconnect();
+    waiter_.Cancel(this);
+    result_cache_.Clear();
+    metadata_cache_.Clear();
+    auto schema_file = std::atomic_exchange(&schema_file_, PersistentSchemaCachePtr());
+    auto status = connection_.Disconnect();
+    if (status.IsOk() && schema_file != nullptr) {
+        return schema_file->Save();
+    }
+    return status;
 }
 
 Status
@@ -84,6 +222,53 @@ MilvusClientV2Impl::SetRetryParam(const RetryParam& retry_param) {
     return connection_.SetRetryParam(retry_param);
 }
 
+Status
+MilvusClientV2Impl::SetTracer(const TracerPtr& tracer) {
+    return connection_.SetTracer(tracer);
+}
+
+Status
+MilvusClientV2Impl::SetResultCacheParam(const ResultCacheParam& param) {
+    result_cache_.SetParam(param);
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::GetResultCacheStats(ResultCacheStats& stats) {
+    stats = result_cache_.Stats();
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::SetMetadataCacheParam(const MetadataCacheParam& param) {
+    metadata_cache_.SetParam(param);
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::GetMetadataCacheStats(MetadataCacheStats& stats) {
+    stats = metadata_cache_.Stats();
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::GetExecutorStats(ExecutorStats& stats) {
+    stats = executor_->Stats();
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::GetAllocationStats(AllocationStats& stats) {
+    stats = AllocationTracker::GetInstance().Stats();
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::GetExecutor(ExecutorPtr& executor) {
+    executor = executor_;
+    return Status::OK();
+}
+
 Status
 MilvusClientV2Impl::GetServerVersion(std::string& version) {
     auto post = [&version](const proto::milvus::GetVersionResponse& response) {
@@ -103,6 +288,7 @@ MilvusClientV2Impl::GetSDKVersion(std::string& version) {
 
 Status
 MilvusClientV2Impl::CheckHealth(const CheckHealthRequest& request, CheckHealthResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::CheckHealthRequest& rpc_request) { return Status::OK(); };
 
     auto post = [&response](const proto::milvus::CheckHealthResponse& rpc_response) {
@@ -205,8 +391,10 @@ MilvusClientV2Impl::CreateCollection(const CreateCollectionRequest& request) {
         return LoadCollection(load_req);
     };
 
-    return connection_.Invoke<proto::milvus::CreateCollectionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::CreateCollectionRequest, proto::common::Status>(
         validate, pre, &MilvusConnection::CreateCollection, post);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -241,6 +429,7 @@ MilvusClientV2Impl::CreateCollection(const CreateSimpleCollectionRequest& reques
 
 Status
 MilvusClientV2Impl::HasCollection(const HasCollectionRequest& request, HasCollectionResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::HasCollectionRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -277,8 +466,10 @@ MilvusClientV2Impl::DropCollection(const DropCollectionRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::DropCollectionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::DropCollectionRequest, proto::common::Status>(
         pre, &MilvusConnection::DropCollection, post);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -296,8 +487,11 @@ MilvusClientV2Impl::TruncateCollection(const TruncateCollectionRequest& request)
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::TruncateCollectionRequest, proto::milvus::TruncateCollectionResponse>(
-        pre, &MilvusConnection::TruncateCollection, post);
+    auto status =
+        connection_.Invoke<proto::milvus::TruncateCollectionRequest, proto::milvus::TruncateCollectionResponse>(
+            pre, &MilvusConnection::TruncateCollection, post);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -319,11 +513,13 @@ MilvusClientV2Impl::LoadCollection(const LoadCollectionRequest& request) {
 
     // if not sync mode, directly return
     if (!request.Sync()) {
-        return connection_.Invoke<proto::milvus::LoadCollectionRequest, proto::common::Status>(
+        auto status = connection_.Invoke<proto::milvus::LoadCollectionRequest, proto::common::Status>(
             pre, &MilvusConnection::LoadCollection);
+        invalidateMetadata(request.DatabaseName(), request.CollectionName());
+        return status;
     }
 
-    // wait loading progress, check load state in interval 500ms, until the time cost exceeds request.TimeoutMs()
+    // wait loading progress, check load state at intervals backing off to 500ms, until request.TimeoutMs() passes
     // ProgressMonitor timeout unit is second, it is a history problem.
     // request.TimeoutMs() 0ms is treated as 0 second, which means "forever".
     // request.TimeoutMs() in [1, 1000] is treated as 1 second, request.
@@ -333,25 +529,24 @@ MilvusClientV2Impl::LoadCollection(const LoadCollectionRequest& request) {
         progress_monitor = ProgressMonitor{static_cast<uint32_t>(request.TimeoutMs() + 999) / 1000};
     }
     auto wait_for_status = [this, &request, &progress_monitor](const proto::common::Status&) {
-        return ConnectionHandler::WaitForStatus(
-            [&request, this](Progress& progress) -> Status {
-                progress.total_ = 100;
-                auto db_name = connection_.CurrentDbName(request.DatabaseName());
-                std::set<std::string> partition_names;
-                uint32_t loading_progress = 0;
-                uint32_t refresh_progress = 0;
-                auto status = connection_.GetLoadingProgress(db_name, request.CollectionName(), partition_names,
-                                                             loading_progress, refresh_progress);
-                if (!status.IsOk()) {
-                    return status;
-                }
-                progress.finished_ = request.Refresh() ? refresh_progress : loading_progress;
-                return Status::OK();
-            },
-            progress_monitor);
+        return waitForStatus(loadingQuery(request.DatabaseName(), request.CollectionName(), {}, request.Refresh()),
+                             progress_monitor);
     };
-    return connection_.Invoke<proto::milvus::LoadCollectionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::LoadCollectionRequest, proto::common::Status>(
         pre, &MilvusConnection::LoadCollection, wait_for_status);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
+}
+
+Status
+MilvusClientV2Impl::LoadCollectionAsync(const LoadCollectionRequest& request, std::future<Status>& done) {
+    auto status = LoadCollection(LoadCollectionRequest(request).WithSync(false));
+    if (!status.IsOk()) {
+        return status;
+    }
+    done = waiter_.Submit(this, loadingQuery(request.DatabaseName(), request.CollectionName(), {}, request.Refresh()),
+                          WaitMonitor(request.TimeoutMs()));
+    return Status::OK();
 }
 
 Status
@@ -369,8 +564,10 @@ MilvusClientV2Impl::refreshLoad(const RefreshLoadRequest& request, uint64_t rpc_
     };
 
     if (!request.Sync()) {
-        return connection_.InvokeWithRpcTimeout<proto::milvus::LoadCollectionRequest, proto::common::Status>(
+        auto status = connection_.InvokeWithRpcTimeout<proto::milvus::LoadCollectionRequest, proto::common::Status>(
             rpc_timeout_ms, pre, &MilvusConnection::LoadCollection);
+        invalidateMetadata(request.DatabaseName(), request.CollectionName());
+        return status;
     }
 
     ProgressMonitor progress_monitor = ProgressMonitor::Forever();
@@ -378,26 +575,15 @@ MilvusClientV2Impl::refreshLoad(const RefreshLoadRequest& request, uint64_t rpc_
         progress_monitor = ProgressMonitor{static_cast<uint32_t>(request.TimeoutMs() + 999) / 1000};
     }
     auto wait_for_status = [this, &request, &progress_monitor, rpc_timeout_ms](const proto::common::Status&) {
-        return ConnectionHandler::WaitForStatus(
-            [&request, this, rpc_timeout_ms](Progress& progress) -> Status {
-                progress.total_ = 100;
-                auto db_name = connection_.CurrentDbName(request.DatabaseName());
-                std::set<std::string> partition_names;
-                uint32_t loading_progress = 0;
-                uint32_t refresh_progress = 0;
-                auto status = connection_.GetLoadingProgress(db_name, request.CollectionName(), partition_names,
-                                                             loading_progress, refresh_progress, rpc_timeout_ms);
-                if (!status.IsOk()) {
-                    return status;
-                }
-                progress.finished_ = refresh_progress;
-                return Status::OK();
-            },
+        return waitForStatus(
+            loadingQuery(request.DatabaseName(), request.CollectionName(), {}, true, rpc_timeout_ms),
             progress_monitor);
     };
-    return connection_.InvokeWithRpcTimeout<proto::milvus::LoadCollectionRequest, proto::common::Status>(
+    auto status = connection_.InvokeWithRpcTimeout<proto::milvus::LoadCollectionRequest, proto::common::Status>(
         rpc_timeout_ms, std::function<Status(void)>{}, pre, &MilvusConnection::LoadCollection, wait_for_status,
         std::function<Status(const proto::common::Status&)>{});
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -408,12 +594,15 @@ MilvusClientV2Impl::ReleaseCollection(const ReleaseCollectionRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::ReleaseCollectionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::ReleaseCollectionRequest, proto::common::Status>(
         pre, &MilvusConnection::ReleaseCollection);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
 MilvusClientV2Impl::DescribeCollection(const DescribeCollectionRequest& request, DescribeCollectionResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return describeCollection(request, response);
 }
 
@@ -442,9 +631,79 @@ MilvusClientV2Impl::describeCollection(const DescribeCollectionRequest& request,
             rpc_timeout_ms, pre, &MilvusConnection::DescribeCollection, post);
 }
 
+Status
+MilvusClientV2Impl::describeCollections(const std::string& database_name,
+                                        const std::vector<std::string>& collection_names,
+                                        std::vector<Status>& statuses, std::vector<CollectionDescPtr>& descs) {
+    auto pre = [&database_name, &collection_names](proto::milvus::BatchDescribeCollectionRequest& rpc_request) {
+        rpc_request.set_db_name(database_name);
+        for (const auto& collection_name : collection_names) {
+            rpc_request.add_collection_name(collection_name);
+        }
+        return Status::OK();
+    };
+
+    // the server answers the names in order, one response with its own status per name
+    auto post = [&collection_names, &statuses,
+                 &descs](const proto::milvus::BatchDescribeCollectionResponse& rpc_response) {
+        if (static_cast<size_t>(rpc_response.responses_size()) != collection_names.size()) {
+            return Status{StatusCode::SERVER_FAILED, "Unexpected number of results from BatchDescribeCollection"};
+        }
+        statuses.resize(collection_names.size());
+        descs.resize(collection_names.size());
+        for (int i = 0; i < rpc_response.responses_size(); ++i) {
+            auto desc = std::make_shared<CollectionDesc>();
+            statuses[i] = ConvertDescribeCollectionResponse(rpc_response.responses(i), *desc);
+            descs[i] = statuses[i].IsOk() ? std::move(desc) : nullptr;
+        }
+        return Status::OK();
+    };
+
+    auto status =
+        connection_
+            .Invoke<proto::milvus::BatchDescribeCollectionRequest, proto::milvus::BatchDescribeCollectionResponse>(
+                pre, &MilvusConnection::BatchDescribeCollection, post);
+    // An older server reports gRPC UNIMPLEMENTED, or Milvus ErrServiceUnimplemented (code 10).
+    if (status.RpcErrCode() == static_cast<int32_t>(::grpc::StatusCode::UNIMPLEMENTED) || status.ServerCode() == 10) {
+        return {StatusCode::NOT_SUPPORTED, "BatchDescribeCollection is not supported by the server"};
+    }
+    return status;
+}
+
+bool
+MilvusClientV2Impl::loadPersistedSchema(const PersistentSchemaCachePtr& schema_file, const CollectionCacheKey& key,
+                                        CollectionDescPtr& desc) {
+    uint64_t update_time = 0;
+    std::string payload;
+    if (schema_file == nullptr || !schema_file->Get(key, update_time, payload)) {
+        return false;
+    }
+
+    auto loaded = std::make_shared<CollectionDesc>();
+    if (!ParseCollectionDesc(payload, *loaded).IsOk()) {
+        schema_file->Invalidate(key);
+        return false;
+    }
+    loaded->SetUpdateTime(update_time);
+    desc = std::move(loaded);
+    return true;
+}
+
+void
+MilvusClientV2Impl::persistSchema(const PersistentSchemaCachePtr& schema_file, const CollectionCacheKey& key,
+                                  const CollectionDescPtr& desc) {
+    if (schema_file == nullptr || desc == nullptr) {
+        return;
+    }
+    std::string payload;
+    SerializeCollectionDesc(*desc, payload);
+    schema_file->Set(key, desc->UpdateTime(), std::move(payload));
+}
+
 Status
 MilvusClientV2Impl::BatchDescribeCollections(const BatchDescribeCollectionsRequest& request,
                                              BatchDescribeCollectionsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::BatchDescribeCollectionRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         for (const auto& collection_name : request.CollectionNames()) {
@@ -477,8 +736,64 @@ MilvusClientV2Impl::BatchDescribeCollections(const BatchDescribeCollectionsReque
             pre, &MilvusConnection::BatchDescribeCollection, post);
 }
 
+Status
+MilvusClientV2Impl::PrefetchSchemas(const std::string& db_name, const std::vector<std::string>& collection_names) {
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(db_name);
+    auto schema_file = std::atomic_load(&schema_file_);
+
+    std::vector<std::string> missing;
+    std::unordered_set<std::string> seen;
+    for (const auto& collection_name : collection_names) {
+        CollectionDescPtr desc;
+        if (collection_name.empty() || !seen.insert(collection_name).second ||
+            SchemaCache::GetInstance().Get(endpoint, database_name, collection_name, desc)) {
+            continue;
+        }
+        const auto key = CollectionCacheKey::Create(endpoint, database_name, collection_name);
+        if (loadPersistedSchema(schema_file, key, desc)) {
+            CollectionDescPtr cached;
+            SchemaCache::GetInstance().GetOrLoad(
+                endpoint, database_name, collection_name, false, this,
+                [&desc](CollectionDescPtr& loaded) {
+                    loaded = desc;
+                    return Status::OK();
+                },
+                cached);
+            continue;
+        }
+        missing.push_back(collection_name);
+    }
+
+    std::vector<Status> statuses;
+    std::vector<CollectionDescPtr> descs;
+    schema_loader_.LoadMany(database_name, missing, statuses, descs);
+
+    Status first_failure;
+    for (size_t i = 0; i < missing.size(); ++i) {
+        if (!statuses[i].IsOk()) {
+            if (first_failure.IsOk()) {
+                first_failure = statuses[i];
+            }
+            continue;
+        }
+        // through GetOrLoad, so that an invalidation racing with this prefetch is not overwritten
+        CollectionDescPtr cached;
+        SchemaCache::GetInstance().GetOrLoad(
+            endpoint, database_name, missing[i], false, this,
+            [&descs, i](CollectionDescPtr& loaded) {
+                loaded = descs[i];
+                return Status::OK();
+            },
+            cached);
+        persistSchema(schema_file, CollectionCacheKey::Create(endpoint, database_name, missing[i]), descs[i]);
+    }
+    return first_failure;
+}
+
 Status
 MilvusClientV2Impl::DescribeReplicas(const DescribeReplicasRequest& request, DescribeReplicasResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     if (request.CollectionName().empty()) {
         return {StatusCode::INVALID_ARGUMENT, "Collection name cannot be empty"};
     }
@@ -565,12 +880,15 @@ MilvusClientV2Impl::RenameCollection(const RenameCollectionRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::RenameCollectionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::RenameCollectionRequest, proto::common::Status>(
         pre, &MilvusConnection::RenameCollection, post);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
 MilvusClientV2Impl::GetCollectionStats(const GetCollectionStatsRequest& request, GetCollectionStatsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::GetCollectionStatisticsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -594,6 +912,7 @@ MilvusClientV2Impl::GetCollectionStats(const GetCollectionStatsRequest& request,
 
 Status
 MilvusClientV2Impl::ListCollections(const ListCollectionsRequest& request, ListCollectionsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::ShowCollectionsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         auto show_type = request.OnlyShowLoaded() ? proto::milvus::ShowType::InMemory : proto::milvus::ShowType::All;
@@ -619,12 +938,31 @@ MilvusClientV2Impl::ListCollections(const ListCollectionsRequest& request, ListC
 
 Status
 MilvusClientV2Impl::GetLoadState(const GetLoadStateRequest& request, GetLoadStateResponse& response) {
-    return getLoadState(request, response);
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    return getLoadState(request, response, 0, true);
 }
 
 Status
 MilvusClientV2Impl::getLoadState(const GetLoadStateRequest& request, GetLoadStateResponse& response,
-                                 uint64_t rpc_timeout_ms) {
+                                 uint64_t rpc_timeout_ms, bool use_cache) {
+    MetadataCache::Key cache_key;
+    const bool cached = use_cache && metadata_cache_.Enabled();
+    if (cached) {
+        // the same partitions in another order give the same answer
+        std::vector<std::string> partition_names(request.PartitionNames().begin(), request.PartitionNames().end());
+        std::sort(partition_names.begin(), partition_names.end());
+        std::string detail;
+        for (const auto& name : partition_names) {
+            detail.append(name).push_back('\0');
+        }
+        cache_key = metadata_cache_.MakeKey(connection_.CurrentEndpoint(),
+                                            connection_.CurrentDbName(request.DatabaseName()),
+                                            request.CollectionName(), MetadataCache::Kind::LOAD_STATE, detail);
+        if (metadata_cache_.Get(cache_key, response)) {
+            return Status::OK();
+        }
+    }
+
     auto pre = [&request](proto::milvus::GetLoadStateRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -655,8 +993,25 @@ MilvusClientV2Impl::getLoadState(const GetLoadStateRequest& request, GetLoadStat
         return Status::OK();
     };
 
-    return connection_.InvokeWithRpcTimeout<proto::milvus::GetLoadStateRequest, proto::milvus::GetLoadStateResponse>(
-        rpc_timeout_ms, pre, &MilvusConnection::GetLoadState, post);
+    auto status =
+        connection_.InvokeWithRpcTimeout<proto::milvus::GetLoadStateRequest, proto::milvus::GetLoadStateResponse>(
+            rpc_timeout_ms, pre, &MilvusConnection::GetLoadState, post);
+    // the progress of a loading collection changes on every call, only settled states are cached
+    if (cached && status.IsOk() && response.State() != LoadState::LOAD_STATE_LOADING) {
+        metadata_cache_.Put(cache_key, response);
+    }
+    return status;
+}
+
+void
+MilvusClientV2Impl::invalidateMetadata(const std::string& db_name, const std::string& collection_name) {
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(db_name);
+    if (collection_name.empty()) {
+        metadata_cache_.InvalidateDb(endpoint, database_name);
+    } else {
+        metadata_cache_.Invalidate(endpoint, database_name, collection_name);
+    }
 }
 
 Status
@@ -1126,8 +1481,10 @@ MilvusClientV2Impl::CreatePartition(const CreatePartitionRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::CreatePartitionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::CreatePartitionRequest, proto::common::Status>(
         pre, &MilvusConnection::CreatePartition);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -1139,12 +1496,15 @@ MilvusClientV2Impl::DropPartition(const DropPartitionRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::DropPartitionRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::DropPartitionRequest, proto::common::Status>(
         pre, &MilvusConnection::DropPartition);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
 MilvusClientV2Impl::HasPartition(const HasPartitionRequest& request, HasPartitionResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::HasPartitionRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -1183,11 +1543,13 @@ MilvusClientV2Impl::LoadPartitions(const LoadPartitionsRequest& request) {
 
     // if not sync mode, directly return
     if (!request.Sync()) {
-        return connection_.Invoke<proto::milvus::LoadPartitionsRequest, proto::common::Status>(
+        auto status = connection_.Invoke<proto::milvus::LoadPartitionsRequest, proto::common::Status>(
             pre, &MilvusConnection::LoadPartitions);
+        invalidateMetadata(request.DatabaseName(), request.CollectionName());
+        return status;
     }
 
-    // wait loading progress, check load state in interval 500ms, until the time cost exceeds request.TimeoutMs()
+    // wait loading progress, check load state at intervals backing off to 500ms, until request.TimeoutMs() passes
     // ProgressMonitor timeout unit is second, it is a history problem.
     // request.TimeoutMs() 0ms is treated as 0 second, which means "forever".
     // request.TimeoutMs() in [1, 1000] is treated as 1 second, request.
@@ -1197,24 +1559,27 @@ MilvusClientV2Impl::LoadPartitions(const LoadPartitionsRequest& request) {
         progress_monitor = ProgressMonitor{static_cast<uint32_t>(request.TimeoutMs() + 999) / 1000};
     }
     auto wait_for_status = [this, &request, &progress_monitor](const proto::common::Status&) {
-        return ConnectionHandler::WaitForStatus(
-            [&request, this](Progress& progress) -> Status {
-                progress.total_ = 100;
-                auto db_name = connection_.CurrentDbName(request.DatabaseName());
-                uint32_t loading_progress = 0;
-                uint32_t refresh_progress = 0;
-                auto status = connection_.GetLoadingProgress(
-                    db_name, request.CollectionName(), request.PartitionNames(), loading_progress, refresh_progress);
-                if (!status.IsOk()) {
-                    return status;
-                }
-                progress.finished_ = request.Refresh() ? refresh_progress : loading_progress;
-                return Status::OK();
-            },
-            progress_monitor);
+        return waitForStatus(loadingQuery(request.DatabaseName(), request.CollectionName(), request.PartitionNames(),
+                                          request.Refresh()),
+                             progress_monitor);
     };
-    return connection_.Invoke<proto::milvus::LoadPartitionsRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::LoadPartitionsRequest, proto::common::Status>(
         nullptr, pre, &MilvusConnection::LoadPartitions, wait_for_status, nullptr);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
+}
+
+Status
+MilvusClientV2Impl::LoadPartitionsAsync(const LoadPartitionsRequest& request, std::future<Status>& done) {
+    auto status = LoadPartitions(LoadPartitionsRequest(request).WithSync(false));
+    if (!status.IsOk()) {
+        return status;
+    }
+    done = waiter_.Submit(this,
+                          loadingQuery(request.DatabaseName(), request.CollectionName(), request.PartitionNames(),
+                                       request.Refresh()),
+                          WaitMonitor(request.TimeoutMs()));
+    return Status::OK();
 }
 
 Status
@@ -1228,13 +1593,16 @@ MilvusClientV2Impl::ReleasePartitions(const ReleasePartitionsRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::ReleasePartitionsRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::ReleasePartitionsRequest, proto::common::Status>(
         pre, &MilvusConnection::ReleasePartitions);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
 MilvusClientV2Impl::GetPartitionStatistics(const GetPartitionStatsRequest& request,
                                            GetPartitionStatsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::GetPartitionStatisticsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -1260,6 +1628,18 @@ MilvusClientV2Impl::GetPartitionStatistics(const GetPartitionStatsRequest& reque
 
 Status
 MilvusClientV2Impl::ListPartitions(const ListPartitionsRequest& request, ListPartitionsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    MetadataCache::Key cache_key;
+    const bool cached = metadata_cache_.Enabled();
+    if (cached) {
+        cache_key = metadata_cache_.MakeKey(connection_.CurrentEndpoint(),
+                                            connection_.CurrentDbName(request.DatabaseName()),
+                                            request.CollectionName(), MetadataCache::Kind::PARTITIONS, "");
+        if (metadata_cache_.Get(cache_key, response)) {
+            return Status::OK();
+        }
+    }
+
     auto pre = [&request](proto::milvus::ShowPartitionsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -1283,8 +1663,12 @@ MilvusClientV2Impl::ListPartitions(const ListPartitionsRequest& request, ListPar
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::ShowPartitionsRequest, proto::milvus::ShowPartitionsResponse>(
+    auto status = connection_.Invoke<proto::milvus::ShowPartitionsRequest, proto::milvus::ShowPartitionsResponse>(
         pre, &MilvusConnection::ShowPartitions, post);
+    if (cached && status.IsOk()) {
+        metadata_cache_.Put(cache_key, response);
+    }
+    return status;
 }
 
 Status
@@ -1305,8 +1689,10 @@ MilvusClientV2Impl::CreateAlias(const CreateAliasRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::CreateAliasRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::CreateAliasRequest, proto::common::Status>(
         pre, &MilvusConnection::CreateAlias, post);
+    invalidateMetadata(request.DatabaseName(), "");
+    return status;
 }
 
 Status
@@ -1325,8 +1711,10 @@ MilvusClientV2Impl::DropAlias(const DropAliasRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::DropAliasRequest, proto::common::Status>(pre, &MilvusConnection::DropAlias,
-                                                                                      post);
+    auto status = connection_.Invoke<proto::milvus::DropAliasRequest, proto::common::Status>(
+        pre, &MilvusConnection::DropAlias, post);
+    invalidateMetadata(request.DatabaseName(), "");
+    return status;
 }
 
 Status
@@ -1347,12 +1735,15 @@ MilvusClientV2Impl::AlterAlias(const AlterAliasRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::AlterAliasRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::AlterAliasRequest, proto::common::Status>(
         pre, &MilvusConnection::AlterAlias, post);
+    invalidateMetadata(request.DatabaseName(), "");
+    return status;
 }
 
 Status
 MilvusClientV2Impl::DescribeAlias(const DescribeAliasRequest& request, DescribeAliasResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::DescribeAliasRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_alias(request.Alias());
@@ -1375,6 +1766,7 @@ MilvusClientV2Impl::DescribeAlias(const DescribeAliasRequest& request, DescribeA
 
 Status
 MilvusClientV2Impl::ListAliases(const ListAliasesRequest& request, ListAliasesResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::ListAliasesRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -1443,12 +1835,15 @@ MilvusClientV2Impl::DropDatabase(const DropDatabaseRequest& request) {
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::DropDatabaseRequest, proto::common::Status>(
+    auto status = connection_.Invoke<proto::milvus::DropDatabaseRequest, proto::common::Status>(
         pre, &MilvusConnection::DropDatabase, post);
+    invalidateMetadata(request.DatabaseName(), "");
+    return status;
 }
 
 Status
 MilvusClientV2Impl::ListDatabases(const ListDatabasesRequest& request, ListDatabasesResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto post = [&response](const proto::milvus::ListDatabasesResponse& rpc_response) {
         std::vector<std::string> db_names;
         db_names.reserve(rpc_response.db_names_size());
@@ -1498,6 +1893,7 @@ MilvusClientV2Impl::DropDatabaseProperties(const DropDatabasePropertiesRequest&
 
 Status
 MilvusClientV2Impl::DescribeDatabase(const DescribeDatabaseRequest& request, DescribeDatabaseResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::DescribeDatabaseRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         return Status::OK();
@@ -1537,14 +1933,46 @@ MilvusClientV2Impl::CreateIndex(const CreateIndexRequest& request) {
     return Status::OK();
 }
 
+Status
+MilvusClientV2Impl::CreateIndexAsync(const CreateIndexRequest& request, std::future<Status>& done) {
+    std::vector<StatusWaiter::QueryFunction> queries;
+    for (const auto& desc : request.Indexes()) {
+        auto status = createIndex(request.DatabaseName(), request.CollectionName(), desc, false, 0);
+        if (!status.IsOk()) {
+            return status;
+        }
+        queries.emplace_back(indexQuery(request.DatabaseName(), request.CollectionName(), desc.FieldName()));
+    }
+    if (queries.empty()) {
+        return ReadyStatus(done);
+    }
+
+    done = waiter_.Submit(this, AllQueries(std::move(queries)), WaitMonitor(request.TimeoutMs()));
+    return Status::OK();
+}
+
 Status
 MilvusClientV2Impl::DescribeIndex(const DescribeIndexRequest& request, DescribeIndexResponse& response) {
-    return describeIndex(request, response);
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    return describeIndex(request, response, 0, true);
 }
 
 Status
 MilvusClientV2Impl::describeIndex(const DescribeIndexRequest& request, DescribeIndexResponse& response,
-                                  uint64_t rpc_timeout_ms) {
+                                  uint64_t rpc_timeout_ms, bool use_cache) {
+    // a describe at a given timestamp is a point-in-time read, not cached
+    MetadataCache::Key cache_key;
+    const bool cached = use_cache && request.Timestamp() == 0 && metadata_cache_.Enabled();
+    if (cached) {
+        cache_key = metadata_cache_.MakeKey(connection_.CurrentEndpoint(),
+                                            connection_.CurrentDbName(request.DatabaseName()),
+                                            request.CollectionName(), MetadataCache::Kind::INDEXES,
+                                            request.IndexName() + '\0' + request.FieldName());
+        if (metadata_cache_.Get(cache_key, response)) {
+            return Status::OK();
+        }
+    }
+
     auto pre = [&request](proto::milvus::DescribeIndexRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -1613,24 +2041,33 @@ MilvusClientV2Impl::describeIndex(const DescribeIndexRequest& request, DescribeI
         return Status::OK();
     };
 
-    return connection_.InvokeWithRpcTimeout<proto::milvus::DescribeIndexRequest, proto::milvus::DescribeIndexResponse>(
-        rpc_timeout_ms, pre, &MilvusConnection::DescribeIndex, post);
+    auto status =
+        connection_.InvokeWithRpcTimeout<proto::milvus::DescribeIndexRequest, proto::milvus::DescribeIndexResponse>(
+            rpc_timeout_ms, pre, &MilvusConnection::DescribeIndex, post);
+    // the rows count of an index in building changes on every call, only finished indexes are cached
+    if (cached && status.IsOk() &&
+        std::all_of(response.Descs().begin(), response.Descs().end(),
+                    [](const IndexDesc& desc) { return desc.StateCode() == IndexStateCode::FINISHED; })) {
+        metadata_cache_.Put(cache_key, response);
+    }
+    return status;
 }
 
 Status
 MilvusClientV2Impl::ListIndexes(const ListIndexesRequest& request, ListIndexesResponse& response) {
-    return listIndexes(request, response);
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    return listIndexes(request, response, 0, true);
 }
 
 Status
 MilvusClientV2Impl::listIndexes(const ListIndexesRequest& request, ListIndexesResponse& response,
-                                uint64_t rpc_timeout_ms) {
+                                uint64_t rpc_timeout_ms, bool use_cache) {
     DescribeIndexRequest d_request = DescribeIndexRequest()
                                          .WithDatabaseName(request.DatabaseName())
                                          .WithCollectionName(request.CollectionName())
                                          .WithFieldName("");
     DescribeIndexResponse d_response;
-    auto status = describeIndex(d_request, d_response, rpc_timeout_ms);
+    auto status = describeIndex(d_request, d_response, rpc_timeout_ms, use_cache);
     if (status.IsOk()) {
         std::vector<IndexDesc> descs = d_response.Descs();
         std::vector<std::string> index_names;
@@ -1670,8 +2107,10 @@ MilvusClientV2Impl::DropIndex(const DropIndexRequest& request) {
 
         return Status::OK();
     };
-    return connection_.Invoke<proto::milvus::DropIndexRequest, proto::common::Status>(pre,
-                                                                                      &MilvusConnection::DropIndex);
+    auto status = connection_.Invoke<proto::milvus::DropIndexRequest, proto::common::Status>(
+        pre, &MilvusConnection::DropIndex);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -1689,8 +2128,10 @@ MilvusClientV2Impl::AlterIndexProperties(const AlterIndexPropertiesRequest& requ
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::AlterIndexRequest, proto::common::Status>(pre,
-                                                                                       &MilvusConnection::AlterIndex);
+    auto status = connection_.Invoke<proto::milvus::AlterIndexRequest, proto::common::Status>(
+        pre, &MilvusConnection::AlterIndex);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
@@ -1706,17 +2147,29 @@ MilvusClientV2Impl::DropIndexProperties(const DropIndexPropertiesRequest& reques
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::AlterIndexRequest, proto::common::Status>(pre,
-                                                                                       &MilvusConnection::AlterIndex);
+    auto status = connection_.Invoke<proto::milvus::AlterIndexRequest, proto::common::Status>(
+        pre, &MilvusConnection::AlterIndex);
+    invalidateMetadata(request.DatabaseName(), request.CollectionName());
+    return status;
 }
 
 Status
 MilvusClientV2Impl::Insert(const InsertRequest& request, InsertResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return insert(request, response, true);
 }
 
 Status
-MilvusClientV2Impl::insert(const InsertRequest& request, InsertResponse& response, bool allow_retry) {
+MilvusClientV2Impl::InsertAsync(const InsertRequest& request, InsertResponse& response, AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
+    }
+    return insert(request, response, true, done);
+}
+
+Status
+MilvusClientV2Impl::insert(const InsertRequest& request, InsertResponse& response, bool allow_retry,
+                           const MilvusConnection::AsyncDone& done) {
     const auto endpoint = connection_.CurrentEndpoint();
     const auto database_name = connection_.CurrentDbName(request.DatabaseName());
     CollectionDescPtr collection_desc;
@@ -1796,7 +2249,7 @@ MilvusClientV2Impl::insert(const InsertRequest& request, InsertResponse& respons
         return Status::OK();
     };
 
-    auto post = [&endpoint, &database_name, &request, &response](const proto::milvus::MutationResult& rpc_response) {
+    auto post = [endpoint, database_name, &request, &response](const proto::milvus::MutationResult& rpc_response) {
         DmlResults results;
         auto id_array = CreateIDArray(rpc_response.ids());
         results.SetIdArray(std::move(id_array));
@@ -1815,6 +2268,13 @@ MilvusClientV2Impl::insert(const InsertRequest& request, InsertResponse& respons
         return Status::OK();
     };
 
+    if (done) {
+        auto retry = [this, &request, &response, done]() { return insert(request, response, false, done); };
+        return connection_.InvokeAsync<proto::milvus::InsertRequest, proto::milvus::MutationResult>(
+            validate, pre, &MilvusConnection::InsertAsync, &MilvusConnection::Insert, post, executor_,
+            retryOnSchemaMismatch(endpoint, database_name, request.CollectionName(), allow_retry, retry, done),
+            response);
+    }
     auto status = connection_.Invoke<proto::milvus::InsertRequest, proto::milvus::MutationResult>(
         validate, pre, &MilvusConnection::Insert, post);
     // If there are multiple clients, the client_A repeatedly do insert, the client_B changes
@@ -1828,13 +2288,50 @@ MilvusClientV2Impl::insert(const InsertRequest& request, InsertResponse& respons
     return status;
 }
 
+MilvusConnection::AsyncDone
+MilvusClientV2Impl::retryOnSchemaMismatch(const std::string& endpoint, const std::string& database_name,
+                                          const std::string& collection_name, bool allow_retry,
+                                          std::function<Status(void)> retry, MilvusConnection::AsyncDone done) {
+    if (!allow_retry) {
+        return done;
+    }
+    auto executor = executor_;
+    return [endpoint, database_name, collection_name, retry, done, executor](const Status& status) {
+        if (status.LegacyServerCode() != static_cast<int32_t>(proto::common::ErrorCode::SchemaMismatch)) {
+            done(status);
+            return;
+        }
+        // the retry describes the collection again, which blocks, so it runs on the executor
+        SchemaCache::GetInstance().Invalidate(endpoint, database_name, collection_name);
+        auto submitted = executor->Submit([retry, done]() {
+            auto retried = retry();
+            if (!retried.IsOk()) {
+                done(retried);
+            }
+        });
+        if (!submitted.IsOk()) {
+            done(status);
+        }
+    };
+}
+
 Status
 MilvusClientV2Impl::Upsert(const UpsertRequest& request, UpsertResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return upsert(request, response, true);
 }
 
 Status
-MilvusClientV2Impl::upsert(const UpsertRequest& request, UpsertResponse& response, bool allow_retry) {
+MilvusClientV2Impl::UpsertAsync(const UpsertRequest& request, UpsertResponse& response, AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
+    }
+    return upsert(request, response, true, done);
+}
+
+Status
+MilvusClientV2Impl::upsert(const UpsertRequest& request, UpsertResponse& response, bool allow_retry,
+                           const MilvusConnection::AsyncDone& done) {
     const auto endpoint = connection_.CurrentEndpoint();
     const auto database_name = connection_.CurrentDbName(request.DatabaseName());
     std::vector<proto::schema::FieldData> rpc_fields;
@@ -1920,7 +2417,7 @@ MilvusClientV2Impl::upsert(const UpsertRequest& request, UpsertResponse& respons
         return Status::OK();
     };
 
-    auto post = [&endpoint, &database_name, &request, &response](const proto::milvus::MutationResult& rpc_response) {
+    auto post = [endpoint, database_name, &request, &response](const proto::milvus::MutationResult& rpc_response) {
         DmlResults results;
         auto id_array = CreateIDArray(rpc_response.ids());
         results.SetIdArray(std::move(id_array));
@@ -1938,6 +2435,13 @@ MilvusClientV2Impl::upsert(const UpsertRequest& request, UpsertResponse& respons
         return Status::OK();
     };
 
+    if (done) {
+        auto retry = [this, &request, &response, done]() { return upsert(request, response, false, done); };
+        return connection_.InvokeAsync<proto::milvus::UpsertRequest, proto::milvus::MutationResult>(
+            validate, pre, &MilvusConnection::UpsertAsync, &MilvusConnection::Upsert, post, executor_,
+            retryOnSchemaMismatch(endpoint, database_name, request.CollectionName(), allow_retry, retry, done),
+            response);
+    }
     auto status = connection_.Invoke<proto::milvus::UpsertRequest, proto::milvus::MutationResult>(
         validate, pre, &MilvusConnection::Upsert, post);
     // If there are multiple clients, the client_A repeatedly do insert, the client_B changes
@@ -1953,6 +2457,21 @@ MilvusClientV2Impl::upsert(const UpsertRequest& request, UpsertResponse& respons
 
 Status
 MilvusClientV2Impl::Delete(const DeleteRequest& request, DeleteResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    return deleteEntities(request, response);
+}
+
+Status
+MilvusClientV2Impl::DeleteAsync(const DeleteRequest& request, DeleteResponse& response, AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
+    }
+    return deleteEntities(request, response, done);
+}
+
+Status
+MilvusClientV2Impl::deleteEntities(const DeleteRequest& request, DeleteResponse& response,
+                                   const MilvusConnection::AsyncDone& done) {
     const auto endpoint = connection_.CurrentEndpoint();
     const auto database_name = connection_.CurrentDbName(request.DatabaseName());
     auto pre = [this, &endpoint, &database_name, &request](proto::milvus::DeleteRequest& rpc_request) {
@@ -1971,11 +2490,14 @@ MilvusClientV2Impl::Delete(const DeleteRequest& request, DeleteResponse& respons
         }
 
         if (!request.Filter().empty()) {
-            // delete by filter expression
+            // delete by filter expression, typed templates first
             rpc_request.set_expr(request.Filter());
             auto rpc_templates = rpc_request.mutable_expr_template_values();
-            const auto& templates = request.FilterTemplates();
-            auto status = ConvertFilterTemplates(templates, rpc_templates);
+            auto status = ConvertFilterTemplates(request.TypedFilterTemplates(), rpc_templates);
+            if (!status.IsOk()) {
+                return status;
+            }
+            status = ConvertFilterTemplates(request.FilterTemplates(), rpc_templates);
             if (!status.IsOk()) {
                 return status;
             }
@@ -1987,18 +2509,25 @@ MilvusClientV2Impl::Delete(const DeleteRequest& request, DeleteResponse& respons
                 return status;
             }
 
-            // use filter template to pass the id array
-            auto pk = collection_desc->Schema().PrimaryFieldName();
-            rpc_request.set_expr(pk + " in {ids}");
-            std::unordered_map<std::string, nlohmann::json> templates;
-            if (request.IDs().IsIntegerID()) {
-                templates.insert(std::make_pair("ids", request.IDs().IntIDArray()));
-            } else {
-                templates.insert(std::make_pair("ids", request.IDs().StrIDArray()));
+            // use filter template to pass the id array, a delete must be exact so bloom prefilter is refused
+            IDsFilter ids_filter;
+            status = BuildIDsFilter(request.IDs(), collection_desc->Schema().PrimaryFieldName(), "ids",
+                                    request.GetIDsEncoding(), true, ids_filter);
+            if (!status.IsOk()) {
+                return status;
             }
+            rpc_request.set_expr(ids_filter.expression);
 
             auto rpc_templates = rpc_request.mutable_expr_template_values();
-            status = ConvertFilterTemplates(templates, rpc_templates);
+            if (ids_filter.encoding == IDsEncoding::LIST) {
+                std::unordered_map<std::string, FilterTemplateArray> templates;
+                templates.insert(std::make_pair("ids", std::move(ids_filter.list)));
+                status = ConvertFilterTemplates(templates, rpc_templates);
+            } else {
+                std::unordered_map<std::string, nlohmann::json> templates;
+                templates.insert(std::make_pair("ids", std::move(ids_filter.blob)));
+                status = ConvertFilterTemplates(templates, rpc_templates);
+            }
             if (!status.IsOk()) {
                 return status;
             }
@@ -2007,7 +2536,7 @@ MilvusClientV2Impl::Delete(const DeleteRequest& request, DeleteResponse& respons
         return Status::OK();
     };
 
-    auto post = [&endpoint, &database_name, &request, &response](const proto::milvus::MutationResult& rpc_response) {
+    auto post = [endpoint, database_name, &request, &response](const proto::milvus::MutationResult& rpc_response) {
         DmlResults results;
         auto id_array = CreateIDArray(rpc_response.ids());
         results.SetIdArray(std::move(id_array));
@@ -2022,45 +2551,260 @@ MilvusClientV2Impl::Delete(const DeleteRequest& request, DeleteResponse& respons
         return Status::OK();
     };
 
+    if (done) {
+        return connection_.InvokeAsync<proto::milvus::DeleteRequest, proto::milvus::MutationResult>(
+            nullptr, pre, &MilvusConnection::DeleteAsync, &MilvusConnection::Delete, post, executor_, done,
+            response);
+    }
     return connection_.Invoke<proto::milvus::DeleteRequest, proto::milvus::MutationResult>(
         pre, &MilvusConnection::Delete, post);
 }
 
 Status
 MilvusClientV2Impl::Search(const SearchRequest& request, SearchResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return search(request, response, "");
 }
 
 Status
-MilvusClientV2Impl::search(const SearchRequest& request, SearchResponse& response, const std::string& cluster_id) {
-    const auto endpoint = connection_.CurrentEndpoint();
-    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
-    auto validate = [&request]() { return request.Validate(); };
+MilvusClientV2Impl::SearchAsync(const SearchRequest& request, SearchResponse& response, AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
+    }
+    return search(request, response, "", 0, done);
+}
 
-    auto pre = [&endpoint, &database_name, &request, &cluster_id](proto::milvus::SearchRequest& rpc_request) {
-        auto status = ConvertSearchRequest<SearchRequest>(request, database_name, rpc_request, cluster_id, endpoint);
-        if (!status.IsOk()) {
-            return status;
-        }
+Status
+MilvusClientV2Impl::MultiSearch(const MultiSearchRequest& request, MultiSearchResponse& response) {
+    FanOutTimer call_timer(connection_.CallTimingEnabled(), response);
+    using Clock = std::chrono::steady_clock;
+    const auto& requests = request.Requests();
+    const auto count = requests.size();
+    const bool stop_on_error = request.StopOnError();
+    const bool has_deadline = request.TimeoutMs() > 0;
+    const auto deadline = Clock::now() + std::chrono::milliseconds(request.TimeoutMs());
 
-        if (request.Rerank()) {
-            auto function_score = rpc_request.mutable_function_score();
-            ConvertFunctionScore(request.Rerank(), *function_score);
+    std::vector<Status> statuses(count);
+    std::vector<SearchResponse> responses(count);
+    std::atomic<bool> failed{false};
+
+    auto run_one = [&](size_t index) {
+        if (stop_on_error && failed.load()) {
+            return Status{StatusCode::UNKNOWN_ERROR, "Search is skipped since another search of the batch failed"};
         }
-        if (request.GetSearchAggregation() != nullptr) {
-            ConvertSearchAggregation(*request.GetSearchAggregation(), *rpc_request.mutable_search_aggregation());
+        uint64_t rpc_timeout_ms = 0;
+        if (has_deadline) {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+            if (remaining.count() <= 0) {
+                return Status{StatusCode::TIMEOUT, "Deadline of the batch passed before the search started"};
+            }
+            rpc_timeout_ms = static_cast<uint64_t>(remaining.count());
         }
-        return Status::OK();
+        // timed on the thread running it, the batch sums the searches below
+        CallTimer search_timer(call_timer.Enabled(), responses[index]);
+        return search(requests[index], responses[index], "", rpc_timeout_ms);
     };
 
-    auto post = [this, &endpoint, &database_name, &request,
-                 &response](const proto::milvus::SearchResults& rpc_response) {
-        // in milvus version older than v2.4.20, the primary_field_name() is empty, we need to
-        // get the primary key field name from collection schema
-        SearchResults results;
-        const auto& result_data = rpc_response.results();
-        auto pk_name = result_data.primary_field_name();
-        if (result_data.primary_field_name().empty()) {
+    // searches are claimed in input order, so with stop-on-error the skipped ones are the later ones
+    RunConcurrently(executor_, count, request.Concurrency(), [&](size_t index) {
+        Status status;
+        try {
+            status = run_one(index);
+        } catch (const std::exception& e) {
+            status = {StatusCode::UNKNOWN_ERROR, "Search failed: " + std::string(e.what())};
+        }
+        if (!status.IsOk()) {
+            failed = true;
+        }
+        statuses[index] = std::move(status);
+    });
+
+    Status status;
+    for (const auto& item : statuses) {
+        if (!item.IsOk()) {
+            status = item;
+            break;
+        }
+    }
+    for (const auto& item : responses) {
+        call_timer.Add(item);
+    }
+    response.SetStatuses(std::move(statuses));
+    response.SetResponses(std::move(responses));
+    return status;
+}
+
+Status
+MilvusClientV2Impl::FederatedSearch(const FederatedSearchRequest& request, SearchResponse& response) {
+    FanOutTimer call_timer(connection_.CallTimingEnabled(), response);
+    const auto& collection_names = request.CollectionNames();
+    if (collection_names.empty()) {
+        return {StatusCode::INVALID_ARGUMENT, "Federated search requires at least one collection"};
+    }
+    const auto& base = request.Request();
+    if (base.GetSearchAggregation() != nullptr) {
+        return {StatusCode::INVALID_ARGUMENT, "Federated search does not support search aggregation"};
+    }
+    if (base.Offset() < 0 || base.Limit() <= 0) {
+        return {StatusCode::INVALID_ARGUMENT, "Federated search requires a positive limit and no negative offset"};
+    }
+    if (connection_.GetConnection() == nullptr) {
+        return {StatusCode::NOT_CONNECTED, "Connection is not created!"};
+    }
+
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(base.DatabaseName());
+    const auto offset = static_cast<size_t>(base.Offset());
+    const auto limit = static_cast<size_t>(base.Limit());
+
+    // the request is converted once, each collection copies the encoded request with its own name
+    ResponseBase prepare_timing;
+    proto::milvus::SearchRequest prepared_request;
+    {
+        CallTimer prepare_timer(call_timer.Enabled(), prepare_timing);
+        auto status = base.Validate();
+        if (!status.IsOk()) {
+            return status;
+        }
+        StageTimer stage_timer(CallTiming::Stage::CONVERT);
+        status = ConvertSearchRequest<SearchRequest>(base, database_name, prepared_request, "", endpoint);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (base.Rerank()) {
+            ConvertFunctionScore(base.Rerank(), *prepared_request.mutable_function_score());
+        }
+        // each collection returns its first offset + limit hits, the merge pages them
+        if (offset > 0) {
+            for (auto& pair : *prepared_request.mutable_search_params()) {
+                if (pair.key() == TOPK) {
+                    pair.set_value(std::to_string(offset + limit));
+                } else if (pair.key() == OFFSET) {
+                    pair.set_value("0");
+                }
+            }
+        }
+    }
+    call_timer.Add(prepare_timing);
+
+    // the raw results are kept, only the merged hits are decoded
+    const auto count = collection_names.size();
+    const auto level = base.GetConsistencyLevel();
+    std::vector<proto::milvus::SearchResults> rpc_results(count);
+    std::vector<Status> statuses(count);
+    std::vector<ResponseBase> timings(count);
+    RunConcurrently(executor_, count, request.Concurrency(), [&](size_t index) {
+        const auto& collection_name = collection_names[index];
+        auto pre = [&](proto::milvus::SearchRequest& rpc_request) {
+            rpc_request = prepared_request;
+            rpc_request.set_collection_name(collection_name);
+            rpc_request.set_guarantee_timestamp(
+                DeduceGuaranteeTimestamp(level, endpoint, database_name, collection_name));
+            return Status::OK();
+        };
+        CallTimer search_timer(call_timer.Enabled(), timings[index]);
+        statuses[index] = connection_.InvokeInto<proto::milvus::SearchRequest, proto::milvus::SearchResults>(
+            0, nullptr, pre, &MilvusConnection::Search, rpc_results[index]);
+    });
+    for (const auto& timing : timings) {
+        call_timer.Add(timing);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!statuses[i].IsOk()) {
+            return {statuses[i].Code(), "Search of collection " + collection_names[i] + " failed, error: " +
+                                            statuses[i].Message()};
+        }
+    }
+
+    // in milvus version older than v2.4.20, the primary_field_name() is empty, we need to
+    // get the primary key field name from collection schema
+    std::string pk_name = rpc_results.front().results().primary_field_name();
+    if (pk_name.empty()) {
+        CollectionDescPtr collection_desc;
+        getCollectionDesc(endpoint, database_name, collection_names.front(), false, collection_desc);
+        if (collection_desc != nullptr) {
+            pk_name = collection_desc->Schema().PrimaryFieldName();
+        }
+    }
+
+    // a rerank ranks by its own score, the direction is then read from the results
+    const auto metric_type = base.Rerank() ? MetricType::DEFAULT : base.MetricType();
+    std::vector<const proto::milvus::SearchResults*> merged_inputs;
+    uint64_t session_ts = 0;
+    for (const auto& rpc_result : rpc_results) {
+        merged_inputs.push_back(&rpc_result);
+        session_ts = std::max(session_ts, rpc_result.session_ts());
+    }
+    SearchResults results;
+    auto status = MergeSearchResults(merged_inputs, pk_name, metric_type, offset, limit, results);
+    if (!status.IsOk()) {
+        return status;
+    }
+    response.SetResults(std::move(results));
+    response.SetSessionTs(session_ts);
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::search(const SearchRequest& request, SearchResponse& response, const std::string& cluster_id,
+                           uint64_t rpc_timeout_ms, const MilvusConnection::AsyncDone& done) {
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
+    auto validate = [&request]() { return request.Validate(); };
+
+    auto convert = [&endpoint, &database_name, &request, &cluster_id](proto::milvus::SearchRequest& rpc_request) {
+        auto status = ConvertSearchRequest<SearchRequest>(request, database_name, rpc_request, cluster_id, endpoint);
+        if (!status.IsOk()) {
+            return status;
+        }
+
+        if (request.Rerank()) {
+            auto function_score = rpc_request.mutable_function_score();
+            ConvertFunctionScore(request.Rerank(), *function_score);
+        }
+        if (request.GetSearchAggregation() != nullptr) {
+            ConvertSearchAggregation(*request.GetSearchAggregation(), *rpc_request.mutable_search_aggregation());
+        }
+        return Status::OK();
+    };
+
+    // the cache key is the converted request, so the request is converted before the rpc call
+    const bool use_cache = result_cache_.Accept(request.GetConsistencyLevel());
+    ResultCache::Key cache_key;
+    proto::milvus::SearchRequest prepared_request;
+    if (use_cache) {
+        auto status = validate();
+        if (!status.IsOk()) {
+            return status;
+        }
+        status = convert(prepared_request);
+        if (!status.IsOk()) {
+            return status;
+        }
+        cache_key = result_cache_.MakeKey(endpoint, database_name, request.CollectionName(),
+                                          request.GetConsistencyLevel(), prepared_request);
+        if (result_cache_.Get(cache_key, response)) {
+            return CompleteWithoutRpc(done);
+        }
+    }
+
+    auto pre = [&use_cache, &convert, &prepared_request](proto::milvus::SearchRequest& rpc_request) {
+        if (use_cache) {
+            rpc_request.Swap(&prepared_request);
+            return Status::OK();
+        }
+        return convert(rpc_request);
+    };
+
+    // post may run after search() returned, it copies the locals it reads
+    auto post = [this, endpoint, database_name, &request, &response, use_cache,
+                 cache_key](const proto::milvus::SearchResults& rpc_response) {
+        // in milvus version older than v2.4.20, the primary_field_name() is empty, we need to
+        // get the primary key field name from collection schema
+        SearchResults results;
+        const auto& result_data = rpc_response.results();
+        auto pk_name = result_data.primary_field_name();
+        if (result_data.primary_field_name().empty()) {
             CollectionDescPtr collection_desc;
             getCollectionDesc(endpoint, database_name, request.CollectionName(), false, collection_desc);
             if (collection_desc != nullptr) {
@@ -2080,11 +2824,24 @@ MilvusClientV2Impl::search(const SearchRequest& request, SearchResponse& respons
         response.SetAggregationBuckets(std::move(aggregation_buckets));
         response.SetSessionTs(rpc_response.session_ts());
         FillSearchResponseExtraInfo(rpc_response.status(), response);
+        if (use_cache) {
+            result_cache_.Put(cache_key, response, rpc_response.ByteSizeLong());
+        }
         return status;
     };
 
-    return connection_.Invoke<proto::milvus::SearchRequest, proto::milvus::SearchResults>(
-        validate, pre, &MilvusConnection::Search, nullptr, post);
+    if (done) {
+        // a cached search is validated already
+        return connection_.InvokeAsync<proto::milvus::SearchRequest, proto::milvus::SearchResults>(
+            use_cache ? std::function<Status(void)>{} : validate, pre, &MilvusConnection::SearchAsync,
+            &MilvusConnection::Search, post, executor_, done, response, rpc_timeout_ms);
+    }
+    if (use_cache) {
+        return connection_.InvokeWithRpcTimeout<proto::milvus::SearchRequest, proto::milvus::SearchResults>(
+            rpc_timeout_ms, pre, &MilvusConnection::Search, post);
+    }
+    return connection_.InvokeWithRpcTimeout<proto::milvus::SearchRequest, proto::milvus::SearchResults>(
+        rpc_timeout_ms, validate, pre, &MilvusConnection::Search, nullptr, post);
 }
 
 Status
@@ -2172,12 +2929,22 @@ MilvusClientV2Impl::searchIterator(SearchIteratorRequest& request, SearchIterato
 
 Status
 MilvusClientV2Impl::HybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return hybridSearch(request, response, "");
 }
 
+Status
+MilvusClientV2Impl::HybridSearchAsync(const HybridSearchRequest& request, HybridSearchResponse& response,
+                                      AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
+    }
+    return hybridSearch(request, response, "", done);
+}
+
 Status
 MilvusClientV2Impl::hybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response,
-                                 const std::string& cluster_id) {
+                                 const std::string& cluster_id, const MilvusConnection::AsyncDone& done) {
     const auto endpoint = connection_.CurrentEndpoint();
     const auto database_name = connection_.CurrentDbName(request.DatabaseName());
     auto pre = [&endpoint, &database_name, &request, &cluster_id](proto::milvus::HybridSearchRequest& rpc_request) {
@@ -2185,8 +2952,7 @@ MilvusClientV2Impl::hybridSearch(const HybridSearchRequest& request, HybridSearc
                                                                endpoint);
     };
 
-    auto post = [this, &endpoint, &database_name, &request,
-                 &response](const proto::milvus::SearchResults& rpc_response) {
+    auto post = [this, endpoint, database_name, &request, &response](const proto::milvus::SearchResults& rpc_response) {
         // in milvus version older than v2.4.20, the primary_field_name() is empty, we need to
         // get the primary key field name from collection schema
         SearchResults results;
@@ -2206,21 +2972,46 @@ MilvusClientV2Impl::hybridSearch(const HybridSearchRequest& request, HybridSearc
         return status;
     };
 
+    if (done) {
+        return connection_.InvokeAsync<proto::milvus::HybridSearchRequest, proto::milvus::SearchResults>(
+            nullptr, pre, &MilvusConnection::HybridSearchAsync, &MilvusConnection::HybridSearch, post, executor_, done,
+            response);
+    }
     return connection_.Invoke<proto::milvus::HybridSearchRequest, proto::milvus::SearchResults>(
         pre, &MilvusConnection::HybridSearch, post);
 }
 
 Status
 MilvusClientV2Impl::Query(const QueryRequest& request, QueryResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     const auto endpoint = connection_.CurrentEndpoint();
     const auto database_name = connection_.CurrentDbName(request.DatabaseName());
     return query(endpoint, database_name, request, response, "");
 }
 
+Status
+MilvusClientV2Impl::QueryAsync(const QueryRequest& request, QueryResponse& response, AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
+    }
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
+    return query(endpoint, database_name, request, response, "", done);
+}
+
 Status
 MilvusClientV2Impl::query(const std::string& endpoint, const std::string& database_name, const QueryRequest& request,
-                          QueryResponse& response, const std::string& cluster_id) {
-    auto pre = [this, &endpoint, &database_name, &request, &cluster_id](proto::milvus::QueryRequest& rpc_request) {
+                          QueryResponse& response, const std::string& cluster_id,
+                          const MilvusConnection::AsyncDone& done) {
+    // set by convert when the ids travel as a bloom prefilter, post then drops the false positives, shared since
+    // post may run after query() returned
+    struct IDsRecheck {
+        bool needed_ = false;
+        std::string pk_name_;
+    };
+    auto recheck = std::make_shared<IDsRecheck>();
+    auto convert = [this, &endpoint, &database_name, &request, &cluster_id,
+                    &recheck](proto::milvus::QueryRequest& rpc_request) {
         const auto id_count = request.IDs().GetRowCount();
         if (!request.Filter().empty() && id_count != 0) {
             return Status{StatusCode::INVALID_ARGUMENT, "Filter and IDs cannot be set at the same time"};
@@ -2239,75 +3030,127 @@ MilvusClientV2Impl::query(const std::string& endpoint, const std::string& databa
             return Status{StatusCode::UNKNOWN_ERROR, "Unable to get collection schema"};
         }
 
-        nlohmann::json ids;
-        if (request.IDs().IsIntegerID()) {
-            ids = request.IDs().IntIDArray();
-        } else {
-            ids = request.IDs().StrIDArray();
-        }
+        // rows of a limited, offset or counted query cannot be rechecked on the client
+        const auto& output_fields = request.OutputFields();
+        const bool exact_only = request.Limit() > 0 || request.Offset() > 0 ||
+                                output_fields.find("count(*)") != output_fields.end();
 
         static const std::string ids_key = "pks_to_query";
+        recheck->pk_name_ = collection_desc->Schema().PrimaryFieldName();
+        IDsFilter ids_filter;
+        status = BuildIDsFilter(request.IDs(), recheck->pk_name_, ids_key, request.GetIDsEncoding(), exact_only,
+                                ids_filter);
+        if (!status.IsOk()) {
+            return status;
+        }
+        recheck->needed_ = ids_filter.NeedRecheck();
+
         auto actual_request = request;
-        actual_request.SetFilter(collection_desc->Schema().PrimaryFieldName() + " in {" + ids_key + "}");
+        actual_request.SetFilter(ids_filter.expression);
         actual_request.SetFilterTemplates({});
-        actual_request.AddFilterTemplate(ids_key, ids);
+        if (ids_filter.encoding == IDsEncoding::LIST) {
+            actual_request.AddFilterTemplate(ids_key, std::move(ids_filter.list));
+        } else {
+            actual_request.AddFilterTemplate(ids_key, ids_filter.blob);
+        }
         return ConvertQueryRequest<QueryRequest>(actual_request, database_name, rpc_request, cluster_id, endpoint);
     };
 
-    auto post = [&response](const proto::milvus::QueryResults& rpc_response) {
+    // the cache key is the converted request, so the request is converted before the rpc call
+    const bool use_cache = result_cache_.Accept(request.GetConsistencyLevel());
+    ResultCache::Key cache_key;
+    proto::milvus::QueryRequest prepared_request;
+    if (use_cache) {
+        auto status = convert(prepared_request);
+        if (!status.IsOk()) {
+            return status;
+        }
+        cache_key = result_cache_.MakeKey(endpoint, database_name, request.CollectionName(),
+                                          request.GetConsistencyLevel(), prepared_request);
+        if (result_cache_.Get(cache_key, response)) {
+            return CompleteWithoutRpc(done);
+        }
+    }
+
+    auto pre = [&use_cache, &convert, &prepared_request](proto::milvus::QueryRequest& rpc_request) {
+        if (use_cache) {
+            rpc_request.Swap(&prepared_request);
+            return Status::OK();
+        }
+        return convert(rpc_request);
+    };
+
+    auto post = [this, &request, &response, use_cache, cache_key,
+                 recheck](const proto::milvus::QueryResults& rpc_response) {
         QueryResults results;
         auto status = ConvertQueryResults(rpc_response, results);
+        if (status.IsOk() && recheck->needed_) {
+            status = RecheckQueryResultIDs(request.IDs(), recheck->pk_name_, results);
+        }
         response.SetResults(std::move(results));
         response.SetSessionTs(rpc_response.session_ts());
+        if (use_cache && status.IsOk()) {
+            result_cache_.Put(cache_key, response, rpc_response.ByteSizeLong());
+        }
         return status;
     };
 
+    if (done) {
+        return connection_.InvokeAsync<proto::milvus::QueryRequest, proto::milvus::QueryResults>(
+            nullptr, pre, &MilvusConnection::QueryAsync, &MilvusConnection::Query, post, executor_, done, response);
+    }
     return connection_.Invoke<proto::milvus::QueryRequest, proto::milvus::QueryResults>(pre, &MilvusConnection::Query,
                                                                                         post);
 }
 
 Status
 MilvusClientV2Impl::Get(const GetRequest& request, GetResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return get(request, response, "");
 }
 
 Status
-MilvusClientV2Impl::get(const GetRequest& request, GetResponse& response, const std::string& cluster_id) {
-    const auto endpoint = connection_.CurrentEndpoint();
-    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
-    CollectionDescPtr collection_desc;
-    auto status = getCollectionDesc(endpoint, database_name, request.CollectionName(), false, collection_desc);
-    if (!status.IsOk()) {
-        return status;
-    }
-    if (collection_desc == nullptr) {
-        return {StatusCode::UNKNOWN_ERROR, "Unable to get collection schema"};
+MilvusClientV2Impl::GetAsync(const GetRequest& request, GetResponse& response, AsyncDone done) {
+    if (!done) {
+        return EmptyAsyncDone();
     }
-    auto pk_name = collection_desc->Schema().PrimaryFieldName();
+    return get(request, response, "", done);
+}
 
-    nlohmann::json filter_template;
-    const auto& id_array = request.IDs();
-    if (id_array.IsIntegerID()) {
-        filter_template = id_array.IntIDArray();
-    } else {
-        filter_template = id_array.StrIDArray();
+Status
+MilvusClientV2Impl::get(const GetRequest& request, GetResponse& response, const std::string& cluster_id,
+                        const MilvusConnection::AsyncDone& done) {
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
+    if (request.IDs().GetRowCount() == 0) {
+        // without ids query() would take the request as an unfiltered query
+        response.SetResults(QueryResults());
+        return CompleteWithoutRpc(done);
     }
 
     std::set<std::string> partition_names = request.PartitionNames();  // this is a copy
     std::set<std::string> output_fields = request.OutputFields();      // this is a copy
 
-    // use filter template to pass the id array
-    static const std::string ids_key = "pks_to_get";
-    auto filter = pk_name + " in {" + ids_key + "}";
+    // query() encodes the id array and rechecks the results of a bloom prefilter
     auto actual_request = QueryRequest()
                               .WithDatabaseName(request.DatabaseName())
                               .WithCollectionName(request.CollectionName())
                               .WithPartitionNames(std::move(partition_names))
                               .WithConsistencyLevel(request.GetConsistencyLevel())
-                              .WithFilter(filter)
-                              .AddFilterTemplate(ids_key, filter_template)
+                              .WithIDsEncoding(request.GetIDsEncoding())
                               .WithOutputFields(std::move(output_fields));
+    if (request.IDs().IsIntegerID()) {
+        actual_request.SetIDs(std::vector<int64_t>(request.IDs().IntIDArray()));
+    } else {
+        actual_request.SetIDs(std::vector<std::string>(request.IDs().StrIDArray()));
+    }
 
+    if (done) {
+        // the query reads the request until it is done
+        auto shared_request = std::make_shared<QueryRequest>(std::move(actual_request));
+        return query(endpoint, database_name, *shared_request, response, cluster_id,
+                     [shared_request, done](const Status& status) { done(status); });
+    }
     return query(endpoint, database_name, actual_request, response, cluster_id);
 }
 
@@ -2340,8 +3183,150 @@ MilvusClientV2Impl::queryIterator(QueryIteratorRequest& request, QueryIteratorPt
     return Status::OK();
 }
 
+Status
+MilvusClientV2Impl::QueryStream(const QueryStreamRequest& request, const QueryStreamCallback& on_batch) {
+    if (!on_batch) {
+        return {StatusCode::INVALID_ARGUMENT, "Query stream callback cannot be empty"};
+    }
+
+    // pages are fetched by the query iterator, each page is decoded and released before the next one
+    QueryIteratorRequest iterator_request = request;
+    QueryIteratorPtr iterator;
+    auto status = queryIterator(iterator_request, iterator, "");
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    while (true) {
+        QueryResults batch;
+        status = iterator->Next(batch);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (batch.GetRowCount() == 0) {
+            break;
+        }
+
+        try {
+            status = on_batch(batch);
+        } catch (const std::exception& e) {
+            return {StatusCode::UNKNOWN_ERROR, "Query stream callback failed: " + std::string(e.what())};
+        }
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
+Status
+MilvusClientV2Impl::ParallelScan(const ParallelScanRequest& request, const ParallelScanCallback& on_batch) {
+    if (!on_batch) {
+        return {StatusCode::INVALID_ARGUMENT, "Parallel scan callback cannot be empty"};
+    }
+    if (request.IDs().GetRowCount() != 0) {
+        return {StatusCode::INVALID_ARGUMENT, "Parallel scan does not support IDs"};
+    }
+    if (request.Limit() >= 0 || request.Offset() > 0) {
+        return {StatusCode::INVALID_ARGUMENT, "Parallel scan does not support limit or offset"};
+    }
+
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
+    ParallelScanRequest prepared_request = request;
+    auto status = iteratorPrepare(endpoint, database_name, prepared_request);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    std::vector<QueryIteratorRequest> shards;
+    status = buildScanShards(prepared_request, database_name, shards);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    using ShardIteratorPtr = std::shared_ptr<QueryIteratorImpl<QueryIteratorRequest>>;
+    auto connection = connection_.GetConnection();
+    auto retry_param = connection_.GetRetryParam();
+    auto create_iterator = [&connection, &retry_param, &shards](size_t index, uint64_t session_ts,
+                                                                ShardIteratorPtr& iterator) {
+        iterator = std::make_shared<QueryIteratorImpl<QueryIteratorRequest>>(connection, shards.at(index), retry_param);
+        iterator->SetSessionTs(session_ts);
+        auto status = iterator->Init();
+        if (!status.IsOk()) {
+            return Status{status.Code(), "Unable to create iterator for shard " + std::to_string(index) +
+                                             ", error: " + status.Message()};
+        }
+        return Status::OK();
+    };
+
+    // the first shard selects the snapshot, the other shards pin the same session ts
+    ShardIteratorPtr first_iterator;
+    status = create_iterator(0, 0, first_iterator);
+    if (!status.IsOk()) {
+        return status;
+    }
+    const auto session_ts = first_iterator->SessionTs();
+
+    std::atomic<bool> stopped{false};
+    std::mutex error_mutex;
+    Status scan_status;
+    auto fail = [&stopped, &error_mutex, &scan_status](const Status& error) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (scan_status.IsOk()) {
+            scan_status = error;
+        }
+        stopped.store(true);
+    };
+
+    auto scan_shard = [&](size_t index) {
+        if (stopped.load()) {
+            return;
+        }
+        ShardIteratorPtr iterator;
+        if (index == 0) {
+            iterator = std::move(first_iterator);
+        } else {
+            auto status = create_iterator(index, session_ts, iterator);
+            if (!status.IsOk()) {
+                fail(status);
+                return;
+            }
+        }
+
+        while (!stopped.load()) {
+            QueryResults batch;
+            auto status = iterator->Next(batch);
+            if (!status.IsOk()) {
+                fail(status);
+                return;
+            }
+            if (batch.GetRowCount() == 0) {
+                return;
+            }
+
+            try {
+                status = on_batch(index, batch);
+            } catch (const std::exception& e) {
+                status = {StatusCode::UNKNOWN_ERROR, "Parallel scan callback failed: " + std::string(e.what())};
+            } catch (...) {
+                status = {StatusCode::UNKNOWN_ERROR, "Parallel scan callback failed with unknown exception"};
+            }
+            if (!status.IsOk()) {
+                fail(status);
+                return;
+            }
+        }
+    };
+
+    // the calling thread scans shards too, the others are scanned on the executor
+    RunConcurrently(executor_, shards.size(), prepared_request.Concurrency(), scan_shard);
+    return scan_status;
+}
+
 Status
 MilvusClientV2Impl::RunAnalyzer(const RunAnalyzerRequest& request, RunAnalyzerResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::RunAnalyzerRequest& rpc_request) {
         rpc_request.set_collection_name(request.CollectionName());
         rpc_request.set_db_name(request.DatabaseName());
@@ -2399,7 +3384,7 @@ MilvusClientV2Impl::Flush(const FlushRequest& request) {
         return Status::OK();
     };
 
-    // wait flush progress, check flush state in interval 1000ms, until the time cost exceeds request.WaitFlushedMs()
+    // wait flush progress, check flush state at intervals backing off to 1000ms, until request.WaitFlushedMs() passes
     // ProgressMonitor timeout unit is second, it is a history problem.
     // request.WaitFlushedMs() 0ms is treated as 0 second, which means "forever".
     // request.WaitFlushedMs() in [1, 1000] is treated as 1 second, request.
@@ -2415,73 +3400,53 @@ MilvusClientV2Impl::Flush(const FlushRequest& request) {
     auto wait_for_status = [this, &progress_monitor, &db_name](const proto::milvus::FlushResponse& response) {
         std::map<std::string, std::vector<int64_t>> flush_segments;
         std::map<std::string, uint64_t> flush_tss;
-        for (const auto& iter : response.coll_segids()) {
-            const auto& ids = iter.second.data();
-            std::vector<int64_t> seg_ids;
-            seg_ids.reserve(ids.size());
-            seg_ids.insert(seg_ids.end(), ids.begin(), ids.end());
-            flush_segments.insert(std::make_pair(iter.first, seg_ids));
-        }
-        for (const auto& iter : response.coll_flush_ts()) {
-            flush_tss.insert(std::make_pair(iter.first, iter.second));
-        }
-
-        // the segment_count is how many segments need to be flushed
-        // the finished_count is how many segments have been flushed
-        uint32_t segment_count = 0, finished_count = 0;
-        for (auto& pair : flush_segments) {
-            segment_count += static_cast<uint32_t>(pair.second.size());
-        }
-        if (segment_count == 0) {
+        FlushSegments(response, flush_segments, flush_tss);
+        if (flush_segments.empty()) {
             return Status::OK();
         }
+        return waitForStatus(flushQuery(db_name, std::move(flush_segments), std::move(flush_tss)), progress_monitor,
+                             kFlushSettleMs);
+    };
 
-        auto status = ConnectionHandler::WaitForStatus(
-            [&segment_count, &flush_segments, &flush_tss, &finished_count, &db_name, this](Progress& p) -> Status {
-                p.total_ = segment_count;
-
-                // call GetFlushState() to check segment state
-                for (auto iter = flush_segments.begin(); iter != flush_segments.end();) {
-                    bool flushed = false;
-                    uint64_t flush_ts = 0;
-                    auto ts_iter = flush_tss.find(iter->first);
-                    if (ts_iter != flush_tss.end()) {
-                        flush_ts = ts_iter->second;
-                    }
-                    Status status = getFlushState(db_name, iter->second, flush_ts, flushed);
-                    if (!status.IsOk()) {
-                        return status;
-                    }
-
-                    if (flushed) {
-                        finished_count += static_cast<uint32_t>(iter->second.size());
-                        flush_segments.erase(iter++);
-                    } else {
-                        iter++;
-                    }
-                }
-                p.finished_ = finished_count;
-
-                return Status::OK();
-            },
-            progress_monitor);
+    return connection_.Invoke<proto::milvus::FlushRequest, proto::milvus::FlushResponse>(
+        nullptr, pre, &MilvusConnection::Flush, wait_for_status, nullptr);
+}
 
-        // wait more 1 second to make sure the flushed segments are visible.
-        // there might be a small delay(on server-side) between the flush_ts and the time when the segments are actually
-        // flushed, if user calls createSnapshot immediately after flush returns, it might not find the flushed
-        // segments.
-        if (status.IsOk()) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+Status
+MilvusClientV2Impl::FlushAsync(const FlushRequest& request, std::future<Status>& done) {
+    auto pre = [&request](proto::milvus::FlushRequest& rpc_request) {
+        rpc_request.set_db_name(request.DatabaseName());
+        for (const auto& collection_name : request.CollectionNames()) {
+            rpc_request.add_collection_names(collection_name);
         }
-        return status;
+        return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::FlushRequest, proto::milvus::FlushResponse>(
-        nullptr, pre, &MilvusConnection::Flush, wait_for_status, nullptr);
+    std::map<std::string, std::vector<int64_t>> flush_segments;
+    std::map<std::string, uint64_t> flush_tss;
+    auto post = [&flush_segments, &flush_tss](const proto::milvus::FlushResponse& response) {
+        FlushSegments(response, flush_segments, flush_tss);
+        return Status::OK();
+    };
+    auto status = connection_.Invoke<proto::milvus::FlushRequest, proto::milvus::FlushResponse>(
+        pre, &MilvusConnection::Flush, post);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    if (flush_segments.empty()) {
+        return ReadyStatus(done);
+    }
+    ProgressMonitor progress_monitor = WaitMonitor(request.WaitFlushedMs());
+    progress_monitor.SetCheckInterval(1000);
+    done = waiter_.Submit(this, flushQuery(request.DatabaseName(), std::move(flush_segments), std::move(flush_tss)),
+                          progress_monitor, kFlushSettleMs);
+    return Status::OK();
 }
 
 Status
 MilvusClientV2Impl::FlushAll(const FlushAllRequest& request, FlushAllResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::FlushAllRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         return Status::OK();
@@ -2493,21 +3458,7 @@ MilvusClientV2Impl::FlushAll(const FlushAllRequest& request, FlushAllResponse& r
     }
 
     auto wait_for_status = [this, &request, &progress_monitor](const proto::milvus::FlushAllResponse& rpc_response) {
-        GetFlushAllStateRequest state_request = GetFlushAllStateRequest()
-                                                    .WithDatabaseName(request.DatabaseName())
-                                                    .WithFlushAllTs(rpc_response.flush_all_ts());
-        return ConnectionHandler::WaitForStatus(
-            [this, &state_request](Progress& p) -> Status {
-                p.total_ = 1;
-                GetFlushAllStateResponse state_response;
-                auto status = getFlushAllState(state_request, state_response);
-                if (!status.IsOk()) {
-                    return status;
-                }
-                p.finished_ = state_response.Flushed() ? 1 : 0;
-                return Status::OK();
-            },
-            progress_monitor);
+        return waitForStatus(flushAllQuery(request.DatabaseName(), rpc_response.flush_all_ts()), progress_monitor);
     };
 
     auto post = [&response](const proto::milvus::FlushAllResponse& rpc_response) {
@@ -2521,6 +3472,7 @@ MilvusClientV2Impl::FlushAll(const FlushAllRequest& request, FlushAllResponse& r
 
 Status
 MilvusClientV2Impl::GetFlushAllState(const GetFlushAllStateRequest& request, GetFlushAllStateResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return getFlushAllState(request, response);
 }
 
@@ -2546,6 +3498,7 @@ MilvusClientV2Impl::getFlushAllState(const GetFlushAllStateRequest& request, Get
 Status
 MilvusClientV2Impl::ListPersistentSegments(const ListPersistentSegmentsRequest& request,
                                            ListPersistentSegmentsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::GetPersistentSegmentInfoRequest& rpc_request) {
         rpc_request.set_dbname(request.DatabaseName());
         rpc_request.set_collectionname(request.CollectionName());
@@ -2571,6 +3524,7 @@ MilvusClientV2Impl::ListPersistentSegments(const ListPersistentSegmentsRequest&
 
 Status
 MilvusClientV2Impl::ListQuerySegments(const ListQuerySegmentsRequest& request, ListQuerySegmentsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::GetQuerySegmentInfoRequest& rpc_request) {
         rpc_request.set_dbname(request.DatabaseName());
         rpc_request.set_collectionname(request.CollectionName());
@@ -2600,10 +3554,22 @@ MilvusClientV2Impl::ListQuerySegments(const ListQuerySegmentsRequest& request, L
 
 Status
 MilvusClientV2Impl::Compact(const CompactRequest& request, CompactResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     const auto database_name = connection_.CurrentDbName(request.DatabaseName());
     return compact(database_name, request, response);
 }
 
+Status
+MilvusClientV2Impl::CompactAsync(const CompactRequest& request, CompactResponse& response, std::future<Status>& done) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    auto status = Compact(request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    done = waiter_.Submit(this, compactionQuery(response.CompactionID()), ProgressMonitor::Forever());
+    return Status::OK();
+}
+
 Status
 MilvusClientV2Impl::compact(const std::string& database_name, const CompactRequest& request, CompactResponse& response,
                             uint64_t rpc_timeout_ms) {
@@ -2641,71 +3607,51 @@ MilvusClientV2Impl::compact(const std::string& database_name, const CompactReque
 Status
 MilvusClientV2Impl::Optimize(const OptimizeRequest& request, OptimizeTaskPtr& task) {
     task = std::make_shared<OptimizeTask>();
-
-    if (!request.Async()) {
-        OptimizeResponse response;
-        auto status = runOptimize(request, *task, response);
-        task->complete(status, std::move(response));
-        return status;
-    }
+    auto run = std::make_shared<OptimizeRun>();
+    // TimeoutMs() counts from the call, including the time an asynchronous task waits for its first poll
+    run->start_ = std::chrono::steady_clock::now();
+    run->request_ = request;
+    run->task_ = task;
+    run->response_.SetCollectionName(request.CollectionName());
 
     std::shared_ptr<MilvusClientV2Impl> self;
-    try {
-        self = shared_from_this();
-    } catch (const std::bad_weak_ptr&) {
-        return {StatusCode::UNKNOWN_ERROR, "MilvusClientV2Impl must be owned by std::shared_ptr to run Optimize"};
+    if (request.Async()) {
+        try {
+            self = shared_from_this();
+        } catch (const std::bad_weak_ptr&) {
+            return {StatusCode::UNKNOWN_ERROR, "MilvusClientV2Impl must be owned by std::shared_ptr to run Optimize"};
+        }
     }
 
-    auto task_copy = task;
-    auto status = task->start([self, request, task_copy](OptimizeResponse& response) {
-        return self->runOptimize(request, *task_copy, response);
-    });
-    if (!status.IsOk()) {
-        return status;
+    // the stages run as the polls of one wait, so waiting for the server between them holds no thread;
+    // Forever() polls at most every 500 milliseconds, the stages check TimeoutMs() themselves
+    auto query = [this, self, run](Progress& progress, uint64_t rpc_timeout_ms) {
+        return optimizeStep(*run, progress, rpc_timeout_ms);
+    };
+    if (!request.Async()) {
+        return finishOptimize(*run, waiter_.Await(this, query, ProgressMonitor::Forever()));
     }
-
+    waiter_.Watch(this, query, ProgressMonitor::Forever(),
+                  [self, run](const Status& status) { self->finishOptimize(*run, status); });
     return Status::OK();
 }
 
 Status
-MilvusClientV2Impl::runOptimize(const OptimizeRequest& request, OptimizeTask& task, OptimizeResponse& response) {
-    response.SetCollectionName(request.CollectionName());
+MilvusClientV2Impl::optimizeStep(OptimizeRun& run, Progress& progress, uint64_t poll_timeout_ms) {
+    using Stage = OptimizeRun::Stage;
+    const auto& request = run.request_;
+    auto& task = *run.task_;
+    auto& response = run.response_;
+    progress.total_ = 1;
 
-    const auto database_name = connection_.CurrentDbName(request.DatabaseName());
-
-    auto finish = [&task, &response](const Status& status) {
-        if (response.StatusText().empty()) {
-            response.SetStatusText(task.shouldCancel() ? "cancelled" : (status.IsOk() ? "success" : "failed"));
-        }
-        return status;
-    };
-
-    auto check_cancelled = [&task]() {
-        if (task.shouldCancel()) {
-            return task.cancelledStatus();
-        }
-        return Status::OK();
-    };
-
-    const auto start = std::chrono::steady_clock::now();
     const auto has_timeout = request.TimeoutMs() > 0;
-    auto check_timeout = [&request, start, has_timeout]() {
-        if (!has_timeout) {
-            return Status::OK();
-        }
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
-        if (elapsed.count() >= request.TimeoutMs()) {
-            return Status{StatusCode::TIMEOUT, "Optimize timeout"};
-        }
-        return Status::OK();
-    };
-
-    auto remaining_timeout_ms = [&request, start, has_timeout](int64_t& timeout_ms) {
+    auto remaining_timeout_ms = [&run, &request, has_timeout](int64_t& timeout_ms) {
         if (!has_timeout) {
             timeout_ms = 0;
             return Status::OK();
         }
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - run.start_);
         auto remaining = request.TimeoutMs() - elapsed.count();
         if (remaining <= 0) {
             return Status{StatusCode::TIMEOUT, "Optimize timeout"};
@@ -2718,242 +3664,230 @@ MilvusClientV2Impl::runOptimize(const OptimizeRequest& request, OptimizeTask& ta
     if (fallback_rpc_timeout_ms == 0) {
         fallback_rpc_timeout_ms = DEFAULT_OPTIMIZE_RPC_TIMEOUT_MS;
     }
-    auto remaining_rpc_timeout_ms = [&remaining_timeout_ms, fallback_rpc_timeout_ms](uint64_t& rpc_timeout_ms) {
+    // an rpc may not outlast the request, nor the poll running it
+    auto remaining_rpc_timeout_ms = [&remaining_timeout_ms, fallback_rpc_timeout_ms,
+                                     poll_timeout_ms](uint64_t& rpc_timeout_ms) {
         int64_t timeout_ms = 0;
         auto status = remaining_timeout_ms(timeout_ms);
         if (!status.IsOk()) {
             return status;
         }
         rpc_timeout_ms = timeout_ms > 0 ? static_cast<uint64_t>(timeout_ms) : fallback_rpc_timeout_ms;
+        rpc_timeout_ms = std::min(rpc_timeout_ms, poll_timeout_ms);
         return Status::OK();
     };
 
-    auto check_task_active = [&check_cancelled, &check_timeout]() {
-        auto status = check_cancelled();
-        if (!status.IsOk()) {
-            return status;
-        }
-        return check_timeout();
-    };
-
-    auto wait_interval = [&check_task_active]() {
-        for (int i = 0; i < 10; ++i) {
-            auto status = check_task_active();
+    auto indexes_finished = [this, &run, &request, &remaining_rpc_timeout_ms](bool& finished) {
+        finished = true;
+        for (const auto& index : run.vector_indexes_) {
+            DescribeIndexRequest describe_request = DescribeIndexRequest()
+                                                        .WithDatabaseName(request.DatabaseName())
+                                                        .WithCollectionName(request.CollectionName())
+                                                        .WithFieldName(index.FieldName())
+                                                        .WithIndexName(index.IndexName());
+            DescribeIndexResponse describe_response;
+            uint64_t rpc_timeout_ms = 0;
+            auto status = remaining_rpc_timeout_ms(rpc_timeout_ms);
             if (!status.IsOk()) {
                 return status;
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            status = describeIndex(describe_request, describe_response, rpc_timeout_ms);
+            if (!status.IsOk()) {
+                return status;
+            }
+            if (describe_response.Descs().empty()) {
+                return Status{StatusCode::SERVER_FAILED, "Index not found: " + index.IndexName()};
+            }
+
+            auto state = describe_response.Descs().front().StateCode();
+            if (state == IndexStateCode::FAILED) {
+                return Status{StatusCode::SERVER_FAILED, describe_response.Descs().front().FailReason()};
+            }
+            if (state != IndexStateCode::FINISHED && state != IndexStateCode::NONE) {
+                finished = false;
+            }
         }
         return Status::OK();
     };
 
-    if (request.CollectionName().empty()) {
-        return finish({StatusCode::INVALID_ARGUMENT, "Collection name cannot be empty"});
-    }
-
-    int64_t target_size_mb = 0;
-    std::string normalized_target_size;
-    auto status = ParseTargetSizeMB(request.TargetSize(), target_size_mb, normalized_target_size);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    response.SetTargetSize(normalized_target_size);
-
-    uint64_t rpc_timeout_ms = 0;
-    task.addProgress("initializing");
-    status = remaining_rpc_timeout_ms(rpc_timeout_ms);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    auto describe_request =
-        DescribeCollectionRequest().WithDatabaseName(database_name).WithCollectionName(request.CollectionName());
-    DescribeCollectionResponse describe_response;
-    status = describeCollection(describe_request, describe_response, rpc_timeout_ms);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-
-    std::unordered_set<std::string> vector_fields;
-    for (const auto& field : describe_response.Desc().Schema().Fields()) {
-        if (IsVectorType(field.FieldDataType())) {
-            vector_fields.insert(field.Name());
-        }
-    }
-
-    std::vector<IndexDesc> vector_indexes;
-    if (!vector_fields.empty()) {
-        ListIndexesRequest list_request =
-            ListIndexesRequest().WithDatabaseName(request.DatabaseName()).WithCollectionName(request.CollectionName());
-        ListIndexesResponse list_response;
-        status = remaining_rpc_timeout_ms(rpc_timeout_ms);
-        if (!status.IsOk()) {
-            return finish(status);
+    // returning OK with progress not done waits for the next poll
+    for (;;) {
+        if (task.shouldCancel()) {
+            return task.cancelledStatus();
         }
-        status = listIndexes(list_request, list_response, rpc_timeout_ms);
+        uint64_t rpc_timeout_ms = 0;
+        auto status = remaining_rpc_timeout_ms(rpc_timeout_ms);
         if (!status.IsOk()) {
-            return finish(status);
+            return status;
         }
 
-        for (const auto& desc : list_response.Descs()) {
-            if (vector_fields.count(desc.FieldName()) > 0) {
-                vector_indexes.push_back(desc);
-            }
-        }
-    }
+        switch (run.stage_) {
+            case Stage::INITIALIZE: {
+                if (request.CollectionName().empty()) {
+                    return {StatusCode::INVALID_ARGUMENT, "Collection name cannot be empty"};
+                }
+                std::string normalized_target_size;
+                status = ParseTargetSizeMB(request.TargetSize(), run.target_size_mb_, normalized_target_size);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                response.SetTargetSize(normalized_target_size);
+
+                task.addProgress("initializing");
+                run.database_name_ = connection_.CurrentDbName(request.DatabaseName());
+                auto describe_request = DescribeCollectionRequest()
+                                            .WithDatabaseName(run.database_name_)
+                                            .WithCollectionName(request.CollectionName());
+                DescribeCollectionResponse describe_response;
+                status = describeCollection(describe_request, describe_response, rpc_timeout_ms);
+                if (!status.IsOk()) {
+                    return status;
+                }
 
-    auto wait_vector_indexes = [this, &request, &task, &wait_interval, &remaining_rpc_timeout_ms](
-                                   const std::vector<IndexDesc>& indexes, const std::string& progress) {
-        if (indexes.empty()) {
-            return Status::OK();
-        }
-        task.addProgress(progress);
-
-        for (;;) {
-            auto all_finished = true;
-            for (const auto& index : indexes) {
-                DescribeIndexRequest describe_request = DescribeIndexRequest()
-                                                            .WithDatabaseName(request.DatabaseName())
-                                                            .WithCollectionName(request.CollectionName())
-                                                            .WithFieldName(index.FieldName())
-                                                            .WithIndexName(index.IndexName());
-                DescribeIndexResponse describe_response;
-                uint64_t rpc_timeout_ms = 0;
-                auto status = remaining_rpc_timeout_ms(rpc_timeout_ms);
+                std::unordered_set<std::string> vector_fields;
+                for (const auto& field : describe_response.Desc().Schema().Fields()) {
+                    if (IsVectorType(field.FieldDataType())) {
+                        vector_fields.insert(field.Name());
+                    }
+                }
+                if (!vector_fields.empty()) {
+                    ListIndexesRequest list_request = ListIndexesRequest()
+                                                          .WithDatabaseName(request.DatabaseName())
+                                                          .WithCollectionName(request.CollectionName());
+                    ListIndexesResponse list_response;
+                    status = remaining_rpc_timeout_ms(rpc_timeout_ms);
+                    if (!status.IsOk()) {
+                        return status;
+                    }
+                    status = listIndexes(list_request, list_response, rpc_timeout_ms);
+                    if (!status.IsOk()) {
+                        return status;
+                    }
+                    for (const auto& desc : list_response.Descs()) {
+                        if (vector_fields.count(desc.FieldName()) > 0) {
+                            run.vector_indexes_.push_back(desc);
+                        }
+                    }
+                }
+                if (!run.vector_indexes_.empty()) {
+                    task.addProgress("waiting for indexes before compaction");
+                }
+                run.stage_ = Stage::INDEXES_BEFORE;
+                break;
+            }
+            case Stage::INDEXES_BEFORE:
+            case Stage::INDEXES_AFTER: {
+                bool finished = false;
+                status = indexes_finished(finished);
                 if (!status.IsOk()) {
                     return status;
                 }
-                status = describeIndex(describe_request, describe_response, rpc_timeout_ms);
+                if (!finished) {
+                    return Status::OK();
+                }
+                run.stage_ = run.stage_ == Stage::INDEXES_BEFORE ? Stage::COMPACT : Stage::LOAD_STATE;
+                break;
+            }
+            case Stage::COMPACT: {
+                task.addProgress("compacting");
+                CompactRequest compact_request = CompactRequest()
+                                                     .WithDatabaseName(request.DatabaseName())
+                                                     .WithCollectionName(request.CollectionName())
+                                                     .WithTargetSize(run.target_size_mb_);
+                CompactResponse compact_response;
+                status = compact(run.database_name_, compact_request, compact_response, rpc_timeout_ms);
                 if (!status.IsOk()) {
                     return status;
                 }
-                if (describe_response.Descs().empty()) {
-                    return Status{StatusCode::SERVER_FAILED, "Index not found: " + index.IndexName()};
+                response.SetCompactionID(compact_response.CompactionID());
+                task.addProgress("waiting for compaction");
+                run.stage_ = Stage::COMPACTION;
+                break;
+            }
+            case Stage::COMPACTION: {
+                GetCompactionStateRequest state_request =
+                    GetCompactionStateRequest().WithCompactionID(response.CompactionID());
+                GetCompactionStateResponse state_response;
+                status = getCompactionState(state_request, state_response, rpc_timeout_ms);
+                if (!status.IsOk()) {
+                    return status;
                 }
-
-                auto state = describe_response.Descs().front().StateCode();
-                if (state == IndexStateCode::FAILED) {
-                    return Status{StatusCode::SERVER_FAILED, describe_response.Descs().front().FailReason()};
+                if (state_response.State().FailedPlan() > 0) {
+                    return {StatusCode::SERVER_FAILED, "Compaction failed"};
                 }
-                if (state != IndexStateCode::FINISHED && state != IndexStateCode::NONE) {
-                    all_finished = false;
+                if (state_response.State().State() != CompactionStateCode::COMPLETED) {
+                    return Status::OK();
                 }
+                if (!run.vector_indexes_.empty()) {
+                    task.addProgress("waiting for indexes after compaction");
+                }
+                run.stage_ = Stage::INDEXES_AFTER;
+                break;
             }
-
-            if (all_finished) {
-                return Status::OK();
+            case Stage::LOAD_STATE: {
+                task.addProgress("checking load state");
+                GetLoadStateRequest load_state_request = GetLoadStateRequest()
+                                                             .WithDatabaseName(request.DatabaseName())
+                                                             .WithCollectionName(request.CollectionName());
+                GetLoadStateResponse load_state_response;
+                status = getLoadState(load_state_request, load_state_response, rpc_timeout_ms);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                if (load_state_response.State() != LoadState::LOAD_STATE_LOADED) {
+                    task.addProgress("collection not loaded; skip refreshLoad");
+                    run.stage_ = Stage::DONE;
+                    break;
+                }
+                if (task.shouldCancel()) {
+                    return task.cancelledStatus();
+                }
+                task.addProgress("refreshing load");
+                RefreshLoadRequest refresh_request = RefreshLoadRequest()
+                                                         .WithDatabaseName(request.DatabaseName())
+                                                         .WithCollectionName(request.CollectionName())
+                                                         .WithSync(false);
+                status = refreshLoad(refresh_request, rpc_timeout_ms);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                run.stage_ = Stage::REFRESH;
+                break;
             }
-
-            auto status = wait_interval();
-            if (!status.IsOk()) {
-                return status;
+            case Stage::REFRESH: {
+                auto refresh_query = loadingQuery(request.DatabaseName(), request.CollectionName(), {}, true);
+                Progress refresh_progress;
+                status = refresh_query(refresh_progress, rpc_timeout_ms);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                if (!refresh_progress.Done()) {
+                    return Status::OK();
+                }
+                run.stage_ = Stage::DONE;
+                break;
             }
+            case Stage::DONE:
+                response.SetStatusText("success");
+                progress.finished_ = 1;
+                return Status::OK();
         }
-    };
-
-    status = wait_vector_indexes(vector_indexes, "waiting for indexes before compaction");
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    status = check_task_active();
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-
-    task.addProgress("compacting");
-    CompactRequest compact_request = CompactRequest()
-                                         .WithDatabaseName(request.DatabaseName())
-                                         .WithCollectionName(request.CollectionName())
-                                         .WithTargetSize(target_size_mb);
-    CompactResponse compact_response;
-    status = remaining_rpc_timeout_ms(rpc_timeout_ms);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    status = compact(database_name, compact_request, compact_response, rpc_timeout_ms);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    response.SetCompactionID(compact_response.CompactionID());
-
-    task.addProgress("waiting for compaction");
-    for (;;) {
-        GetCompactionStateRequest state_request =
-            GetCompactionStateRequest().WithCompactionID(compact_response.CompactionID());
-        GetCompactionStateResponse state_response;
-        status = remaining_rpc_timeout_ms(rpc_timeout_ms);
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-        status = getCompactionState(state_request, state_response, rpc_timeout_ms);
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-        if (state_response.State().FailedPlan() > 0) {
-            return finish({StatusCode::SERVER_FAILED, "Compaction failed"});
-        }
-
-        auto compaction_state = state_response.State().State();
-        if (compaction_state == CompactionStateCode::COMPLETED) {
-            break;
-        }
-
-        status = wait_interval();
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-    }
-
-    status = wait_vector_indexes(vector_indexes, "waiting for indexes after compaction");
-    if (!status.IsOk()) {
-        return finish(status);
     }
+}
 
-    task.addProgress("checking load state");
-    GetLoadStateRequest load_state_request =
-        GetLoadStateRequest().WithDatabaseName(request.DatabaseName()).WithCollectionName(request.CollectionName());
-    GetLoadStateResponse load_state_response;
-    status = remaining_rpc_timeout_ms(rpc_timeout_ms);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    status = getLoadState(load_state_request, load_state_response, rpc_timeout_ms);
-    if (!status.IsOk()) {
-        return finish(status);
-    }
-    if (load_state_response.State() == LoadState::LOAD_STATE_LOADED) {
-        status = check_task_active();
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-        task.addProgress("refreshing load");
-        int64_t refresh_timeout_ms = 0;
-        status = remaining_timeout_ms(refresh_timeout_ms);
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-        status = remaining_rpc_timeout_ms(rpc_timeout_ms);
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-        RefreshLoadRequest refresh_request = RefreshLoadRequest()
-                                                 .WithDatabaseName(request.DatabaseName())
-                                                 .WithCollectionName(request.CollectionName())
-                                                 .WithSync(true)
-                                                 .WithTimeoutMs(refresh_timeout_ms);
-        status = refreshLoad(refresh_request, rpc_timeout_ms);
-        if (!status.IsOk()) {
-            return finish(status);
-        }
-    } else {
-        task.addProgress("collection not loaded; skip refreshLoad");
+Status
+MilvusClientV2Impl::finishOptimize(OptimizeRun& run, const Status& status) {
+    auto& response = run.response_;
+    if (response.StatusText().empty()) {
+        response.SetStatusText(run.task_->shouldCancel() ? "cancelled" : (status.IsOk() ? "success" : "failed"));
     }
-
-    response.SetStatusText("success");
-    return finish(Status::OK());
+    run.task_->complete(status, std::move(response));
+    return status;
 }
 
 Status
 MilvusClientV2Impl::GetCompactionState(const GetCompactionStateRequest& request, GetCompactionStateResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     return getCompactionState(request, response);
 }
 
@@ -2992,6 +3926,7 @@ MilvusClientV2Impl::getCompactionState(const GetCompactionStateRequest& request,
 
 Status
 MilvusClientV2Impl::GetCompactionPlans(const GetCompactionPlansRequest& request, GetCompactionPlansResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::GetCompactionPlansRequest& rpc_request) {
         rpc_request.set_compactionid(request.CompactionID());
         return Status::OK();
@@ -3068,6 +4003,7 @@ MilvusClientV2Impl::DropSnapshot(const DropSnapshotRequest& request) {
 
 Status
 MilvusClientV2Impl::ListSnapshots(const ListSnapshotsRequest& request, ListSnapshotsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::ListSnapshotsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         if (!request.CollectionName().empty()) {
@@ -3090,6 +4026,7 @@ MilvusClientV2Impl::ListSnapshots(const ListSnapshotsRequest& request, ListSnaps
 
 Status
 MilvusClientV2Impl::DescribeSnapshot(const DescribeSnapshotRequest& request, DescribeSnapshotResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto validate = [&request]() {
         if (request.SnapshotName().empty()) {
             return Status{StatusCode::INVALID_ARGUMENT, "Snapshot name is empty"};
@@ -3127,6 +4064,7 @@ MilvusClientV2Impl::DescribeSnapshot(const DescribeSnapshotRequest& request, Des
 
 Status
 MilvusClientV2Impl::RestoreSnapshot(const RestoreSnapshotRequest& request, RestoreSnapshotResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto validate = [&request]() {
         if (request.SnapshotName().empty()) {
             return Status{StatusCode::INVALID_ARGUMENT, "Snapshot name is empty"};
@@ -3158,9 +4096,28 @@ MilvusClientV2Impl::RestoreSnapshot(const RestoreSnapshotRequest& request, Resto
         validate, pre, &MilvusConnection::RestoreSnapshot, post);
 }
 
+Status
+MilvusClientV2Impl::RestoreSnapshotAsync(const RestoreSnapshotRequest& request, RestoreSnapshotResponse& response,
+                                         std::future<Status>& done) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    auto status = RestoreSnapshot(request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    done = waiter_.Submit(this, restoreSnapshotQuery(response.JobID()), ProgressMonitor::Forever());
+    return Status::OK();
+}
+
 Status
 MilvusClientV2Impl::GetRestoreSnapshotState(const GetRestoreSnapshotStateRequest& request,
                                             GetRestoreSnapshotStateResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
+    return getRestoreSnapshotState(request, response);
+}
+
+Status
+MilvusClientV2Impl::getRestoreSnapshotState(const GetRestoreSnapshotStateRequest& request,
+                                            GetRestoreSnapshotStateResponse& response, uint64_t rpc_timeout_ms) {
     auto validate = [&request]() {
         if (request.JobID() <= 0) {
             return Status{StatusCode::INVALID_ARGUMENT, "Restore snapshot job id must be positive"};
@@ -3178,14 +4135,15 @@ MilvusClientV2Impl::GetRestoreSnapshotState(const GetRestoreSnapshotStateRequest
         return Status::OK();
     };
 
-    return connection_
-        .Invoke<proto::milvus::GetRestoreSnapshotStateRequest, proto::milvus::GetRestoreSnapshotStateResponse>(
-            validate, pre, &MilvusConnection::GetRestoreSnapshotState, post);
+    return connection_.InvokeWithRpcTimeout<proto::milvus::GetRestoreSnapshotStateRequest,
+                                            proto::milvus::GetRestoreSnapshotStateResponse>(
+        rpc_timeout_ms, validate, pre, &MilvusConnection::GetRestoreSnapshotState, nullptr, post);
 }
 
 Status
 MilvusClientV2Impl::ListRestoreSnapshotJobs(const ListRestoreSnapshotJobsRequest& request,
                                             ListRestoreSnapshotJobsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::ListRestoreSnapshotJobsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         if (!request.CollectionName().empty()) {
@@ -3211,6 +4169,7 @@ MilvusClientV2Impl::ListRestoreSnapshotJobs(const ListRestoreSnapshotJobsRequest
 
 Status
 MilvusClientV2Impl::PinSnapshotData(const PinSnapshotDataRequest& request, PinSnapshotDataResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto validate = [&request]() {
         if (request.SnapshotName().empty()) {
             return Status{StatusCode::INVALID_ARGUMENT, "Snapshot name is empty"};
@@ -3262,6 +4221,7 @@ MilvusClientV2Impl::UnpinSnapshotData(const UnpinSnapshotDataRequest& request) {
 Status
 MilvusClientV2Impl::RefreshExternalCollection(const RefreshExternalCollectionRequest& request,
                                               RefreshExternalCollectionResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto validate = [&request]() {
         if (request.CollectionName().empty()) {
             return Status{StatusCode::INVALID_ARGUMENT, "Collection name is empty"};
@@ -3290,6 +4250,7 @@ MilvusClientV2Impl::RefreshExternalCollection(const RefreshExternalCollectionReq
 Status
 MilvusClientV2Impl::GetRefreshExternalCollectionProgress(const GetRefreshExternalCollectionProgressRequest& request,
                                                          GetRefreshExternalCollectionProgressResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto validate = [&request]() {
         if (request.JobID() <= 0) {
             return Status{StatusCode::INVALID_ARGUMENT, "Refresh external collection job id must be positive"};
@@ -3315,6 +4276,7 @@ MilvusClientV2Impl::GetRefreshExternalCollectionProgress(const GetRefreshExterna
 Status
 MilvusClientV2Impl::ListRefreshExternalCollectionJobs(const ListRefreshExternalCollectionJobsRequest& request,
                                                       ListRefreshExternalCollectionJobsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::ListRefreshExternalCollectionJobsRequest& rpc_request) {
         rpc_request.set_db_name(request.DatabaseName());
         rpc_request.set_collection_name(request.CollectionName());
@@ -3378,6 +4340,7 @@ MilvusClientV2Impl::RemoveFileResource(const RemoveFileResourceRequest& request)
 
 Status
 MilvusClientV2Impl::ListFileResources(const ListFileResourcesRequest& request, ListFileResourcesResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto post = [&response](const proto::milvus::ListFileResourcesResponse& rpc_response) {
         std::vector<FileResourceInfo> resources;
         resources.reserve(rpc_response.resources_size());
@@ -3395,6 +4358,7 @@ MilvusClientV2Impl::ListFileResources(const ListFileResourcesRequest& request, L
 Status
 MilvusClientV2Impl::GetReplicateConfiguration(const GetReplicateConfigurationRequest& request,
                                               GetReplicateConfigurationResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto post = [&response](const proto::milvus::GetReplicateConfigurationResponse& rpc_response) {
         ReplicateConfiguration configuration;
         ConvertReplicateConfiguration(rpc_response.configuration(), configuration);
@@ -3421,6 +4385,7 @@ MilvusClientV2Impl::UpdateReplicateConfiguration(const UpdateReplicateConfigurat
 
 Status
 MilvusClientV2Impl::GetReplicateInfo(const GetReplicateInfoRequest& request, GetReplicateInfoResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::GetReplicateInfoRequest& rpc_request) {
         rpc_request.set_source_cluster_id(request.SourceClusterID());
         rpc_request.set_target_pchannel(request.TargetPChannel());
@@ -3551,6 +4516,7 @@ MilvusClientV2Impl::TransferReplica(const TransferReplicaRequest& request) {
 
 Status
 MilvusClientV2Impl::ListResourceGroups(const ListResourceGroupsRequest& request, ListResourceGroupsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto post = [&response](const proto::milvus::ListResourceGroupsResponse& rpc_response) {
         std::vector<std::string> group_names;
         group_names.reserve(rpc_response.resource_groups_size());
@@ -3567,6 +4533,7 @@ MilvusClientV2Impl::ListResourceGroups(const ListResourceGroupsRequest& request,
 Status
 MilvusClientV2Impl::DescribeResourceGroup(const DescribeResourceGroupRequest& request,
                                           DescribeResourceGroupResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::DescribeResourceGroupRequest& rpc_request) {
         rpc_request.set_resource_group(request.GroupName());
         return Status::OK();
@@ -3656,6 +4623,7 @@ MilvusClientV2Impl::DropUser(const DropUserRequest& request) {
 
 Status
 MilvusClientV2Impl::DescribeUser(const DescribeUserRequest& request, DescribeUserResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::SelectUserRequest& rpc_request) {
         rpc_request.mutable_user()->set_name(request.UserName());
         rpc_request.set_include_role_info(true);
@@ -3683,6 +4651,7 @@ MilvusClientV2Impl::DescribeUser(const DescribeUserRequest& request, DescribeUse
 
 Status
 MilvusClientV2Impl::ListUsers(const ListUsersRequest& request, ListUsersResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto post = [&response](const proto::milvus::ListCredUsersResponse& rpc_response) {
         std::vector<std::string> names;
         names.reserve(rpc_response.usernames_size());
@@ -3735,6 +4704,7 @@ MilvusClientV2Impl::DropRole(const DropRoleRequest& request) {
 
 Status
 MilvusClientV2Impl::DescribeRole(const DescribeRoleRequest& request, DescribeRoleResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [&request](proto::milvus::SelectGrantRequest& rpc_request) {
         auto entity = rpc_request.mutable_entity();
         entity->mutable_role()->set_name(request.RoleName());
@@ -3778,6 +4748,7 @@ MilvusClientV2Impl::DescribeRole(const DescribeRoleRequest& request, DescribeRol
 
 Status
 MilvusClientV2Impl::ListRoles(const ListRolesRequest& request, ListRolesResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto pre = [](proto::milvus::SelectRoleRequest& rpc_request) {
         rpc_request.set_include_user_info(false);
         return Status::OK();
@@ -3878,6 +4849,7 @@ MilvusClientV2Impl::DropPrivilegeGroup(const DropPrivilegeGroupRequest& request)
 Status
 MilvusClientV2Impl::ListPrivilegeGroups(const ListPrivilegeGroupsRequest& request,
                                         ListPrivilegeGroupsResponse& response) {
+    CallTimer call_timer(connection_.CallTimingEnabled(), response);
     auto post = [&response](const proto::milvus::ListPrivilegeGroupsResponse& rpc_response) {
         PrivilegeGroupInfos groups;
         groups.reserve(rpc_response.privilege_groups_size());
@@ -3960,11 +4932,13 @@ MilvusClientV2Impl::createIndex(const std::string& db_name, const std::string& c
 
     // if not sync mode, directly return
     if (!sync) {
-        return connection_.Invoke<proto::milvus::CreateIndexRequest, proto::common::Status>(
+        auto status = connection_.Invoke<proto::milvus::CreateIndexRequest, proto::common::Status>(
             pre, &MilvusConnection::CreateIndex);
+        invalidateMetadata(db_name, collection_name);
+        return status;
     }
 
-    // wait index progress, check index state in interval 500ms, until the time cost exceeds timeout_ms
+    // wait index progress, check index state at intervals backing off to 500ms, until timeout_ms passes
     // ProgressMonitor timeout unit is second, it is a history problem.
     // timeout_ms 0ms is treated as 0 second, which means "forever".
     // timeout_ms in [1, 1000] is treated as 1 second, request.
@@ -3975,49 +4949,177 @@ MilvusClientV2Impl::createIndex(const std::string& db_name, const std::string& c
         progress_monitor = ProgressMonitor{static_cast<uint32_t>(timeout_ms + 999) / 1000};
     }
     auto wait_for_status = [&db_name, &collection_name, &desc, &progress_monitor, this](const proto::common::Status&) {
-        return ConnectionHandler::WaitForStatus(
-            [&db_name, &collection_name, &desc, this](Progress& progress) -> Status {
-                progress.total_ = 100;
-
-                DescribeIndexRequest request = DescribeIndexRequest()
-                                                   .WithDatabaseName(db_name)
-                                                   .WithCollectionName(collection_name)
-                                                   .WithFieldName(desc.FieldName());
-                DescribeIndexResponse response;
-                auto status = DescribeIndex(request, response);
-                if (!status.IsOk()) {
-                    return status;
-                }
+        return waitForStatus(indexQuery(db_name, collection_name, desc.FieldName()), progress_monitor);
+    };
+    auto status = connection_.Invoke<proto::milvus::CreateIndexRequest, proto::common::Status>(
+        nullptr, pre, &MilvusConnection::CreateIndex, wait_for_status, nullptr);
+    invalidateMetadata(db_name, collection_name);
+    return status;
+}
 
-                // each field only returns one index desc, but in future if we support multi-indexes in one filed,
-                // describeIndex() might return multiple descs. now we only process the first desc.
-                const auto& out_descs = response.Descs();
-                if (out_descs.empty()) {
-                    // server-side error, it should return one desc here
-                    return Status{StatusCode::SERVER_FAILED, "Index is created by cannot be described"};
-                }
+Status
+MilvusClientV2Impl::waitForStatus(StatusWaiter::QueryFunction query, const ProgressMonitor& progress_monitor,
+                                  uint32_t settle_ms) {
+    return waiter_.Await(this, std::move(query), progress_monitor, settle_ms);
+}
 
-                const auto& out_desc = out_descs.at(0);
-                // if index finished, progress set to 100%
-                // else if index failed, return error status
-                // else if index is in progressing, continue to check
-                if (out_desc.StateCode() == IndexStateCode::FINISHED || out_desc.StateCode() == IndexStateCode::NONE) {
-                    progress.finished_ = 100;
-                } else if (out_desc.StateCode() == IndexStateCode::FAILED) {
-                    return Status{StatusCode::SERVER_FAILED, "index failed:" + out_desc.FailReason()};
-                }
+StatusWaiter::QueryFunction
+MilvusClientV2Impl::loadingQuery(const std::string& db_name, const std::string& collection_name,
+                                 std::set<std::string> partition_names, bool refresh, uint64_t rpc_timeout_ms) {
+    return [this, db_name, collection_name, partition_names, refresh, rpc_timeout_ms](Progress& progress,
+                                                                                      uint64_t poll_timeout_ms) {
+        progress.total_ = 100;
+        uint32_t loading_progress = 0;
+        uint32_t refresh_progress = 0;
+        auto status = connection_.GetLoadingProgress(
+            connection_.CurrentDbName(db_name), collection_name, partition_names, loading_progress, refresh_progress,
+            rpc_timeout_ms > 0 ? std::min(rpc_timeout_ms, poll_timeout_ms) : poll_timeout_ms);
+        if (!status.IsOk()) {
+            return status;
+        }
+        progress.finished_ = refresh ? refresh_progress : loading_progress;
+        return Status::OK();
+    };
+}
+
+StatusWaiter::QueryFunction
+MilvusClientV2Impl::indexQuery(const std::string& db_name, const std::string& collection_name,
+                               const std::string& field_name) {
+    auto request =
+        DescribeIndexRequest().WithDatabaseName(db_name).WithCollectionName(collection_name).WithFieldName(field_name);
+    return [this, request](Progress& progress, uint64_t rpc_timeout_ms) {
+        progress.total_ = 100;
+        DescribeIndexResponse response;
+        auto status = describeIndex(request, response, rpc_timeout_ms);
+        if (!status.IsOk()) {
+            return status;
+        }
+
+        // each field only returns one index desc, but in future if we support multi-indexes in one filed,
+        // describeIndex() might return multiple descs. now we only process the first desc.
+        const auto& out_descs = response.Descs();
+        if (out_descs.empty()) {
+            // server-side error, it should return one desc here
+            return Status{StatusCode::SERVER_FAILED, "Index is created by cannot be described"};
+        }
+
+        const auto& out_desc = out_descs.at(0);
+        // if index finished, progress set to 100%
+        // else if index failed, return error status
+        // else if index is in progressing, continue to check
+        if (out_desc.StateCode() == IndexStateCode::FINISHED || out_desc.StateCode() == IndexStateCode::NONE) {
+            progress.finished_ = 100;
+        } else if (out_desc.StateCode() == IndexStateCode::FAILED) {
+            return Status{StatusCode::SERVER_FAILED, "index failed:" + out_desc.FailReason()};
+        }
+
+        return status;
+    };
+}
 
+StatusWaiter::QueryFunction
+MilvusClientV2Impl::flushQuery(const std::string& db_name, std::map<std::string, std::vector<int64_t>> flush_segments,
+                               std::map<std::string, uint64_t> flush_tss) {
+    // the segments still being flushed, shrinking as the query runs, the query object is copied by std::function
+    struct FlushState {
+        std::map<std::string, std::vector<int64_t>> segments_;
+        std::map<std::string, uint64_t> flush_tss_;
+        uint32_t segment_count_ = 0;
+        uint32_t finished_count_ = 0;
+    };
+    auto state = std::make_shared<FlushState>();
+    for (const auto& pair : flush_segments) {
+        state->segment_count_ += static_cast<uint32_t>(pair.second.size());
+    }
+    state->segments_ = std::move(flush_segments);
+    state->flush_tss_ = std::move(flush_tss);
+
+    return [this, db_name, state](Progress& p, uint64_t rpc_timeout_ms) -> Status {
+        p.total_ = state->segment_count_;
+
+        // call GetFlushState() to check segment state
+        for (auto iter = state->segments_.begin(); iter != state->segments_.end();) {
+            bool flushed = false;
+            uint64_t flush_ts = 0;
+            auto ts_iter = state->flush_tss_.find(iter->first);
+            if (ts_iter != state->flush_tss_.end()) {
+                flush_ts = ts_iter->second;
+            }
+            Status status = getFlushState(db_name, iter->second, flush_ts, flushed, rpc_timeout_ms);
+            if (!status.IsOk()) {
                 return status;
-            },
-            progress_monitor);
+            }
+
+            if (flushed) {
+                state->finished_count_ += static_cast<uint32_t>(iter->second.size());
+                state->segments_.erase(iter++);
+            } else {
+                iter++;
+            }
+        }
+        p.finished_ = state->finished_count_;
+
+        return Status::OK();
+    };
+}
+
+StatusWaiter::QueryFunction
+MilvusClientV2Impl::flushAllQuery(const std::string& db_name, uint64_t flush_all_ts) {
+    auto state_request = GetFlushAllStateRequest().WithDatabaseName(db_name).WithFlushAllTs(flush_all_ts);
+    return [this, state_request](Progress& p, uint64_t rpc_timeout_ms) -> Status {
+        p.total_ = 1;
+        GetFlushAllStateResponse state_response;
+        auto status = getFlushAllState(state_request, state_response, rpc_timeout_ms);
+        if (!status.IsOk()) {
+            return status;
+        }
+        p.finished_ = state_response.Flushed() ? 1 : 0;
+        return Status::OK();
+    };
+}
+
+StatusWaiter::QueryFunction
+MilvusClientV2Impl::compactionQuery(int64_t compaction_id) {
+    auto state_request = GetCompactionStateRequest().WithCompactionID(compaction_id);
+    return [this, state_request](Progress& p, uint64_t rpc_timeout_ms) -> Status {
+        p.total_ = 1;
+        GetCompactionStateResponse state_response;
+        auto status = getCompactionState(state_request, state_response, rpc_timeout_ms);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (state_response.State().FailedPlan() > 0) {
+            return Status{StatusCode::SERVER_FAILED, "Compaction failed"};
+        }
+        p.finished_ = state_response.State().State() == CompactionStateCode::COMPLETED ? 1 : 0;
+        return Status::OK();
+    };
+}
+
+StatusWaiter::QueryFunction
+MilvusClientV2Impl::restoreSnapshotQuery(int64_t job_id) {
+    auto state_request = GetRestoreSnapshotStateRequest().WithJobID(job_id);
+    return [this, state_request](Progress& p, uint64_t rpc_timeout_ms) -> Status {
+        p.total_ = 100;
+        GetRestoreSnapshotStateResponse state_response;
+        auto status = getRestoreSnapshotState(state_request, state_response, rpc_timeout_ms);
+        if (!status.IsOk()) {
+            return status;
+        }
+        const auto& job = state_response.JobInfo();
+        if (job.State() == RestoreSnapshotStateCode::FAILED) {
+            return Status{StatusCode::SERVER_FAILED, "Restore snapshot failed: " + job.Reason()};
+        }
+        p.finished_ = job.State() == RestoreSnapshotStateCode::COMPLETED
+                          ? 100
+                          : static_cast<uint32_t>(std::min(std::max(job.Progress(), 0), 99));
+        return Status::OK();
     };
-    return connection_.Invoke<proto::milvus::CreateIndexRequest, proto::common::Status>(
-        nullptr, pre, &MilvusConnection::CreateIndex, wait_for_status, nullptr);
 }
 
 Status
 MilvusClientV2Impl::getFlushState(const std::string& db_name, const std::vector<int64_t>& segments, uint64_t flush_ts,
-                                  bool& flushed) {
+                                  bool& flushed, uint64_t rpc_timeout_ms) {
     auto actual_db = connection_.CurrentDbName(db_name);
     auto pre = [&actual_db, &segments, flush_ts](proto::milvus::GetFlushStateRequest& rpc_request) {
         rpc_request.set_db_name(actual_db);
@@ -4033,29 +5135,264 @@ MilvusClientV2Impl::getFlushState(const std::string& db_name, const std::vector<
         return Status::OK();
     };
 
-    return connection_.Invoke<proto::milvus::GetFlushStateRequest, proto::milvus::GetFlushStateResponse>(
-        pre, &MilvusConnection::GetFlushState, post);
+    return connection_.InvokeWithRpcTimeout<proto::milvus::GetFlushStateRequest, proto::milvus::GetFlushStateResponse>(
+        rpc_timeout_ms, pre, &MilvusConnection::GetFlushState, post);
 }
 
 Status
 MilvusClientV2Impl::getCollectionDesc(const std::string& endpoint, const std::string& database_name,
                                       const std::string& collection_name, bool force_update,
                                       CollectionDescPtr& desc_ptr, uint64_t rpc_timeout_ms) {
+    StageTimer stage_timer(CallTiming::Stage::SCHEMA_LOOKUP);
     return SchemaCache::GetInstance().GetOrLoad(
         endpoint, database_name, collection_name, force_update, this,
-        [this, &database_name, &collection_name, rpc_timeout_ms](CollectionDescPtr& loaded) {
-            auto request =
-                DescribeCollectionRequest().WithDatabaseName(database_name).WithCollectionName(collection_name);
-            DescribeCollectionResponse response;
-            auto status = describeCollection(request, response, rpc_timeout_ms);
+        [this, &endpoint, &database_name, &collection_name, force_update, rpc_timeout_ms](CollectionDescPtr& loaded) {
+            // A schema from the persistent file is trusted until the server reports a schema mismatch: the
+            // insert path then invalidates it, which drops it from the file too, and the retry describes again.
+            auto schema_file = std::atomic_load(&schema_file_);
+            const auto file_key = CollectionCacheKey::Create(endpoint, database_name, collection_name);
+            if (!force_update && loadPersistedSchema(schema_file, file_key, loaded)) {
+                return Status::OK();
+            }
+
+            Status status;
+            if (rpc_timeout_ms == 0) {
+                // misses of concurrent calls share one BatchDescribeCollection call
+                status = schema_loader_.Load(database_name, collection_name, loaded);
+            } else {
+                auto request =
+                    DescribeCollectionRequest().WithDatabaseName(database_name).WithCollectionName(collection_name);
+                DescribeCollectionResponse response;
+                status = describeCollection(request, response, rpc_timeout_ms);
+                if (status.IsOk()) {
+                    loaded = std::make_shared<CollectionDesc>(response.Desc());
+                }
+            }
             if (status.IsOk()) {
-                loaded = std::make_shared<CollectionDesc>(response.Desc());
+                persistSchema(schema_file, file_key, loaded);
             }
             return status;
         },
         desc_ptr);
 }
 
+// Split the scan into disjoint shards, see the comment of ParallelScanRequest.
+Status
+MilvusClientV2Impl::buildScanShards(const ParallelScanRequest& request, const std::string& database_name,
+                                    std::vector<QueryIteratorRequest>& shards) {
+    const auto& pk_schema = request.PkSchema();
+    const auto& pk_name = pk_schema.Name();
+    const auto& user_filter = request.Filter();
+    auto add_shard = [&shards, &request, &user_filter](const std::string& condition) -> QueryIteratorRequest& {
+        shards.emplace_back(request);
+        auto& shard = shards.back();
+        if (!condition.empty()) {
+            shard.SetFilter(user_filter.empty() ? condition : "(" + user_filter + ") and (" + condition + ")");
+        }
+        return shard;
+    };
+
+    // boundaries are passed by filter templates, string values need no escaping
+    auto add_range_shards = [&pk_name, &shards, &add_shard](const nlohmann::json& values) {
+        static const std::string lower_key = "scan_shard_lower";
+        static const std::string upper_key = "scan_shard_upper";
+        shards.reserve(values.size() + 1);
+        for (size_t i = 0; i <= values.size(); ++i) {
+            std::string condition;
+            if (i > 0) {
+                condition = pk_name + " >= {" + lower_key + "}";
+            }
+            if (i < values.size()) {
+                condition += (condition.empty() ? "" : " and ") + pk_name + " < {" + upper_key + "}";
+            }
+            auto& shard = add_shard(condition);
+            if (i > 0) {
+                shard.AddFilterTemplate(lower_key, values[i - 1]);
+            }
+            if (i < values.size()) {
+                shard.AddFilterTemplate(upper_key, values[i]);
+            }
+        }
+    };
+
+    const auto& boundaries = request.PkBoundaries();
+    if (boundaries.GetRowCount() > 0) {
+        if (boundaries.IsIntegerID() != (pk_schema.FieldDataType() == DataType::INT64)) {
+            return {StatusCode::INVALID_ARGUMENT, "Primary key boundaries do not match the primary key type"};
+        }
+
+        nlohmann::json values;
+        if (boundaries.IsIntegerID()) {
+            values = boundaries.IntIDArray();
+        } else {
+            values = boundaries.StrIDArray();
+        }
+        for (size_t i = 1; i < values.size(); ++i) {
+            if (!(values[i - 1] < values[i])) {
+                return {StatusCode::INVALID_ARGUMENT, "Primary key boundaries must be strictly ascending"};
+            }
+        }
+        add_range_shards(values);
+        return Status::OK();
+    }
+
+    const auto shard_count = request.ShardCount();
+    if (shard_count > 1) {
+        if (pk_schema.FieldDataType() != DataType::INT64) {
+            return {StatusCode::INVALID_ARGUMENT,
+                    "Shard count requires an INT64 primary key, use primary key boundaries instead"};
+        }
+        shards.reserve(shard_count);
+        const auto modulo = pk_name + " % " + std::to_string(shard_count) + " == ";
+        for (size_t i = 0; i < shard_count; ++i) {
+            // the remainder keeps the sign of a negative key, such a key lands in the shard of remainder i - N
+            auto condition = modulo + std::to_string(i);
+            if (i > 0) {
+                const auto negative_remainder = static_cast<int64_t>(i) - static_cast<int64_t>(shard_count);
+                condition += " or " + modulo + std::to_string(negative_remainder);
+            }
+            add_shard(condition);
+        }
+        return Status::OK();
+    }
+
+    std::vector<std::string> partition_names(request.PartitionNames().begin(), request.PartitionNames().end());
+    if (partition_names.empty() && request.Concurrency() > 1 && pk_schema.FieldDataType() == DataType::INT64) {
+        std::vector<int64_t> values;
+        auto status = splitPkRange(request, database_name, pk_name, request.Concurrency(), values);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (!values.empty()) {
+            add_range_shards(values);
+            return Status::OK();
+        }
+    }
+    if (partition_names.empty()) {
+        ListPartitionsResponse response;
+        auto status = ListPartitions(
+            ListPartitionsRequest().WithDatabaseName(database_name).WithCollectionName(request.CollectionName()),
+            response);
+        if (!status.IsOk()) {
+            return status;
+        }
+        partition_names = response.PartitionsNames();
+    }
+    if (partition_names.empty()) {
+        add_shard("");
+        return Status::OK();
+    }
+
+    shards.reserve(partition_names.size());
+    for (const auto& name : partition_names) {
+        add_shard("").SetPartitionNames({name});
+    }
+    return Status::OK();
+}
+
+// Find up to count - 1 primary keys splitting the rows matched by the request into ranges of about the same size.
+// The smallest and largest keys come from two queries ordered by the primary key, then each split key is searched
+// between them with count(*) queries, alternating interpolation and bisection steps. A key is close enough once
+// its range is within a quarter of a shard of the ideal size. A collection smaller than one batch per shard, or a
+// server that cannot order a query, leaves boundaries empty.
+Status
+MilvusClientV2Impl::splitPkRange(const ParallelScanRequest& request, const std::string& database_name,
+                                 const std::string& pk_name, size_t count, std::vector<int64_t>& boundaries) {
+    const auto endpoint = connection_.CurrentEndpoint();
+    const auto& user_filter = request.Filter();
+    auto count_rows = [&](const std::string& condition, uint64_t& rows) {
+        QueryRequest count_request = request;
+        count_request.SetOutputFields({"count(*)"});
+        if (!condition.empty()) {
+            count_request.SetFilter(user_filter.empty() ? condition : "(" + user_filter + ") and (" + condition + ")");
+        }
+        QueryResponse response;
+        auto status = query(endpoint, database_name, count_request, response, "");
+        rows = response.Results().GetRowCount();
+        return status;
+    };
+    auto edge_key = [&](AggregationDirection direction, int64_t& key) {
+        QueryRequest edge_request = request;
+        edge_request.SetOutputFields({pk_name});
+        edge_request.SetLimit(1);
+        edge_request.SetOrderByFields({OrderByField(pk_name, direction)});
+        QueryResponse response;
+        auto status = query(endpoint, database_name, edge_request, response, "");
+        auto keys = response.Results().OutputField<Int64FieldData>(pk_name);
+        if (status.IsOk() && (keys == nullptr || keys->Count() == 0)) {
+            status = {StatusCode::UNKNOWN_ERROR, "No primary key returned"};
+        }
+        if (status.IsOk()) {
+            key = keys->Value(0);
+        }
+        return status;
+    };
+
+    uint64_t total = 0;
+    auto status = count_rows("", total);
+    if (!status.IsOk()) {
+        return status;
+    }
+    int64_t min_key = 0;
+    int64_t max_key = 0;
+    if (total < count * static_cast<uint64_t>(std::max<int64_t>(request.BatchSize(), 1)) ||
+        !edge_key(AggregationDirection::ASC, min_key).IsOk() || !edge_key(AggregationDirection::DESC, max_key).IsOk()) {
+        return Status::OK();
+    }
+
+    // a range [low, high) holds the rows below high minus the rows below low
+    const uint64_t tolerance = total / (4 * count);
+    int64_t low = min_key;
+    uint64_t low_rows = 0;
+    for (size_t i = 1; i < count && low < max_key; ++i) {
+        const uint64_t target = total / count * i;
+        int64_t high = max_key;
+        uint64_t high_rows = total - 1;
+        int64_t split = high;
+        uint64_t split_rows = high_rows;
+        for (int step = 0; step < 64; ++step) {
+            // the difference of two keys may not fit in int64_t
+            const auto width = static_cast<uint64_t>(high) - static_cast<uint64_t>(low);
+            if (width <= 1) {
+                break;
+            }
+            uint64_t offset = width / 2;
+            if (step % 2 == 0 && high_rows > low_rows && target > low_rows) {
+                const auto ratio =
+                    static_cast<long double>(target - low_rows) / static_cast<long double>(high_rows - low_rows);
+                offset = static_cast<uint64_t>(ratio * static_cast<long double>(width));
+            }
+            offset = std::min(std::max<uint64_t>(offset, 1), width);
+            const auto mid = static_cast<int64_t>(static_cast<uint64_t>(low) + offset);
+            uint64_t below = 0;
+            status = count_rows(pk_name + " < " + std::to_string(mid), below);
+            if (!status.IsOk()) {
+                return status;
+            }
+            if (below + tolerance >= target && below <= target + tolerance) {
+                split = mid;
+                split_rows = below;
+                break;
+            }
+            if (below < target) {
+                low = mid;
+                low_rows = below;
+            } else {
+                high = mid;
+                high_rows = below;
+                split = mid;
+                split_rows = below;
+            }
+        }
+        if (boundaries.empty() || split > boundaries.back()) {
+            boundaries.push_back(split);
+        }
+        low = split;
+        low_rows = split_rows;
+    }
+    return Status::OK();
+}
+
 template <typename RequestClass>
 Status
 MilvusClientV2Impl::iteratorPrepare(const std::string& endpoint, const std::string& database_name,
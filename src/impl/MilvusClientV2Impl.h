@@ -16,11 +16,22 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <future>
+#include <map>
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "milvus/MilvusClientV2.h"
 #include "utils/ConnectionHandler.h"
+#include "utils/StatusWaiter.h"
+#include "utils/cache/MetadataCache.h"
+#include "utils/cache/PersistentSchemaCache.h"
+#include "utils/cache/ResultCache.h"
+#include "utils/cache/SchemaBatchLoader.h"
 
 namespace milvus {
 
@@ -28,7 +39,7 @@ class MilvusClientV2SessionImpl;
 
 class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from_this<MilvusClientV2Impl> {
  public:
-    MilvusClientV2Impl() = default;
+    explicit MilvusClientV2Impl(ExecutorPtr executor = nullptr);
     ~MilvusClientV2Impl() override;
 
     Status
@@ -43,6 +54,30 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     SetRetryParam(const RetryParam& retry_param) final;
 
+    Status
+    SetTracer(const TracerPtr& tracer) final;
+
+    Status
+    SetResultCacheParam(const ResultCacheParam& param) final;
+
+    Status
+    GetResultCacheStats(ResultCacheStats& stats) final;
+
+    Status
+    SetMetadataCacheParam(const MetadataCacheParam& param) final;
+
+    Status
+    GetMetadataCacheStats(MetadataCacheStats& stats) final;
+
+    Status
+    GetExecutorStats(ExecutorStats& stats) final;
+
+    Status
+    GetAllocationStats(AllocationStats& stats) final;
+
+    Status
+    GetExecutor(ExecutorPtr& executor) final;
+
     Status
     GetServerVersion(std::string& version) final;
 
@@ -70,6 +105,9 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     LoadCollection(const LoadCollectionRequest& request) final;
 
+    Status
+    LoadCollectionAsync(const LoadCollectionRequest& request, std::future<Status>& done) final;
+
     Status
     RefreshLoad(const RefreshLoadRequest& request) final;
 
@@ -83,6 +121,9 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     BatchDescribeCollections(const BatchDescribeCollectionsRequest& request,
                              BatchDescribeCollectionsResponse& response) final;
 
+    Status
+    PrefetchSchemas(const std::string& db_name, const std::vector<std::string>& collection_names) final;
+
     Status
     DescribeReplicas(const DescribeReplicasRequest& request, DescribeReplicasResponse& response) final;
 
@@ -146,6 +187,9 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     LoadPartitions(const LoadPartitionsRequest& request) final;
 
+    Status
+    LoadPartitionsAsync(const LoadPartitionsRequest& request, std::future<Status>& done) final;
+
     Status
     ReleasePartitions(const ReleasePartitionsRequest& request) final;
 
@@ -197,6 +241,9 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     CreateIndex(const CreateIndexRequest& request) final;
 
+    Status
+    CreateIndexAsync(const CreateIndexRequest& request, std::future<Status>& done) final;
+
     Status
     DescribeIndex(const DescribeIndexRequest& request, DescribeIndexResponse& response) final;
 
@@ -215,36 +262,72 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     Insert(const InsertRequest& request, InsertResponse& response) final;
 
+    Status
+    InsertAsync(const InsertRequest& request, InsertResponse& response, AsyncDone done) final;
+
     Status
     Upsert(const UpsertRequest& request, UpsertResponse& response) final;
 
+    Status
+    UpsertAsync(const UpsertRequest& request, UpsertResponse& response, AsyncDone done) final;
+
     Status
     Delete(const DeleteRequest& request, DeleteResponse& response) final;
 
+    Status
+    DeleteAsync(const DeleteRequest& request, DeleteResponse& response, AsyncDone done) final;
+
     Status
     Search(const SearchRequest& request, SearchResponse& response) final;
 
+    Status
+    SearchAsync(const SearchRequest& request, SearchResponse& response, AsyncDone done) final;
+
+    Status
+    MultiSearch(const MultiSearchRequest& request, MultiSearchResponse& response) final;
+
+    Status
+    FederatedSearch(const FederatedSearchRequest& request, SearchResponse& response) final;
+
     Status
     SearchIterator(SearchIteratorRequest& request, SearchIteratorPtr& response) final;
 
     Status
     HybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response) final;
 
+    Status
+    HybridSearchAsync(const HybridSearchRequest& request, HybridSearchResponse& response, AsyncDone done) final;
+
     Status
     Query(const QueryRequest& request, QueryResponse& response) final;
 
+    Status
+    QueryAsync(const QueryRequest& request, QueryResponse& response, AsyncDone done) final;
+
     Status
     Get(const GetRequest& request, GetResponse& response) final;
 
+    Status
+    GetAsync(const GetRequest& request, GetResponse& response, AsyncDone done) final;
+
     Status
     QueryIterator(QueryIteratorRequest& request, QueryIteratorPtr& response) final;
 
+    Status
+    QueryStream(const QueryStreamRequest& request, const QueryStreamCallback& on_batch) final;
+
+    Status
+    ParallelScan(const ParallelScanRequest& request, const ParallelScanCallback& on_batch) final;
+
     Status
     RunAnalyzer(const RunAnalyzerRequest& request, RunAnalyzerResponse& response) final;
 
     Status
     Flush(const FlushRequest& request) final;
 
+    Status
+    FlushAsync(const FlushRequest& request, std::future<Status>& done) final;
+
     Status
     FlushAll(const FlushAllRequest& request, FlushAllResponse& response) final;
 
@@ -282,6 +365,9 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     Compact(const CompactRequest& request, CompactResponse& response) final;
 
+    Status
+    CompactAsync(const CompactRequest& request, CompactResponse& response, std::future<Status>& done) final;
+
     Status
     Optimize(const OptimizeRequest& request, OptimizeTaskPtr& task) final;
 
@@ -306,6 +392,10 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     Status
     RestoreSnapshot(const RestoreSnapshotRequest& request, RestoreSnapshotResponse& response) final;
 
+    Status
+    RestoreSnapshotAsync(const RestoreSnapshotRequest& request, RestoreSnapshotResponse& response,
+                         std::future<Status>& done) final;
+
     Status
     GetRestoreSnapshotState(const GetRestoreSnapshotStateRequest& request,
                             GetRestoreSnapshotStateResponse& response) final;
@@ -422,36 +512,62 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     friend class MilvusClientV2SessionImpl;
 
     Status
-    insert(const InsertRequest& request, InsertResponse& response, bool allow_retry);
+    insert(const InsertRequest& request, InsertResponse& response, bool allow_retry,
+           const MilvusConnection::AsyncDone& done = nullptr);
+
+    Status
+    upsert(const UpsertRequest& request, UpsertResponse& response, bool allow_retry,
+           const MilvusConnection::AsyncDone& done = nullptr);
+
+    // The done of an asynchronous insert or upsert, a SchemaMismatch error describes the collection again and
+    // calls retry once, as insert() and upsert() do for a blocking call.
+    MilvusConnection::AsyncDone
+    retryOnSchemaMismatch(const std::string& endpoint, const std::string& database_name,
+                          const std::string& collection_name, bool allow_retry, std::function<Status(void)> retry,
+                          MilvusConnection::AsyncDone done);
 
     Status
-    upsert(const UpsertRequest& request, UpsertResponse& response, bool allow_retry);
+    deleteEntities(const DeleteRequest& request, DeleteResponse& response,
+                   const MilvusConnection::AsyncDone& done = nullptr);
 
+    // With done set, the calls below return once the rpc is sent and call done when it completes.
     Status
-    search(const SearchRequest& request, SearchResponse& response, const std::string& cluster_id);
+    search(const SearchRequest& request, SearchResponse& response, const std::string& cluster_id,
+           uint64_t rpc_timeout_ms = 0, const MilvusConnection::AsyncDone& done = nullptr);
 
     Status
     searchIterator(SearchIteratorRequest& request, SearchIteratorPtr& iterator, const std::string& cluster_id);
 
     Status
-    hybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response, const std::string& cluster_id);
+    hybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response, const std::string& cluster_id,
+                 const MilvusConnection::AsyncDone& done = nullptr);
 
     Status
     query(const std::string& endpoint, const std::string& database_name, const QueryRequest& request,
-          QueryResponse& response, const std::string& cluster_id);
+          QueryResponse& response, const std::string& cluster_id, const MilvusConnection::AsyncDone& done = nullptr);
 
     Status
-    get(const GetRequest& request, GetResponse& response, const std::string& cluster_id);
+    get(const GetRequest& request, GetResponse& response, const std::string& cluster_id,
+        const MilvusConnection::AsyncDone& done = nullptr);
 
     Status
     queryIterator(QueryIteratorRequest& request, QueryIteratorPtr& iterator, const std::string& cluster_id);
 
+    Status
+    buildScanShards(const ParallelScanRequest& request, const std::string& database_name,
+                    std::vector<QueryIteratorRequest>& shards);
+
+    Status
+    splitPkRange(const ParallelScanRequest& request, const std::string& database_name, const std::string& pk_name,
+                 size_t count, std::vector<int64_t>& boundaries);
+
     Status
     createIndex(const std::string& db_name, const std::string& collection_name, const IndexDesc& desc, bool sync,
                 int64_t timeout_ms);
 
     Status
-    getFlushState(const std::string& db_name, const std::vector<int64_t>& segments, uint64_t flush_ts, bool& flushed);
+    getFlushState(const std::string& db_name, const std::vector<int64_t>& segments, uint64_t flush_ts, bool& flushed,
+                  uint64_t rpc_timeout_ms = 0);
 
     Status
     getFlushAllState(const GetFlushAllStateRequest& request, GetFlushAllStateResponse& response,
@@ -461,11 +577,26 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
     describeCollection(const DescribeCollectionRequest& request, DescribeCollectionResponse& response,
                        uint64_t rpc_timeout_ms = 0);
 
+    // Describe collections of one database with one BatchDescribeCollection call, a status per collection.
     Status
-    describeIndex(const DescribeIndexRequest& request, DescribeIndexResponse& response, uint64_t rpc_timeout_ms = 0);
+    describeCollections(const std::string& database_name, const std::vector<std::string>& collection_names,
+                        std::vector<Status>& statuses, std::vector<CollectionDescPtr>& descs);
+
+    bool
+    loadPersistedSchema(const PersistentSchemaCachePtr& schema_file, const CollectionCacheKey& key,
+                        CollectionDescPtr& desc);
+
+    void
+    persistSchema(const PersistentSchemaCachePtr& schema_file, const CollectionCacheKey& key,
+                  const CollectionDescPtr& desc);
 
     Status
-    listIndexes(const ListIndexesRequest& request, ListIndexesResponse& response, uint64_t rpc_timeout_ms = 0);
+    describeIndex(const DescribeIndexRequest& request, DescribeIndexResponse& response, uint64_t rpc_timeout_ms = 0,
+                  bool use_cache = false);
+
+    Status
+    listIndexes(const ListIndexesRequest& request, ListIndexesResponse& response, uint64_t rpc_timeout_ms = 0,
+                bool use_cache = false);
 
     Status
     compact(const std::string& database_name, const CompactRequest& request, CompactResponse& response,
@@ -476,17 +607,71 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
                        uint64_t rpc_timeout_ms = 0);
 
     Status
-    getLoadState(const GetLoadStateRequest& request, GetLoadStateResponse& response, uint64_t rpc_timeout_ms = 0);
+    getRestoreSnapshotState(const GetRestoreSnapshotStateRequest& request, GetRestoreSnapshotStateResponse& response,
+                            uint64_t rpc_timeout_ms = 0);
+
+    Status
+    getLoadState(const GetLoadStateRequest& request, GetLoadStateResponse& response, uint64_t rpc_timeout_ms = 0,
+                 bool use_cache = false);
+
+    // Drop the cached index, partition and load state lookups of a collection after this client changed it,
+    // an empty collection name drops every collection of the database.
+    void
+    invalidateMetadata(const std::string& db_name, const std::string& collection_name);
 
     Status
     refreshLoad(const RefreshLoadRequest& request, uint64_t rpc_timeout_ms = 0);
 
+    // Block until the query reports done through the shared StatusWaiter, the query may capture the caller's
+    // locals since it is never called again once this returns. The progress callback runs on this thread.
+    Status
+    waitForStatus(StatusWaiter::QueryFunction query, const ProgressMonitor& progress_monitor, uint32_t settle_ms = 0);
+
+    // The queries below own their inputs, so they can outlive the call that submits them.
+    StatusWaiter::QueryFunction
+    loadingQuery(const std::string& db_name, const std::string& collection_name,
+                 std::set<std::string> partition_names, bool refresh, uint64_t rpc_timeout_ms = 0);
+
+    StatusWaiter::QueryFunction
+    indexQuery(const std::string& db_name, const std::string& collection_name, const std::string& field_name);
+
+    StatusWaiter::QueryFunction
+    flushQuery(const std::string& db_name, std::map<std::string, std::vector<int64_t>> flush_segments,
+               std::map<std::string, uint64_t> flush_tss);
+
+    StatusWaiter::QueryFunction
+    flushAllQuery(const std::string& db_name, uint64_t flush_all_ts);
+
+    StatusWaiter::QueryFunction
+    compactionQuery(int64_t compaction_id);
+
+    StatusWaiter::QueryFunction
+    restoreSnapshotQuery(int64_t job_id);
+
     Status
     getCollectionDesc(const std::string& endpoint, const std::string& database_name, const std::string& collection_name,
                       bool force_update, CollectionDescPtr& desc_ptr, uint64_t rpc_timeout_ms = 0);
 
+    // The state of one Optimize() between the polls that drive it.
+    struct OptimizeRun {
+        enum class Stage { INITIALIZE, INDEXES_BEFORE, COMPACT, COMPACTION, INDEXES_AFTER, LOAD_STATE, REFRESH, DONE };
+
+        OptimizeRequest request_;
+        std::chrono::steady_clock::time_point start_;
+        OptimizeTaskPtr task_;
+        OptimizeResponse response_;
+        Stage stage_{Stage::INITIALIZE};
+        std::string database_name_;
+        int64_t target_size_mb_{0};
+        std::vector<IndexDesc> vector_indexes_;
+    };
+
+    // Run the stages of an Optimize() until one has to wait for the server, the progress is done after the last.
+    Status
+    optimizeStep(OptimizeRun& run, Progress& progress, uint64_t poll_timeout_ms);
+
     Status
-    runOptimize(const OptimizeRequest& request, OptimizeTask& task, OptimizeResponse& response);
+    finishOptimize(OptimizeRun& run, const Status& status);
 
     template <typename RequestClass>
     Status
@@ -495,6 +680,16 @@ class MilvusClientV2Impl : public MilvusClientV2, public std::enable_shared_from
 
  private:
     ConnectionHandler connection_;
+    ResultCache result_cache_;
+    MetadataCache metadata_cache_;
+    // set between Connect() and Disconnect() when ConnectParam::SchemaCacheFile() is given,
+    // accessed with std::atomic_load/atomic_store since schema loads run on caller threads
+    PersistentSchemaCachePtr schema_file_;
+    SchemaBatchLoader schema_loader_;
+    // taken in the constructor, so the shared waiter outlives a client held in a static
+    StatusWaiter& waiter_;
+    // runs asynchronous Optimize() tasks and coroutine calls, Executor::Default() unless one is given to Create()
+    ExecutorPtr executor_;
 };
 
 }  // namespace milvus
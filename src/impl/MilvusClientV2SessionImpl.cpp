@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "MilvusClientV2Impl.h"
+#include "utils/CallTimer.h"
 
 namespace milvus {
 
@@ -35,7 +36,11 @@ Status
 MilvusClientV2SessionImpl::Search(const SearchRequest& request, SearchResponse& response) {
     std::shared_ptr<MilvusClientV2Impl> parent;
     auto status = getParent(parent);
-    return status.IsOk() ? parent->search(request, response, cluster_id_) : status;
+    if (!status.IsOk()) {
+        return status;
+    }
+    CallTimer call_timer(parent->connection_.CallTimingEnabled(), response);
+    return parent->search(request, response, cluster_id_);
 }
 
 Status
@@ -53,7 +58,11 @@ Status
 MilvusClientV2SessionImpl::HybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response) {
     std::shared_ptr<MilvusClientV2Impl> parent;
     auto status = getParent(parent);
-    return status.IsOk() ? parent->hybridSearch(request, response, cluster_id_) : status;
+    if (!status.IsOk()) {
+        return status;
+    }
+    CallTimer call_timer(parent->connection_.CallTimingEnabled(), response);
+    return parent->hybridSearch(request, response, cluster_id_);
 }
 
 Status
@@ -63,6 +72,7 @@ MilvusClientV2SessionImpl::Query(const QueryRequest& request, QueryResponse& res
     if (!status.IsOk()) {
         return status;
     }
+    CallTimer call_timer(parent->connection_.CallTimingEnabled(), response);
     const auto endpoint = parent->connection_.CurrentEndpoint();
     const auto database_name = parent->connection_.CurrentDbName(request.DatabaseName());
     return parent->query(endpoint, database_name, request, response, cluster_id_);
@@ -72,7 +82,11 @@ Status
 MilvusClientV2SessionImpl::Get(const GetRequest& request, GetResponse& response) {
     std::shared_ptr<MilvusClientV2Impl> parent;
     auto status = getParent(parent);
-    return status.IsOk() ? parent->get(request, response, cluster_id_) : status;
+    if (!status.IsOk()) {
+        return status;
+    }
+    CallTimer call_timer(parent->connection_.CallTimingEnabled(), response);
+    return parent->get(request, response, cluster_id_);
 }
 
 Status
@@ -20,6 +20,7 @@
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <utility>
 
 #include "MilvusInterceptor.h"
 #include "grpcpp/security/credentials.h"
@@ -102,6 +103,25 @@ MilvusConnection::StatusCodeFromGrpcStatus(const ::grpc::Status& grpc_status) {
     return Status{code, grpc_status.error_message(), grpc_status.error_code(), 0, 0};
 }
 
+void
+MilvusConnection::setContextOptions(::grpc::ClientContext& context, const GrpcContextOptions& options) {
+    if (options.timeout > 0) {
+        auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds{options.timeout};
+        context.set_deadline(deadline);
+    }
+    if (options.headers != nullptr) {
+        for (const auto& header : *options.headers) {
+            context.AddMetadata(header.first, header.second);
+        }
+    }
+}
+
+std::shared_ptr<proto::milvus::MilvusService::Stub>
+MilvusConnection::currentStub() {
+    std::lock_guard<std::mutex> lock(stub_mtx_);
+    return stub_;
+}
+
 Status
 MilvusConnection::Connect(const ConnectParam& param) {
     std::shared_ptr<grpc::Channel> channel;
@@ -551,6 +571,43 @@ MilvusConnection::Query(const proto::milvus::QueryRequest& request, proto::milvu
     return grpcCall("Query", &Stub::Query, request, response, options);
 }
 
+void
+MilvusConnection::InsertAsync(const proto::milvus::InsertRequest& request, proto::milvus::MutationResult& response,
+                              const GrpcContextOptions& options, AsyncDone done) {
+    grpcAsyncCall(&Stub::async::Insert, request, response, options, std::move(done));
+}
+
+void
+MilvusConnection::UpsertAsync(const proto::milvus::UpsertRequest& request, proto::milvus::MutationResult& response,
+                              const GrpcContextOptions& options, AsyncDone done) {
+    grpcAsyncCall(&Stub::async::Upsert, request, response, options, std::move(done));
+}
+
+void
+MilvusConnection::DeleteAsync(const proto::milvus::DeleteRequest& request, proto::milvus::MutationResult& response,
+                              const GrpcContextOptions& options, AsyncDone done) {
+    grpcAsyncCall(&Stub::async::Delete, request, response, options, std::move(done));
+}
+
+void
+MilvusConnection::SearchAsync(const proto::milvus::SearchRequest& request, proto::milvus::SearchResults& response,
+                              const GrpcContextOptions& options, AsyncDone done) {
+    grpcAsyncCall(&Stub::async::Search, request, response, options, std::move(done));
+}
+
+void
+MilvusConnection::HybridSearchAsync(const proto::milvus::HybridSearchRequest& request,
+                                    proto::milvus::SearchResults& response, const GrpcContextOptions& options,
+                                    AsyncDone done) {
+    grpcAsyncCall(&Stub::async::HybridSearch, request, response, options, std::move(done));
+}
+
+void
+MilvusConnection::QueryAsync(const proto::milvus::QueryRequest& request, proto::milvus::QueryResults& response,
+                             const GrpcContextOptions& options, AsyncDone done) {
+    grpcAsyncCall(&Stub::async::Query, request, response, options, std::move(done));
+}
+
 Status
 MilvusConnection::RunAnalyzer(const proto::milvus::RunAnalyzerRequest& request,
                               proto::milvus::RunAnalyzerResponse& response, const GrpcContextOptions& options) {
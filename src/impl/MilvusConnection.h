@@ -27,6 +27,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "common.pb.h"
 #include "milvus.grpc.pb.h"
@@ -45,13 +46,21 @@ class MilvusConnection {
     struct GrpcContextOptions {
         /** timeout in milliseconds */
         uint64_t timeout{0};
+        /** metadata added to this call only, sent along with the headers of the channel interceptor */
+        const std::unordered_map<std::string, std::string>* headers{nullptr};
 
         // constructors
         GrpcContextOptions() = default;
         explicit GrpcContextOptions(uint64_t timeout_) : timeout{timeout_} {
         }
+        GrpcContextOptions(uint64_t timeout_, const std::unordered_map<std::string, std::string>* headers_)
+            : timeout{timeout_}, headers{headers_} {
+        }
     };
 
+    // Receives the final status of an asynchronous call, on the grpc thread that completed it.
+    using AsyncDone = std::function<void(const Status&)>;
+
     MilvusConnection() = default;
 
     virtual ~MilvusConnection();
@@ -284,6 +293,32 @@ class MilvusConnection {
     Query(const proto::milvus::QueryRequest& request, proto::milvus::QueryResults& response,
           const GrpcContextOptions& options);
 
+    // The asynchronous calls below are issued on the callback stub and return at once, request and response must
+    // outlive done. A call that cannot be issued calls done before returning.
+    void
+    InsertAsync(const proto::milvus::InsertRequest& request, proto::milvus::MutationResult& response,
+                const GrpcContextOptions& options, AsyncDone done);
+
+    void
+    UpsertAsync(const proto::milvus::UpsertRequest& request, proto::milvus::MutationResult& response,
+                const GrpcContextOptions& options, AsyncDone done);
+
+    void
+    DeleteAsync(const proto::milvus::DeleteRequest& request, proto::milvus::MutationResult& response,
+                const GrpcContextOptions& options, AsyncDone done);
+
+    void
+    SearchAsync(const proto::milvus::SearchRequest& request, proto::milvus::SearchResults& response,
+                const GrpcContextOptions& options, AsyncDone done);
+
+    void
+    HybridSearchAsync(const proto::milvus::HybridSearchRequest& request, proto::milvus::SearchResults& response,
+                      const GrpcContextOptions& options, AsyncDone done);
+
+    void
+    QueryAsync(const proto::milvus::QueryRequest& request, proto::milvus::QueryResults& response,
+               const GrpcContextOptions& options, AsyncDone done);
+
     Status
     RunAnalyzer(const proto::milvus::RunAnalyzerRequest& request, proto::milvus::RunAnalyzerResponse& response,
                 const GrpcContextOptions& options);
@@ -524,25 +559,24 @@ class MilvusConnection {
     static Status
     StatusCodeFromGrpcStatus(const ::grpc::Status& grpc_status);
 
+    static void
+    setContextOptions(::grpc::ClientContext& context, const GrpcContextOptions& options);
+
+    std::shared_ptr<proto::milvus::MilvusService::Stub>
+    currentStub();
+
     template <typename Request, typename Response>
     Status
     grpcCall(const char* name,
              grpc::Status (proto::milvus::MilvusService::Stub::*func)(grpc::ClientContext*, const Request&, Response*),
              const Request& request, Response& response, const GrpcContextOptions& options) {
-        std::shared_ptr<proto::milvus::MilvusService::Stub> stub;
-        {
-            std::lock_guard<std::mutex> lock(stub_mtx_);
-            stub = stub_;
-        }
+        auto stub = currentStub();
         if (stub == nullptr) {
             return {StatusCode::NOT_CONNECTED, "Connection is not ready!"};
         }
 
         ::grpc::ClientContext context;
-        if (options.timeout > 0) {
-            auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds{options.timeout};
-            context.set_deadline(deadline);
-        }
+        setContextOptions(context, options);
 
         ::grpc::Status grpc_status = (stub.get()->*func)(&context, request, &response);
 
@@ -564,6 +598,33 @@ class MilvusConnection {
         //   or response.status()code() == 8 can be retried
         return StatusByProtoResponse(response);
     }
+
+    // The grpc status and the response status are checked as grpcCall() does, once the call completes.
+    template <typename Request, typename Response>
+    void
+    grpcAsyncCall(void (proto::milvus::MilvusService::Stub::async::*func)(grpc::ClientContext*, const Request*,
+                                                                         Response*, std::function<void(grpc::Status)>),
+                  const Request& request, Response& response, const GrpcContextOptions& options, AsyncDone done) {
+        auto stub = currentStub();
+        if (stub == nullptr) {
+            done(Status{StatusCode::NOT_CONNECTED, "Connection is not ready!"});
+            return;
+        }
+
+        // the context must live until the call completes, the stub is kept for the same reason
+        auto context = std::make_shared<::grpc::ClientContext>();
+        setContextOptions(*context, options);
+
+        auto* response_ptr = &response;
+        (stub->async()->*func)(context.get(), &request, response_ptr,
+                               [stub, context, response_ptr, done](const ::grpc::Status& grpc_status) {
+                                   if (!grpc_status.ok()) {
+                                       done(StatusCodeFromGrpcStatus(grpc_status));
+                                       return;
+                                   }
+                                   done(StatusByProtoResponse(*response_ptr));
+                               });
+    }
 };
 
 using GrpcOpts = MilvusConnection::GrpcContextOptions;
@@ -18,6 +18,8 @@
 
 #include <memory>
 
+#include "../../utils/MemoryUtils.h"
+
 namespace milvus {
 
 const std::string&
@@ -43,13 +45,27 @@ DeleteRequest::FilterTemplates() const {
 
 DeleteRequest&
 DeleteRequest::AddFilterTemplate(std::string key, nlohmann::json&& filter_template) {
+    typed_filter_templates_.erase(key);
     filter_templates_[std::move(key)] = std::move(filter_template);
     return *this;
 }
 
+DeleteRequest&
+DeleteRequest::AddFilterTemplate(std::string key, FilterTemplateArray filter_template) {
+    filter_templates_.erase(key);
+    typed_filter_templates_[std::move(key)] = std::move(filter_template);
+    return *this;
+}
+
+const std::unordered_map<std::string, FilterTemplateArray>&
+DeleteRequest::TypedFilterTemplates() const {
+    return typed_filter_templates_;
+}
+
 void
 DeleteRequest::SetFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates) {
     filter_templates_ = std::move(filter_templates);
+    typed_filter_templates_.clear();
 }
 
 DeleteRequest&
@@ -85,4 +101,27 @@ DeleteRequest::WithIDs(std::vector<std::string>&& id_array) {
     return *this;
 }
 
+IDsEncoding
+DeleteRequest::GetIDsEncoding() const {
+    return ids_encoding_;
+}
+
+void
+DeleteRequest::SetIDsEncoding(IDsEncoding encoding) {
+    ids_encoding_ = encoding;
+}
+
+DeleteRequest&
+DeleteRequest::WithIDsEncoding(IDsEncoding encoding) {
+    SetIDsEncoding(encoding);
+    return *this;
+}
+
+size_t
+DeleteRequest::MemoryUsage() const {
+    return sizeof(DeleteRequest) + HeapBytes(DatabaseName()) + HeapBytes(CollectionName()) +
+           HeapBytes(PartitionName()) + HeapBytes(filter_) + HeapBytes(filter_templates_) +
+           HeapBytes(typed_filter_templates_) + HeapBytes(ids_);
+}
+
 }  // namespace milvus
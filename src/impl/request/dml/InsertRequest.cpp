@@ -17,6 +17,9 @@
 #include "milvus/request/dml/InsertRequest.h"
 
 #include <memory>
+#include <unordered_set>
+
+#include "../../utils/MemoryUtils.h"
 
 namespace milvus {
 
@@ -64,4 +67,11 @@ InsertRequest::AddRowData(EntityRow&& row_data) {
     return *this;
 }
 
+size_t
+InsertRequest::MemoryUsage() const {
+    std::unordered_set<const Field*> seen;
+    return sizeof(InsertRequest) + HeapBytes(DatabaseName()) + HeapBytes(CollectionName()) +
+           HeapBytes(PartitionName()) + FieldsMemoryUsage(columns_data_, seen) + HeapBytes(rows_data_);
+}
+
 }  // namespace milvus
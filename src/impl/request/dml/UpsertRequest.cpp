@@ -18,6 +18,8 @@
 
 #include <memory>
 
+#include "../../utils/MemoryUtils.h"
+
 namespace milvus {
 
 UpsertRequest&
@@ -105,4 +107,9 @@ UpsertRequest::AddFieldOp(FieldPartialUpdateOp field_op) {
     return *this;
 }
 
+size_t
+UpsertRequest::MemoryUsage() const {
+    return InsertRequest::MemoryUsage() - sizeof(InsertRequest) + sizeof(UpsertRequest) + HeapBytes(field_ops_);
+}
+
 }  // namespace milvus
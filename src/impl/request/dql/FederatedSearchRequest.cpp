@@ -0,0 +1,79 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/request/dql/FederatedSearchRequest.h"
+
+#include <utility>
+
+namespace milvus {
+
+const SearchRequest&
+FederatedSearchRequest::Request() const {
+    return request_;
+}
+
+void
+FederatedSearchRequest::SetRequest(SearchRequest request) {
+    request_ = std::move(request);
+}
+
+FederatedSearchRequest&
+FederatedSearchRequest::WithRequest(SearchRequest request) {
+    SetRequest(std::move(request));
+    return *this;
+}
+
+const std::vector<std::string>&
+FederatedSearchRequest::CollectionNames() const {
+    return collection_names_;
+}
+
+void
+FederatedSearchRequest::SetCollectionNames(std::vector<std::string>&& collection_names) {
+    collection_names_ = std::move(collection_names);
+}
+
+FederatedSearchRequest&
+FederatedSearchRequest::WithCollectionNames(std::vector<std::string>&& collection_names) {
+    SetCollectionNames(std::move(collection_names));
+    return *this;
+}
+
+FederatedSearchRequest&
+FederatedSearchRequest::AddCollectionName(const std::string& collection_name) {
+    collection_names_.push_back(collection_name);
+    return *this;
+}
+
+size_t
+FederatedSearchRequest::Concurrency() const {
+    return concurrency_;
+}
+
+void
+FederatedSearchRequest::SetConcurrency(size_t concurrency) {
+    if (concurrency > 0) {
+        concurrency_ = concurrency;
+    }
+}
+
+FederatedSearchRequest&
+FederatedSearchRequest::WithConcurrency(size_t concurrency) {
+    SetConcurrency(concurrency);
+    return *this;
+}
+
+}  // namespace milvus
@@ -18,6 +18,8 @@
 
 #include <memory>
 
+#include "../../utils/MemoryUtils.h"
+
 namespace milvus {
 
 const IDArray&
@@ -47,4 +49,26 @@ GetRequest::WithIDs(std::vector<std::string>&& id_array) {
     return *this;
 }
 
+IDsEncoding
+GetRequest::GetIDsEncoding() const {
+    return ids_encoding_;
+}
+
+void
+GetRequest::SetIDsEncoding(IDsEncoding encoding) {
+    ids_encoding_ = encoding;
+}
+
+GetRequest&
+GetRequest::WithIDsEncoding(IDsEncoding encoding) {
+    SetIDsEncoding(encoding);
+    return *this;
+}
+
+size_t
+GetRequest::MemoryUsage() const {
+    return sizeof(GetRequest) + HeapBytes(DatabaseName()) + HeapBytes(CollectionName()) +
+           HeapBytes(PartitionNames()) + HeapBytes(OutputFields()) + HeapBytes(ids_);
+}
+
 }  // namespace milvus
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "../../utils/ExtraParamUtils.h"
+#include "../../utils/MemoryUtils.h"
 
 namespace milvus {
 
@@ -185,4 +186,17 @@ HybridSearchRequest::WithStrictGroupSize(bool strict_group_size) {
     return *this;
 }
 
+size_t
+HybridSearchRequest::MemoryUsage() const {
+    size_t bytes = sizeof(HybridSearchRequest) + HeapBytes(DatabaseName()) + HeapBytes(CollectionName()) +
+                   HeapBytes(PartitionNames()) + HeapBytes(OutputFields()) + HeapBytes(extra_params_) +
+                   sub_requests_.capacity() * sizeof(SubSearchRequestPtr);
+    for (const auto& sub_request : sub_requests_) {
+        if (sub_request != nullptr) {
+            bytes += sub_request->MemoryUsage();
+        }
+    }
+    return bytes;
+}
+
 }  // namespace milvus
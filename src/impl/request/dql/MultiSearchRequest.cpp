@@ -0,0 +1,101 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/request/dql/MultiSearchRequest.h"
+
+#include <utility>
+
+namespace milvus {
+
+const std::vector<SearchRequest>&
+MultiSearchRequest::Requests() const {
+    return requests_;
+}
+
+void
+MultiSearchRequest::SetRequests(std::vector<SearchRequest>&& requests) {
+    requests_ = std::move(requests);
+}
+
+MultiSearchRequest&
+MultiSearchRequest::WithRequests(std::vector<SearchRequest>&& requests) {
+    SetRequests(std::move(requests));
+    return *this;
+}
+
+MultiSearchRequest&
+MultiSearchRequest::AddRequest(SearchRequest&& request) {
+    requests_.emplace_back(std::move(request));
+    return *this;
+}
+
+MultiSearchRequest&
+MultiSearchRequest::AddRequest(const SearchRequest& request) {
+    requests_.push_back(request);
+    return *this;
+}
+
+size_t
+MultiSearchRequest::Concurrency() const {
+    return concurrency_;
+}
+
+void
+MultiSearchRequest::SetConcurrency(size_t concurrency) {
+    if (concurrency > 0) {
+        concurrency_ = concurrency;
+    }
+}
+
+MultiSearchRequest&
+MultiSearchRequest::WithConcurrency(size_t concurrency) {
+    SetConcurrency(concurrency);
+    return *this;
+}
+
+bool
+MultiSearchRequest::StopOnError() const {
+    return stop_on_error_;
+}
+
+void
+MultiSearchRequest::SetStopOnError(bool stop_on_error) {
+    stop_on_error_ = stop_on_error;
+}
+
+MultiSearchRequest&
+MultiSearchRequest::WithStopOnError(bool stop_on_error) {
+    SetStopOnError(stop_on_error);
+    return *this;
+}
+
+uint64_t
+MultiSearchRequest::TimeoutMs() const {
+    return timeout_ms_;
+}
+
+void
+MultiSearchRequest::SetTimeoutMs(uint64_t timeout_ms) {
+    timeout_ms_ = timeout_ms;
+}
+
+MultiSearchRequest&
+MultiSearchRequest::WithTimeoutMs(uint64_t timeout_ms) {
+    SetTimeoutMs(timeout_ms);
+    return *this;
+}
+
+}  // namespace milvus
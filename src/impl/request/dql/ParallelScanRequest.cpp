@@ -0,0 +1,73 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/request/dql/ParallelScanRequest.h"
+
+#include <utility>
+
+namespace milvus {
+
+size_t
+ParallelScanRequest::Concurrency() const {
+    return concurrency_;
+}
+
+void
+ParallelScanRequest::SetConcurrency(size_t concurrency) {
+    if (concurrency > 0) {
+        concurrency_ = concurrency;
+    }
+}
+
+ParallelScanRequest&
+ParallelScanRequest::WithConcurrency(size_t concurrency) {
+    SetConcurrency(concurrency);
+    return *this;
+}
+
+size_t
+ParallelScanRequest::ShardCount() const {
+    return shard_count_;
+}
+
+void
+ParallelScanRequest::SetShardCount(size_t shard_count) {
+    shard_count_ = shard_count;
+}
+
+ParallelScanRequest&
+ParallelScanRequest::WithShardCount(size_t shard_count) {
+    SetShardCount(shard_count);
+    return *this;
+}
+
+const IDArray&
+ParallelScanRequest::PkBoundaries() const {
+    return pk_boundaries_;
+}
+
+void
+ParallelScanRequest::SetPkBoundaries(IDArray boundaries) {
+    pk_boundaries_ = std::move(boundaries);
+}
+
+ParallelScanRequest&
+ParallelScanRequest::WithPkBoundaries(IDArray boundaries) {
+    SetPkBoundaries(std::move(boundaries));
+    return *this;
+}
+
+}  // namespace milvus
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "../../utils/ExtraParamUtils.h"
+#include "../../utils/MemoryUtils.h"
 
 namespace milvus {
 
@@ -49,6 +50,22 @@ QueryRequest::WithIDs(std::vector<std::string>&& id_array) {
     return *this;
 }
 
+IDsEncoding
+QueryRequest::GetIDsEncoding() const {
+    return ids_encoding_;
+}
+
+void
+QueryRequest::SetIDsEncoding(IDsEncoding encoding) {
+    ids_encoding_ = encoding;
+}
+
+QueryRequest&
+QueryRequest::WithIDsEncoding(IDsEncoding encoding) {
+    SetIDsEncoding(encoding);
+    return *this;
+}
+
 const std::string&
 QueryRequest::Filter() const {
     return filter_;
@@ -73,14 +90,28 @@ QueryRequest::FilterTemplates() const {
 void
 QueryRequest::SetFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates) {
     filter_templates_ = std::move(filter_templates);
+    typed_filter_templates_.clear();
 }
 
 QueryRequest&
 QueryRequest::AddFilterTemplate(std::string key, const nlohmann::json& filter_template) {
-    filter_templates_.emplace(std::move(key), filter_template);
+    typed_filter_templates_.erase(key);
+    filter_templates_[std::move(key)] = filter_template;
     return *this;
 }
 
+QueryRequest&
+QueryRequest::AddFilterTemplate(std::string key, FilterTemplateArray filter_template) {
+    filter_templates_.erase(key);
+    typed_filter_templates_[std::move(key)] = std::move(filter_template);
+    return *this;
+}
+
+const std::unordered_map<std::string, FilterTemplateArray>&
+QueryRequest::TypedFilterTemplates() const {
+    return typed_filter_templates_;
+}
+
 QueryRequest&
 QueryRequest::WithFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates) {
     SetFilterTemplates(std::move(filter_templates));
@@ -186,4 +217,12 @@ QueryRequest::AddOrderByField(OrderByField order_by_field) {
     return *this;
 }
 
+size_t
+QueryRequest::MemoryUsage() const {
+    return sizeof(QueryRequest) + HeapBytes(DatabaseName()) + HeapBytes(CollectionName()) +
+           HeapBytes(PartitionNames()) + HeapBytes(OutputFields()) + HeapBytes(ids_) + HeapBytes(filter_) +
+           HeapBytes(filter_templates_) + HeapBytes(typed_filter_templates_) + HeapBytes(extra_params_) +
+           HeapBytes(order_by_fields_);
+}
+
 }  // namespace milvus
@@ -20,6 +20,7 @@
 
 #include "../../utils/Constants.h"
 #include "../../utils/ExtraParamUtils.h"
+#include "../../utils/MemoryUtils.h"
 
 namespace milvus {
 
@@ -94,6 +95,12 @@ SearchRequest::AddFilterTemplate(std::string key, const nlohmann::json& filter_t
     return *this;
 }
 
+SearchRequest&
+SearchRequest::AddFilterTemplate(std::string key, FilterTemplateArray filter_template) {
+    SearchRequestBase::AddFilterTemplate(std::move(key), std::move(filter_template));
+    return *this;
+}
+
 SearchRequest&
 SearchRequest::WithFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates) {
     SetFilterTemplates(std::move(filter_templates));
@@ -305,4 +312,12 @@ SearchRequest::Validate() const {
     return search_aggregation_->Validate();
 }
 
+size_t
+SearchRequest::MemoryUsage() const {
+    // the ranker, highlighter and aggregation are shared settings, only the pointers are counted
+    return SearchRequestBase::MemoryUsage() - sizeof(SearchRequestBase) + sizeof(SearchRequest) +
+           HeapBytes(DatabaseName()) + HeapBytes(CollectionName()) + HeapBytes(PartitionNames()) +
+           HeapBytes(OutputFields()) + HeapBytes(ids_) + HeapBytes(order_by_fields_);
+}
+
 }  // namespace milvus
@@ -0,0 +1,59 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/response/dql/MultiSearchResponse.h"
+
+#include <utility>
+
+namespace milvus {
+
+const std::vector<Status>&
+MultiSearchResponse::Statuses() const {
+    return statuses_;
+}
+
+void
+MultiSearchResponse::SetStatuses(std::vector<Status>&& statuses) {
+    statuses_ = std::move(statuses);
+}
+
+const std::vector<SearchResponse>&
+MultiSearchResponse::Responses() const {
+    return responses_;
+}
+
+std::vector<SearchResponse>&
+MultiSearchResponse::Responses() {
+    return responses_;
+}
+
+void
+MultiSearchResponse::SetResponses(std::vector<SearchResponse>&& responses) {
+    responses_ = std::move(responses);
+}
+
+size_t
+MultiSearchResponse::FailedCount() const {
+    size_t count = 0;
+    for (const auto& status : statuses_) {
+        if (!status.IsOk()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+}  // namespace milvus
@@ -0,0 +1,72 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/AllocationStats.h"
+
+#include <utility>
+
+namespace milvus {
+
+ApiAllocationStats::ApiAllocationStats(std::string api, uint64_t calls, uint64_t total_bytes, uint64_t max_bytes)
+    : api_(std::move(api)), calls_(calls), total_bytes_(total_bytes), max_bytes_(max_bytes) {
+}
+
+const std::string&
+ApiAllocationStats::Api() const {
+    return api_;
+}
+
+uint64_t
+ApiAllocationStats::Calls() const {
+    return calls_;
+}
+
+uint64_t
+ApiAllocationStats::TotalBytes() const {
+    return total_bytes_;
+}
+
+uint64_t
+ApiAllocationStats::MaxBytes() const {
+    return max_bytes_;
+}
+
+double
+ApiAllocationStats::MeanBytes() const {
+    if (calls_ == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(total_bytes_) / static_cast<double>(calls_);
+}
+
+AllocationStats::AllocationStats(std::vector<ApiAllocationStats> apis) : apis_(std::move(apis)) {
+}
+
+const std::vector<ApiAllocationStats>&
+AllocationStats::Apis() const {
+    return apis_;
+}
+
+uint64_t
+AllocationStats::TotalBytes() const {
+    uint64_t bytes = 0;
+    for (const auto& api : apis_) {
+        bytes += api.TotalBytes();
+    }
+    return bytes;
+}
+
+}  // namespace milvus
@@ -0,0 +1,53 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/CallTiming.h"
+
+namespace milvus {
+
+constexpr size_t CallTiming::kStageCount;
+
+CallTiming::Duration
+CallTiming::Total() const {
+    return total_;
+}
+
+void
+CallTiming::SetTotal(Duration total) {
+    total_ = total;
+}
+
+CallTiming::Duration
+CallTiming::Elapsed(Stage stage) const {
+    return stages_.at(static_cast<size_t>(stage));
+}
+
+void
+CallTiming::AddElapsed(Stage stage, Duration elapsed) {
+    stages_.at(static_cast<size_t>(stage)) += elapsed;
+}
+
+const std::vector<CallTiming::Duration>&
+CallTiming::Attempts() const {
+    return attempts_;
+}
+
+void
+CallTiming::AddAttempt(Duration elapsed) {
+    attempts_.push_back(elapsed);
+}
+
+}  // namespace milvus
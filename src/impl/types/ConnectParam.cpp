@@ -70,6 +70,8 @@ ConnectParam::operator=(const ConnectParam& other) {
         username_ = other.username_;
         token_ = other.token_;
         db_name_ = other.db_name_;
+
+        schema_cache_file_ = other.schema_cache_file_;
     }
     return *this;
 }
@@ -314,4 +316,36 @@ ConnectParam::WithDbName(const std::string& db_name) {
     return *this;
 }
 
+const std::string&
+ConnectParam::SchemaCacheFile() const {
+    return schema_cache_file_;
+}
+
+void
+ConnectParam::SetSchemaCacheFile(const std::string& path) {
+    schema_cache_file_ = path;
+}
+
+ConnectParam&
+ConnectParam::WithSchemaCacheFile(const std::string& path) {
+    SetSchemaCacheFile(path);
+    return *this;
+}
+
+bool
+ConnectParam::CallTimingEnabled() const {
+    return call_timing_;
+}
+
+void
+ConnectParam::SetCallTimingEnabled(bool enabled) {
+    call_timing_ = enabled;
+}
+
+ConnectParam&
+ConnectParam::WithCallTimingEnabled(bool enabled) {
+    SetCallTimingEnabled(enabled);
+    return *this;
+}
+
 }  // namespace milvus
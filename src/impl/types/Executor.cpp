@@ -0,0 +1,41 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/Executor.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "utils/WorkStealingExecutor.h"
+
+namespace milvus {
+
+ExecutorPtr
+Executor::Create(uint32_t worker_count) {
+    if (worker_count == 0) {
+        worker_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    return std::make_shared<WorkStealingExecutor>(worker_count);
+}
+
+ExecutorPtr
+Executor::Default() {
+    // leaked on purpose, joining the workers at exit would wait for the tasks that are still running
+    static auto* executor = new ExecutorPtr(Create(std::max(2U, std::thread::hardware_concurrency())));
+    return *executor;
+}
+
+}  // namespace milvus
@@ -0,0 +1,102 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/ExecutorStats.h"
+
+namespace milvus {
+
+ExecutorStats::ExecutorStats(uint32_t workers, uint64_t queue_depth, uint64_t max_queue_depth, uint64_t submitted,
+                             uint64_t completed, uint64_t stolen, uint64_t failed, uint64_t total_wait_us,
+                             uint64_t max_wait_us, uint64_t total_run_us)
+    : workers_(workers),
+      queue_depth_(queue_depth),
+      max_queue_depth_(max_queue_depth),
+      submitted_(submitted),
+      completed_(completed),
+      stolen_(stolen),
+      failed_(failed),
+      total_wait_us_(total_wait_us),
+      max_wait_us_(max_wait_us),
+      total_run_us_(total_run_us) {
+}
+
+uint32_t
+ExecutorStats::Workers() const {
+    return workers_;
+}
+
+uint64_t
+ExecutorStats::QueueDepth() const {
+    return queue_depth_;
+}
+
+uint64_t
+ExecutorStats::MaxQueueDepth() const {
+    return max_queue_depth_;
+}
+
+uint64_t
+ExecutorStats::Submitted() const {
+    return submitted_;
+}
+
+uint64_t
+ExecutorStats::Completed() const {
+    return completed_;
+}
+
+uint64_t
+ExecutorStats::Stolen() const {
+    return stolen_;
+}
+
+uint64_t
+ExecutorStats::Failed() const {
+    return failed_;
+}
+
+uint64_t
+ExecutorStats::TotalWaitUs() const {
+    return total_wait_us_;
+}
+
+uint64_t
+ExecutorStats::MaxWaitUs() const {
+    return max_wait_us_;
+}
+
+uint64_t
+ExecutorStats::TotalRunUs() const {
+    return total_run_us_;
+}
+
+double
+ExecutorStats::MeanWaitUs() const {
+    if (completed_ == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(total_wait_us_) / static_cast<double>(completed_);
+}
+
+double
+ExecutorStats::MeanRunUs() const {
+    if (completed_ == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(total_run_us_) / static_cast<double>(completed_);
+}
+
+}  // namespace milvus
@@ -20,6 +20,8 @@
 #include <iterator>
 #include <stdexcept>
 
+#include "../utils/MemoryUtils.h"
+
 namespace milvus {
 
 namespace {
@@ -122,6 +124,11 @@ Field::ElementType() const {
     return element_type_;
 }
 
+size_t
+Field::MemoryUsage() const {
+    return sizeof(Field) + HeapBytes(name_);
+}
+
 Field::Field(std::string name, DataType data_type) : name_(std::move(name)), data_type_(data_type) {
 }
 
@@ -253,6 +260,12 @@ FieldData<T, Dt>::Reserve(size_t count) {
     valid_data_.reserve(count);
 }
 
+template <typename T, DataType Dt>
+size_t
+FieldData<T, Dt>::MemoryUsage() const {
+    return sizeof(*this) + HeapBytes(name_) + HeapBytes(data_) + HeapBytes(valid_data_);
+}
+
 template <typename T, DataType Dt>
 const std::vector<T>&
 FieldData<T, Dt>::Data() const {
@@ -0,0 +1,142 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/FilterTemplateArray.h"
+
+#include <utility>
+
+namespace milvus {
+
+struct FilterTemplateArray::Values {
+    DataType type{DataType::INT64};
+    std::vector<bool> bools;
+    std::vector<int64_t> int64s;
+    std::vector<double> doubles;
+    std::vector<std::string> strings;
+    std::vector<FilterTemplateArray> arrays;
+};
+
+namespace {
+// shared by default constructed arrays and accessors of other element types
+const std::vector<bool> kNoBools;
+const std::vector<int64_t> kNoInt64s;
+const std::vector<double> kNoDoubles;
+const std::vector<std::string> kNoStrings;
+const std::vector<FilterTemplateArray> kNoArrays;
+}  // namespace
+
+FilterTemplateArray::FilterTemplateArray() = default;
+
+FilterTemplateArray::FilterTemplateArray(std::shared_ptr<const Values> values) : values_(std::move(values)) {
+}
+
+FilterTemplateArray
+FilterTemplateArray::Bools(std::vector<bool> values) {
+    auto array = std::make_shared<Values>();
+    array->type = DataType::BOOL;
+    array->bools = std::move(values);
+    return FilterTemplateArray(std::move(array));
+}
+
+FilterTemplateArray
+FilterTemplateArray::Int64s(std::vector<int64_t> values) {
+    auto array = std::make_shared<Values>();
+    array->type = DataType::INT64;
+    array->int64s = std::move(values);
+    return FilterTemplateArray(std::move(array));
+}
+
+FilterTemplateArray
+FilterTemplateArray::Int64s(const int64_t* data, size_t count) {
+    return Int64s(std::vector<int64_t>(data, data + count));
+}
+
+FilterTemplateArray
+FilterTemplateArray::Doubles(std::vector<double> values) {
+    auto array = std::make_shared<Values>();
+    array->type = DataType::DOUBLE;
+    array->doubles = std::move(values);
+    return FilterTemplateArray(std::move(array));
+}
+
+FilterTemplateArray
+FilterTemplateArray::Doubles(const double* data, size_t count) {
+    return Doubles(std::vector<double>(data, data + count));
+}
+
+FilterTemplateArray
+FilterTemplateArray::Strings(std::vector<std::string> values) {
+    auto array = std::make_shared<Values>();
+    array->type = DataType::VARCHAR;
+    array->strings = std::move(values);
+    return FilterTemplateArray(std::move(array));
+}
+
+FilterTemplateArray
+FilterTemplateArray::Arrays(std::vector<FilterTemplateArray> values) {
+    auto array = std::make_shared<Values>();
+    array->type = DataType::ARRAY;
+    array->arrays = std::move(values);
+    return FilterTemplateArray(std::move(array));
+}
+
+DataType
+FilterTemplateArray::ElementType() const {
+    return values_ == nullptr ? DataType::INT64 : values_->type;
+}
+
+size_t
+FilterTemplateArray::Size() const {
+    switch (ElementType()) {
+        case DataType::BOOL:
+            return values_->bools.size();
+        case DataType::DOUBLE:
+            return values_->doubles.size();
+        case DataType::VARCHAR:
+            return values_->strings.size();
+        case DataType::ARRAY:
+            return values_->arrays.size();
+        default:
+            return values_ == nullptr ? 0 : values_->int64s.size();
+    }
+}
+
+const std::vector<bool>&
+FilterTemplateArray::BoolValues() const {
+    return values_ == nullptr ? kNoBools : values_->bools;
+}
+
+const std::vector<int64_t>&
+FilterTemplateArray::Int64Values() const {
+    return values_ == nullptr ? kNoInt64s : values_->int64s;
+}
+
+const std::vector<double>&
+FilterTemplateArray::DoubleValues() const {
+    return values_ == nullptr ? kNoDoubles : values_->doubles;
+}
+
+const std::vector<std::string>&
+FilterTemplateArray::StringValues() const {
+    return values_ == nullptr ? kNoStrings : values_->strings;
+}
+
+const std::vector<FilterTemplateArray>&
+FilterTemplateArray::ArrayValues() const {
+    return values_ == nullptr ? kNoArrays : values_->arrays;
+}
+
+}  // namespace milvus
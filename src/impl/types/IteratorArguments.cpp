@@ -59,6 +59,25 @@ IteratorArguments::SetPkSchema(const FieldSchema& schema) {
     return Status::OK();
 }
 
+int64_t
+IteratorArguments::PrefetchDepth() const {
+    return prefetch_depth_;
+}
+
+Status
+IteratorArguments::SetPrefetchDepth(int64_t prefetch_depth) {
+    if (prefetch_depth < 0) {
+        return {StatusCode::INVALID_ARGUMENT, "prefetch depth cannot be negative"};
+    }
+    if (prefetch_depth > MAX_PREFETCH_DEPTH) {
+        return {StatusCode::INVALID_ARGUMENT,
+                "prefetch depth cannot be larger than " + std::to_string(MAX_PREFETCH_DEPTH)};
+    }
+
+    prefetch_depth_ = prefetch_depth;
+    return Status::OK();
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 // QueryIteratorArguments
 bool
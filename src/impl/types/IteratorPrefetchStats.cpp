@@ -0,0 +1,54 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/IteratorPrefetchStats.h"
+
+namespace milvus {
+
+IteratorPrefetchStats::IteratorPrefetchStats(uint64_t depth, uint64_t fetched_pages, uint64_t hits, uint64_t misses)
+    : depth_(depth), fetched_pages_(fetched_pages), hits_(hits), misses_(misses) {
+}
+
+uint64_t
+IteratorPrefetchStats::Depth() const {
+    return depth_;
+}
+
+uint64_t
+IteratorPrefetchStats::FetchedPages() const {
+    return fetched_pages_;
+}
+
+uint64_t
+IteratorPrefetchStats::Hits() const {
+    return hits_;
+}
+
+uint64_t
+IteratorPrefetchStats::Misses() const {
+    return misses_;
+}
+
+double
+IteratorPrefetchStats::HitRatio() const {
+    const auto total = hits_ + misses_;
+    if (total == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(hits_) / static_cast<double>(total);
+}
+
+}  // namespace milvus
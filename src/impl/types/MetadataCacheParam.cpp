@@ -0,0 +1,55 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/MetadataCacheParam.h"
+
+namespace milvus {
+
+uint64_t
+MetadataCacheParam::TtlMs() const {
+    return ttl_ms_;
+}
+
+void
+MetadataCacheParam::SetTtlMs(uint64_t ttl_ms) {
+    ttl_ms_ = ttl_ms;
+}
+
+MetadataCacheParam&
+MetadataCacheParam::WithTtlMs(uint64_t ttl_ms) {
+    SetTtlMs(ttl_ms);
+    return *this;
+}
+
+uint64_t
+MetadataCacheParam::MaxEntries() const {
+    return max_entries_;
+}
+
+void
+MetadataCacheParam::SetMaxEntries(uint64_t max_entries) {
+    if (max_entries > 0) {
+        max_entries_ = max_entries;
+    }
+}
+
+MetadataCacheParam&
+MetadataCacheParam::WithMaxEntries(uint64_t max_entries) {
+    SetMaxEntries(max_entries);
+    return *this;
+}
+
+}  // namespace milvus
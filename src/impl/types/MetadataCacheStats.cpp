@@ -0,0 +1,70 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/MetadataCacheStats.h"
+
+namespace milvus {
+
+MetadataCacheStats::MetadataCacheStats(uint64_t hits, uint64_t misses, uint64_t expirations, uint64_t invalidations,
+                                       uint64_t evictions, uint64_t entries)
+    : hits_(hits),
+      misses_(misses),
+      expirations_(expirations),
+      invalidations_(invalidations),
+      evictions_(evictions),
+      entries_(entries) {
+}
+
+uint64_t
+MetadataCacheStats::Hits() const {
+    return hits_;
+}
+
+uint64_t
+MetadataCacheStats::Misses() const {
+    return misses_;
+}
+
+uint64_t
+MetadataCacheStats::Expirations() const {
+    return expirations_;
+}
+
+uint64_t
+MetadataCacheStats::Invalidations() const {
+    return invalidations_;
+}
+
+uint64_t
+MetadataCacheStats::Evictions() const {
+    return evictions_;
+}
+
+uint64_t
+MetadataCacheStats::Entries() const {
+    return entries_;
+}
+
+double
+MetadataCacheStats::HitRatio() const {
+    const auto total = hits_ + misses_;
+    if (total == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(hits_) / static_cast<double>(total);
+}
+
+}  // namespace milvus
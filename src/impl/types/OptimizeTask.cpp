@@ -17,8 +17,6 @@
 #include "milvus/types/OptimizeTask.h"
 
 #include <chrono>
-#include <exception>
-#include <system_error>
 #include <utility>
 
 namespace milvus {
@@ -90,33 +88,6 @@ OptimizeTask::TaskStatus() const {
     return status_;
 }
 
-Status
-OptimizeTask::start(Worker worker) {
-    auto self = shared_from_this();
-    try {
-        worker_ = std::thread([self, worker]() {
-            OptimizeResponse response;
-            try {
-                auto status = worker(response);
-                self->complete(status, std::move(response));
-            } catch (const std::exception& e) {
-                auto status = Status{StatusCode::UNKNOWN_ERROR, "Optimization task failed: " + std::string(e.what())};
-                self->complete(status, std::move(response));
-            } catch (...) {
-                auto status = Status{StatusCode::UNKNOWN_ERROR, "Optimization task failed with unknown exception"};
-                self->complete(status, std::move(response));
-            }
-        });
-        worker_.detach();
-    } catch (const std::system_error& e) {
-        OptimizeResponse response;
-        auto status = Status{StatusCode::UNKNOWN_ERROR, "Failed to start optimization task: " + std::string(e.what())};
-        complete(status, std::move(response));
-        return status;
-    }
-    return Status::OK();
-}
-
 bool
 OptimizeTask::shouldCancel() const {
     std::lock_guard<std::mutex> lock(mutex_);
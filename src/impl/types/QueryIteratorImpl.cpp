@@ -35,12 +35,110 @@ QueryIteratorImpl<T>::QueryIteratorImpl(const MilvusConnectionPtr& connection, c
     cluster_id_ = std::move(cluster_id);
 }
 
+template <typename T>
+QueryIteratorImpl<T>::~QueryIteratorImpl() {
+    if (prefetcher_ != nullptr) {
+        prefetcher_->Stop();
+    }
+}
+
 template <typename T>
 Status
 QueryIteratorImpl<T>::Next(QueryResults& results) {
     results.Clear();
 
     QueryResults temp_results;
+    auto status = (prefetcher_ != nullptr) ? nextPrefetchedBatch(temp_results) : nextBatch(temp_results);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const auto row_count = temp_results.GetRowCount();
+    if (limit_ < 0) {
+        // no limited, continue to fetch
+        results = std::move(temp_results);
+    } else {
+        int64_t left_count = limit_ - static_cast<int64_t>(returned_count_);
+        if (left_count >= static_cast<int64_t>(row_count)) {
+            // not enough, continue to fetch
+            results = std::move(temp_results);
+        } else if (left_count > 0) {
+            // the last batch
+            auto status = copyResults(temp_results, 0, left_count, results);
+            if (!status.IsOk()) {
+                return status;
+            }
+        }
+    }
+
+    returned_count_ += row_count;
+    return Status::OK();
+}
+
+template <typename T>
+IteratorPrefetchStats
+QueryIteratorImpl<T>::PrefetchStats() const {
+    if (prefetcher_ == nullptr) {
+        return {};
+    }
+    return prefetcher_->Stats();
+}
+
+template <typename T>
+Status
+QueryIteratorImpl<T>::Init() {
+    // store the limit/offset values, the args's limit/offset will be changed later
+    limit_ = args_.Limit();
+    offset_ = args_.Offset();
+
+    // reset args_.offset to 0 since the filter expression will be reset to the correct position
+    args_.SetOffset(0);
+
+    // run query to setup the session ts if it is not pinned
+    if (session_ts_ == 0) {
+        QueryResults results;
+        auto status = executeQuery(args_.Filter(), 1, false, results);
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+
+    // run query to jump offset
+    auto status = seek();
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    // from now on the background thread owns the cursor
+    if (args_.PrefetchDepth() > 0) {
+        auto fetcher = [this](QueryResults& page, bool& last) { return prefetchPage(page, last); };
+        prefetcher_ = std::unique_ptr<PagePrefetcher<QueryResults>>(
+            new PagePrefetcher<QueryResults>(static_cast<size_t>(args_.PrefetchDepth()), fetcher));
+        // the fetcher reads prefetcher_, start the thread once the member is assigned
+        prefetcher_->Start();
+    }
+    return Status::OK();
+}
+
+template <typename T>
+void
+QueryIteratorImpl<T>::SetSessionTs(uint64_t session_ts) {
+    session_ts_ = session_ts;
+}
+
+template <typename T>
+uint64_t
+QueryIteratorImpl<T>::SessionTs() const {
+    return session_ts_;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// internal methods
+
+// Get one batch without prefetch, the query is executed when the cache has no enough rows.
+template <typename T>
+Status
+QueryIteratorImpl<T>::nextBatch(QueryResults& temp_results) {
     if (cache_.GetRowCount() >= args_.BatchSize()) {
         // return from cache
         auto status = copyResults(cache_, 0, args_.BatchSize(), temp_results);
@@ -93,52 +191,80 @@ QueryIteratorImpl<T>::Next(QueryResults& results) {
         }
     }
 
-    if (limit_ < 0) {
-        // no limited, continue to fetch
-        results = temp_results;
-    } else {
-        int64_t left_count = limit_ - static_cast<int64_t>(returned_count_);
-        if (left_count >= static_cast<int64_t>(temp_results.GetRowCount())) {
-            // not enough, continue to fetch
-            results = temp_results;
-        } else if (left_count > 0) {
-            // the last batch
-            auto status = copyResults(temp_results, 0, left_count, results);
-            if (!status.IsOk()) {
-                return status;
-            }
+    updateCursor(temp_results);
+    return Status::OK();
+}
+
+// Get one batch from the pages fetched by the background thread. Each page holds a multiple of
+// batch size rows except the last one, so the cache is either empty or has enough rows.
+// The batches are cut from the page at cache_offset_, each row is copied once, a page of one batch is moved.
+template <typename T>
+Status
+QueryIteratorImpl<T>::nextPrefetchedBatch(QueryResults& batch) {
+    if (cache_offset_ >= cache_.GetRowCount()) {
+        cache_ = QueryResults();
+        cache_offset_ = 0;
+        QueryResults page;
+        bool end = false;
+        auto status = prefetcher_->Next(page, end);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (end) {
+            return Status::OK();
         }
+        cache_ = std::move(page);
     }
 
-    updateCursor(temp_results);
-    returned_count_ += temp_results.GetRowCount();
+    const auto batch_size = static_cast<uint64_t>(args_.BatchSize());
+    if (cache_offset_ == 0 && cache_.GetRowCount() <= batch_size) {
+        batch = std::move(cache_);
+        cache_ = QueryResults();
+        return Status::OK();
+    }
+
+    const auto to = std::min(cache_offset_ + batch_size, cache_.GetRowCount());
+    auto status = copyResults(cache_, cache_offset_, to, batch);
+    if (!status.IsOk()) {
+        return status;
+    }
+    cache_offset_ = to;
     return Status::OK();
 }
 
+// Called by the background thread. The page is cut to a multiple of batch size in the same way as
+// nextBatch() caches rows, the remaining rows are fetched again by the next page.
 template <typename T>
 Status
-QueryIteratorImpl<T>::Init() {
-    // store the limit/offset values, the args's limit/offset will be changed later
-    limit_ = args_.Limit();
-    offset_ = args_.Offset();
+QueryIteratorImpl<T>::prefetchPage(QueryResults& page, bool& last) {
+    auto filter = setupNextFilter();
+    QueryResults query_results;
+    auto status = executeQuery(filter, args_.BatchSize(), false, query_results);
+    if (!status.IsOk()) {
+        return status;
+    }
 
-    // reset args_.offset to 0 since the filter expression will be reset to the correct position
-    args_.SetOffset(0);
+    const auto batch_size = static_cast<uint64_t>(args_.BatchSize());
+    const auto row_count = query_results.GetRowCount();
+    if (row_count > batch_size) {
+        status = copyResults(query_results, 0, row_count / batch_size * batch_size, page);
+        if (!status.IsOk()) {
+            return status;
+        }
+    } else {
+        page = std::move(query_results);
+    }
 
-    // run query to setup the session ts
-    QueryResults results;
-    auto status = executeQuery(args_.Filter(), 1, false, results);
+    status = updateCursor(page);
     if (!status.IsOk()) {
         return status;
     }
 
-    // run query to jump offset
-    return seek();
+    fetched_count_ += page.GetRowCount();
+    last = page.GetRowCount() == 0 || (limit_ >= 0 && fetched_count_ >= static_cast<uint64_t>(limit_));
+    return Status::OK();
 }
 
-///////////////////////////////////////////////////////////////////////////////////
-// internal methods
-
 // This method is to handle offset
 // offset value could be larger than 16384, this method might call query multiple
 // times until the "next_id_" is set to the offset position.
@@ -247,7 +373,12 @@ QueryIteratorImpl<T>::executeQuery(const std::string& filter, int64_t limit, boo
 
     // query rpc call via retry process
     proto::milvus::QueryResults rpc_response;
-    auto caller = [&]() { return connection_->Query(rpc_request, rpc_response, GrpcOpts{timeout}); };
+    auto caller = [&]() {
+        if (prefetcher_ != nullptr && prefetcher_->Stopping()) {
+            return Status{StatusCode::UNKNOWN_ERROR, "Iterator is closed"};
+        }
+        return connection_->Query(rpc_request, rpc_response, GrpcOpts{timeout});
+    };
     status = Retry(caller, retry_param_);
     if (!status.IsOk()) {
         return status;
@@ -263,7 +394,7 @@ QueryIteratorImpl<T>::executeQuery(const std::string& filter, int64_t limit, boo
         }
     }
 
-    return ConvertQueryResults(rpc_response, results);
+    return ConvertQueryResults(std::move(rpc_response), results);
 }
 
 template <typename T>
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "../MilvusConnection.h"
+#include "../utils/PagePrefetcher.h"
 #include "milvus/request/dql/QueryIteratorRequest.h"
 #include "milvus/types/FieldSchema.h"
 #include "milvus/types/Iterator.h"
@@ -33,13 +35,34 @@ class QueryIteratorImpl : public QueryIterator {
     QueryIteratorImpl(const MilvusConnectionPtr& connection, const T& args, const RetryParam& retry_param,
                       std::string cluster_id = "");
 
+    ~QueryIteratorImpl() override;
+
     Status
     Next(QueryResults& results) final;
 
+    IteratorPrefetchStats
+    PrefetchStats() const final;
+
     Status
     Init();
 
+    // Pin the snapshot before Init(), so that several iterators read the same snapshot.
+    void
+    SetSessionTs(uint64_t session_ts);
+
+    uint64_t
+    SessionTs() const;
+
  private:
+    Status
+    nextBatch(QueryResults& temp_results);
+
+    Status
+    nextPrefetchedBatch(QueryResults& batch);
+
+    Status
+    prefetchPage(QueryResults& page, bool& last);
+
     Status
     seek();
 
@@ -69,6 +92,12 @@ class QueryIteratorImpl : public QueryIterator {
     uint64_t returned_count_{0};
 
     QueryResults cache_;
+    // rows of cache_ already returned, only used with the prefetcher
+    uint64_t cache_offset_{0};
+
+    // declared last so that the background fetch stops before other members are destroyed
+    uint64_t fetched_count_{0};
+    std::unique_ptr<PagePrefetcher<QueryResults>> prefetcher_;
 };
 
 // explicitly instantiation of template methods to avoid link error
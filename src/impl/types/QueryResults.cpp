@@ -16,7 +16,10 @@
 
 #include "milvus/types/QueryResults.h"
 
+#include <unordered_set>
+
 #include "../utils/DqlUtils.h"
+#include "../utils/MemoryUtils.h"
 
 namespace milvus {
 
@@ -92,4 +95,10 @@ QueryResults::Clear() {
     output_names_.clear();
 }
 
+size_t
+QueryResults::MemoryUsage() const {
+    std::unordered_set<const Field*> seen;
+    return sizeof(QueryResults) + FieldsMemoryUsage(output_fields_, seen) + HeapBytes(output_names_);
+}
+
 }  // namespace milvus
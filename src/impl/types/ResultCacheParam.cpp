@@ -0,0 +1,55 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/ResultCacheParam.h"
+
+namespace milvus {
+
+uint64_t
+ResultCacheParam::CapacityBytes() const {
+    return capacity_bytes_;
+}
+
+void
+ResultCacheParam::SetCapacityBytes(uint64_t capacity_bytes) {
+    capacity_bytes_ = capacity_bytes;
+}
+
+ResultCacheParam&
+ResultCacheParam::WithCapacityBytes(uint64_t capacity_bytes) {
+    SetCapacityBytes(capacity_bytes);
+    return *this;
+}
+
+uint64_t
+ResultCacheParam::TtlMs() const {
+    return ttl_ms_;
+}
+
+void
+ResultCacheParam::SetTtlMs(uint64_t ttl_ms) {
+    if (ttl_ms > 0) {
+        ttl_ms_ = ttl_ms;
+    }
+}
+
+ResultCacheParam&
+ResultCacheParam::WithTtlMs(uint64_t ttl_ms) {
+    SetTtlMs(ttl_ms);
+    return *this;
+}
+
+}  // namespace milvus
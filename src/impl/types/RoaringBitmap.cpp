@@ -58,9 +58,14 @@
 #include "milvus/types/RoaringBitmap.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+
+#include "utils/ConcurrencyUtils.h"
 
 namespace milvus {
 
@@ -79,6 +84,14 @@ constexpr uint32_t kBitmapBodySize = 8192;
 // stop matching what the Go SDK emits for the same members.
 constexpr uint64_t kBitmapContainerSizeInMemory = 8224;
 
+// Below this many keys std::sort beats the radix passes, and a parallel body write costs more in
+// task hand-off than it saves.
+constexpr size_t kMinRadixKeys = 64 * 1024;
+constexpr size_t kMinRadixBucket = 256;
+constexpr size_t kMinParallelKeys = 256 * 1024;
+// more body writers than this only add range bookkeeping
+constexpr uint32_t kMaxWriteThreads = 16;
+
 enum class ContainerKind { ARRAY, BITMAP, RUN };
 
 // One 16-bit container. The values are the [begin, end) slice of the normalized key vector, so
@@ -131,6 +144,77 @@ WriteU64LE(uint8_t* data, uint64_t value) {
     }
 }
 
+void
+RadixSortDigit(uint64_t* first, uint64_t* last, int digit) {
+    const int shift = 8 * digit;
+    std::array<size_t, 256> counts{};
+    for (auto* key = first; key != last; ++key) {
+        counts[(*key >> shift) & 0xFF]++;
+    }
+
+    const auto size = static_cast<size_t>(last - first);
+    if (counts[(*first >> shift) & 0xFF] != size) {
+        std::array<size_t, 256> heads{};
+        std::array<size_t, 256> tails{};
+        size_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            heads[b] = offset;
+            offset += counts[b];
+            tails[b] = offset;
+        }
+        // each swap drops one key into its final bucket, so every key moves at most once
+        for (int b = 0; b < 256; b++) {
+            while (heads[b] < tails[b]) {
+                auto key = first[heads[b]];
+                auto bucket = (key >> shift) & 0xFF;
+                while (bucket != static_cast<uint64_t>(b)) {
+                    std::swap(key, first[heads[bucket]++]);
+                    bucket = (key >> shift) & 0xFF;
+                }
+                first[heads[b]++] = key;
+            }
+        }
+    }
+    if (digit == 0) {
+        return;
+    }
+
+    auto* bucket_first = first;
+    for (const auto count : counts) {
+        auto* bucket_last = bucket_first + count;
+        if (count >= kMinRadixBucket) {
+            RadixSortDigit(bucket_first, bucket_last, digit - 1);
+        } else if (count > 1) {
+            std::sort(bucket_first, bucket_last);
+        }
+        bucket_first = bucket_last;
+    }
+}
+
+/**
+ * In-place MSD radix sort on 8-bit digits, so sorting ten million members needs no second
+ * buffer of the same size. Sorting starts at the highest byte in which the keys differ, and for
+ * real id sets that skips most: ids drawn from one range share their top bytes, so a 10M-member
+ * set of auto ids typically takes three or four passes instead of std::sort's n log n comparisons.
+ * Each pass permutes one bucket range by cycle swaps, then the buckets are sorted one byte lower.
+ */
+void
+RadixSort(std::vector<uint64_t>& keys) {
+    // start at the highest byte in which any two keys differ
+    uint64_t differing = 0;
+    for (const auto key : keys) {
+        differing |= key ^ keys.front();
+    }
+    if (differing == 0) {
+        return;
+    }
+    int digit = 7;
+    while ((differing >> (8 * digit)) == 0) {
+        digit--;
+    }
+    RadixSortDigit(keys.data(), keys.data() + keys.size(), digit);
+}
+
 /**
  * Groups the normalized keys into high groups and 16-bit containers, picks each container's
  * encoding and sizes the whole body -- all without allocating it, so a member set that exceeds
@@ -312,7 +396,53 @@ CheckLimits(const RoaringBitmapStats& stats) {
 }
 
 void
-WriteBody(uint8_t* body, const std::vector<uint64_t>& keys, const Layout& layout) {
+WriteContainer(uint8_t* out, const std::vector<uint64_t>& keys, const ContainerPlan& container) {
+    switch (container.kind) {
+        case ContainerKind::ARRAY: {
+            for (size_t j = container.begin; j < container.end; j++) {
+                WriteU16LE(out, static_cast<uint16_t>(keys[j]));
+                out += 2;
+            }
+            break;
+        }
+        case ContainerKind::BITMAP: {
+            // Word v >> 6, bit v & 63, stored little-endian -- which is byte v >> 3,
+            // bit v & 7. The 8192 bytes start out zero.
+            for (size_t j = container.begin; j < container.end; j++) {
+                const auto value = static_cast<uint16_t>(keys[j]);
+                out[value >> 3] |= static_cast<uint8_t>(1u << (value & 7));
+            }
+            break;
+        }
+        case ContainerKind::RUN: {
+            WriteU16LE(out, static_cast<uint16_t>(container.num_runs));
+            out += 2;
+            size_t j = container.begin;
+            while (j < container.end) {
+                const auto start = static_cast<uint32_t>(keys[j] & 0xFFFF);
+                uint32_t last = start;
+                j++;
+                while (j < container.end && static_cast<uint32_t>(keys[j] & 0xFFFF) == last + 1) {
+                    last++;
+                    j++;
+                }
+                WriteU16LE(out, static_cast<uint16_t>(start));
+                // Minus one, so a run covering the whole container still fits a uint16.
+                WriteU16LE(out + 2, static_cast<uint16_t>(last - start));
+                out += 4;
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Writes everything but the container bodies, and records where each body starts so the bodies
+ * can be written in any order.
+ */
+void
+WriteHeaders(uint8_t* body, const Layout& layout, std::vector<size_t>& positions) {
+    positions.resize(layout.containers.size());
     WriteU64LE(body, layout.groups.size());
     size_t pos = 8;
 
@@ -357,47 +487,50 @@ WriteBody(uint8_t* body, const std::vector<uint64_t>& keys, const Layout& layout
         }
 
         for (size_t i = 0; i < group.count; i++) {
-            const auto& container = layout.containers[group.first + i];
-            switch (container.kind) {
-                case ContainerKind::ARRAY: {
-                    for (size_t j = container.begin; j < container.end; j++) {
-                        WriteU16LE(body + pos, static_cast<uint16_t>(keys[j]));
-                        pos += 2;
-                    }
-                    break;
-                }
-                case ContainerKind::BITMAP: {
-                    // Word v >> 6, bit v & 63, stored little-endian -- which is byte v >> 3,
-                    // bit v & 7. The 8192 bytes start out zero.
-                    for (size_t j = container.begin; j < container.end; j++) {
-                        const auto value = static_cast<uint16_t>(keys[j]);
-                        body[pos + (value >> 3)] |= static_cast<uint8_t>(1u << (value & 7));
-                    }
-                    pos += kBitmapBodySize;
-                    break;
-                }
-                case ContainerKind::RUN: {
-                    WriteU16LE(body + pos, static_cast<uint16_t>(container.num_runs));
-                    pos += 2;
-                    size_t j = container.begin;
-                    while (j < container.end) {
-                        const auto start = static_cast<uint32_t>(keys[j] & 0xFFFF);
-                        uint32_t last = start;
-                        j++;
-                        while (j < container.end && static_cast<uint32_t>(keys[j] & 0xFFFF) == last + 1) {
-                            last++;
-                            j++;
-                        }
-                        WriteU16LE(body + pos, static_cast<uint16_t>(start));
-                        // Minus one, so a run covering the whole container still fits a uint16.
-                        WriteU16LE(body + pos + 2, static_cast<uint16_t>(last - start));
-                        pos += 4;
-                    }
-                    break;
-                }
-            }
+            positions[group.first + i] = pos;
+            pos += layout.containers[group.first + i].body_size;
+        }
+    }
+}
+
+/**
+ * The container bodies are independent once their positions are known, so a large set is
+ * encoded by several workers: the calling thread and helpers from the default executor. Each
+ * worker takes a contiguous range of containers holding about the same number of keys; a dense
+ * set of a few wide containers and a sparse set of many tiny ones split equally well that way.
+ */
+void
+WriteBody(uint8_t* body, const std::vector<uint64_t>& keys, const Layout& layout, uint32_t num_threads) {
+    std::vector<size_t> positions;
+    WriteHeaders(body, layout, positions);
+
+    const auto& containers = layout.containers;
+    auto write_range = [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; i++) {
+            WriteContainer(body + positions[i], keys, containers[i]);
         }
+    };
+    const auto hardware_threads = std::max(1U, std::thread::hardware_concurrency());
+    num_threads = std::min({num_threads, hardware_threads, kMaxWriteThreads});
+    if (num_threads > containers.size()) {
+        num_threads = static_cast<uint32_t>(containers.size());
     }
+    if (num_threads <= 1 || keys.size() < kMinParallelKeys) {
+        write_range(0, containers.size());
+        return;
+    }
+
+    // boundaries[w] is the first container whose first key is at or past w / num_threads of the keys
+    std::vector<size_t> boundaries(num_threads + 1, containers.size());
+    for (uint32_t w = 0; w < num_threads; w++) {
+        const size_t first_key = keys.size() * w / num_threads;
+        boundaries[w] = static_cast<size_t>(
+            std::lower_bound(containers.begin(), containers.end(), first_key,
+                             [](const ContainerPlan& container, size_t key) { return container.begin < key; }) -
+            containers.begin());
+    }
+    RunConcurrently(Executor::Default(), num_threads, num_threads,
+                    [&](size_t w) { write_range(boundaries[w], boundaries[w + 1]); });
 }
 
 }  // namespace
@@ -407,8 +540,7 @@ RoaringBitmapBuilder::AddInt64(int64_t value) {
     // Sign-extend, then reinterpret the two's complement bit pattern as the bitmap key. This is
     // the mapping the server probes with, so INT8(-1) and INT64(-1) are the same member and
     // negative values land in the top half of the key space.
-    keys_.push_back(static_cast<uint64_t>(value));
-    normalized_ = false;
+    append(static_cast<uint64_t>(value));
     return *this;
 }
 
@@ -419,12 +551,28 @@ RoaringBitmapBuilder::AddInt64s(const std::vector<int64_t>& values) {
     }
     keys_.reserve(keys_.size() + values.size());
     for (const auto value : values) {
-        keys_.push_back(static_cast<uint64_t>(value));
+        append(static_cast<uint64_t>(value));
     }
-    normalized_ = false;
     return *this;
 }
 
+void
+RoaringBitmapBuilder::append(uint64_t key) {
+    // Members streamed in ascending order -- a cursor over a primary key index, a range of auto
+    // ids -- stay normalized as they arrive: a repeat of the last key is dropped on the spot and
+    // neither a sort nor a dedup pass is needed later. The first key out of order falls back to
+    // sorting everything in normalize().
+    if (normalized_ && !keys_.empty()) {
+        if (key == keys_.back()) {
+            return;
+        }
+        if (key < keys_.back()) {
+            normalized_ = false;
+        }
+    }
+    keys_.push_back(key);
+}
+
 void
 RoaringBitmapBuilder::normalize() const {
     if (normalized_) {
@@ -433,7 +581,11 @@ RoaringBitmapBuilder::normalize() const {
     // Unsigned order, which is what the bitmap layout is defined on: -1 sorts above 5, not
     // below it. Sorting the signed values instead would group and order the containers wrongly
     // for any member set that straddles zero.
-    std::sort(keys_.begin(), keys_.end());
+    if (keys_.size() >= kMinRadixKeys) {
+        RadixSort(keys_);
+    } else {
+        std::sort(keys_.begin(), keys_.end());
+    }
     keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
     normalized_ = true;
 }
@@ -467,6 +619,11 @@ RoaringBitmapBuilder::Validate() const {
 
 std::vector<uint8_t>
 RoaringBitmapBuilder::Build() const {
+    return Build(1);
+}
+
+std::vector<uint8_t>
+RoaringBitmapBuilder::Build(uint32_t num_threads) const {
     normalize();
     const auto bucket_status = CheckBucketLimits(CountBuckets(keys_));
     if (!bucket_status.IsOk()) {
@@ -487,7 +644,7 @@ RoaringBitmapBuilder::Build() const {
     WriteU64LE(blob.data() + 8, stats.cardinality);
     WriteU64LE(blob.data() + 16, layout.body_length);
     // blob[24..31] stays zero (reserved).
-    WriteBody(blob.data() + kHeaderSize, keys_, layout);
+    WriteBody(blob.data() + kHeaderSize, keys_, layout, num_threads);
     return blob;
 }
 
@@ -496,6 +653,11 @@ RoaringBitmapBuilder::BuildTemplate() const {
     return nlohmann::json::binary(Build());
 }
 
+nlohmann::json
+RoaringBitmapBuilder::BuildTemplate(uint32_t num_threads) const {
+    return nlohmann::json::binary(Build(num_threads));
+}
+
 Status
 RoaringBitmapTemplate(const std::vector<int64_t>& members, nlohmann::json& output) {
     RoaringBitmapBuilder builder;
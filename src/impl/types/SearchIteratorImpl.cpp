@@ -54,7 +54,7 @@ SearchIteratorImpl<T>::Next(SingleResult& results) {
         output_count = std::min(output_count, left_count);
     }
 
-    if (SearchIteratorImpl::CachedCount(cache_) < output_count) {
+    if (cache_.Count() < static_cast<uint64_t>(output_count)) {
         // if cache is not sufficient, try to fill the result by probing with constant width
         // until finish filling or exceeding max trial time: 10
         auto status = trySearchFill(output_count);
@@ -64,7 +64,7 @@ SearchIteratorImpl<T>::Next(SingleResult& results) {
     }
 
     // return batch from the cache if cache is big enough
-    auto status = SearchIteratorImpl::FetchPageFromCache(cache_, args_.OutputFields(), output_count, results);
+    auto status = cache_.Fetch(args_.OutputFields(), static_cast<uint64_t>(output_count), results);
     if (!status.IsOk()) {
         return status;
     }
@@ -145,70 +145,6 @@ SearchIteratorImpl<T>::CheckInput(const FieldDataPtr& vectors,
     return Status::OK();
 }
 
-template <typename T>
-uint64_t
-SearchIteratorImpl<T>::CachedCount(const std::list<SingleResultPtr>& cache) {
-    uint64_t cached_count = 0;
-    for (const auto& item : cache) {
-        cached_count += item->GetRowCount();
-    }
-    return cached_count;
-}
-
-// Try return a page with count from cache.
-// The cache might have multiple SingleResult in a list. This method copy data from
-// the header of the list until the count is meet.
-template <typename T>
-Status
-SearchIteratorImpl<T>::FetchPageFromCache(std::list<SingleResultPtr>& cache, const std::set<std::string>& output_fields,
-                                          int64_t count, SingleResult& results) {
-    int64_t row_count = 0;
-
-    while (!cache.empty() && row_count < count) {
-        auto one_cache = cache.front();
-        cache.pop_front();
-
-        if (row_count + one_cache->GetRowCount() <= count) {
-            // this batch is smaller than required, append the entire batch
-            auto status = AppendSearchResult(*one_cache, results);
-            if (!status.IsOk()) {
-                return status;
-            }
-            row_count += one_cache->GetRowCount();
-        } else {
-            // this batch is greater than required, append a part of the batch
-            auto left_count = row_count + one_cache->GetRowCount() - count;
-            auto append_count = one_cache->GetRowCount() - left_count;
-            std::vector<FieldDataPtr> append_data;
-            auto status = CopyFieldsData(one_cache->OutputFields(), 0, append_count, append_data);
-            if (!status.IsOk()) {
-                return status;
-            }
-
-            SingleResult append_result{one_cache->PrimaryKeyName(), one_cache->ScoreName(), std::move(append_data),
-                                       output_fields};
-            status = AppendSearchResult(append_result, results);
-            if (!status.IsOk()) {
-                return status;
-            }
-            row_count += append_count;
-
-            // keep the left batch in cache, note we push the left batch in the header of the cache
-            if (left_count > 0) {
-                std::vector<FieldDataPtr> left_data;
-                status = CopyFieldsData(one_cache->OutputFields(), append_count, one_cache->GetRowCount(), left_data);
-                if (!status.IsOk()) {
-                    return status;
-                }
-                SingleResultPtr left_batch = std::make_shared<SingleResult>(
-                    one_cache->PrimaryKeyName(), one_cache->ScoreName(), std::move(left_data), output_fields);
-                cache.emplace_front(std::move(left_batch));
-            }
-        }
-    }
-    return Status::OK();
-}
-
 ///////////////////////////////////////////////////////////////////////////////////
 // internal methods
 // L2/JACCARD/HAMMING, smallest value is most similar
@@ -239,7 +175,7 @@ SearchIteratorImpl<T>::initSearchIterator() {
     if (!status.IsOk()) {
         return status;
     }
-    cache_.emplace_back(std::move(single_result));
+    cache_.Push(std::move(single_result));
 
     return Status::OK();
 }
@@ -527,11 +463,11 @@ SearchIteratorImpl<T>::trySearchFill(int64_t count) {
 
             // cache the rows at the tail of the list
             // warning: single_result will become empty here
-            cache_.emplace_back(std::move(single_result));
+            cache_.Push(std::move(single_result));
         }
 
         // already enough rows
-        if (SearchIteratorImpl::CachedCount(cache_) >= count) {
+        if (cache_.Count() >= static_cast<uint64_t>(count)) {
             break;
         }
 
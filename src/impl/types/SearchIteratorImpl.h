@@ -16,12 +16,12 @@
 
 #pragma once
 
-#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "../MilvusConnection.h"
+#include "SearchPageCache.h"
 #include "milvus/request/dql/SearchIteratorRequest.h"
 #include "milvus/types/FieldSchema.h"
 #include "milvus/types/Iterator.h"
@@ -47,13 +47,6 @@ class SearchIteratorImpl : public SearchIterator {
     CheckInput(const FieldDataPtr& vectors, const std::unordered_map<std::string, std::string>& params,
                int64_t batch_size, MetricType metric_type);
 
-    static uint64_t
-    CachedCount(const std::list<SingleResultPtr>& cache);
-
-    static Status
-    FetchPageFromCache(std::list<SingleResultPtr>& cache, const std::set<std::string>& output_fields, int64_t count,
-                       SingleResult& results);
-
  private:
     static bool
     MetricsPositiveRelated(MetricType metric_type);
@@ -102,7 +95,7 @@ class SearchIteratorImpl : public SearchIterator {
     double tail_distance_{0.0};
     std::vector<std::string> filtered_ids_;
 
-    std::list<SingleResultPtr> cache_;
+    SearchPageCache cache_;
 };
 
 // explicitly instantiation of template methods to avoid link error
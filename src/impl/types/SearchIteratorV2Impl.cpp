@@ -40,6 +40,13 @@ SearchIteratorV2Impl<T>::SearchIteratorV2Impl(const MilvusConnectionPtr& connect
     cluster_id_ = std::move(cluster_id);
 }
 
+template <typename T>
+SearchIteratorV2Impl<T>::~SearchIteratorV2Impl() {
+    if (prefetcher_ != nullptr) {
+        prefetcher_->Stop();
+    }
+}
+
 template <typename T>
 Status
 SearchIteratorV2Impl<T>::Next(SingleResult& results) {
@@ -59,24 +66,27 @@ SearchIteratorV2Impl<T>::Next(SingleResult& results) {
 
     while (true) {
         SingleResultPtr single_result;
-        auto status = next(single_result);
+        bool end = false;
+        auto status = (prefetcher_ != nullptr) ? prefetcher_->Next(single_result, end) : next(single_result);
         if (!status.IsOk()) {
             return status;
         }
+        if (end) {
+            break;
+        }
         auto result_count = single_result->GetRowCount();
         if (result_count == 0) {
             break;
         }
 
-        cache_.emplace_back(std::move(single_result));
-        auto cache_count = SearchIteratorImpl<T>::CachedCount(cache_);
-        if (cache_count >= static_cast<uint64_t>(target_len)) {
+        cache_.Push(std::move(single_result));
+        if (cache_.Count() >= static_cast<uint64_t>(target_len)) {
             break;
         }
     }
 
     // return batch from the cache if cache is big enough
-    auto status = SearchIteratorImpl<T>::FetchPageFromCache(cache_, args_.OutputFields(), target_len, results);
+    auto status = cache_.Fetch(args_.OutputFields(), static_cast<uint64_t>(target_len), results);
     if (!status.IsOk()) {
         return status;
     }
@@ -85,6 +95,15 @@ SearchIteratorV2Impl<T>::Next(SingleResult& results) {
     return Status::OK();
 }
 
+template <typename T>
+IteratorPrefetchStats
+SearchIteratorV2Impl<T>::PrefetchStats() const {
+    if (prefetcher_ == nullptr) {
+        return {};
+    }
+    return prefetcher_->Stats();
+}
+
 template <typename T>
 Status
 SearchIteratorV2Impl<T>::Init() {
@@ -105,6 +124,14 @@ SearchIteratorV2Impl<T>::Init() {
         return status;
     }
 
+    // from now on the background thread owns the search bound and token
+    if (args_.PrefetchDepth() > 0) {
+        auto fetcher = [this](SingleResultPtr& page, bool& last) { return prefetchPage(page, last); };
+        prefetcher_ = std::unique_ptr<PagePrefetcher<SingleResultPtr>>(
+            new PagePrefetcher<SingleResultPtr>(static_cast<size_t>(args_.PrefetchDepth()), fetcher));
+        // the fetcher reads prefetcher_, start the thread once the member is assigned
+        prefetcher_->Start();
+    }
     return Status::OK();
 }
 
@@ -164,7 +191,12 @@ SearchIteratorV2Impl<T>::executeSearch(const T& args, proto::milvus::SearchResul
     }
 
     // query rpc call via retry process
-    auto caller = [&]() { return connection_->Search(rpc_request, rpc_response, GrpcOpts{timeout}); };
+    auto caller = [&]() {
+        if (prefetcher_ != nullptr && prefetcher_->Stopping()) {
+            return Status{StatusCode::UNKNOWN_ERROR, "Iterator is closed"};
+        }
+        return connection_->Search(rpc_request, rpc_response, GrpcOpts{timeout});
+    };
     status = Retry(caller, retry_param_);
     if (!status.IsOk()) {
         return status;
@@ -221,6 +253,21 @@ SearchIteratorV2Impl<T>::next(SingleResultPtr& results) {
     return Status::OK();
 }
 
+// Called by the background thread, stops fetching after the last page or once the limit is met.
+template <typename T>
+Status
+SearchIteratorV2Impl<T>::prefetchPage(SingleResultPtr& page, bool& last) {
+    auto status = next(page);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const auto row_count = static_cast<int64_t>(page->GetRowCount());
+    fetched_count_ += row_count;
+    last = row_count == 0 || (original_limit_ > 0 && fetched_count_ >= original_limit_);
+    return Status::OK();
+}
+
 // explicitly instantiation of template methods to avoid link error
 template class MILVUS_SDK_API SearchIteratorV2Impl<SearchIteratorArguments>;
 template class MILVUS_SDK_API SearchIteratorV2Impl<SearchIteratorRequest>;
@@ -16,12 +16,13 @@
 
 #pragma once
 
-#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "../MilvusConnection.h"
+#include "../utils/PagePrefetcher.h"
+#include "SearchPageCache.h"
 #include "milvus.pb.h"
 #include "milvus/request/dql/SearchIteratorRequest.h"
 #include "milvus/types/Iterator.h"
@@ -36,9 +37,14 @@ class SearchIteratorV2Impl : public SearchIterator {
     SearchIteratorV2Impl(const MilvusConnectionPtr& connection, const T& args, const RetryParam& retry_param,
                          std::string cluster_id = "");
 
+    ~SearchIteratorV2Impl() override;
+
     Status
     Next(SingleResult& results) final;
 
+    IteratorPrefetchStats
+    PrefetchStats() const final;
+
     Status
     Init();
 
@@ -55,6 +61,9 @@ class SearchIteratorV2Impl : public SearchIterator {
     Status
     next(SingleResultPtr& results);
 
+    Status
+    prefetchPage(SingleResultPtr& page, bool& last);
+
  private:
     MilvusConnectionPtr connection_;
     T args_;
@@ -64,7 +73,11 @@ class SearchIteratorV2Impl : public SearchIterator {
     int64_t original_limit_{0};
     int64_t returned_count_{0};
     uint64_t session_ts_{0};
-    std::list<SingleResultPtr> cache_;
+    SearchPageCache cache_;
+
+    // declared last so that the background fetch stops before other members are destroyed
+    int64_t fetched_count_{0};
+    std::unique_ptr<PagePrefetcher<SingleResultPtr>> prefetcher_;
 };
 
 // explicitly instantiation of template methods to avoid link error
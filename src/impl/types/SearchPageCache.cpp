@@ -0,0 +1,84 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SearchPageCache.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "../utils/DqlUtils.h"
+
+namespace milvus {
+
+void
+SearchPageCache::Push(SingleResultPtr page) {
+    if (page == nullptr || page->GetRowCount() == 0) {
+        return;
+    }
+    count_ += page->GetRowCount();
+    pages_.emplace_back(std::move(page));
+}
+
+uint64_t
+SearchPageCache::Count() const {
+    return count_;
+}
+
+Status
+SearchPageCache::Fetch(const std::set<std::string>& output_fields, uint64_t count, SingleResult& results) {
+    uint64_t row_count = 0;
+    while (!pages_.empty() && row_count < count) {
+        auto& page = pages_.front();
+        const auto page_rows = page->GetRowCount();
+        const auto take = std::min(page_rows - head_offset_, count - row_count);
+
+        Status status;
+        if (head_offset_ == 0 && take == page_rows) {
+            // the entire page is required, hand over the page without copying
+            status = AppendSearchResult(std::move(*page), results);
+        } else {
+            // only copy the required rows, the rest rows stay in the page
+            std::vector<FieldDataPtr> slice_data;
+            status = CopyFieldsData(page->OutputFields(), head_offset_, head_offset_ + take, slice_data);
+            if (status.IsOk()) {
+                SingleResult slice{page->PrimaryKeyName(), page->ScoreName(), std::move(slice_data), output_fields};
+                status = AppendSearchResult(std::move(slice), results);
+            }
+        }
+        if (!status.IsOk()) {
+            return status;
+        }
+
+        row_count += take;
+        count_ -= take;
+        head_offset_ += take;
+        if (head_offset_ >= page_rows) {
+            pages_.pop_front();
+            head_offset_ = 0;
+        }
+    }
+    return Status::OK();
+}
+
+void
+SearchPageCache::Clear() {
+    pages_.clear();
+    head_offset_ = 0;
+    count_ = 0;
+}
+
+}  // namespace milvus
@@ -0,0 +1,64 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <string>
+
+#include "milvus/Status.h"
+#include "milvus/types/SearchResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Page cache of search iterators.
+ * Fetched pages are kept as they are, a partially consumed head page is tracked by a row offset
+ * instead of being split, so the rows left in the cache are never copied. Only rows returned by a
+ * partial fetch are copied once, whole pages are moved into the result.
+ */
+class SearchPageCache {
+ public:
+    /**
+     * @brief Append a page at the tail, empty pages are ignored.
+     */
+    void
+    Push(SingleResultPtr page);
+
+    /**
+     * @brief Number of rows not fetched yet.
+     */
+    uint64_t
+    Count() const;
+
+    /**
+     * @brief Fetch at most count rows from the head.
+     */
+    Status
+    Fetch(const std::set<std::string>& output_fields, uint64_t count, SingleResult& results);
+
+    void
+    Clear();
+
+ private:
+    std::deque<SingleResultPtr> pages_;
+    uint64_t head_offset_{0};
+    uint64_t count_{0};
+};
+
+}  // namespace milvus
@@ -22,6 +22,7 @@
 #include "../utils/DmlUtils.h"
 #include "../utils/DqlUtils.h"
 #include "../utils/ExtraParamUtils.h"
+#include "../utils/MemoryUtils.h"
 #include "../utils/TypeUtils.h"
 #include "milvus/utils/FP16.h"
 
@@ -52,7 +53,15 @@ SearchRequestBase::AddFilterTemplate(std::string key, const nlohmann::json& filt
         }
     }
 
-    filter_templates_.insert(std::make_pair(key, filter_template));
+    typed_filter_templates_.erase(key);
+    filter_templates_[std::move(key)] = filter_template;
+    return Status::OK();
+}
+
+Status
+SearchRequestBase::AddFilterTemplate(std::string key, FilterTemplateArray filter_template) {
+    filter_templates_.erase(key);
+    typed_filter_templates_[std::move(key)] = std::move(filter_template);
     return Status::OK();
 }
 
@@ -61,9 +70,15 @@ SearchRequestBase::FilterTemplates() const {
     return filter_templates_;
 }
 
+const std::unordered_map<std::string, FilterTemplateArray>&
+SearchRequestBase::TypedFilterTemplates() const {
+    return typed_filter_templates_;
+}
+
 Status
 SearchRequestBase::SetFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates) {
     filter_templates_ = std::move(filter_templates);
+    typed_filter_templates_.clear();
     return Status::OK();
 }
 
@@ -338,4 +353,11 @@ SearchRequestBase::AddInt8Vector(std::string field_name, const Int8VecFieldData:
     return target_vectors_.AddInt8Vector(vector);
 }
 
+size_t
+SearchRequestBase::MemoryUsage() const {
+    return sizeof(SearchRequestBase) + HeapBytes(ann_field_) + HeapBytes(target_vectors_) +
+           HeapBytes(embedding_lists_) + HeapBytes(filter_expression_) + HeapBytes(filter_templates_) +
+           HeapBytes(typed_filter_templates_) + HeapBytes(extra_params_);
+}
+
 }  // namespace milvus
@@ -17,9 +17,11 @@
 #include "milvus/types/SearchResults.h"
 
 #include <stdexcept>
+#include <unordered_set>
 
 #include "../utils/Constants.h"
 #include "../utils/DqlUtils.h"
+#include "../utils/MemoryUtils.h"
 
 namespace milvus {
 
@@ -32,6 +34,14 @@ SingleResult::SingleResult(const SingleResult& src)
     verify();
 }
 
+SingleResult::SingleResult(SingleResult&& src) noexcept = default;
+
+SingleResult&
+SingleResult::operator=(const SingleResult& src) = default;
+
+SingleResult&
+SingleResult::operator=(SingleResult&& src) noexcept = default;
+
 SingleResult::SingleResult(const std::string& pk_name, const std::string& score_name,
                            std::vector<FieldDataPtr>&& output_fields, const std::set<std::string>& output_names)
     : pk_name_(pk_name), score_name_(score_name), output_fields_(std::move(output_fields)) {
@@ -161,6 +171,13 @@ SingleResult::Clear() {
     highlight_results_.clear();
 }
 
+size_t
+SingleResult::MemoryUsage() const {
+    std::unordered_set<const Field*> seen;
+    return sizeof(SingleResult) + HeapBytes(pk_name_) + HeapBytes(score_name_) +
+           FieldsMemoryUsage(output_fields_, seen) + HeapBytes(output_names_) + HeapBytes(highlight_results_);
+}
+
 SingleResult&
 SingleResult::WithHighlightResults(std::vector<HighlightResults>&& highlight_results) {
     highlight_results_ = std::move(highlight_results);
@@ -192,4 +209,14 @@ SearchResults::WithRecalls(std::vector<float>&& recalls) {
     return *this;
 }
 
+size_t
+SearchResults::MemoryUsage() const {
+    size_t bytes = sizeof(SearchResults) + HeapBytes(recalls_);
+    bytes += (nq_results_.capacity() - nq_results_.size()) * sizeof(SingleResult);
+    for (const auto& result : nq_results_) {
+        bytes += result.MemoryUsage();
+    }
+    return bytes;
+}
+
 }  // namespace milvus
@@ -0,0 +1,136 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/types/Tracer.h"
+
+#include <utility>
+
+namespace milvus {
+
+const char* TRACEPARENT_HEADER = "traceparent";
+
+namespace {
+
+bool
+IsLowerHexId(const std::string& id, size_t length) {
+    if (id.size() != length) {
+        return false;
+    }
+    bool all_zero = true;
+    for (auto c : id) {
+        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+            return false;
+        }
+        all_zero = all_zero && c == '0';
+    }
+    return !all_zero;
+}
+
+}  // namespace
+
+const std::string&
+SpanAttributes::RpcName() const {
+    return rpc_name_;
+}
+
+void
+SpanAttributes::SetRpcName(std::string rpc_name) {
+    rpc_name_ = std::move(rpc_name);
+}
+
+const std::string&
+SpanAttributes::DatabaseName() const {
+    return db_name_;
+}
+
+void
+SpanAttributes::SetDatabaseName(std::string db_name) {
+    db_name_ = std::move(db_name);
+}
+
+const std::string&
+SpanAttributes::CollectionName() const {
+    return collection_name_;
+}
+
+void
+SpanAttributes::SetCollectionName(std::string collection_name) {
+    collection_name_ = std::move(collection_name);
+}
+
+int64_t
+SpanAttributes::Nq() const {
+    return nq_;
+}
+
+void
+SpanAttributes::SetNq(int64_t nq) {
+    nq_ = nq;
+}
+
+int64_t
+SpanAttributes::Rows() const {
+    return rows_;
+}
+
+void
+SpanAttributes::SetRows(int64_t rows) {
+    rows_ = rows;
+}
+
+uint64_t
+SpanAttributes::RequestBytes() const {
+    return request_bytes_;
+}
+
+void
+SpanAttributes::SetRequestBytes(uint64_t bytes) {
+    request_bytes_ = bytes;
+}
+
+uint64_t
+SpanAttributes::ResponseBytes() const {
+    return response_bytes_;
+}
+
+void
+SpanAttributes::SetResponseBytes(uint64_t bytes) {
+    response_bytes_ = bytes;
+}
+
+uint32_t
+SpanAttributes::Retries() const {
+    return retries_;
+}
+
+void
+SpanAttributes::SetRetries(uint32_t retries) {
+    retries_ = retries;
+}
+
+void
+Span::InjectHeaders(std::unordered_map<std::string, std::string>&) {
+}
+
+std::string
+Traceparent(const std::string& trace_id, const std::string& span_id, bool sampled) {
+    if (!IsLowerHexId(trace_id, 32) || !IsLowerHexId(span_id, 16)) {
+        return "";
+    }
+    return "00-" + trace_id + "-" + span_id + (sampled ? "-01" : "-00");
+}
+
+}  // namespace milvus
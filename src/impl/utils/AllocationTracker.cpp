@@ -0,0 +1,89 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AllocationTracker.h"
+
+#include <utility>
+#include <vector>
+
+#include "RpcUtils.h"
+
+namespace milvus {
+
+AllocationTracker&
+AllocationTracker::GetInstance() {
+    static AllocationTracker instance;
+    return instance;
+}
+
+void
+AllocationTracker::SetCounter(AllocationCounter counter) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    counter_ = counter ? std::make_shared<const AllocationCounter>(std::move(counter)) : nullptr;
+    entries_.clear();
+    enabled_.store(counter_ != nullptr, std::memory_order_release);
+}
+
+AllocationTracker::CounterPtr
+AllocationTracker::Counter() const {
+    if (!enabled_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return counter_;
+}
+
+void
+AllocationTracker::Record(const std::string& api, uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = entries_[api];
+    ++entry.calls_;
+    entry.total_bytes_ += bytes;
+    if (bytes > entry.max_bytes_) {
+        entry.max_bytes_ = bytes;
+    }
+}
+
+AllocationStats
+AllocationTracker::Stats() const {
+    std::vector<ApiAllocationStats> apis;
+    std::lock_guard<std::mutex> lock(mutex_);
+    apis.reserve(entries_.size());
+    for (const auto& pair : entries_) {
+        const auto& entry = pair.second;
+        apis.emplace_back(pair.first, entry.calls_, entry.total_bytes_, entry.max_bytes_);
+    }
+    return AllocationStats{std::move(apis)};
+}
+
+AllocationScope::AllocationScope(const google::protobuf::Descriptor* request)
+    : counter_(AllocationTracker::GetInstance().Counter()), request_(request) {
+    if (counter_ != nullptr) {
+        start_bytes_ = (*counter_)();
+    }
+}
+
+AllocationScope::~AllocationScope() {
+    if (counter_ == nullptr) {
+        return;
+    }
+    const auto end_bytes = (*counter_)();
+    // a counter replaced or reset by the application may run backwards, such a call is counted as 0 bytes
+    const auto bytes = end_bytes > start_bytes_ ? end_bytes - start_bytes_ : 0;
+    AllocationTracker::GetInstance().Record(RpcName(request_), bytes);
+}
+
+}  // namespace milvus
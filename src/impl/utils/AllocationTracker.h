@@ -0,0 +1,86 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "google/protobuf/descriptor.h"
+#include "milvus/types/AllocationStats.h"
+
+namespace milvus {
+
+// Keeps the per API allocation statistics of the SDK. The tracking is off until an AllocationCounter is set, a call
+// then only pays an atomic load.
+class AllocationTracker {
+ public:
+    using CounterPtr = std::shared_ptr<const AllocationCounter>;
+
+    static AllocationTracker&
+    GetInstance();
+
+    // Replace the counter and clear the statistics, an empty counter turns the tracking off.
+    void
+    SetCounter(AllocationCounter counter);
+
+    // The counter, nullptr while the tracking is off.
+    CounterPtr
+    Counter() const;
+
+    void
+    Record(const std::string& api, uint64_t bytes);
+
+    AllocationStats
+    Stats() const;
+
+ private:
+    struct Entry {
+        uint64_t calls_ = 0;
+        uint64_t total_bytes_ = 0;
+        uint64_t max_bytes_ = 0;
+    };
+
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    CounterPtr counter_;
+    std::map<std::string, Entry> entries_;
+};
+
+// Measures the bytes the calling thread allocates while the scope lives and records them under the rpc name of the
+// request, "SearchRequest" is recorded as "Search". A call made by another call counts in both.
+class AllocationScope {
+ public:
+    explicit AllocationScope(const google::protobuf::Descriptor* request);
+
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+
+    AllocationScope&
+    operator=(const AllocationScope&) = delete;
+
+ private:
+    AllocationTracker::CounterPtr counter_;
+    const google::protobuf::Descriptor* request_ = nullptr;
+    uint64_t start_bytes_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,152 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CallTimer.h"
+
+#include <memory>
+#include <utility>
+
+namespace milvus {
+
+namespace {
+
+thread_local CallTimer* current_timer = nullptr;
+
+}  // namespace
+
+constexpr int CallTimer::kNoStage;
+
+CallTimer::CallTimer(bool enabled, ResponseBase& response) {
+    if (!enabled || current_timer != nullptr) {
+        return;
+    }
+    response_ = &response;
+    start_ = Clock::now();
+    stage_start_ = start_;
+    current_timer = this;
+}
+
+CallTimer::~CallTimer() {
+    if (response_ == nullptr) {
+        return;
+    }
+    const auto now = Clock::now();
+    switchTo(kNoStage, now);
+    timing_.SetTotal(now - start_);
+    if (current_timer == this) {
+        current_timer = nullptr;
+    }
+    response_->SetTiming(std::make_shared<CallTiming>(std::move(timing_)));
+}
+
+void
+CallTimer::Detach(CallTiming::Stage stage) {
+    if (response_ == nullptr || current_timer != this) {
+        return;
+    }
+    switchTo(static_cast<int>(stage), Clock::now());
+    current_timer = nullptr;
+    detached_ = true;
+}
+
+void
+CallTimer::Attach() {
+    // a thread already timing another call leaves the detached stage running until this timer closes
+    if (!detached_ || current_timer != nullptr) {
+        return;
+    }
+    const auto now = Clock::now();
+    if (stage_ == static_cast<int>(CallTiming::Stage::RPC)) {
+        timing_.AddAttempt(now - stage_start_);
+    }
+    switchTo(kNoStage, now);
+    current_timer = this;
+    detached_ = false;
+}
+
+CallTimer*
+CallTimer::current() {
+    return current_timer;
+}
+
+void
+CallTimer::switchTo(int stage, Clock::time_point now) {
+    if (stage_ != kNoStage) {
+        timing_.AddElapsed(static_cast<CallTiming::Stage>(stage_), now - stage_start_);
+    }
+    stage_ = stage;
+    stage_start_ = now;
+}
+
+FanOutTimer::FanOutTimer(bool enabled, ResponseBase& response) {
+    if (!enabled || current_timer != nullptr) {
+        return;
+    }
+    response_ = &response;
+    start_ = std::chrono::steady_clock::now();
+}
+
+FanOutTimer::~FanOutTimer() {
+    if (response_ == nullptr) {
+        return;
+    }
+    timing_.SetTotal(std::chrono::steady_clock::now() - start_);
+    response_->SetTiming(std::make_shared<CallTiming>(std::move(timing_)));
+}
+
+bool
+FanOutTimer::Enabled() const {
+    return response_ != nullptr;
+}
+
+void
+FanOutTimer::Add(const ResponseBase& part) {
+    const auto& timing = part.Timing();
+    if (response_ == nullptr || timing == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < CallTiming::kStageCount; ++i) {
+        const auto stage = static_cast<CallTiming::Stage>(i);
+        timing_.AddElapsed(stage, timing->Elapsed(stage));
+    }
+    for (const auto& attempt : timing->Attempts()) {
+        timing_.AddAttempt(attempt);
+    }
+}
+
+StageTimer::StageTimer(CallTiming::Stage stage) : stage_(stage) {
+    auto* timer = CallTimer::current();
+    if (timer == nullptr || timer->stage_ == static_cast<int>(CallTiming::Stage::SCHEMA_LOOKUP)) {
+        return;
+    }
+    timer_ = timer;
+    previous_ = timer->stage_;
+    start_ = CallTimer::Clock::now();
+    timer->switchTo(static_cast<int>(stage), start_);
+}
+
+StageTimer::~StageTimer() {
+    if (timer_ == nullptr) {
+        return;
+    }
+    const auto now = CallTimer::Clock::now();
+    timer_->switchTo(previous_, now);
+    if (stage_ == CallTiming::Stage::RPC) {
+        timer_->timing_.AddAttempt(now - start_);
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,121 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+
+#include "milvus/response/ResponseBase.h"
+#include "milvus/types/CallTiming.h"
+
+namespace milvus {
+
+// Collects the CallTiming of one API call on the calling thread and attaches it to the response when it closes.
+// Only the outermost timer of a thread opens, a call made by another call is charged to the stages of the outer one.
+// An asynchronous call carries its timer to the thread completing it, see Detach() and Attach().
+class CallTimer {
+ public:
+    CallTimer(bool enabled, ResponseBase& response);
+
+    ~CallTimer();
+
+    CallTimer(const CallTimer&) = delete;
+
+    CallTimer&
+    operator=(const CallTimer&) = delete;
+
+    // Leave the calling thread while the call waits for another one, the time until Attach() is charged to stage.
+    void
+    Detach(CallTiming::Stage stage);
+
+    // Open on the calling thread again. The detached time of an RPC stage is recorded as an attempt.
+    void
+    Attach();
+
+ private:
+    friend class StageTimer;
+
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int kNoStage = -1;
+
+    // The open timer of the calling thread, nullptr if there is none.
+    static CallTimer*
+    current();
+
+    // Charge the time since the last switch to the current stage, then make stage the current one.
+    void
+    switchTo(int stage, Clock::time_point now);
+
+    ResponseBase* response_ = nullptr;
+    Clock::time_point start_;
+    Clock::time_point stage_start_;
+    int stage_ = kNoStage;
+    bool detached_ = false;
+    CallTiming timing_;
+};
+
+// Collects the CallTiming of a call that fans out to sub-calls running on several threads, such as MultiSearch().
+// It leaves the thread without an open timer, so each sub-call opens its own CallTimer on the thread running it,
+// enabled when Enabled() is true. Add() sums the stages of a sub-call into the call and appends its attempts.
+// When it closes, the total is the time from its start, the sum of the stages may exceed it since sub-calls overlap.
+class FanOutTimer {
+ public:
+    FanOutTimer(bool enabled, ResponseBase& response);
+
+    ~FanOutTimer();
+
+    FanOutTimer(const FanOutTimer&) = delete;
+
+    FanOutTimer&
+    operator=(const FanOutTimer&) = delete;
+
+    // Whether the sub-calls should be timed, false if timing is off or the call is made by another timed call.
+    bool
+    Enabled() const;
+
+    // Take the timing of a sub-call, a sub-call without timing is skipped.
+    void
+    Add(const ResponseBase& part);
+
+ private:
+    ResponseBase* response_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+    CallTiming timing_;
+};
+
+// Charges the time while it lives to a stage of the open CallTimer of the thread, and does nothing while the thread
+// has none. Stages nest, the time of the inner stage is taken out of the outer one. Inside a schema lookup no other
+// stage is recorded, the DescribeCollection() call a lookup may make is charged to SCHEMA_LOOKUP as a whole.
+class StageTimer {
+ public:
+    explicit StageTimer(CallTiming::Stage stage);
+
+    ~StageTimer();
+
+    StageTimer(const StageTimer&) = delete;
+
+    StageTimer&
+    operator=(const StageTimer&) = delete;
+
+ private:
+    CallTimer* timer_ = nullptr;
+    CallTiming::Stage stage_;
+    int previous_ = CallTimer::kNoStage;
+    CallTimer::Clock::time_point start_;
+};
+
+}  // namespace milvus
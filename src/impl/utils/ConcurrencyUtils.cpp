@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ConcurrencyUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace milvus {
+
+void
+RunConcurrently(const ExecutorPtr& executor, size_t count, size_t concurrency,
+                const std::function<void(size_t)>& task) {
+    struct Batch {
+        std::atomic<size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable idle;
+        size_t active = 0;
+        bool closed = false;
+    };
+    auto batch = std::make_shared<Batch>();
+    // task belongs to the caller, it is only run while the batch is open
+    auto claim = [count, &task](Batch& state) {
+        for (auto index = state.next.fetch_add(1); index < count; index = state.next.fetch_add(1)) {
+            task(index);
+        }
+    };
+    auto leave = [](Batch& state) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        --state.active;
+        state.idle.notify_all();
+    };
+
+    size_t helper_count = 0;
+    if (executor != nullptr && count > 1 && concurrency > 1) {
+        helper_count = std::min<size_t>({concurrency - 1, count - 1, executor->WorkerCount()});
+    }
+    for (size_t i = 0; i < helper_count; ++i) {
+        auto submitted = executor->Submit([batch, claim, leave]() {
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                if (batch->closed) {
+                    return;
+                }
+                ++batch->active;
+            }
+            try {
+                claim(*batch);
+            } catch (...) {
+                leave(*batch);
+                throw;
+            }
+            leave(*batch);
+        });
+        if (!submitted.IsOk()) {
+            break;
+        }
+    }
+
+    // the caller returns only when no helper can touch task any more
+    auto close = [&batch]() {
+        std::unique_lock<std::mutex> lock(batch->mutex);
+        batch->closed = true;
+        batch->idle.wait(lock, [&batch]() { return batch->active == 0; });
+    };
+    try {
+        claim(*batch);
+    } catch (...) {
+        batch->next = count;
+        close();
+        throw;
+    }
+    close();
+}
+
+}  // namespace milvus
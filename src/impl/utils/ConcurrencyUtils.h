@@ -0,0 +1,34 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "milvus/types/Executor.h"
+
+namespace milvus {
+
+// Run task(0) ... task(count - 1) on the calling thread and up to concurrency - 1 helpers submitted to the
+// executor, no more helpers than the executor has workers. Tasks are claimed in index order.
+// The calling thread claims tasks too, so the batch completes even if no helper ever starts, for example
+// when the caller is itself a worker of a busy executor. A helper starting after the batch is done returns at once.
+void
+RunConcurrently(const ExecutorPtr& executor, size_t count, size_t concurrency,
+                const std::function<void(size_t)>& task);
+
+}  // namespace milvus
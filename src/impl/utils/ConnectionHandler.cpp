@@ -36,6 +36,7 @@ ConnectionHandler::Connect(const ConnectParam& connect_param) {
         connection_->Disconnect();
     }
     connection_ = std::move(connection);
+    call_timing_ = connect_param.CallTimingEnabled();
     return Status::OK();
 }
 
@@ -89,6 +90,19 @@ ConnectionHandler::GetRetryParam() const {
     return retry_param_;
 }
 
+Status
+ConnectionHandler::SetTracer(const TracerPtr& tracer) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    tracer_ = tracer;
+    return Status::OK();
+}
+
+TracerPtr
+ConnectionHandler::GetTracer() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return tracer_;
+}
+
 Status
 ConnectionHandler::UseDatabase(const std::string& db_name) {
     std::lock_guard<std::mutex> lock(mtx_);
@@ -124,6 +138,11 @@ ConnectionHandler::CurrentEndpoint() const {
     return connection_->GetConnectParam().Uri();
 }
 
+bool
+ConnectionHandler::CallTimingEnabled() const {
+    return call_timing_.load(std::memory_order_relaxed);
+}
+
 Status
 ConnectionHandler::GetLoadingProgress(const std::string& db_name, const std::string& collection_name,
                                       const std::set<std::string>& partition_names, uint32_t& progress,
@@ -16,18 +16,26 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "../MilvusConnection.h"
+#include "./AllocationTracker.h"
+#include "./CallTimer.h"
 #include "./RpcUtils.h"
+#include "./TraceScope.h"
 #include "common.pb.h"
 #include "milvus/Status.h"
 #include "milvus/types/ConnectParam.h"
+#include "milvus/types/Executor.h"
 #include "milvus/types/ProgressMonitor.h"
 #include "milvus/types/RetryParam.h"
+#include "milvus/types/Tracer.h"
 
 namespace milvus {
 
@@ -56,6 +64,12 @@ class ConnectionHandler {
     RetryParam
     GetRetryParam() const;
 
+    Status
+    SetTracer(const TracerPtr& tracer);
+
+    TracerPtr
+    GetTracer() const;
+
     Status
     UseDatabase(const std::string& db_name);
 
@@ -65,6 +79,10 @@ class ConnectionHandler {
     std::string
     CurrentEndpoint() const;
 
+    // ConnectParam::CallTimingEnabled() of the last successful Connect(), read without the lock for each call
+    bool
+    CallTimingEnabled() const;
+
     // This interface is not exposed to users
     Status
     GetLoadingProgress(const std::string& db_name, const std::string& collection_name,
@@ -160,7 +178,164 @@ class ConnectionHandler {
         return apiHandler(validate, pre, rpc, wait_for_status, post, rpc_timeout_ms);
     }
 
+    /**
+     * @brief template for a public api call whose raw response is kept by the caller
+     *        the rpc writes into rpc_response, which must outlive the call
+     */
+    template <typename Request, typename Response>
+    Status
+    InvokeInto(uint64_t rpc_timeout_ms, const std::function<Status(void)>& validate,
+               std::function<Status(Request&)> pre,
+               Status (MilvusConnection::*rpc)(const Request&, Response&, const GrpcOpts&), Response& rpc_response) {
+        return apiHandler(validate, pre, rpc, std::function<Status(const Response&)>{},
+                          std::function<Status(const Response&)>{}, rpc_timeout_ms, rpc_response);
+    }
+
+    /**
+     * @brief template for an asynchronous public api call
+     *        validate -> pre -> async rpc, then post -> done on the grpc thread completing the rpc
+     *
+     * Returns the error of validate or pre without calling done. A failed attempt is retried with the blocking
+     * rpc on the executor, since the backoff between attempts sleeps. post must not refer to the caller's locals.
+     * When call timing is on, the timing is set on response before done is called.
+     */
+    template <typename Request, typename Response>
+    Status
+    InvokeAsync(const std::function<Status(void)>& validate, const std::function<Status(Request&)>& pre,
+                void (MilvusConnection::*async_rpc)(const Request&, Response&, const GrpcOpts&,
+                                                    MilvusConnection::AsyncDone),
+                Status (MilvusConnection::*rpc)(const Request&, Response&, const GrpcOpts&),
+                std::function<Status(const Response&)> post, const ExecutorPtr& executor,
+                MilvusConnection::AsyncDone done, ResponseBase& response, uint64_t rpc_timeout_ms = 0) {
+        // bytes allocated by the calling thread, the decoding on the grpc thread is not counted
+        AllocationScope allocation_scope(Request::descriptor());
+        // the timer goes with the call to the thread completing it
+        std::unique_ptr<CallTimer> call_timer;
+        if (CallTimingEnabled()) {
+            call_timer.reset(new CallTimer(true, response));
+        }
+
+        MilvusConnectionPtr connection;
+        RetryParam retry_param;
+        uint64_t timeout = 0;
+        TracerPtr tracer;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (connection_ == nullptr) {
+                return {StatusCode::NOT_CONNECTED, "Connection is not created!"};
+            }
+            connection = connection_;
+            retry_param = retry_param_;
+            tracer = tracer_;
+            timeout = connection_->GetConnectParam().RpcDeadlineMs();
+        }
+
+        if (validate) {
+            StageTimer stage_timer(CallTiming::Stage::VALIDATE);
+            auto status = validate();
+            if (!status.IsOk()) {
+                return status;
+            }
+        }
+
+        auto call = std::make_shared<AsyncCall<Request, Response>>();
+        if (pre) {
+            StageTimer stage_timer(CallTiming::Stage::CONVERT);
+            auto status = pre(call->request_);
+            if (!status.IsOk()) {
+                return status;
+            }
+        }
+
+        if (rpc_timeout_ms > 0 && (timeout == 0 || rpc_timeout_ms < timeout)) {
+            timeout = rpc_timeout_ms;
+        }
+        if (call_timer != nullptr) {
+            call_timer->Detach(CallTiming::Stage::RPC);
+        }
+        call->call_timer_ = std::move(call_timer);
+        call->post_ = std::move(post);
+        call->done_ = std::move(done);
+        // the headers belong to the trace scope, which lives until the call finishes
+        GrpcOpts options{timeout};
+        if (tracer != nullptr) {
+            call->trace_scope_.reset(new TraceScope(tracer, call->request_, call->response_, call->status_));
+            call->trace_scope_->OnAttempt();
+            options.headers = call->trace_scope_->Headers();
+        }
+        (connection.get()->*async_rpc)(
+            call->request_, call->response_, options,
+            [call, connection, rpc, options, retry_param, executor](const Status& status) {
+                if (status.IsOk() || retry_param.MaxRetryTimes() <= 1 || executor == nullptr) {
+                    call->Finish(status);
+                    return;
+                }
+                auto submitted = executor->Submit([call, connection, rpc, options, retry_param, status]() {
+                    call->AttachTimer();
+                    // Retry() judges the failed first attempt as if it had made it
+                    bool first = true;
+                    auto caller = [&]() {
+                        if (first) {
+                            first = false;
+                            return status;
+                        }
+                        StageTimer stage_timer(CallTiming::Stage::RPC);
+                        if (call->trace_scope_ != nullptr) {
+                            call->trace_scope_->OnAttempt();
+                        }
+                        return (connection.get()->*rpc)(call->request_, call->response_, options);
+                    };
+                    Status final_status;
+                    {
+                        StageTimer stage_timer(CallTiming::Stage::BACKOFF);
+                        final_status = Retry(caller, retry_param);
+                    }
+                    call->Finish(final_status);
+                });
+                if (!submitted.IsOk()) {
+                    call->Finish(status);
+                }
+            });
+        return Status::OK();
+    }
+
  private:
+    // The state of an asynchronous call, owned by its completion callback.
+    template <typename Request, typename Response>
+    struct AsyncCall {
+        Request request_;
+        Response response_;
+        Status status_;
+        std::function<Status(const Response&)> post_;
+        MilvusConnection::AsyncDone done_;
+        // nullptr when call timing is off, detached while the rpc is in flight
+        std::unique_ptr<CallTimer> call_timer_;
+        // nullptr without a tracer, declared last since the span reads the members above when it ends
+        std::unique_ptr<TraceScope> trace_scope_;
+
+        // times the rest of the call on the calling thread
+        void
+        AttachTimer() {
+            if (call_timer_ != nullptr) {
+                call_timer_->Attach();
+            }
+        }
+
+        // the span ends with the final status and the timing is set before done is called
+        void
+        Finish(const Status& status) {
+            AttachTimer();
+            status_ = status;
+            if (status_.IsOk() && post_) {
+                StageTimer stage_timer(CallTiming::Stage::DECODE);
+                status_ = post_(response_);
+            }
+            trace_scope_.reset();
+            call_timer_.reset();
+            done_(status_);
+        }
+    };
+
     /**
      * @brief template for public api call
      *        validate -> pre -> rpc -> wait_for_status -> post
@@ -171,9 +346,23 @@ class ConnectionHandler {
                Status (MilvusConnection::*rpc)(const Request&, Response&, const GrpcOpts&),
                std::function<Status(const Response&)> wait_for_status, std::function<Status(const Response&)> post,
                uint64_t rpc_timeout_ms = 0) {
+        Response rpc_response;
+        return apiHandler(validate, pre, rpc, wait_for_status, post, rpc_timeout_ms, rpc_response);
+    }
+
+    template <typename Request, typename Response>
+    Status
+    apiHandler(const std::function<Status(void)>& validate, std::function<Status(Request&)> pre,
+               Status (MilvusConnection::*rpc)(const Request&, Response&, const GrpcOpts&),
+               std::function<Status(const Response&)> wait_for_status, std::function<Status(const Response&)> post,
+               uint64_t rpc_timeout_ms, Response& rpc_response) {
+        // bytes allocated by the whole call, recorded only when the application set an AllocationCounter
+        AllocationScope allocation_scope(Request::descriptor());
+
         MilvusConnectionPtr connection;
         RetryParam retry_param;
         uint64_t timeout = 0;
+        TracerPtr tracer;
         {
             std::lock_guard<std::mutex> lock(mtx_);
             if (connection_ == nullptr) {
@@ -181,6 +370,7 @@ class ConnectionHandler {
             }
             connection = connection_;
             retry_param = retry_param_;
+            tracer = tracer_;
             timeout = connection_->GetConnectParam().RpcDeadlineMs();
         }
         if (connection == nullptr) {
@@ -189,6 +379,7 @@ class ConnectionHandler {
 
         // validate input
         if (validate) {
+            StageTimer stage_timer(CallTiming::Stage::VALIDATE);
             auto status = validate();
             if (!status.IsOk()) {
                 return status;
@@ -198,6 +389,7 @@ class ConnectionHandler {
         // construct rpc request
         Request rpc_request;
         if (pre) {
+            StageTimer stage_timer(CallTiming::Stage::CONVERT);
             auto status = pre(rpc_request);
             if (!status.IsOk()) {
                 return status;
@@ -205,14 +397,26 @@ class ConnectionHandler {
         }
 
         // call rpc interface
-        Response rpc_response;
         // the timeout value can be changed by MilvusClient::SetRpcDeadlineMs()
         if (rpc_timeout_ms > 0 && (timeout == 0 || rpc_timeout_ms < timeout)) {
             timeout = rpc_timeout_ms;
         }
-        auto func = std::bind(rpc, connection.get(), rpc_request, std::placeholders::_1, GrpcOpts{timeout});
-        auto caller = [&func, &rpc_response]() { return func(rpc_response); };
-        auto status = Retry(caller, retry_param);
+        Status status;
+        // the span ends with the final status when the handler returns
+        TraceScope trace_scope(tracer, rpc_request, rpc_response, status);
+        // the request outlives the attempts, so they share it instead of a bound copy
+        auto func = std::bind(rpc, connection.get(), std::cref(rpc_request), std::placeholders::_1,
+                              GrpcOpts{timeout, trace_scope.Headers()});
+        auto caller = [&func, &rpc_response, &trace_scope]() {
+            StageTimer stage_timer(CallTiming::Stage::RPC);
+            trace_scope.OnAttempt();
+            return func(rpc_response);
+        };
+        {
+            // the time of Retry() outside the attempts is the backoff between them
+            StageTimer stage_timer(CallTiming::Stage::BACKOFF);
+            status = Retry(caller, retry_param);
+        }
         if (!status.IsOk()) {
             // response's status already checked in connection class
             return status;
@@ -220,6 +424,7 @@ class ConnectionHandler {
 
         // wait loop
         if (wait_for_status) {
+            StageTimer stage_timer(CallTiming::Stage::WAIT);
             status = wait_for_status(rpc_response);
             if (!status.IsOk()) {
                 return status;
@@ -228,18 +433,21 @@ class ConnectionHandler {
 
         // process results
         if (post) {
+            StageTimer stage_timer(CallTiming::Stage::DECODE);
             status = post(rpc_response);
             if (!status.IsOk()) {
                 return status;
             }
         }
-        return Status::OK();
+        return status;
     }
 
  private:
     mutable std::mutex mtx_;
     MilvusConnectionPtr connection_;
     RetryParam retry_param_;
+    TracerPtr tracer_;
+    std::atomic<bool> call_timing_{false};
 };
 
 }  // namespace milvus
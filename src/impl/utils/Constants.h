@@ -24,6 +24,7 @@
 namespace milvus {
 // const values for internal common usage
 constexpr int64_t MAX_BATCH_SIZE = 16384;
+constexpr int64_t MAX_PREFETCH_DEPTH = 64;
 constexpr uint64_t ITERATION_MAX_FILTERED_IDS_COUNT = 100000;
 constexpr uint64_t ITERATION_MAX_RETRY_TIME = 20;
 constexpr uint64_t DEFAULT_OPTIMIZE_RPC_TIMEOUT_MS = 60000;
@@ -17,13 +17,16 @@
 #include "DqlUtils.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <set>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 
 #include "./Constants.h"
 #include "./DmlUtils.h"
 #include "./MiscUtils.h"
+#include "./TopKMerge.h"
 #include "./TypeUtils.h"
 #include "./cache/CollectionTsCache.h"
 #include "milvus/response/dql/SearchResponse.h"
@@ -82,6 +85,26 @@ GetOrderByFields(const T&) {
     return empty;
 }
 
+template <typename T>
+struct SupportsTypedFilterTemplates
+    : std::integral_constant<bool, std::is_base_of<QueryRequest, T>::value ||
+                                       std::is_base_of<SearchRequestBase, T>::value> {};
+
+template <typename T>
+typename std::enable_if<SupportsTypedFilterTemplates<T>::value,
+                        const std::unordered_map<std::string, FilterTemplateArray>&>::type
+GetTypedFilterTemplates(const T& request) {
+    return request.TypedFilterTemplates();
+}
+
+template <typename T>
+typename std::enable_if<!SupportsTypedFilterTemplates<T>::value,
+                        const std::unordered_map<std::string, FilterTemplateArray>&>::type
+GetTypedFilterTemplates(const T&) {
+    static const std::unordered_map<std::string, FilterTemplateArray> empty;
+    return empty;
+}
+
 Status
 AppendOrderByFields(const std::vector<OrderByField>& order_by_fields,
                     ::google::protobuf::RepeatedPtrField<proto::common::KeyValuePair>* params) {
@@ -1449,7 +1472,7 @@ DeduceTemplateArray(const nlohmann::json& array, proto::schema::TemplateArrayVal
             rpc_array.mutable_string_data()->add_data(ele.get<std::string>());
         }
     } else if (first_ele.is_array()) {
-        auto rpc_array_array = rpc_array.mutable_array_data()->add_data();
+        auto rpc_array_array = rpc_array.mutable_array_data();
         for (const auto& ele : array) {
             if (!ele.is_array()) {
                 return {
@@ -1457,7 +1480,7 @@ DeduceTemplateArray(const nlohmann::json& array, proto::schema::TemplateArrayVal
                     "Filter expression template is a list, the first value is List, but some elements are not List"};
             }
 
-            auto sub_array = rpc_array_array->mutable_array_data()->add_data();
+            auto sub_array = rpc_array_array->add_data();
             auto status = DeduceTemplateArray(ele, *sub_array);
             if (!status.IsOk()) {
                 return status;
@@ -1514,6 +1537,68 @@ ConvertFilterTemplates(const std::unordered_map<std::string, nlohmann::json>& te
     return Status::OK();
 }
 
+namespace {
+
+Status
+ConvertTemplateArray(const FilterTemplateArray& array, proto::schema::TemplateArrayValue& rpc_array) {
+    switch (array.ElementType()) {
+        case DataType::BOOL: {
+            const auto& values = array.BoolValues();
+            auto* data = rpc_array.mutable_bool_data()->mutable_data();
+            data->Reserve(static_cast<int>(values.size()));
+            for (const auto value : values) {
+                data->AddAlreadyReserved(value);
+            }
+            break;
+        }
+        case DataType::INT64: {
+            const auto& values = array.Int64Values();
+            rpc_array.mutable_long_data()->mutable_data()->Add(values.begin(), values.end());
+            break;
+        }
+        case DataType::DOUBLE: {
+            const auto& values = array.DoubleValues();
+            rpc_array.mutable_double_data()->mutable_data()->Add(values.begin(), values.end());
+            break;
+        }
+        case DataType::VARCHAR: {
+            const auto& values = array.StringValues();
+            rpc_array.mutable_string_data()->mutable_data()->Add(values.begin(), values.end());
+            break;
+        }
+        case DataType::ARRAY: {
+            auto* sub_arrays = rpc_array.mutable_array_data()->mutable_data();
+            sub_arrays->Reserve(static_cast<int>(array.Size()));
+            for (const auto& sub_array : array.ArrayValues()) {
+                auto status = ConvertTemplateArray(sub_array, *sub_arrays->Add());
+                if (!status.IsOk()) {
+                    return status;
+                }
+            }
+            break;
+        }
+        default:
+            return {StatusCode::INVALID_ARGUMENT, "Unsupported template array type"};
+    }
+    return Status::OK();
+}
+
+}  // namespace
+
+Status
+ConvertFilterTemplates(const std::unordered_map<std::string, FilterTemplateArray>& templates,
+                       ::google::protobuf::Map<std::string, proto::schema::TemplateValue>* rpc_templates) {
+    for (const auto& pair : templates) {
+        // Fill the map-owned protobuf value to avoid copying populated messages across Windows DLL boundaries.
+        auto& value = (*rpc_templates)[pair.first];
+        auto status = ConvertTemplateArray(pair.second, *value.mutable_array_val());
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 // current_db is the actual target db that the request is performed, for setting the GuaranteeTimestamp
 // to compatible with old versions.
 // for examples:
@@ -1536,9 +1621,13 @@ ConvertQueryRequest(const T& request, const std::string& current_db, proto::milv
 
     rpc_request.set_expr(request.Filter());
     if (!request.Filter().empty()) {
+        // typed templates first, a json template with the same key is skipped
         auto rpc_templates = rpc_request.mutable_expr_template_values();
-        const auto& templates = request.FilterTemplates();
-        auto status = ConvertFilterTemplates(templates, rpc_templates);
+        auto status = ConvertFilterTemplates(GetTypedFilterTemplates(request), rpc_templates);
+        if (!status.IsOk()) {
+            return status;
+        }
+        status = ConvertFilterTemplates(request.FilterTemplates(), rpc_templates);
         if (!status.IsOk()) {
             return status;
         }
@@ -1584,17 +1673,26 @@ ConvertQueryRequest(const T& request, const std::string& current_db, proto::milv
     return Status::OK();
 }
 
+namespace {
+
+// With owned set to the rpc results, each column is released once it is decoded, so the peak memory is one copy
+// plus one column. The const overload passes nullptr and leaves the rpc results untouched.
 Status
-ConvertQueryResults(const proto::milvus::QueryResults& rpc_results, QueryResults& results) {
+ConvertQueryColumns(const proto::milvus::QueryResults& rpc_results, proto::milvus::QueryResults* owned,
+                    QueryResults& results) {
     std::vector<milvus::FieldDataPtr> return_fields{};
     return_fields.reserve(rpc_results.fields_data_size());
-    for (const auto& field_data : rpc_results.fields_data()) {
+    for (int i = 0; i < rpc_results.fields_data_size(); ++i) {
         FieldDataPtr field_ptr;
-        auto status = CreateMilvusFieldData(field_data, field_ptr);
+        auto status = CreateMilvusFieldData(rpc_results.fields_data(i), field_ptr);
         if (!status.IsOk()) {
             return status;
         }
         return_fields.emplace_back(std::move(field_ptr));
+        if (owned != nullptr) {
+            proto::schema::FieldData released;
+            owned->mutable_fields_data(i)->Swap(&released);
+        }
     }
 
     std::set<std::string> output_names;
@@ -1606,6 +1704,89 @@ ConvertQueryResults(const proto::milvus::QueryResults& rpc_results, QueryResults
     return Status::OK();
 }
 
+}  // namespace
+
+Status
+ConvertQueryResults(const proto::milvus::QueryResults& rpc_results, QueryResults& results) {
+    return ConvertQueryColumns(rpc_results, nullptr, results);
+}
+
+Status
+ConvertQueryResults(proto::milvus::QueryResults&& rpc_results, QueryResults& results) {
+    return ConvertQueryColumns(rpc_results, &rpc_results, results);
+}
+
+namespace {
+
+template <typename T>
+Status
+MarkListedRows(const std::vector<typename T::ElementT>& ids, const FieldDataPtr& pk_field, std::vector<bool>& keep) {
+    auto pk_ptr = std::dynamic_pointer_cast<T>(pk_field);
+    if (pk_ptr == nullptr) {
+        return {StatusCode::DATA_UNMATCH_SCHEMA, "Primary key type of the results does not match the id array"};
+    }
+    std::unordered_set<typename T::ElementT> members(ids.begin(), ids.end());
+    const auto& data = pk_ptr->Data();
+    keep.reserve(data.size());
+    for (const auto& value : data) {
+        keep.push_back(members.find(value) != members.end());
+    }
+    return Status::OK();
+}
+
+}  // namespace
+
+Status
+RecheckQueryResultIDs(const IDArray& ids, const std::string& pk_name, QueryResults& results) {
+    const auto pk_field = results.OutputField(pk_name);
+    if (pk_field == nullptr) {
+        return {StatusCode::UNKNOWN_ERROR, "Primary key field is missing in the results, unable to recheck ids"};
+    }
+
+    std::vector<bool> keep;
+    auto status = ids.IsIntegerID() ? MarkListedRows<Int64FieldData>(ids.IntIDArray(), pk_field, keep)
+                                    : MarkListedRows<VarCharFieldData>(ids.StrIDArray(), pk_field, keep);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (std::all_of(keep.begin(), keep.end(), [](bool kept) { return kept; })) {
+        return Status::OK();
+    }
+
+    // false positives are rare, so the kept rows are copied as long runs rather than one by one
+    std::vector<FieldDataPtr> kept_fields;
+    size_t from = 0;
+    while (from < keep.size()) {
+        if (!keep[from]) {
+            ++from;
+            continue;
+        }
+        auto to = from;
+        while (to < keep.size() && keep[to]) {
+            ++to;
+        }
+        std::vector<FieldDataPtr> run;
+        status = CopyFieldsData(results.OutputFields(), from, to, run);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (kept_fields.empty()) {
+            kept_fields = std::move(run);
+        } else {
+            for (size_t i = 0; i < run.size(); ++i) {
+                status = AppendFieldData(run[i], kept_fields[i]);
+                if (!status.IsOk()) {
+                    return status;
+                }
+            }
+        }
+        from = to;
+    }
+
+    results = QueryResults(std::move(kept_fields), results.OutputFieldNames());
+    return Status::OK();
+}
+
 // current_db is the actual target db that the request is performed, for setting the GuaranteeTimestamp
 // to compatible with old versions.
 // for examples:
@@ -1626,8 +1807,11 @@ ConvertSearchRequest(const T& request, const std::string& current_db, proto::mil
         rpc_request.set_dsl(request.Filter());
 
         auto rpc_templates = rpc_request.mutable_expr_template_values();
-        const auto& templates = request.FilterTemplates();
-        auto status = ConvertFilterTemplates(templates, rpc_templates);
+        auto status = ConvertFilterTemplates(request.TypedFilterTemplates(), rpc_templates);
+        if (!status.IsOk()) {
+            return status;
+        }
+        status = ConvertFilterTemplates(request.FilterTemplates(), rpc_templates);
         if (!status.IsOk()) {
             return status;
         }
@@ -1877,6 +2061,182 @@ ConvertSearchResults(const proto::milvus::SearchResults& rpc_results, const std:
     return Status::OK();
 }
 
+Status
+MergeSearchResults(const std::vector<const proto::milvus::SearchResults*>& rpc_results, const std::string& pk_name,
+                   MetricType metric_type, size_t offset, size_t limit, SearchResults& results) {
+    results = SearchResults{};
+    if (rpc_results.empty()) {
+        return Status::OK();
+    }
+
+    const auto& first = rpc_results.front()->results();
+    std::string real_pk_name = first.primary_field_name();
+    real_pk_name = real_pk_name.empty() ? pk_name : real_pk_name;
+    real_pk_name = real_pk_name.empty() ? "pk" : real_pk_name;
+
+    std::set<std::string> output_names;
+    for (const auto& name : first.output_fields()) {
+        output_names.insert(name);
+    }
+    // fields are ordered as the first collection returns them, and found by name in the others
+    std::vector<std::string> field_names;
+    for (const auto& field_data : first.fields_data()) {
+        field_names.push_back(field_data.field_name());
+    }
+    std::string score_name = SCORE;
+    while (std::find(field_names.begin(), field_names.end(), score_name) != field_names.end()) {
+        score_name = "_" + score_name;
+    }
+
+    const auto num_queries = first.num_queries();
+    const auto shard_count = rpc_results.size();
+    std::vector<std::vector<size_t>> bases(shard_count);
+    std::vector<std::vector<size_t>> topks(shard_count);
+    std::vector<std::vector<int>> field_indices(shard_count);
+    for (size_t s = 0; s < shard_count; ++s) {
+        const auto& data = rpc_results[s]->results();
+        if (data.num_queries() != num_queries) {
+            return {StatusCode::UNKNOWN_ERROR, "Collections returned different numbers of queries"};
+        }
+        size_t base = 0;
+        for (int64_t q = 0; q < num_queries; ++q) {
+            const size_t topk = q < data.topks_size() ? static_cast<size_t>(data.topks(static_cast<int>(q))) : 0;
+            bases[s].push_back(base);
+            topks[s].push_back(topk);
+            base += topk;
+        }
+        if (base > static_cast<size_t>(data.scores_size())) {
+            return {StatusCode::UNKNOWN_ERROR, "Search results do not contain a score for every hit"};
+        }
+        for (const auto& name : field_names) {
+            int index = -1;
+            for (int i = 0; i < data.fields_data_size(); ++i) {
+                if (data.fields_data(i).field_name() == name) {
+                    index = i;
+                    break;
+                }
+            }
+            field_indices[s].push_back(index);
+        }
+    }
+
+    // a collection without any hit may return no ids at all
+    bool int_pk = true;
+    for (const auto* rpc_result : rpc_results) {
+        const auto& ids = rpc_result->results().ids();
+        if (ids.has_int_id() || ids.has_str_id()) {
+            int_pk = ids.has_int_id();
+            break;
+        }
+    }
+
+    std::vector<SingleResult> single_results;
+    single_results.reserve(num_queries);
+    for (int64_t q = 0; q < num_queries; ++q) {
+        std::vector<RankedList> lists;
+        lists.reserve(shard_count);
+        for (size_t s = 0; s < shard_count; ++s) {
+            lists.push_back(RankedList{rpc_results[s]->results().scores().data() + bases[s][q], topks[s][q]});
+        }
+        const auto hits = MergeRankedLists(lists, offset, limit, LargerScoreFirst(metric_type, lists));
+
+        // the winners of a collection are a contiguous run of its ranking, only that run is decoded
+        std::vector<size_t> first_hit(shard_count, SIZE_MAX);
+        std::vector<size_t> last_hit(shard_count, 0);
+        for (const auto& hit : hits) {
+            first_hit[hit.list_] = std::min(first_hit[hit.list_], hit.position_);
+            last_hit[hit.list_] = std::max(last_hit[hit.list_], hit.position_);
+        }
+        std::vector<std::vector<FieldDataPtr>> decoded(shard_count);
+        for (size_t s = 0; s < shard_count; ++s) {
+            if (first_hit[s] == SIZE_MAX) {
+                continue;
+            }
+            const auto& data = rpc_results[s]->results();
+            for (auto index : field_indices[s]) {
+                if (index < 0) {
+                    return {StatusCode::UNKNOWN_ERROR, "Collections returned different output fields"};
+                }
+                FieldDataPtr field;
+                auto status = CreateMilvusFieldData(data.fields_data(index), bases[s][q] + first_hit[s],
+                                                    last_hit[s] - first_hit[s] + 1, field);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                decoded[s].emplace_back(std::move(field));
+            }
+        }
+
+        std::vector<FieldDataPtr> item_fields(field_names.size());
+        std::vector<int64_t> int_ids;
+        std::vector<std::string> str_ids;
+        std::vector<float> scores;
+        scores.reserve(hits.size());
+        for (size_t begin = 0; begin < hits.size();) {
+            // consecutive hits of the same collection are copied as one run
+            const auto shard = hits[begin].list_;
+            auto end = begin + 1;
+            while (end < hits.size() && hits[end].list_ == shard &&
+                   hits[end].position_ == hits[end - 1].position_ + 1) {
+                ++end;
+            }
+            const auto& data = rpc_results[shard]->results();
+            for (auto i = begin; i < end; ++i) {
+                const auto row = static_cast<int>(bases[shard][q] + hits[i].position_);
+                scores.push_back(data.scores(row));
+                if (int_pk) {
+                    int_ids.push_back(data.ids().int_id().data(row));
+                } else {
+                    str_ids.push_back(data.ids().str_id().data(row));
+                }
+            }
+
+            const auto from = hits[begin].position_ - first_hit[shard];
+            const auto to = hits[end - 1].position_ - first_hit[shard] + 1;
+            for (size_t f = 0; f < field_names.size(); ++f) {
+                FieldDataPtr piece;
+                auto status = CopyFieldData(decoded[shard][f], from, to, piece);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                status = item_fields[f] == nullptr ? Status::OK() : AppendFieldData(piece, item_fields[f]);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                if (item_fields[f] == nullptr) {
+                    item_fields[f] = std::move(piece);
+                }
+            }
+            begin = end;
+        }
+
+        for (size_t f = 0; f < field_names.size(); ++f) {
+            if (item_fields[f] == nullptr) {
+                // no hit, keep the field with no row
+                auto status = CreateMilvusFieldData(first.fields_data(static_cast<int>(f)), 0, 0, item_fields[f]);
+                if (!status.IsOk()) {
+                    return status;
+                }
+            }
+        }
+        if (int_pk) {
+            item_fields.emplace_back(std::make_shared<Int64FieldData>(real_pk_name, std::move(int_ids)));
+        } else {
+            item_fields.emplace_back(std::make_shared<VarCharFieldData>(real_pk_name, std::move(str_ids)));
+        }
+        item_fields.emplace_back(std::make_shared<FloatFieldData>(score_name, std::move(scores)));
+
+        try {
+            single_results.emplace_back(real_pk_name, score_name, std::move(item_fields), output_names);
+        } catch (const std::exception& e) {
+            return {StatusCode::UNKNOWN_ERROR, "Not able to merge search results, error: " + std::string(e.what())};
+        }
+    }
+
+    results = SearchResults(std::move(single_results));
+    return Status::OK();
+}
+
 namespace {
 
 nlohmann::json
@@ -2071,8 +2431,11 @@ ConvertHybridSearchRequest(const T& request, const std::string& current_db,
             search_req->set_dsl(sub_request->Filter());
 
             auto rpc_templates = search_req->mutable_expr_template_values();
-            const auto& templates = sub_request->FilterTemplates();
-            auto status = ConvertFilterTemplates(templates, rpc_templates);
+            auto status = ConvertFilterTemplates(sub_request->TypedFilterTemplates(), rpc_templates);
+            if (!status.IsOk()) {
+                return status;
+            }
+            status = ConvertFilterTemplates(sub_request->FilterTemplates(), rpc_templates);
             if (!status.IsOk()) {
                 return status;
             }
@@ -2152,14 +2515,14 @@ ConvertHybridSearchRequest(const T& request, const std::string& current_db,
 
 template <typename T>
 Status
-CopyFieldDataRange(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr& target) {
+CopyFieldDataRange(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr& target, bool share_full) {
     if (from >= to) {
         return {StatusCode::INVALID_ARGUMENT, "Illegal copy range"};
     }
 
     auto src_ptr = std::static_pointer_cast<T>(src);
     const auto& src_data = src_ptr->Data();
-    if (from == 0 && to == src->Count()) {
+    if (share_full && from == 0 && to == src->Count()) {
         target = src;
     } else {
         std::vector<typename T::ElementT> target_data{};
@@ -2179,7 +2542,7 @@ CopyFieldDataRange(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDat
 }
 
 Status
-CopyFieldData(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr& target) {
+CopyFieldData(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr& target, bool share_full) {
     if (src == nullptr) {
         return {StatusCode::INVALID_ARGUMENT, "Source field data is null pointer"};
     }
@@ -2192,66 +2555,66 @@ CopyFieldData(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr&
 
     switch (src->Type()) {
         case DataType::BOOL: {
-            return CopyFieldDataRange<BoolFieldData>(src, from, to, target);
+            return CopyFieldDataRange<BoolFieldData>(src, from, to, target, share_full);
         }
         case DataType::INT8: {
-            return CopyFieldDataRange<Int8FieldData>(src, from, to, target);
+            return CopyFieldDataRange<Int8FieldData>(src, from, to, target, share_full);
         }
         case DataType::INT16: {
-            return CopyFieldDataRange<Int16FieldData>(src, from, to, target);
+            return CopyFieldDataRange<Int16FieldData>(src, from, to, target, share_full);
         }
         case DataType::INT32: {
-            return CopyFieldDataRange<Int32FieldData>(src, from, to, target);
+            return CopyFieldDataRange<Int32FieldData>(src, from, to, target, share_full);
         }
         case DataType::INT64: {
-            return CopyFieldDataRange<Int64FieldData>(src, from, to, target);
+            return CopyFieldDataRange<Int64FieldData>(src, from, to, target, share_full);
         }
         case DataType::FLOAT: {
-            return CopyFieldDataRange<FloatFieldData>(src, from, to, target);
+            return CopyFieldDataRange<FloatFieldData>(src, from, to, target, share_full);
         }
         case DataType::DOUBLE: {
-            return CopyFieldDataRange<DoubleFieldData>(src, from, to, target);
+            return CopyFieldDataRange<DoubleFieldData>(src, from, to, target, share_full);
         }
         case DataType::VARCHAR:
         case DataType::GEOMETRY:
         case DataType::TEXT:
         case DataType::TIMESTAMPTZ: {
-            return CopyFieldDataRange<VarCharFieldData>(src, from, to, target);
+            return CopyFieldDataRange<VarCharFieldData>(src, from, to, target, share_full);
         }
         case DataType::JSON: {
-            return CopyFieldDataRange<JSONFieldData>(src, from, to, target);
+            return CopyFieldDataRange<JSONFieldData>(src, from, to, target, share_full);
         }
         case DataType::ARRAY: {
             switch (src->ElementType()) {
                 case DataType::BOOL: {
-                    return CopyFieldDataRange<ArrayBoolFieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayBoolFieldData>(src, from, to, target, share_full);
                 }
                 case DataType::INT8: {
-                    return CopyFieldDataRange<ArrayInt8FieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayInt8FieldData>(src, from, to, target, share_full);
                 }
                 case DataType::INT16: {
-                    return CopyFieldDataRange<ArrayInt16FieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayInt16FieldData>(src, from, to, target, share_full);
                 }
                 case DataType::INT32: {
-                    return CopyFieldDataRange<ArrayInt32FieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayInt32FieldData>(src, from, to, target, share_full);
                 }
                 case DataType::INT64: {
-                    return CopyFieldDataRange<ArrayInt64FieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayInt64FieldData>(src, from, to, target, share_full);
                 }
                 case DataType::FLOAT: {
-                    return CopyFieldDataRange<ArrayFloatFieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayFloatFieldData>(src, from, to, target, share_full);
                 }
                 case DataType::DOUBLE: {
-                    return CopyFieldDataRange<ArrayDoubleFieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayDoubleFieldData>(src, from, to, target, share_full);
                 }
                 case DataType::VARCHAR:
                 case DataType::GEOMETRY:
                 case DataType::TEXT:
                 case DataType::TIMESTAMPTZ: {
-                    return CopyFieldDataRange<ArrayVarCharFieldData>(src, from, to, target);
+                    return CopyFieldDataRange<ArrayVarCharFieldData>(src, from, to, target, share_full);
                 }
                 case DataType::STRUCT: {
-                    return CopyFieldDataRange<StructFieldData>(src, from, to, target);
+                    return CopyFieldDataRange<StructFieldData>(src, from, to, target, share_full);
                 }
                 default: {
                     std::string msg = "Unsupported element type: " + std::to_string(src->ElementType());
@@ -2260,22 +2623,22 @@ CopyFieldData(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr&
             }
         }
         case DataType::BINARY_VECTOR: {
-            return CopyFieldDataRange<BinaryVecFieldData>(src, from, to, target);
+            return CopyFieldDataRange<BinaryVecFieldData>(src, from, to, target, share_full);
         }
         case DataType::FLOAT_VECTOR: {
-            return CopyFieldDataRange<FloatVecFieldData>(src, from, to, target);
+            return CopyFieldDataRange<FloatVecFieldData>(src, from, to, target, share_full);
         }
         case DataType::FLOAT16_VECTOR: {
-            return CopyFieldDataRange<Float16VecFieldData>(src, from, to, target);
+            return CopyFieldDataRange<Float16VecFieldData>(src, from, to, target, share_full);
         }
         case DataType::BFLOAT16_VECTOR: {
-            return CopyFieldDataRange<BFloat16VecFieldData>(src, from, to, target);
+            return CopyFieldDataRange<BFloat16VecFieldData>(src, from, to, target, share_full);
         }
         case DataType::SPARSE_FLOAT_VECTOR: {
-            return CopyFieldDataRange<SparseFloatVecFieldData>(src, from, to, target);
+            return CopyFieldDataRange<SparseFloatVecFieldData>(src, from, to, target, share_full);
         }
         case DataType::INT8_VECTOR: {
-            return CopyFieldDataRange<Int8VecFieldData>(src, from, to, target);
+            return CopyFieldDataRange<Int8VecFieldData>(src, from, to, target, share_full);
         }
         default: {
             return {StatusCode::NOT_SUPPORTED, "Unsupported field type: " + std::to_string(src->Type())};
@@ -2414,14 +2777,10 @@ AppendFieldData(const FieldDataPtr& from, FieldDataPtr& to) {
     return Status::OK();
 }
 
-Status
-AppendSearchResult(const SingleResult& from, SingleResult& to) {
-    if (to.GetRowCount() == 0) {
-        // target is empty, no need to copy, just return the souce
-        to = SingleResult(from);
-        return Status::OK();
-    }
+namespace {
 
+Status
+AppendSearchFields(const SingleResult& from, SingleResult& to) {
     const auto& from_fields = from.OutputFields();
     for (const auto& from_field : from_fields) {
         auto to_field = to.OutputField(from_field->Name());
@@ -2438,6 +2797,28 @@ AppendSearchResult(const SingleResult& from, SingleResult& to) {
     return Status::OK();
 }
 
+}  // namespace
+
+Status
+AppendSearchResult(const SingleResult& from, SingleResult& to) {
+    if (to.GetRowCount() == 0) {
+        // target is empty, no need to copy, just return the souce
+        to = SingleResult(from);
+        return Status::OK();
+    }
+    return AppendSearchFields(from, to);
+}
+
+Status
+AppendSearchResult(SingleResult&& from, SingleResult& to) {
+    if (to.GetRowCount() == 0) {
+        // target is empty, take over the source fields
+        to = std::move(from);
+        return Status::OK();
+    }
+    return AppendSearchFields(from, to);
+}
+
 Status
 IsAmbiguousParam(const std::string& key) {
     static std::set<std::string> s_ambiguous = {PARAMS, TOPK, ANNS_FIELD, METRIC_TYPE, CLUSTER_ID};
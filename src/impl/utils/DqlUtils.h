@@ -25,6 +25,7 @@
 #include "milvus/request/dql/SearchRequest.h"
 #include "milvus/types/AggregationBucket.h"
 #include "milvus/types/FieldData.h"
+#include "milvus/types/FilterTemplateArray.h"
 #include "milvus/types/HybridSearchArguments.h"
 #include "milvus/types/IteratorArguments.h"
 #include "milvus/types/QueryArguments.h"
@@ -76,6 +77,14 @@ Status
 ConvertFilterTemplates(const std::unordered_map<std::string, nlohmann::json>& templates,
                        ::google::protobuf::Map<std::string, proto::schema::TemplateValue>* rpc_templates);
 
+Status
+ConvertFilterTemplates(const std::unordered_map<std::string, FilterTemplateArray>& templates,
+                       ::google::protobuf::Map<std::string, proto::schema::TemplateValue>* rpc_templates);
+
+// drop the rows whose primary key is not in the id array, the false positives of a bloom prefilter
+Status
+RecheckQueryResultIDs(const IDArray& ids, const std::string& pk_name, QueryResults& results);
+
 template <typename T>
 Status
 ConvertQueryRequest(const T& request, const std::string& current_db, proto::milvus::QueryRequest& rpc_request,
@@ -84,6 +93,9 @@ ConvertQueryRequest(const T& request, const std::string& current_db, proto::milv
 Status
 ConvertQueryResults(const proto::milvus::QueryResults& rpc_results, QueryResults& results);
 
+Status
+ConvertQueryResults(proto::milvus::QueryResults&& rpc_results, QueryResults& results);
+
 template <typename T>
 Status
 ConvertSearchRequest(const T& request, const std::string& current_db, proto::milvus::SearchRequest& rpc_request,
@@ -93,6 +105,12 @@ Status
 ConvertSearchResults(const proto::milvus::SearchResults& rpc_results, const std::string& pk_name,
                      SearchResults& results);
 
+// Merge the results of one search sent to several collections into a global top-k of each query. The output
+// fields are only decoded for the rows that make it into the merged results.
+Status
+MergeSearchResults(const std::vector<const proto::milvus::SearchResults*>& rpc_results, const std::string& pk_name,
+                   MetricType metric_type, size_t offset, size_t limit, SearchResults& results);
+
 void
 ConvertSearchAggregation(const SearchAggregation& aggregation, proto::common::SearchAggregationSpec& rpc_aggregation);
 
@@ -108,8 +126,10 @@ ConvertHybridSearchRequest(const T& request, const std::string& current_db,
                            proto::milvus::HybridSearchRequest& rpc_request, const std::string& cluster_id = "",
                            const std::string& endpoint = "");
 
+// Copy rows [from, to) of src. A full range shares src unless share_full is false, then target can be appended.
 Status
-CopyFieldData(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr& target);
+CopyFieldData(const FieldDataPtr& src, uint64_t from, uint64_t to, FieldDataPtr& target,
+              bool share_full = true);
 
 Status
 CopyFieldsData(const std::vector<FieldDataPtr>& src, uint64_t from, uint64_t to, std::vector<FieldDataPtr>& target);
@@ -120,6 +140,9 @@ AppendFieldData(const FieldDataPtr& from, FieldDataPtr& to);
 Status
 AppendSearchResult(const SingleResult& from, SingleResult& to);
 
+Status
+AppendSearchResult(SingleResult&& from, SingleResult& to);
+
 Status
 IsAmbiguousParam(const std::string& key);
 
@@ -0,0 +1,144 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "IDsEncodingUtils.h"
+
+#include "milvus/types/BloomFilter.h"
+#include "milvus/types/RoaringBitmap.h"
+
+namespace milvus {
+
+namespace {
+
+// every blob starts with a 32-byte envelope header, RoaringBitmapStats::body_length excludes it
+constexpr uint64_t kBlobHeaderSize = 32;
+
+uint64_t
+VarintSize(uint64_t value) {
+    uint64_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+// A roaring bitmap is picked when it is at most half the size of the list: a dense set shrinks by an order
+// of magnitude, while a sparse set gains nothing and the list is cheaper for the server to parse. A bloom
+// prefilter is only picked when the list would not pass the proxy receive limit anyway.
+IDsEncoding
+ChooseIDsEncoding(const IDArray& ids, bool exact_only, nlohmann::json& blob) {
+    const auto count = ids.GetRowCount();
+    if (count < IDsEncodingMinAutoCount) {
+        return IDsEncoding::LIST;
+    }
+
+    const auto list_size = EstimateIDsListSize(ids);
+    if (ids.IsIntegerID()) {
+        RoaringBitmapBuilder builder;
+        builder.AddInt64s(ids.IntIDArray());
+        if (builder.Validate().IsOk()) {
+            const auto stats = builder.Stats();
+            if ((stats.body_length + kBlobHeaderSize) * 2 <= list_size) {
+                blob = builder.BuildTemplate();
+                return IDsEncoding::ROARING_BITMAP;
+            }
+        }
+    }
+
+    if (!exact_only && list_size > IDsEncodingMaxListSize) {
+        uint64_t bloom_size = 0;
+        auto status = EstimateBloomFilterSize(count, BloomFilterDefaultFPR, bloom_size);
+        if (status.IsOk() && bloom_size < list_size) {
+            return IDsEncoding::BLOOM_PREFILTER;
+        }
+    }
+    return IDsEncoding::LIST;
+}
+
+}  // namespace
+
+FilterTemplateArray
+CreateIDsTemplate(const IDArray& ids) {
+    if (ids.IsIntegerID()) {
+        return FilterTemplateArray::Int64s(ids.IntIDArray());
+    }
+    return FilterTemplateArray::Strings(ids.StrIDArray());
+}
+
+uint64_t
+EstimateIDsListSize(const IDArray& ids) {
+    uint64_t size = 0;
+    if (ids.IsIntegerID()) {
+        for (const auto id : ids.IntIDArray()) {
+            size += VarintSize(static_cast<uint64_t>(id));
+        }
+    } else {
+        // one tag byte and a length prefix per string
+        for (const auto& id : ids.StrIDArray()) {
+            size += 1 + VarintSize(id.size()) + id.size();
+        }
+    }
+    return size;
+}
+
+Status
+BuildIDsFilter(const IDArray& ids, const std::string& pk_name, const std::string& key, IDsEncoding encoding,
+               bool exact_only, IDsFilter& filter) {
+    filter = IDsFilter{};
+    if (encoding == IDsEncoding::AUTO) {
+        encoding = ChooseIDsEncoding(ids, exact_only, filter.blob);
+    } else if (encoding == IDsEncoding::ROARING_BITMAP) {
+        if (!ids.IsIntegerID()) {
+            return {StatusCode::INVALID_ARGUMENT, "Roaring bitmap encoding requires integer primary keys"};
+        }
+        auto status = RoaringBitmapTemplate(ids.IntIDArray(), filter.blob);
+        if (!status.IsOk()) {
+            return status;
+        }
+    } else if (encoding == IDsEncoding::BLOOM_PREFILTER && exact_only) {
+        return {StatusCode::INVALID_ARGUMENT,
+                "Bloom prefilter encoding is not exact, not allowed for delete, limit, offset or count(*)"};
+    }
+
+    filter.encoding = encoding;
+    switch (encoding) {
+        case IDsEncoding::ROARING_BITMAP: {
+            filter.expression = "roaring_match(" + pk_name + ", {" + key + "})";
+            break;
+        }
+        case IDsEncoding::BLOOM_PREFILTER: {
+            // the template is only built once the encoding is settled, AUTO rarely gets here
+            auto status = ids.IsIntegerID()
+                              ? BloomFilterTemplate(ids.IntIDArray(), BloomFilterDefaultFPR, filter.blob)
+                              : BloomFilterTemplate(ids.StrIDArray(), BloomFilterDefaultFPR, filter.blob);
+            if (!status.IsOk()) {
+                return status;
+            }
+            filter.expression = "bloom_match(" + pk_name + ", {" + key + "})";
+            break;
+        }
+        default: {
+            filter.encoding = IDsEncoding::LIST;
+            filter.expression = pk_name + " in {" + key + "}";
+            filter.list = CreateIDsTemplate(ids);
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+}  // namespace milvus
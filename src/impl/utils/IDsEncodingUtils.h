@@ -0,0 +1,69 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <milvus/thirdparty/nlohmann/json.hpp>
+#include <string>
+
+#include "milvus/Status.h"
+#include "milvus/types/FilterTemplateArray.h"
+#include "milvus/types/IDArray.h"
+#include "milvus/types/IDsEncoding.h"
+
+namespace milvus {
+
+// below this many ids AUTO always sends a list, the server parses a short list faster than it decodes a blob
+constexpr uint64_t IDsEncodingMinAutoCount = 1024;
+
+// AUTO only falls back to a bloom prefilter for a list this large, half of the default proxy receive limit,
+// because the false positives it lets through scale with the collection, not with the id set
+constexpr uint64_t IDsEncodingMaxListSize = 64ULL * 1024 * 1024;
+
+/**
+ * @brief The filter expression and template that carry an id set.
+ */
+struct IDsFilter {
+    // never AUTO once built
+    IDsEncoding encoding{IDsEncoding::LIST};
+    std::string expression;
+    // template value for LIST
+    FilterTemplateArray list;
+    // template value for ROARING_BITMAP and BLOOM_PREFILTER, a JSON binary blob
+    nlohmann::json blob;
+
+    // the server returns the false positives of a bloom prefilter, the caller must drop them
+    bool
+    NeedRecheck() const {
+        return encoding == IDsEncoding::BLOOM_PREFILTER;
+    }
+};
+
+FilterTemplateArray
+CreateIDsTemplate(const IDArray& ids);
+
+// wire size of the id array sent as a `pk in {ids}` template, varint int64 or length-prefixed strings
+uint64_t
+EstimateIDsListSize(const IDArray& ids);
+
+// exact_only is set by the callers that cannot recheck the results: Delete(), and Query() with limit,
+// offset or count(*). An explicit BLOOM_PREFILTER is refused for them, AUTO never picks it.
+Status
+BuildIDsFilter(const IDArray& ids, const std::string& pk_name, const std::string& key, IDsEncoding encoding,
+               bool exact_only, IDsFilter& filter);
+
+}  // namespace milvus
@@ -0,0 +1,158 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MemoryUtils.h"
+
+#include <climits>
+
+namespace milvus {
+
+namespace {
+
+// a red-black tree node keeps its color and three links ahead of the value
+constexpr size_t kTreeNodeBytes = 4 * sizeof(void*);
+
+// a hash node keeps the next link and the cached hash ahead of the value
+constexpr size_t kHashNodeBytes = 2 * sizeof(void*);
+
+template <typename Map>
+size_t
+HashMapBytes(const Map& value) {
+    size_t bytes = value.bucket_count() * sizeof(void*);
+    for (const auto& entry : value) {
+        bytes += kHashNodeBytes + sizeof(typename Map::value_type) + HeapBytes(entry.first) + HeapBytes(entry.second);
+    }
+    return bytes;
+}
+
+}  // namespace
+
+size_t
+HeapBytes(const std::string& value) {
+    // the capacity of an empty string is the inline buffer of the small string optimization
+    static const size_t inline_capacity = std::string().capacity();
+    return value.capacity() > inline_capacity ? value.capacity() + 1 : 0;
+}
+
+size_t
+HeapBytes(const std::vector<bool>& value) {
+    return (value.capacity() + CHAR_BIT - 1) / CHAR_BIT;
+}
+
+size_t
+HeapBytes(const std::map<uint32_t, float>& value) {
+    return value.size() * (kTreeNodeBytes + sizeof(std::map<uint32_t, float>::value_type));
+}
+
+size_t
+HeapBytes(const std::set<std::string>& value) {
+    size_t bytes = value.size() * (kTreeNodeBytes + sizeof(std::string));
+    for (const auto& item : value) {
+        bytes += HeapBytes(item);
+    }
+    return bytes;
+}
+
+size_t
+HeapBytes(const nlohmann::json& value) {
+    // a json keeps strings, arrays and objects in separately allocated containers
+    switch (value.type()) {
+        case nlohmann::json::value_t::string:
+            return sizeof(nlohmann::json::string_t) + HeapBytes(value.get_ref<const nlohmann::json::string_t&>());
+        case nlohmann::json::value_t::array:
+            return sizeof(nlohmann::json::array_t) + HeapBytes(value.get_ref<const nlohmann::json::array_t&>());
+        case nlohmann::json::value_t::object: {
+            const auto& object = value.get_ref<const nlohmann::json::object_t&>();
+            size_t bytes = sizeof(nlohmann::json::object_t);
+            for (const auto& entry : object) {
+                bytes += kTreeNodeBytes + sizeof(nlohmann::json::object_t::value_type) + HeapBytes(entry.first) +
+                         HeapBytes(entry.second);
+            }
+            return bytes;
+        }
+        case nlohmann::json::value_t::binary:
+            return sizeof(nlohmann::json::binary_t) + value.get_binary().capacity();
+        default:
+            return 0;
+    }
+}
+
+size_t
+HeapBytes(const std::unordered_map<std::string, std::string>& value) {
+    return HashMapBytes(value);
+}
+
+size_t
+HeapBytes(const std::unordered_map<std::string, nlohmann::json>& value) {
+    return HashMapBytes(value);
+}
+
+size_t
+HeapBytes(const std::unordered_map<std::string, FilterTemplateArray>& value) {
+    return HashMapBytes(value);
+}
+
+size_t
+HeapBytes(const IDArray& value) {
+    return HeapBytes(value.IntIDArray()) + HeapBytes(value.StrIDArray());
+}
+
+size_t
+HeapBytes(const FilterTemplateArray& value) {
+    // the values are shared between copies, each copy counts them
+    return HeapBytes(value.BoolValues()) + HeapBytes(value.Int64Values()) + HeapBytes(value.DoubleValues()) +
+           HeapBytes(value.StringValues()) + HeapBytes(value.ArrayValues());
+}
+
+size_t
+HeapBytes(const EmbeddingList& value) {
+    const auto& vectors = value.TargetVectors();
+    return vectors == nullptr ? 0 : vectors->MemoryUsage();
+}
+
+size_t
+HeapBytes(const HighlightResults& value) {
+    size_t bytes = value.bucket_count() * sizeof(void*);
+    for (const auto& entry : value) {
+        const auto& result = entry.second;
+        bytes += kHashNodeBytes + sizeof(HighlightResults::value_type) + HeapBytes(entry.first) +
+                 HeapBytes(result.field_name) + HeapBytes(result.fragments) + HeapBytes(result.scores);
+    }
+    return bytes;
+}
+
+size_t
+HeapBytes(const FieldPartialUpdateOp& value) {
+    return HeapBytes(value.FieldName());
+}
+
+size_t
+HeapBytes(const OrderByField& value) {
+    return HeapBytes(value.FieldName());
+}
+
+size_t
+FieldsMemoryUsage(const std::vector<FieldDataPtr>& fields, std::unordered_set<const Field*>& seen) {
+    size_t bytes = fields.capacity() * sizeof(FieldDataPtr);
+    for (const auto& field : fields) {
+        if (field != nullptr && seen.insert(field.get()).second) {
+            bytes += field->MemoryUsage();
+        }
+    }
+    return bytes;
+}
+
+}  // namespace milvus
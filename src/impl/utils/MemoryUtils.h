@@ -0,0 +1,107 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "milvus/types/EmbeddingList.h"
+#include "milvus/types/FieldData.h"
+#include "milvus/types/FieldPartialUpdateOp.h"
+#include "milvus/types/FilterTemplateArray.h"
+#include "milvus/types/IDArray.h"
+#include "milvus/types/OrderByField.h"
+#include "milvus/types/SearchResults.h"
+
+namespace milvus {
+
+// HeapBytes() estimates the bytes a value owns on the heap, the value object itself is not included. Vectors count
+// their capacity, strings count their capacity once it outgrows the inline buffer, node based containers count a
+// node header per entry. Allocator headers and padding are ignored.
+
+template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+size_t
+HeapBytes(const T&) {
+    return 0;
+}
+
+size_t
+HeapBytes(const std::string& value);
+
+size_t
+HeapBytes(const std::vector<bool>& value);
+
+size_t
+HeapBytes(const std::map<uint32_t, float>& value);
+
+size_t
+HeapBytes(const std::set<std::string>& value);
+
+size_t
+HeapBytes(const nlohmann::json& value);
+
+size_t
+HeapBytes(const std::unordered_map<std::string, std::string>& value);
+
+size_t
+HeapBytes(const std::unordered_map<std::string, nlohmann::json>& value);
+
+size_t
+HeapBytes(const std::unordered_map<std::string, FilterTemplateArray>& value);
+
+size_t
+HeapBytes(const IDArray& value);
+
+size_t
+HeapBytes(const FilterTemplateArray& value);
+
+size_t
+HeapBytes(const EmbeddingList& value);
+
+size_t
+HeapBytes(const HighlightResults& value);
+
+size_t
+HeapBytes(const FieldPartialUpdateOp& value);
+
+size_t
+HeapBytes(const OrderByField& value);
+
+template <typename T>
+size_t
+HeapBytes(const std::vector<T>& value) {
+    size_t bytes = value.capacity() * sizeof(T);
+    if (!std::is_arithmetic<T>::value) {
+        for (const auto& item : value) {
+            bytes += HeapBytes(item);
+        }
+    }
+    return bytes;
+}
+
+// The footprint of the fields, a field shared by several holders is counted the first time it is seen.
+size_t
+FieldsMemoryUsage(const std::vector<FieldDataPtr>& fields, std::unordered_set<const Field*>& seen);
+
+}  // namespace milvus
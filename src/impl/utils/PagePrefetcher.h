@@ -0,0 +1,192 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "milvus/Status.h"
+#include "milvus/types/IteratorPrefetchStats.h"
+
+namespace milvus {
+
+/**
+ * Fetches pages of an iterator in a background thread while the caller consumes earlier pages.
+ * The fetcher is only called from the background thread, it owns the iterator cursor after the
+ * prefetcher is started. The thread is launched by Start(), so the owner can publish the prefetcher
+ * before the fetcher runs and reads it. At most `depth` pages are buffered, the thread waits for the consumer
+ * when the buffer is full and exits when the fetcher reports the last page, fails, or Stop() is called.
+ */
+template <typename Page>
+class PagePrefetcher {
+ public:
+    using Fetcher = std::function<Status(Page& page, bool& last)>;
+
+    PagePrefetcher(size_t depth, Fetcher fetcher) : depth_(depth == 0 ? 1 : depth), fetcher_(std::move(fetcher)) {
+    }
+
+    ~PagePrefetcher() {
+        Stop();
+    }
+
+    PagePrefetcher(const PagePrefetcher&) = delete;
+    PagePrefetcher&
+    operator=(const PagePrefetcher&) = delete;
+
+    /**
+     * Launch the background thread. Calling it again, or after Stop(), does nothing.
+     */
+    void
+    Start() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (worker_.joinable() || Stopping()) {
+            return;
+        }
+        worker_ = std::thread(&PagePrefetcher::run, this);
+    }
+
+    /**
+     * Take the next page in fetch order, wait if it is not fetched yet.
+     * The end flag is set when all pages are consumed. Must not be called before Start().
+     */
+    Status
+    Next(Page& page, bool& end) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const bool waited = pages_.empty() && !done_;
+        if (waited) {
+            cv_.wait(lock, [this]() { return !pages_.empty() || done_; });
+        }
+
+        if (pages_.empty()) {
+            end = true;
+            return status_;
+        }
+
+        if (waited) {
+            ++misses_;
+        } else {
+            ++hits_;
+        }
+        end = false;
+        page = std::move(pages_.front());
+        pages_.pop_front();
+        cv_.notify_all();
+        return Status::OK();
+    }
+
+    /**
+     * Cancel outstanding work and wait for the background thread. A fetch in flight is not
+     * interrupted, but the fetcher can poll Stopping() to skip retries.
+     */
+    void
+    Stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_.store(true, std::memory_order_release);
+            // without a worker nothing else ends the page stream
+            if (!worker_.joinable()) {
+                done_ = true;
+            }
+        }
+        cv_.notify_all();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    bool
+    Stopping() const {
+        return stopping_.load(std::memory_order_acquire);
+    }
+
+    IteratorPrefetchStats
+    Stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {depth_, fetched_, hits_, misses_};
+    }
+
+ private:
+    void
+    run() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return pages_.size() < depth_ || Stopping(); });
+                if (Stopping()) {
+                    break;
+                }
+            }
+
+            Page page;
+            bool last = false;
+            Status status;
+            try {
+                status = fetcher_(page, last);
+            } catch (const std::exception& e) {
+                status = Status{StatusCode::UNKNOWN_ERROR, "Iterator prefetch failed: " + std::string(e.what())};
+            } catch (...) {
+                status = Status{StatusCode::UNKNOWN_ERROR, "Iterator prefetch failed with unknown exception"};
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!status.IsOk()) {
+                status_ = status;
+                last = true;
+            } else {
+                pages_.emplace_back(std::move(page));
+                ++fetched_;
+            }
+            if (last) {
+                break;
+            }
+            cv_.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    const size_t depth_;
+    Fetcher fetcher_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Page> pages_;
+    Status status_;
+    bool done_ = false;
+    std::atomic<bool> stopping_{false};
+
+    uint64_t fetched_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+
+    std::thread worker_;
+};
+
+}  // namespace milvus
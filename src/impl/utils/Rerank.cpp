@@ -0,0 +1,179 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "milvus/utils/Rerank.h"
+
+#include <set>
+#include <string>
+
+#include "utils/DqlUtils.h"
+#include "utils/RerankUtils.h"
+
+namespace milvus {
+
+namespace {
+
+// Output fields of the first list that every list has with the same type, the key and score are excluded.
+std::vector<std::string>
+SharedFieldNames(const std::vector<RerankInput>& inputs) {
+    std::vector<std::string> names;
+    const auto& first = *inputs.front().result;
+    for (const auto& field : first.OutputFields()) {
+        if (field == nullptr || field->Name() == first.PrimaryKeyName() || field->Name() == first.ScoreName()) {
+            continue;
+        }
+        bool shared = true;
+        for (const auto& input : inputs) {
+            auto other = input.result->OutputField(field->Name());
+            if (other == nullptr || other->Type() != field->Type() || other->ElementType() != field->ElementType()) {
+                shared = false;
+                break;
+            }
+        }
+        if (shared) {
+            names.push_back(field->Name());
+        }
+    }
+    return names;
+}
+
+}  // namespace
+
+Status
+RerankResults(const FunctionPtr& ranker, const std::vector<RerankInput>& inputs, int64_t limit,
+              SingleResult& result) {
+    if (ranker == nullptr) {
+        return {StatusCode::INVALID_ARGUMENT, "Rerank function is null"};
+    }
+    if (limit <= 0) {
+        return {StatusCode::INVALID_ARGUMENT, "Rerank limit must be greater than 0"};
+    }
+    for (const auto& input : inputs) {
+        if (input.result == nullptr) {
+            return {StatusCode::INVALID_ARGUMENT, "Rerank input has no result"};
+        }
+    }
+
+    RerankParams params;
+    auto status = ParseRerankFunction(*ranker, inputs.size(), params);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    // Ids() returns a copy, the ids are kept alive here while the lists point into them
+    std::vector<IDArray> ids;
+    ids.reserve(inputs.size());
+    std::vector<RerankList> lists;
+    lists.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        ids.emplace_back(input.result->Ids());
+        const auto& id_array = ids.back();
+        RerankList list;
+        if (id_array.IsIntegerID()) {
+            list.int_ids_ = &id_array.IntIDArray();
+        } else {
+            list.str_ids_ = &id_array.StrIDArray();
+        }
+        list.scores_ = &input.result->Scores();
+        list.metric_type_ = input.metric_type;
+        lists.push_back(list);
+    }
+
+    std::vector<FusedHit> hits;
+    status = FuseRankedLists(params, lists, static_cast<size_t>(limit), hits);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const std::string pk_name = inputs.empty() ? "id" : inputs.front().result->PrimaryKeyName();
+    const std::string score_name = inputs.empty() ? "score" : inputs.front().result->ScoreName();
+    std::vector<std::string> field_names;
+    if (!inputs.empty()) {
+        field_names = SharedFieldNames(inputs);
+    }
+
+    std::vector<FieldDataPtr> fields;
+    std::set<std::string> output_names;
+    for (const auto& name : field_names) {
+        FieldDataPtr target;
+        for (size_t begin = 0; begin < hits.size();) {
+            // consecutive rows of the same list are copied as one run
+            auto end = begin + 1;
+            while (end < hits.size() && hits[end].list_ == hits[begin].list_ &&
+                   hits[end].row_ == hits[end - 1].row_ + 1) {
+                ++end;
+            }
+            const auto source = inputs[hits[begin].list_].result->OutputField(name);
+            FieldDataPtr piece;
+            // the first piece becomes the target, it must not share the caller's field
+            status = CopyFieldData(source, hits[begin].row_, hits[end - 1].row_ + 1, piece, target != nullptr);
+            if (status.IsOk() && target != nullptr) {
+                status = AppendFieldData(piece, target);
+            }
+            if (!status.IsOk()) {
+                return status;
+            }
+            if (target == nullptr) {
+                target = std::move(piece);
+            }
+            begin = end;
+        }
+        if (target != nullptr) {
+            fields.emplace_back(std::move(target));
+            output_names.insert(name);
+        }
+    }
+
+    std::vector<float> scores;
+    scores.reserve(hits.size());
+    std::vector<int64_t> int_ids;
+    std::vector<std::string> str_ids;
+    bool int_pk = true;
+    for (const auto& hit : hits) {
+        scores.push_back(hit.score_);
+        const auto& list = lists[hit.list_];
+        if (list.int_ids_ != nullptr) {
+            int_ids.push_back((*list.int_ids_)[hit.row_]);
+        } else {
+            int_pk = false;
+            str_ids.push_back((*list.str_ids_)[hit.row_]);
+        }
+    }
+    if (int_pk) {
+        fields.emplace_back(std::make_shared<Int64FieldData>(pk_name, std::move(int_ids)));
+    } else {
+        fields.emplace_back(std::make_shared<VarCharFieldData>(pk_name, std::move(str_ids)));
+    }
+    fields.emplace_back(std::make_shared<FloatFieldData>(score_name, std::move(scores)));
+
+    try {
+        result = SingleResult(pk_name, score_name, std::move(fields), output_names);
+    } catch (const std::exception& e) {
+        return {StatusCode::UNKNOWN_ERROR, "Not able to build rerank result, error: " + std::string(e.what())};
+    }
+    return Status::OK();
+}
+
+Status
+RerankResults(const FunctionScorePtr& function_score, const std::vector<RerankInput>& inputs, int64_t limit,
+              SingleResult& result) {
+    if (function_score == nullptr || function_score->Functions().size() != 1) {
+        return {StatusCode::INVALID_ARGUMENT, "Client side rerank requires exactly one rerank function"};
+    }
+    return RerankResults(function_score->Functions().front(), inputs, limit, result);
+}
+
+}  // namespace milvus
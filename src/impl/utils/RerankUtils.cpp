@@ -0,0 +1,360 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/RerankUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <milvus/thirdparty/nlohmann/json.hpp>
+
+#include "utils/Constants.h"
+#include "utils/TopKMerge.h"
+
+namespace milvus {
+
+namespace {
+
+constexpr float kInvPi = 0.31830988618379067f;
+constexpr size_t kNotSeen = std::numeric_limits<size_t>::max();
+
+uint64_t
+MixHash(uint64_t x) {
+    // splitmix64 finalizer, consecutive primary keys spread over the whole table
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+void
+MinMaxScale(const float* scores, size_t count, float* normalized) {
+    if (count == 0) {
+        return;
+    }
+    const auto range = std::minmax_element(scores, scores + count);
+    const float low = *range.first;
+    const float high = *range.second;
+    if (high == low) {
+        std::fill(normalized, normalized + count, 1.0f);
+        return;
+    }
+    const float scale = 1.0f / (high - low);
+    if (LargerScoreFirst(MetricType::DEFAULT, {RankedList{scores, count}})) {
+        for (size_t i = 0; i < count; ++i) {
+            normalized[i] = (scores[i] - low) * scale;
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            normalized[i] = (high - scores[i]) * scale;
+        }
+    }
+}
+
+}  // namespace
+
+Status
+ParseRerankFunction(const Function& function, size_t list_count, RerankParams& params) {
+    if (function.GetFunctionType() != FunctionType::RERANK) {
+        return {StatusCode::INVALID_ARGUMENT, "Function " + function.Name() + " is not a rerank function"};
+    }
+    const auto& function_params = function.Params();
+    auto it = function_params.find(STRATEGY);
+    if (it == function_params.end() || (it->second != "rrf" && it->second != "weighted")) {
+        return {StatusCode::NOT_SUPPORTED, "Only rrf and weighted rerank are supported on the client side"};
+    }
+    params = RerankParams{};
+    params.strategy_ = it->second == "rrf" ? RerankStrategy::RRF : RerankStrategy::WEIGHTED;
+
+    nlohmann::json json_params = nlohmann::json::object();
+    it = function_params.find(PARAMS);
+    if (it != function_params.end()) {
+        json_params = nlohmann::json::parse(it->second, nullptr, false);
+        if (json_params.is_discarded() || !json_params.is_object()) {
+            return {StatusCode::INVALID_ARGUMENT, "Rerank params is not a json object: " + it->second};
+        }
+    }
+
+    if (json_params.contains("norm_score")) {
+        if (!json_params["norm_score"].is_boolean()) {
+            return {StatusCode::INVALID_ARGUMENT, "norm_score of weighted rerank must be a boolean"};
+        }
+        params.norm_score_ = json_params["norm_score"].get<bool>();
+    }
+
+    if (params.strategy_ == RerankStrategy::RRF) {
+        if (json_params.contains("k")) {
+            if (!json_params["k"].is_number_integer()) {
+                return {StatusCode::INVALID_ARGUMENT, "k of rrf rerank must be an integer"};
+            }
+            params.k_ = json_params["k"].get<int>();
+        }
+        if (params.k_ <= 0 || params.k_ >= 16384) {
+            return {StatusCode::INVALID_ARGUMENT, "k of rrf rerank must be in range (0, 16384)"};
+        }
+        return Status::OK();
+    }
+
+    if (!json_params.contains("weights") || !json_params["weights"].is_array()) {
+        return {StatusCode::INVALID_ARGUMENT, "Weighted rerank requires a weights array"};
+    }
+    for (const auto& weight : json_params["weights"]) {
+        if (!weight.is_number()) {
+            return {StatusCode::INVALID_ARGUMENT, "Weights of weighted rerank must be numbers"};
+        }
+        const auto value = weight.get<float>();
+        if (value < 0.0f || value > 1.0f) {
+            return {StatusCode::INVALID_ARGUMENT, "Weights of weighted rerank must be in range [0, 1]"};
+        }
+        params.weights_.push_back(value);
+    }
+    if (params.weights_.size() != list_count) {
+        return {StatusCode::INVALID_ARGUMENT, "Weighted rerank has " + std::to_string(params.weights_.size()) +
+                                                  " weights for " + std::to_string(list_count) + " lists"};
+    }
+    return Status::OK();
+}
+
+void
+NormalizeScores(MetricType metric_type, const float* scores, size_t count, float* normalized) {
+    switch (metric_type) {
+        case MetricType::COSINE:
+        case MetricType::MAX_SIM_COSINE: {
+            for (size_t i = 0; i < count; ++i) {
+                normalized[i] = (1.0f + scores[i]) * 0.5f;
+            }
+            break;
+        }
+        case MetricType::IP:
+        case MetricType::MAX_SIM_IP: {
+            for (size_t i = 0; i < count; ++i) {
+                normalized[i] = 0.5f + std::atan(scores[i]) * kInvPi;
+            }
+            break;
+        }
+        case MetricType::BM25: {
+            for (size_t i = 0; i < count; ++i) {
+                normalized[i] = 2.0f * std::atan(scores[i]) * kInvPi;
+            }
+            break;
+        }
+        case MetricType::L2:
+        case MetricType::HAMMING:
+        case MetricType::JACCARD:
+        case MetricType::MHJACCARD:
+        case MetricType::MAX_SIM_L2:
+        case MetricType::MAX_SIM_JACCARD:
+        case MetricType::MAX_SIM_HAMMING: {
+            for (size_t i = 0; i < count; ++i) {
+                normalized[i] = 1.0f - 2.0f * std::atan(scores[i]) * kInvPi;
+            }
+            break;
+        }
+        default: {
+            MinMaxScale(scores, count, normalized);
+            break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// PkIndex
+PkIndex::PkIndex(size_t expected) {
+    size_t capacity = 16;
+    while (capacity < expected * 2) {
+        capacity <<= 1;
+    }
+    slots_.assign(capacity, 0);
+    hashes_.reserve(expected);
+}
+
+size_t
+PkIndex::Insert(int64_t key, bool& inserted) {
+    return insert(key, MixHash(static_cast<uint64_t>(key)), inserted);
+}
+
+size_t
+PkIndex::Insert(const std::string& key, bool& inserted) {
+    return insert(key, MixHash(std::hash<std::string>{}(key)), inserted);
+}
+
+size_t
+PkIndex::Size() const {
+    return hashes_.size();
+}
+
+template <typename K>
+size_t
+PkIndex::insert(const K& key, uint64_t hash, bool& inserted) {
+    const size_t mask = slots_.size() - 1;
+    size_t pos = hash & mask;
+    while (slots_[pos] != 0) {
+        const uint32_t index = slots_[pos] - 1;
+        if (hashes_[index] == hash && equal(index, key)) {
+            inserted = false;
+            return index;
+        }
+        pos = (pos + 1) & mask;
+    }
+
+    const auto index = hashes_.size();
+    hashes_.push_back(hash);
+    store(key);
+    slots_[pos] = static_cast<uint32_t>(index + 1);
+    inserted = true;
+    if (hashes_.size() * 2 > slots_.size()) {
+        grow();
+    }
+    return index;
+}
+
+bool
+PkIndex::equal(uint32_t index, int64_t key) const {
+    return int_keys_[index] == key;
+}
+
+bool
+PkIndex::equal(uint32_t index, const std::string& key) const {
+    return *str_keys_[index] == key;
+}
+
+void
+PkIndex::store(int64_t key) {
+    int_keys_.push_back(key);
+}
+
+void
+PkIndex::store(const std::string& key) {
+    str_keys_.push_back(&key);
+}
+
+void
+PkIndex::grow() {
+    slots_.assign(slots_.size() * 2, 0);
+    const size_t mask = slots_.size() - 1;
+    for (size_t index = 0; index < hashes_.size(); ++index) {
+        size_t pos = hashes_[index] & mask;
+        while (slots_[pos] != 0) {
+            pos = (pos + 1) & mask;
+        }
+        slots_[pos] = static_cast<uint32_t>(index + 1);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// FuseRankedLists
+Status
+FuseRankedLists(const RerankParams& params, const std::vector<RerankList>& lists, size_t limit,
+                std::vector<FusedHit>& hits) {
+    hits.clear();
+    if (params.strategy_ == RerankStrategy::WEIGHTED && params.weights_.size() != lists.size()) {
+        return {StatusCode::INVALID_ARGUMENT, "Weighted rerank requires one weight per list"};
+    }
+
+    size_t total = 0;
+    bool has_int_ids = false;
+    bool has_str_ids = false;
+    for (const auto& list : lists) {
+        if (list.scores_ == nullptr) {
+            return {StatusCode::INVALID_ARGUMENT, "Rerank list has no scores"};
+        }
+        const auto& scores = *list.scores_;
+        if (scores.empty()) {
+            continue;
+        }
+        if (list.int_ids_ != nullptr && list.int_ids_->size() == scores.size()) {
+            has_int_ids = true;
+        } else if (list.str_ids_ != nullptr && list.str_ids_->size() == scores.size()) {
+            has_str_ids = true;
+        } else {
+            return {StatusCode::INVALID_ARGUMENT, "Rerank list has not the same number of ids and scores"};
+        }
+        total += scores.size();
+    }
+    if (has_int_ids && has_str_ids) {
+        return {StatusCode::INVALID_ARGUMENT, "Rerank lists mix int and string primary keys"};
+    }
+
+    PkIndex pk_index(total);
+    std::vector<float> fused;
+    std::vector<FusedHit> origins;
+    std::vector<size_t> last_list;
+    fused.reserve(total);
+    origins.reserve(total);
+    last_list.reserve(total);
+
+    // the contributions of a list are computed in one pass over contiguous floats, only the scatter into the
+    // fused scores goes through the primary key table
+    std::vector<float> contributions;
+    for (size_t l = 0; l < lists.size(); ++l) {
+        const auto& scores = *lists[l].scores_;
+        const auto count = scores.size();
+        contributions.resize(count);
+        if (params.strategy_ == RerankStrategy::RRF) {
+            const auto k = static_cast<float>(params.k_);
+            for (size_t r = 0; r < count; ++r) {
+                contributions[r] = 1.0f / (k + static_cast<float>(r + 1));
+            }
+        } else {
+            if (params.norm_score_) {
+                NormalizeScores(lists[l].metric_type_, scores.data(), count, contributions.data());
+            } else {
+                std::copy(scores.begin(), scores.end(), contributions.begin());
+            }
+            const auto weight = params.weights_[l];
+            for (size_t r = 0; r < count; ++r) {
+                contributions[r] *= weight;
+            }
+        }
+
+        for (size_t r = 0; r < count; ++r) {
+            bool inserted = false;
+            const auto index = has_int_ids ? pk_index.Insert((*lists[l].int_ids_)[r], inserted)
+                                           : pk_index.Insert((*lists[l].str_ids_)[r], inserted);
+            if (inserted) {
+                fused.push_back(0.0f);
+                origins.push_back(FusedHit{l, r, 0.0f});
+                last_list.push_back(kNotSeen);
+            }
+            if (last_list[index] == l) {
+                continue;
+            }
+            last_list[index] = l;
+            fused[index] += contributions[r];
+        }
+    }
+
+    std::vector<size_t> order(fused.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    auto better = [&fused](size_t a, size_t b) { return fused[a] != fused[b] ? fused[a] > fused[b] : a < b; };
+    const auto keep = std::min(limit, order.size());
+    std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(keep), order.end(), better);
+
+    hits.reserve(keep);
+    for (size_t i = 0; i < keep; ++i) {
+        auto hit = origins[order[i]];
+        hit.score_ = fused[order[i]];
+        hits.push_back(hit);
+    }
+    return Status::OK();
+}
+
+}  // namespace milvus
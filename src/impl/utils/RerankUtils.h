@@ -0,0 +1,117 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "milvus/Status.h"
+#include "milvus/types/Function.h"
+#include "milvus/types/MetricType.h"
+
+namespace milvus {
+
+enum class RerankStrategy {
+    RRF = 0,
+    WEIGHTED = 1,
+};
+
+// Parameters of a RRFRerank or WeightedRerank function, read from its "params" json.
+struct RerankParams {
+    RerankStrategy strategy_{RerankStrategy::RRF};
+    int k_{60};
+    std::vector<float> weights_;
+    bool norm_score_{true};
+};
+
+Status
+ParseRerankFunction(const Function& function, size_t list_count, RerankParams& params);
+
+// Map the scores of one list into [0, 1] where larger is better, the same mapping the server uses for weighted
+// rerank: COSINE (1 + x) / 2, IP 0.5 + atan(x) / pi, BM25 2 * atan(x) / pi and distances 1 - 2 * atan(x) / pi.
+// Scores of DEFAULT, e.g. from an external engine, are min-max scaled in their ranking direction.
+// The metric is switched on once per list, so each branch is a plain loop over contiguous floats.
+void
+NormalizeScores(MetricType metric_type, const float* scores, size_t count, float* normalized);
+
+// Open-addressing table from primary key to a dense index in first-seen order, linear probing over a power of
+// two slots kept at most half full. The keys are not copied, string keys must outlive the table.
+class PkIndex {
+ public:
+    explicit PkIndex(size_t expected);
+
+    // Dense index of the key, the key is added if absent.
+    size_t
+    Insert(int64_t key, bool& inserted);
+
+    size_t
+    Insert(const std::string& key, bool& inserted);
+
+    size_t
+    Size() const;
+
+ private:
+    template <typename K>
+    size_t
+    insert(const K& key, uint64_t hash, bool& inserted);
+
+    bool
+    equal(uint32_t index, int64_t key) const;
+
+    bool
+    equal(uint32_t index, const std::string& key) const;
+
+    void
+    store(int64_t key);
+
+    void
+    store(const std::string& key);
+
+    void
+    grow();
+
+ private:
+    std::vector<uint32_t> slots_;  // dense index + 1, 0 is empty
+    std::vector<uint64_t> hashes_;
+    std::vector<int64_t> int_keys_;
+    std::vector<const std::string*> str_keys_;
+};
+
+// One list to fuse: the primary keys, int or string, and scores ranked best first.
+struct RerankList {
+    const std::vector<int64_t>* int_ids_ = nullptr;
+    const std::vector<std::string>* str_ids_ = nullptr;
+    const std::vector<float>* scores_ = nullptr;
+    MetricType metric_type_{MetricType::DEFAULT};
+};
+
+// A fused hit, the list and row are where its primary key first appears.
+struct FusedHit {
+    size_t list_ = 0;
+    size_t row_ = 0;
+    float score_ = 0.0f;
+};
+
+// Fuse the lists into one ranking of at most limit hits, deduplicated by primary key. A key that repeats
+// within one list only counts at its best rank. Equal fused scores keep the first-seen order.
+Status
+FuseRankedLists(const RerankParams& params, const std::vector<RerankList>& lists, size_t limit,
+                std::vector<FusedHit>& hits);
+
+}  // namespace milvus
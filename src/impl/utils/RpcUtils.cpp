@@ -101,4 +101,15 @@ Retry(std::function<Status(void)> caller, const RetryParam& retry_param) {
     return Status::OK();
 }
 
+std::string
+RpcName(const google::protobuf::Descriptor* request) {
+    static const std::string kRequestSuffix = "Request";
+    std::string name(request->name());
+    if (name.size() > kRequestSuffix.size() &&
+        name.compare(name.size() - kRequestSuffix.size(), kRequestSuffix.size(), kRequestSuffix) == 0) {
+        name.resize(name.size() - kRequestSuffix.size());
+    }
+    return name;
+}
+
 }  // namespace milvus
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <functional>
+#include <string>
 
+#include "google/protobuf/descriptor.h"
 #include "milvus/Status.h"
 #include "milvus/types/RetryParam.h"
 
@@ -25,4 +27,8 @@ namespace milvus {
 Status
 Retry(std::function<Status(void)> caller, const RetryParam& retry_param);
 
+// The rpc name of a request message, "SearchRequest" is "Search".
+std::string
+RpcName(const google::protobuf::Descriptor* request);
+
 }  // namespace milvus
@@ -0,0 +1,305 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StatusWaiter.h"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace milvus {
+
+namespace {
+
+// set while the thread runs a poll, a poll cancelling an owner cannot wait for the polls of it
+thread_local bool tls_polling = false;
+
+}  // namespace
+
+constexpr uint32_t StatusWaiter::first_interval_ms;
+constexpr uint64_t StatusWaiter::max_poll_ms;
+constexpr uint32_t StatusWaiter::poll_workers;
+
+StatusWaiter::~StatusWaiter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& due : queue_) {
+            resolveLocked(*due.wait_, Status{StatusCode::NOT_CONNECTED, "The status waiter is stopped"});
+        }
+        queue_.clear();
+    }
+    // runs the polls and done callbacks already handed over, a poll finishing now resolves its wait as stopped
+    pollers_.reset();
+    pending_ = 0;
+}
+
+StatusWaiter&
+StatusWaiter::GetInstance() {
+    static StatusWaiter instance;
+    return instance;
+}
+
+std::future<Status>
+StatusWaiter::Submit(const void* owner, QueryFunction query, const ProgressMonitor& monitor, uint32_t settle_ms) {
+    std::future<Status> future;
+    submit(owner, std::move(query), monitor, settle_ms, false, nullptr, future);
+    return future;
+}
+
+Status
+StatusWaiter::Await(const void* owner, QueryFunction query, const ProgressMonitor& monitor, uint32_t settle_ms) {
+    std::future<Status> future;
+    auto wait = submit(owner, std::move(query), monitor, settle_ms, true, nullptr, future);
+    if (wait == nullptr) {
+        return future.get();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wait->reported_.wait(lock, [&wait] { return !wait->reports_.empty() || wait->resolved_; });
+        // the progresses of a wait are all reported before it is resolved
+        auto reports = std::move(wait->reports_);
+        wait->reports_.clear();
+        const bool resolved = wait->resolved_;
+        lock.unlock();
+        for (auto& progress : reports) {
+            wait->monitor_.DoProgress(progress);
+        }
+        if (resolved) {
+            return future.get();
+        }
+        lock.lock();
+    }
+}
+
+void
+StatusWaiter::Watch(const void* owner, QueryFunction query, const ProgressMonitor& monitor, DoneFunction done) {
+    std::future<Status> future;
+    submit(owner, std::move(query), monitor, 0, false, std::move(done), future);
+}
+
+StatusWaiter::WaitPtr
+StatusWaiter::submit(const void* owner, QueryFunction query, const ProgressMonitor& monitor, uint32_t settle_ms,
+                     bool report, DoneFunction on_done, std::future<Status>& future) {
+    auto wait = std::make_shared<Wait>();
+    future = wait->promise_.get_future();
+    // no need to check
+    if (monitor.CheckTimeout() == 0) {
+        wait->promise_.set_value(Status::OK());
+        if (on_done) {
+            on_done(Status::OK());
+        }
+        return nullptr;
+    }
+
+    const auto now = Clock::now();
+    wait->owner_ = owner;
+    wait->query_ = std::move(query);
+    wait->monitor_ = monitor;
+    wait->deadline_ = now + std::chrono::milliseconds{static_cast<uint64_t>(monitor.CheckTimeout()) * 1000};
+    wait->cap_ms_ = std::max<uint32_t>(monitor.CheckInterval(), 1);
+    wait->interval_ms_ = std::min(first_interval_ms, wait->cap_ms_);
+    wait->settle_ms_ = settle_ms;
+    wait->report_ = report;
+    wait->on_done_ = std::move(on_done);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!thread_.joinable()) {
+            pollers_ = Executor::Create(poll_workers);
+            thread_ = std::thread(&StatusWaiter::run, this);
+        }
+        ++pending_;
+        scheduleLocked(wait, std::min(now + std::chrono::milliseconds{wait->interval_ms_}, wait->deadline_));
+    }
+    cv_.notify_one();
+    return wait;
+}
+
+void
+StatusWaiter::Cancel(const void* owner) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // a poll cancelling its own owner cannot wait for itself
+    if (!tls_polling) {
+        idle_cv_.wait(lock, [this, owner] { return polling_owners_.count(owner) == 0; });
+    }
+    for (auto& due : queue_) {
+        auto& wait = *due.wait_;
+        if (wait.owner_ == owner && !wait.resolved_) {
+            resolveLocked(wait, Status{StatusCode::NOT_CONNECTED, "Client is disconnected before the wait finished"});
+            --pending_;
+        }
+    }
+}
+
+size_t
+StatusWaiter::Pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_;
+}
+
+uint32_t
+StatusWaiter::NextIntervalMs(uint32_t current_ms, uint32_t cap_ms) {
+    return current_ms >= cap_ms / 2 ? cap_ms : current_ms * 2;
+}
+
+void
+StatusWaiter::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        if (queue_.empty()) {
+            cv_.wait(lock);
+            continue;
+        }
+        const auto at = queue_.front().at_;
+        if (Clock::now() < at) {
+            cv_.wait_until(lock, at);
+            continue;
+        }
+
+        std::pop_heap(queue_.begin(), queue_.end());
+        auto wait = std::move(queue_.back().wait_);
+        queue_.pop_back();
+        if (wait->resolved_) {
+            continue;
+        }
+        if (wait->done_) {
+            // the settle delay has passed
+            resolveLocked(*wait, Status::OK());
+            --pending_;
+            continue;
+        }
+
+        ++polling_owners_[wait->owner_];
+        lock.unlock();
+        auto submitted = pollers_->Submit([this, wait]() { pollAndSchedule(wait); });
+        if (!submitted.IsOk()) {
+            pollAndSchedule(wait);
+        }
+        lock.lock();
+    }
+}
+
+void
+StatusWaiter::pollAndSchedule(const WaitPtr& wait) {
+    Progress progress;
+    Status status;
+    bool finished = true;
+    tls_polling = true;
+    try {
+        finished = poll(*wait, progress, status);
+    } catch (const std::exception& e) {
+        status = Status{StatusCode::UNKNOWN_ERROR, "Progress query failed: " + std::string(e.what())};
+    } catch (...) {
+        status = Status{StatusCode::UNKNOWN_ERROR, "Progress query failed with unknown exception"};
+    }
+    tls_polling = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto polling = polling_owners_.find(wait->owner_);
+        if (--polling->second == 0) {
+            polling_owners_.erase(polling);
+        }
+        idle_cv_.notify_all();
+
+        if (wait->resolved_) {
+            return;
+        }
+        if (wait->report_ && status.IsOk()) {
+            wait->reports_.push_back(progress);
+            wait->reported_.notify_one();
+        }
+        // the queue is resolved already, a wait may not go back into it
+        if (stop_) {
+            resolveLocked(*wait, finished ? status : Status{StatusCode::NOT_CONNECTED, "The status waiter is stopped"});
+            --pending_;
+            return;
+        }
+        const auto now = Clock::now();
+        if (!finished) {
+            wait->interval_ms_ = NextIntervalMs(wait->interval_ms_, wait->cap_ms_);
+            scheduleLocked(wait, std::min(now + std::chrono::milliseconds{wait->interval_ms_}, wait->deadline_));
+        } else if (status.IsOk() && wait->settle_ms_ > 0) {
+            wait->done_ = true;
+            scheduleLocked(wait, now + std::chrono::milliseconds{wait->settle_ms_});
+        } else {
+            resolveLocked(*wait, status);
+            --pending_;
+            return;
+        }
+    }
+    cv_.notify_one();
+}
+
+bool
+StatusWaiter::poll(Wait& wait, Progress& progress, Status& status) {
+    // the rpc may not outlast the wait, nor hold up the other waits for long
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(wait.deadline_ - Clock::now()).count();
+    const uint64_t rpc_timeout_ms = std::min<uint64_t>(std::max<int64_t>(left, 1), max_poll_ms);
+    status = wait.query_(progress, rpc_timeout_ms);
+    // if the internal check function failed, return error
+    if (!status.IsOk()) {
+        return true;
+    }
+
+    if (progress.Done()) {
+        return true;
+    }
+
+    // the last poll is scheduled at the deadline
+    if (Clock::now() >= wait.deadline_) {
+        status = Status{StatusCode::TIMEOUT, "time out"};
+        return true;
+    }
+    return false;
+}
+
+void
+StatusWaiter::scheduleLocked(const WaitPtr& wait, Clock::time_point at) {
+    queue_.push_back(Due{at, ++sequence_, wait});
+    std::push_heap(queue_.begin(), queue_.end());
+}
+
+void
+StatusWaiter::resolveLocked(Wait& wait, const Status& status) {
+    if (wait.resolved_) {
+        return;
+    }
+    wait.resolved_ = true;
+    wait.promise_.set_value(status);
+    wait.reported_.notify_one();
+    if (wait.on_done_) {
+        auto on_done = std::move(wait.on_done_);
+        wait.on_done_ = nullptr;
+        auto submitted = pollers_->Submit([on_done, status]() { on_done(status); });
+        if (!submitted.IsOk()) {
+            on_done(status);
+        }
+    }
+}
+
+}  // namespace milvus
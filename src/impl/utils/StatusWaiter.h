@@ -0,0 +1,167 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "milvus/Status.h"
+#include "milvus/types/Executor.h"
+#include "milvus/types/ProgressMonitor.h"
+
+namespace milvus {
+
+// Polls the progress of long-running operations for all clients. One timer thread keeps the waits in due
+// order and hands each due poll to a small executor of poll_workers threads, so waiting for hundreds of loads
+// or flushes costs a few threads instead of one sleeping thread each, and the timer never blocks on an rpc.
+// A wait is polled after first_interval_ms first, the interval then doubles up to the CheckInterval() of its
+// ProgressMonitor, so a short operation is seen done within a few milliseconds while a long one costs no more
+// polls than before. The rpc of a poll is bounded by the time left of its wait and by max_poll_ms, a stalled
+// server only holds up the polls queued behind poll_workers stalled ones. A wait is never polled twice at
+// once. The progress callbacks of the monitors never run on the polling threads.
+class StatusWaiter {
+ public:
+    // Report the progress of one poll, the rpc of the query must not take longer than rpc_timeout_ms.
+    using QueryFunction = std::function<Status(Progress&, uint64_t rpc_timeout_ms)>;
+
+    // Called with the final status of a wait submitted by Watch().
+    using DoneFunction = std::function<void(const Status&)>;
+
+    static constexpr uint32_t first_interval_ms = 5;
+
+    static constexpr uint64_t max_poll_ms = 5000;
+
+    static constexpr uint32_t poll_workers = 4;
+
+    StatusWaiter() = default;
+
+    ~StatusWaiter();
+
+    static StatusWaiter&
+    GetInstance();
+
+    // Poll query until it reports done, fails, or the CheckTimeout() of the monitor passes. The future holds
+    // the final status. A done wait is resolved settle_ms later, for operations whose result becomes visible
+    // a little after the server reports it done. The owner tells the waits of one client apart for Cancel().
+    // The progress callback of the monitor is not called, nobody is blocked to run it.
+    std::future<Status>
+    Submit(const void* owner, QueryFunction query, const ProgressMonitor& monitor, uint32_t settle_ms = 0);
+
+    // Submit() and block until the wait is finished, the progress callback of the monitor runs on the calling
+    // thread, so it may block or call the client without holding up other waits.
+    Status
+    Await(const void* owner, QueryFunction query, const ProgressMonitor& monitor, uint32_t settle_ms = 0);
+
+    // Submit() without a future: done is called with the final status once the wait is finished, cancelled, or
+    // the waiter is stopped. It runs on a poll worker, never under the lock of the waiter, so it may submit
+    // another wait. A monitor that does not wait calls it on the calling thread.
+    void
+    Watch(const void* owner, QueryFunction query, const ProgressMonitor& monitor, DoneFunction done);
+
+    // Resolve the pending waits of an owner with NOT_CONNECTED, and wait for a poll of it that is running, so
+    // the owner can be destroyed once this returns.
+    void
+    Cancel(const void* owner);
+
+    size_t
+    Pending() const;
+
+    // The interval after a poll that waited current_ms, doubled up to cap_ms.
+    static uint32_t
+    NextIntervalMs(uint32_t current_ms, uint32_t cap_ms);
+
+ private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Wait {
+        const void* owner_ = nullptr;
+        QueryFunction query_;
+        ProgressMonitor monitor_;
+        Clock::time_point deadline_;
+        uint32_t interval_ms_ = 0;
+        uint32_t cap_ms_ = 0;
+        uint32_t settle_ms_ = 0;
+        // set once the query reported done, the wait is then only delayed by settle_ms_
+        bool done_ = false;
+        bool resolved_ = false;
+        std::promise<Status> promise_;
+        DoneFunction on_done_;
+        // the progresses of polls not yet passed to the callback by Await(), only kept when report_ is set
+        bool report_ = false;
+        std::vector<Progress> reports_;
+        std::condition_variable reported_;
+    };
+
+    using WaitPtr = std::shared_ptr<Wait>;
+
+    struct Due {
+        Clock::time_point at_;
+        uint64_t sequence_;
+        WaitPtr wait_;
+
+        // the earliest due is at the front of a heap ordered by this
+        bool
+        operator<(const Due& other) const {
+            return at_ != other.at_ ? at_ > other.at_ : sequence_ > other.sequence_;
+        }
+    };
+
+    WaitPtr
+    submit(const void* owner, QueryFunction query, const ProgressMonitor& monitor, uint32_t settle_ms, bool report,
+           DoneFunction on_done, std::future<Status>& future);
+
+    void
+    run();
+
+    // Poll one wait on a poll worker, then schedule its next poll or resolve it.
+    void
+    pollAndSchedule(const WaitPtr& wait);
+
+    // Poll one wait outside the lock, returns true with the final status once the wait is finished.
+    static bool
+    poll(Wait& wait, Progress& progress, Status& status);
+
+    void
+    scheduleLocked(const WaitPtr& wait, Clock::time_point at);
+
+    void
+    resolveLocked(Wait& wait, const Status& status);
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    // a heap rather than a std::priority_queue, so Cancel() can reach the waits of an owner
+    std::vector<Due> queue_;
+    uint64_t sequence_ = 0;
+    size_t pending_ = 0;
+    // the owners whose waits are handed to a poll worker, with their count, Cancel() of one waits until it has none
+    std::unordered_map<const void*, size_t> polling_owners_;
+    bool stop_ = false;
+    std::thread thread_;
+    ExecutorPtr pollers_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,101 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/TopKMerge.h"
+
+#include <queue>
+
+namespace milvus {
+
+namespace {
+
+struct Head {
+    float score_;
+    size_t list_;
+    size_t position_;
+};
+
+}  // namespace
+
+std::vector<MergedHit>
+MergeRankedLists(const std::vector<RankedList>& lists, size_t offset, size_t limit, bool larger_first) {
+    // true if a ranks after b, the heap top is then the best head
+    auto after = [larger_first](const Head& a, const Head& b) {
+        if (a.score_ != b.score_) {
+            return larger_first ? a.score_ < b.score_ : a.score_ > b.score_;
+        }
+        return a.list_ != b.list_ ? a.list_ > b.list_ : a.position_ > b.position_;
+    };
+    std::priority_queue<Head, std::vector<Head>, decltype(after)> heap(after);
+    for (size_t i = 0; i < lists.size(); ++i) {
+        if (lists[i].size_ > 0) {
+            heap.push(Head{lists[i].scores_[0], i, 0});
+        }
+    }
+
+    std::vector<MergedHit> hits;
+    hits.reserve(limit);
+    size_t skipped = 0;
+    while (!heap.empty() && hits.size() < limit) {
+        const auto head = heap.top();
+        heap.pop();
+        if (skipped < offset) {
+            ++skipped;
+        } else {
+            hits.push_back(MergedHit{head.list_, head.position_});
+        }
+
+        const auto next = head.position_ + 1;
+        const auto& list = lists[head.list_];
+        if (next < list.size_) {
+            heap.push(Head{list.scores_[next], head.list_, next});
+        }
+    }
+    return hits;
+}
+
+bool
+LargerScoreFirst(MetricType metric_type, const std::vector<RankedList>& lists) {
+    switch (metric_type) {
+        case MetricType::L2:
+        case MetricType::HAMMING:
+        case MetricType::JACCARD:
+        case MetricType::MHJACCARD:
+        case MetricType::MAX_SIM_L2:
+        case MetricType::MAX_SIM_JACCARD:
+        case MetricType::MAX_SIM_HAMMING:
+            return false;
+        case MetricType::IP:
+        case MetricType::COSINE:
+        case MetricType::BM25:
+        case MetricType::MAX_SIM_COSINE:
+        case MetricType::MAX_SIM_IP:
+            return true;
+        default:
+            break;
+    }
+
+    for (const auto& list : lists) {
+        for (size_t i = 1; i < list.size_; ++i) {
+            if (list.scores_[i] != list.scores_[i - 1]) {
+                return list.scores_[i] < list.scores_[i - 1];
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace milvus
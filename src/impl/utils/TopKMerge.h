@@ -0,0 +1,50 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "milvus/types/MetricType.h"
+
+namespace milvus {
+
+// Scores of one query on one collection, ranked best first as the server returns them.
+struct RankedList {
+    const float* scores_ = nullptr;
+    size_t size_ = 0;
+};
+
+// A hit of the merged ranking, the position is within its list.
+struct MergedHit {
+    size_t list_ = 0;
+    size_t position_ = 0;
+};
+
+// Merge ranked lists into one ranking with a k-way heap, skipping the first offset hits and keeping at most
+// limit. Only the head of each list is on the heap, so the cost is O((offset + limit) * log(lists)) no matter
+// how long the lists are. Equal scores are ordered by list then position, so the result is deterministic.
+std::vector<MergedHit>
+MergeRankedLists(const std::vector<RankedList>& lists, size_t offset, size_t limit, bool larger_first);
+
+// Whether a larger score ranks first. Distance metrics rank the smaller first, similarity metrics the larger.
+// For other metrics, including DEFAULT where the server picks it, the direction is read from the first list
+// with two different adjacent scores, and defaults to larger first.
+bool
+LargerScoreFirst(MetricType metric_type, const std::vector<RankedList>& lists);
+
+}  // namespace milvus
@@ -0,0 +1,101 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TraceScope.h"
+
+#include <utility>
+
+#include "RpcUtils.h"
+#include "google/protobuf/descriptor.h"
+
+namespace milvus {
+
+namespace {
+
+std::string
+StringField(const google::protobuf::Message& message, const char* name) {
+    const auto* field = message.GetDescriptor()->FindFieldByName(name);
+    if (field == nullptr || field->is_repeated() ||
+        field->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+        return "";
+    }
+    return message.GetReflection()->GetString(message, field);
+}
+
+int64_t
+IntegerField(const google::protobuf::Message& message, const char* name) {
+    const auto* field = message.GetDescriptor()->FindFieldByName(name);
+    if (field == nullptr || field->is_repeated()) {
+        return 0;
+    }
+    const auto* reflection = message.GetReflection();
+    switch (field->cpp_type()) {
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+            return reflection->GetInt32(message, field);
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+            return reflection->GetInt64(message, field);
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+            return reflection->GetUInt32(message, field);
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+            return static_cast<int64_t>(reflection->GetUInt64(message, field));
+        default:
+            return 0;
+    }
+}
+
+}  // namespace
+
+TraceScope::TraceScope(const TracerPtr& tracer, const google::protobuf::Message& request,
+                       const google::protobuf::Message& response, const Status& status)
+    : response_(response), status_(status) {
+    if (tracer == nullptr) {
+        return;
+    }
+    auto state = std::unique_ptr<State>(new State());
+    auto& attributes = state->attributes_;
+    attributes.SetRpcName(RpcName(request.GetDescriptor()));
+    attributes.SetDatabaseName(StringField(request, "db_name"));
+    attributes.SetCollectionName(StringField(request, "collection_name"));
+    attributes.SetNq(IntegerField(request, "nq"));
+    attributes.SetRows(IntegerField(request, "num_rows"));
+    attributes.SetRequestBytes(request.ByteSizeLong());
+    state->span_ = tracer->StartSpan(attributes);
+    if (state->span_ == nullptr) {
+        return;
+    }
+    state->span_->InjectHeaders(state->headers_);
+    state_ = std::move(state);
+}
+
+TraceScope::~TraceScope() {
+    if (state_ == nullptr) {
+        return;
+    }
+    auto& attributes = state_->attributes_;
+    attributes.SetResponseBytes(response_.ByteSizeLong());
+    attributes.SetRetries(attempts_ > 1 ? attempts_ - 1 : 0);
+    state_->span_->End(attributes, status_);
+}
+
+const std::unordered_map<std::string, std::string>*
+TraceScope::Headers() const {
+    if (state_ == nullptr || state_->headers_.empty()) {
+        return nullptr;
+    }
+    return &state_->headers_;
+}
+
+}  // namespace milvus
@@ -0,0 +1,67 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "google/protobuf/message.h"
+#include "milvus/Status.h"
+#include "milvus/types/Tracer.h"
+
+namespace milvus {
+
+// Reports one rpc call of ConnectionHandler to the tracer of the client. Without a tracer it only keeps a null
+// pointer and an attempt counter, the attributes are read from the rpc request with reflection once a span starts.
+class TraceScope {
+ public:
+    // The status is read when the scope ends, it must outlive the scope.
+    TraceScope(const TracerPtr& tracer, const google::protobuf::Message& request,
+               const google::protobuf::Message& response, const Status& status);
+
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+
+    TraceScope&
+    operator=(const TraceScope&) = delete;
+
+    void
+    OnAttempt() {
+        ++attempts_;
+    }
+
+    // Headers of the span sent with each attempt, nullptr when there are none.
+    const std::unordered_map<std::string, std::string>*
+    Headers() const;
+
+ private:
+    struct State {
+        SpanPtr span_;
+        SpanAttributes attributes_;
+        std::unordered_map<std::string, std::string> headers_;
+    };
+
+    std::unique_ptr<State> state_;
+    const google::protobuf::Message& response_;
+    const Status& status_;
+    uint32_t attempts_ = 0;
+};
+
+}  // namespace milvus
@@ -555,6 +555,7 @@ ConvertDescribeCollectionResponse(const proto::milvus::DescribeCollectionRespons
     collection_desc.SetSchema(std::move(schema));
     collection_desc.SetID(rpc_response.collectionid());
     collection_desc.SetCreatedTime(rpc_response.created_timestamp());
+    collection_desc.SetUpdateTime(rpc_response.update_timestamp());
 
     std::vector<std::string> aliases;
     aliases.reserve(rpc_response.aliases_size());
@@ -573,6 +574,40 @@ ConvertDescribeCollectionResponse(const proto::milvus::DescribeCollectionRespons
     return Status::OK();
 }
 
+void
+SerializeCollectionDesc(const CollectionDesc& collection_desc, std::string& payload) {
+    proto::milvus::DescribeCollectionResponse rpc_response;
+    ConvertCollectionSchema(collection_desc.Schema(), *rpc_response.mutable_schema());
+    rpc_response.set_shards_num(collection_desc.Schema().ShardsNum());
+    rpc_response.set_collectionid(collection_desc.ID());
+    rpc_response.set_created_timestamp(collection_desc.CreatedTime());
+    rpc_response.set_update_timestamp(collection_desc.UpdateTime());
+    rpc_response.set_db_name(collection_desc.DatabaseName());
+    rpc_response.set_collection_name(collection_desc.CollectionName());
+    for (const auto& alias : collection_desc.Alias()) {
+        rpc_response.add_aliases(alias);
+    }
+    for (const auto& pair : collection_desc.Properties()) {
+        auto prop = rpc_response.add_properties();
+        prop->set_key(pair.first);
+        prop->set_value(pair.second);
+    }
+    rpc_response.SerializeToString(&payload);
+}
+
+Status
+ParseCollectionDesc(const std::string& payload, CollectionDesc& collection_desc) {
+    proto::milvus::DescribeCollectionResponse rpc_response;
+    if (!rpc_response.ParseFromString(payload)) {
+        return {StatusCode::UNKNOWN_ERROR, "Failed to parse a cached collection schema"};
+    }
+    auto status = ConvertDescribeCollectionResponse(rpc_response, collection_desc);
+    if (status.IsOk()) {
+        collection_desc.SetDatabaseName(rpc_response.db_name());
+    }
+    return status;
+}
+
 Status
 CheckDefaultValue(const FieldSchema& schema) {
     const nlohmann::json& val = schema.DefaultValue();
@@ -105,6 +105,13 @@ Status
 ConvertDescribeCollectionResponse(const proto::milvus::DescribeCollectionResponse& rpc_response,
                                   CollectionDesc& collection_desc);
 
+// A collection desc is kept in the persistent schema cache file as a serialized DescribeCollectionResponse.
+void
+SerializeCollectionDesc(const CollectionDesc& collection_desc, std::string& payload);
+
+Status
+ParseCollectionDesc(const std::string& payload, CollectionDesc& collection_desc);
+
 Status
 CheckDefaultValue(const FieldSchema& schema);
 
@@ -0,0 +1,210 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/WorkStealingExecutor.h"
+
+#include <system_error>
+#include <utility>
+
+namespace milvus {
+
+namespace {
+
+// the state and deque index of the executor worker running on this thread
+thread_local const void* tls_state = nullptr;
+thread_local size_t tls_index = 0;
+
+void
+RaiseMax(std::atomic<uint64_t>& target, uint64_t value) {
+    auto current = target.load(std::memory_order_relaxed);
+    while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t
+ElapsedUs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+}
+
+}  // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(uint32_t worker_count) : state_(std::make_shared<State>()) {
+    if (worker_count == 0) {
+        worker_count = 1;
+    }
+    state_->queues_.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        state_->queues_.emplace_back(new Queue);
+    }
+
+    // keep the workers that started if the system runs out of threads, any worker reaches every deque
+    threads_.reserve(worker_count);
+    try {
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            auto state = state_;
+            threads_.emplace_back([state, i]() { run(state, i); });
+        }
+    } catch (const std::system_error&) {
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex_);
+        state_->stopping_ = true;
+    }
+    state_->cv_.notify_all();
+
+    // a task may drop the last reference to the executor, its worker cannot join itself and finishes on its own
+    const auto self = std::this_thread::get_id();
+    for (auto& thread : threads_) {
+        if (thread.get_id() == self) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
+Status
+WorkStealingExecutor::Submit(Task task) {
+    if (!task) {
+        return {StatusCode::INVALID_ARGUMENT, "Executor task cannot be empty"};
+    }
+    if (threads_.empty()) {
+        return {StatusCode::UNKNOWN_ERROR, "Executor failed to start any worker thread"};
+    }
+
+    auto& state = *state_;
+    const bool own_worker = tls_state == state_.get();
+    // workers keep draining until their tasks stop submitting, other threads are turned away
+    if (!own_worker && state.stopping_.load()) {
+        return {StatusCode::UNKNOWN_ERROR, "Executor is shutting down"};
+    }
+
+    const auto index = own_worker ? tls_index : state.next_queue_.fetch_add(1) % state.queues_.size();
+    auto& queue = *state.queues_[index];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex_);
+        queue.items_.push_back(Item{std::move(task), Clock::now()});
+    }
+    state.submitted_.fetch_add(1, std::memory_order_relaxed);
+    const auto pending = state.pending_.fetch_add(1) + 1;
+    if (pending > 0) {
+        RaiseMax(state.max_pending_, static_cast<uint64_t>(pending));
+    }
+
+    // a worker counts itself idle before checking pending_, so either it sees this task or we see it idle
+    if (state.idle_.load() > 0) {
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        state.cv_.notify_one();
+    }
+    return Status::OK();
+}
+
+uint32_t
+WorkStealingExecutor::WorkerCount() const {
+    return static_cast<uint32_t>(threads_.size());
+}
+
+ExecutorStats
+WorkStealingExecutor::Stats() const {
+    const auto& state = *state_;
+    const auto pending = state.pending_.load();
+    return ExecutorStats{WorkerCount(),
+                         pending > 0 ? static_cast<uint64_t>(pending) : 0,
+                         state.max_pending_.load(),
+                         state.submitted_.load(),
+                         state.completed_.load(),
+                         state.stolen_.load(),
+                         state.failed_.load(),
+                         state.total_wait_us_.load(),
+                         state.max_wait_us_.load(),
+                         state.total_run_us_.load()};
+}
+
+void
+WorkStealingExecutor::run(const StatePtr& state, size_t index) {
+    tls_state = state.get();
+    tls_index = index;
+
+    while (true) {
+        Item item;
+        if (take(*state, index, item)) {
+            execute(*state, item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(state->mutex_);
+        if (state->stopping_.load() && state->pending_.load() <= 0) {
+            break;
+        }
+        state->idle_.fetch_add(1);
+        state->cv_.wait(lock, [&state] { return state->pending_.load() > 0 || state->stopping_.load(); });
+        state->idle_.fetch_sub(1);
+    }
+
+    tls_state = nullptr;
+}
+
+bool
+WorkStealingExecutor::take(State& state, size_t index, Item& item) {
+    {
+        auto& own = *state.queues_[index];
+        std::lock_guard<std::mutex> lock(own.mutex_);
+        if (!own.items_.empty()) {
+            item = std::move(own.items_.back());
+            own.items_.pop_back();
+            state.pending_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    const auto count = state.queues_.size();
+    for (size_t i = 1; i < count; ++i) {
+        auto& other = *state.queues_[(index + i) % count];
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        if (!other.items_.empty()) {
+            item = std::move(other.items_.front());
+            other.items_.pop_front();
+            state.pending_.fetch_sub(1);
+            state.stolen_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+WorkStealingExecutor::execute(State& state, Item& item) {
+    const auto started = Clock::now();
+    const auto wait_us = ElapsedUs(item.submitted_, started);
+    try {
+        item.task_();
+    } catch (...) {
+        state.failed_.fetch_add(1, std::memory_order_relaxed);
+    }
+    // release what the task captured before it is counted done
+    item.task_ = nullptr;
+    const auto run_us = ElapsedUs(started, Clock::now());
+
+    state.total_wait_us_.fetch_add(wait_us, std::memory_order_relaxed);
+    RaiseMax(state.max_wait_us_, wait_us);
+    state.total_run_us_.fetch_add(run_us, std::memory_order_relaxed);
+    state.completed_.fetch_add(1);
+}
+
+}  // namespace milvus
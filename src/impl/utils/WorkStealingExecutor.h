@@ -0,0 +1,108 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "milvus/types/Executor.h"
+
+namespace milvus {
+
+// Executor with one task deque per worker. A worker runs the newest task of its own deque first, and once it is
+// empty takes the oldest task of the next non-empty deque, so tasks submitted by a task stay on the warm worker
+// while a burst queued on one worker is still spread over the idle ones. Each deque has its own lock, a submit or
+// a take only touches the shared lock when a worker is sleeping. Tasks submitted from outside the pool are spread
+// over the deques round-robin.
+// The workers share the queues through State rather than the executor, so the last reference to the executor may
+// be dropped by one of its own tasks.
+class WorkStealingExecutor : public Executor {
+ public:
+    explicit WorkStealingExecutor(uint32_t worker_count);
+
+    ~WorkStealingExecutor() override;
+
+    Status
+    Submit(Task task) override;
+
+    uint32_t
+    WorkerCount() const override;
+
+    ExecutorStats
+    Stats() const override;
+
+ private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Item {
+        Task task_;
+        Clock::time_point submitted_;
+    };
+
+    struct Queue {
+        std::mutex mutex_;
+        std::deque<Item> items_;
+    };
+
+    struct State {
+        std::vector<std::unique_ptr<Queue>> queues_;
+
+        // workers sleep on cv_ when every deque is empty, idle_ tells a submit whether one needs waking
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::atomic<uint32_t> idle_{0};
+        std::atomic<bool> stopping_{false};
+
+        // signed, a worker may take a task before its submit counted it
+        std::atomic<int64_t> pending_{0};
+        std::atomic<uint64_t> next_queue_{0};
+
+        std::atomic<uint64_t> max_pending_{0};
+        std::atomic<uint64_t> submitted_{0};
+        std::atomic<uint64_t> completed_{0};
+        std::atomic<uint64_t> stolen_{0};
+        std::atomic<uint64_t> failed_{0};
+        std::atomic<uint64_t> total_wait_us_{0};
+        std::atomic<uint64_t> max_wait_us_{0};
+        std::atomic<uint64_t> total_run_us_{0};
+    };
+
+    using StatePtr = std::shared_ptr<State>;
+
+    static void
+    run(const StatePtr& state, size_t index);
+
+    // Take the newest task of the own deque, or else the oldest task of another one.
+    static bool
+    take(State& state, size_t index, Item& item);
+
+    static void
+    execute(State& state, Item& item);
+
+    StatePtr state_;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace milvus
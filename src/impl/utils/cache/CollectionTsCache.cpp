@@ -29,12 +29,11 @@ CollectionTsCache::GetInstance() {
 uint64_t
 CollectionTsCache::Get(const std::string& endpoint, const std::string& db_name, const std::string& collection_name) {
     const auto key = CollectionCacheKey::Create(endpoint, db_name, collection_name);
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto it = cache_.find(key);
-    if (it == cache_.end()) {
+    auto slot = findSlot(key);
+    if (slot == nullptr) {
         return 0;
     }
-    return it->second;
+    return slot->ts_.load(std::memory_order_acquire);
 }
 
 void
@@ -45,37 +44,55 @@ CollectionTsCache::Set(const std::string& endpoint, const std::string& db_name,
     }
 
     const auto key = CollectionCacheKey::Create(endpoint, db_name, collection_name);
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    auto it = cache_.find(key);
-    if (it != cache_.end()) {
-        if (ts > it->second) {
-            it->second = ts;
-        }
+    auto slot = findSlot(key);
+    if (slot != nullptr) {
+        raise(*slot, ts);
         return;
     }
 
-    cache_.emplace(key, ts);
+    // the key is new, or was added by another thread since findSlot() looked
+    auto& shard = shardOf(key);
+    std::unique_lock<std::shared_timed_mutex> lock(shard.mutex_);
+    auto it = shard.slots_.find(key);
+    if (it != shard.slots_.end()) {
+        raise(*it->second, ts);
+        return;
+    }
+    shard.slots_.emplace(key, std::make_shared<Slot>(ts));
 }
 
 void
 CollectionTsCache::Invalidate(const std::string& endpoint, const std::string& db_name,
                               const std::string& collection_name) {
     const auto key = CollectionCacheKey::Create(endpoint, db_name, collection_name);
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    cache_.erase(key);
+    auto& shard = shardOf(key);
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex_);
+        if (shard.slots_.erase(key) == 0) {
+            return;
+        }
+    }
+    snapshot_.Invalidate();
 }
 
 void
 CollectionTsCache::InvalidateDb(const std::string& endpoint, const std::string& db_name) {
     const auto prefix = CollectionCacheKey::Create(endpoint, db_name, "");
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    for (auto it = cache_.begin(); it != cache_.end();) {
-        if (it->first.endpoint_ == prefix.endpoint_ && it->first.db_name_ == prefix.db_name_) {
-            it = cache_.erase(it);
-        } else {
-            ++it;
+    bool removed = false;
+    for (auto& shard : shards_) {
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex_);
+        for (auto it = shard.slots_.begin(); it != shard.slots_.end();) {
+            if (it->first.endpoint_ == prefix.endpoint_ && it->first.db_name_ == prefix.db_name_) {
+                it = shard.slots_.erase(it);
+                removed = true;
+            } else {
+                ++it;
+            }
         }
     }
+    if (removed) {
+        snapshot_.Invalidate();
+    }
 }
 
 void
@@ -97,41 +114,97 @@ CollectionTsCache::Copy(const std::string& endpoint, const std::string& source_d
 void
 CollectionTsCache::transfer(const CollectionCacheKey& source_key, const CollectionCacheKey& target_key,
                             bool drop_source) {
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-
     if (source_key == target_key) {
         return;
     }
 
-    uint64_t latest_ts = 0;
-    auto source_it = cache_.find(source_key);
-    if (source_it != cache_.end()) {
-        latest_ts = source_it->second;
+    auto& source_shard = shardOf(source_key);
+    auto& target_shard = shardOf(target_key);
+    std::unique_lock<std::shared_timed_mutex> source_lock(source_shard.mutex_, std::defer_lock);
+    std::unique_lock<std::shared_timed_mutex> target_lock(target_shard.mutex_, std::defer_lock);
+    if (&source_shard == &target_shard) {
+        source_lock.lock();
+    } else {
+        std::lock(source_lock, target_lock);
     }
-    auto target_it = cache_.find(target_key);
-    if (target_it != cache_.end()) {
-        latest_ts = std::max(latest_ts, target_it->second);
+
+    uint64_t latest_ts = 0;
+    bool removed = false;
+    auto source_it = source_shard.slots_.find(source_key);
+    if (source_it != source_shard.slots_.end()) {
+        latest_ts = source_it->second->ts_.load(std::memory_order_acquire);
+        if (drop_source) {
+            source_shard.slots_.erase(source_it);
+            removed = true;
+        }
     }
 
-    if (drop_source) {
-        cache_.erase(source_key);
+    // an existing target slot is raised in place, so the threads holding it keep seeing it
+    auto target_it = target_shard.slots_.find(target_key);
+    if (target_it != target_shard.slots_.end()) {
+        raise(*target_it->second, latest_ts);
+    } else if (latest_ts != 0) {
+        target_shard.slots_.emplace(target_key, std::make_shared<Slot>(latest_ts));
     }
-    cache_.erase(target_key);
-    if (latest_ts != 0) {
-        cache_.emplace(target_key, latest_ts);
+
+    if (removed) {
+        snapshot_.Invalidate();
     }
 }
 
 void
 CollectionTsCache::Clear() {
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    cache_.clear();
+    for (auto& shard : shards_) {
+        std::unique_lock<std::shared_timed_mutex> lock(shard.mutex_);
+        shard.slots_.clear();
+    }
+    snapshot_.Invalidate();
 }
 
 size_t
 CollectionTsCache::Size() const {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    return cache_.size();
+    size_t size = 0;
+    for (const auto& shard : shards_) {
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex_);
+        size += shard.slots_.size();
+    }
+    return size;
+}
+
+void
+CollectionTsCache::raise(Slot& slot, uint64_t ts) {
+    // a timestamp not newer than the slot costs a load only, the cache line stays shared between readers
+    auto current = slot.ts_.load(std::memory_order_relaxed);
+    while (current < ts &&
+           !slot.ts_.compare_exchange_weak(current, ts, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+    }
+}
+
+CollectionTsCache::Shard&
+CollectionTsCache::shardOf(const CollectionCacheKey& key) {
+    // the map buckets use the low bits of the same hash, the shard is picked by the high bits of its product
+    const auto hash = static_cast<uint64_t>(CollectionCacheKeyHash{}(key));
+    return shards_[((hash * 0x9e3779b97f4a7c15ULL) >> 32) % kShardCount];
+}
+
+CollectionTsCache::Slot*
+CollectionTsCache::findSlot(const CollectionCacheKey& key) {
+    auto cached = snapshot_.Find(key);
+    if (cached != nullptr) {
+        return cached->get();
+    }
+
+    SlotPtr slot;
+    {
+        auto& shard = shardOf(key);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex_);
+        auto it = shard.slots_.find(key);
+        if (it == shard.slots_.end()) {
+            return nullptr;
+        }
+        slot = it->second;
+    }
+    return snapshot_.Keep(key, std::move(slot)).get();
 }
 
 }  // namespace milvus
@@ -16,17 +16,25 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
 #include "./CollectionCacheKey.h"
+#include "./ThreadSnapshot.h"
 
 namespace milvus {
 
+// Latest write timestamp of each collection, read by every SESSION consistency search/query and raised after
+// every insert, upsert and delete. Keys are spread over shards, each key owns an atomic slot that is only ever
+// raised. Once a thread has seen a key, Get() is one atomic load and Set() one compare-and-swap at most, both
+// through a per-thread snapshot of the slots, no lock is taken until a key is added or removed.
 class CollectionTsCache {
  public:
     static CollectionTsCache&
@@ -62,11 +70,42 @@ class CollectionTsCache {
     Size() const;
 
  private:
+    // A slot removed from its shard stays alive while a thread snapshot still holds it, a write racing
+    // with the removal lands in the removed slot and is dropped with it, as if it had happened first.
+    struct Slot {
+        explicit Slot(uint64_t ts) : ts_(ts) {
+        }
+
+        std::atomic<uint64_t> ts_;
+    };
+
+    using SlotPtr = std::shared_ptr<Slot>;
+    using SlotMap = std::unordered_map<CollectionCacheKey, SlotPtr, CollectionCacheKeyHash>;
+
+    struct Shard {
+        mutable std::shared_timed_mutex mutex_;
+        SlotMap slots_;
+    };
+
+    static constexpr size_t kShardCount = 64;
+
+    static void
+    raise(Slot& slot, uint64_t ts);
+
+    Shard&
+    shardOf(const CollectionCacheKey& key);
+
+    // The slot of a key, owned by the calling thread's snapshot, or nullptr if the key is not cached.
+    Slot*
+    findSlot(const CollectionCacheKey& key);
+
     void
     transfer(const CollectionCacheKey& source_key, const CollectionCacheKey& target_key, bool drop_source);
 
-    mutable std::shared_timed_mutex mutex_;
-    std::unordered_map<CollectionCacheKey, uint64_t, CollectionCacheKeyHash> cache_;
+    // Invalidated whenever a slot is removed. Adding a key or raising a timestamp leaves it alone, so steady
+    // writes never invalidate readers.
+    ThreadSnapshot<SlotPtr> snapshot_;
+    std::array<Shard, kShardCount> shards_;
 };
 
 }  // namespace milvus
@@ -0,0 +1,220 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./MetadataCache.h"
+
+#include <chrono>
+#include <iterator>
+#include <utility>
+
+namespace milvus {
+
+void
+MetadataCache::SetParam(const MetadataCacheParam& param) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    param_ = param;
+    if (param_.TtlMs() == 0) {
+        lru_.clear();
+        index_.clear();
+        return;
+    }
+    while (lru_.size() > param_.MaxEntries()) {
+        eraseLocked(std::prev(lru_.end()));
+        ++evictions_;
+    }
+}
+
+MetadataCacheParam
+MetadataCache::Param() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return param_;
+}
+
+bool
+MetadataCache::Enabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return param_.TtlMs() > 0;
+}
+
+MetadataCache::Key
+MetadataCache::MakeKey(const std::string& endpoint, const std::string& db_name, const std::string& collection_name,
+                       Kind kind, std::string detail) const {
+    Key key;
+    key.collection_ = CollectionCacheKey::Create(endpoint, db_name, collection_name);
+    key.kind_ = kind;
+    key.detail_ = std::move(detail);
+    std::lock_guard<std::mutex> lock(mutex_);
+    key.generation_ = generation_;
+    return key;
+}
+
+bool
+MetadataCache::Get(const Key& key, DescribeIndexResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookupLocked(key);
+    if (it == lru_.end() || it->indexes_ == nullptr) {
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    response = *it->indexes_;
+    return true;
+}
+
+bool
+MetadataCache::Get(const Key& key, ListPartitionsResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookupLocked(key);
+    if (it == lru_.end() || it->partitions_ == nullptr) {
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    response = *it->partitions_;
+    return true;
+}
+
+bool
+MetadataCache::Get(const Key& key, GetLoadStateResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookupLocked(key);
+    if (it == lru_.end() || it->load_state_ == nullptr) {
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    response = *it->load_state_;
+    return true;
+}
+
+void
+MetadataCache::Put(const Key& key, const DescribeIndexResponse& response) {
+    Entry entry;
+    entry.indexes_ = std::make_shared<const DescribeIndexResponse>(response);
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(key, std::move(entry));
+}
+
+void
+MetadataCache::Put(const Key& key, const ListPartitionsResponse& response) {
+    Entry entry;
+    entry.partitions_ = std::make_shared<const ListPartitionsResponse>(response);
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(key, std::move(entry));
+}
+
+void
+MetadataCache::Put(const Key& key, const GetLoadStateResponse& response) {
+    Entry entry;
+    entry.load_state_ = std::make_shared<const GetLoadStateResponse>(response);
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(key, std::move(entry));
+}
+
+void
+MetadataCache::Invalidate(const std::string& endpoint, const std::string& db_name,
+                          const std::string& collection_name) {
+    const auto collection = CollectionCacheKey::Create(endpoint, db_name, collection_name);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        auto current = it++;
+        if (current->key_.collection_ == collection) {
+            eraseLocked(current);
+            ++invalidations_;
+        }
+    }
+}
+
+void
+MetadataCache::InvalidateDb(const std::string& endpoint, const std::string& db_name) {
+    const auto prefix = CollectionCacheKey::Create(endpoint, db_name, "");
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        auto current = it++;
+        if (current->key_.collection_.endpoint_ == prefix.endpoint_ &&
+            current->key_.collection_.db_name_ == prefix.db_name_) {
+            eraseLocked(current);
+            ++invalidations_;
+        }
+    }
+}
+
+void
+MetadataCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    lru_.clear();
+    index_.clear();
+}
+
+MetadataCacheStats
+MetadataCache::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, expirations_, invalidations_, evictions_, static_cast<uint64_t>(lru_.size())};
+}
+
+MetadataCache::EntryList::iterator
+MetadataCache::lookupLocked(const Key& key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+        return lru_.end();
+    }
+    auto it = found->second;
+    if (it->expire_at_ms_ <= nowMs()) {
+        eraseLocked(it);
+        ++expirations_;
+        return lru_.end();
+    }
+    lru_.splice(lru_.begin(), lru_, it);
+    return it;
+}
+
+void
+MetadataCache::insertLocked(const Key& key, Entry&& entry) {
+    // disabled, or the collection was changed while the rpc call was in flight
+    if (param_.TtlMs() == 0 || key.generation_ != generation_) {
+        return;
+    }
+    entry.key_ = key;
+    entry.expire_at_ms_ = nowMs() + static_cast<int64_t>(param_.TtlMs());
+
+    auto found = index_.find(key);
+    if (found != index_.end()) {
+        eraseLocked(found->second);
+    }
+    while (!lru_.empty() && lru_.size() >= param_.MaxEntries()) {
+        eraseLocked(std::prev(lru_.end()));
+        ++evictions_;
+    }
+    lru_.push_front(std::move(entry));
+    index_[key] = lru_.begin();
+}
+
+void
+MetadataCache::eraseLocked(EntryList::iterator it) {
+    index_.erase(it->key_);
+    lru_.erase(it);
+}
+
+int64_t
+MetadataCache::nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace milvus
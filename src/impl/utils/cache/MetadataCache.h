@@ -0,0 +1,150 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "./CollectionCacheKey.h"
+#include "milvus/response/collection/GetLoadStateResponse.h"
+#include "milvus/response/index/DescribeIndexResponse.h"
+#include "milvus/response/partition/ListPartitionsResponse.h"
+#include "milvus/types/MetadataCacheParam.h"
+#include "milvus/types/MetadataCacheStats.h"
+
+namespace milvus {
+
+// Per-client TTL cache of index, partition and load state lookups, see MetadataCacheParam. Entries are keyed by
+// collection, kind of lookup and the request details that change the answer. Every invalidation bumps a
+// generation, a response whose rpc call started before that is not cached, so a lookup racing with a change of
+// this client cannot put the old answer back.
+class MetadataCache {
+ public:
+    enum class Kind {
+        INDEXES = 0,
+        PARTITIONS = 1,
+        LOAD_STATE = 2,
+    };
+
+    struct Key {
+        CollectionCacheKey collection_;
+        Kind kind_ = Kind::INDEXES;
+        std::string detail_;
+        // the generation observed before the rpc call, not a part of the identity
+        uint64_t generation_ = 0;
+
+        bool
+        operator==(const Key& other) const {
+            return kind_ == other.kind_ && collection_ == other.collection_ && detail_ == other.detail_;
+        }
+    };
+
+    struct KeyHash {
+        size_t
+        operator()(const Key& key) const {
+            size_t seed = CollectionCacheKeyHash{}(key.collection_);
+            seed ^= std::hash<std::string>{}(key.detail_) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            seed ^= static_cast<size_t>(key.kind_) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            return seed;
+        }
+    };
+
+    void
+    SetParam(const MetadataCacheParam& param);
+
+    MetadataCacheParam
+    Param() const;
+
+    bool
+    Enabled() const;
+
+    Key
+    MakeKey(const std::string& endpoint, const std::string& db_name, const std::string& collection_name, Kind kind,
+            std::string detail) const;
+
+    bool
+    Get(const Key& key, DescribeIndexResponse& response);
+
+    bool
+    Get(const Key& key, ListPartitionsResponse& response);
+
+    bool
+    Get(const Key& key, GetLoadStateResponse& response);
+
+    void
+    Put(const Key& key, const DescribeIndexResponse& response);
+
+    void
+    Put(const Key& key, const ListPartitionsResponse& response);
+
+    void
+    Put(const Key& key, const GetLoadStateResponse& response);
+
+    void
+    Invalidate(const std::string& endpoint, const std::string& db_name, const std::string& collection_name);
+
+    void
+    InvalidateDb(const std::string& endpoint, const std::string& db_name);
+
+    void
+    Clear();
+
+    MetadataCacheStats
+    Stats() const;
+
+ private:
+    struct Entry {
+        Key key_;
+        int64_t expire_at_ms_ = 0;
+        std::shared_ptr<const DescribeIndexResponse> indexes_;
+        std::shared_ptr<const ListPartitionsResponse> partitions_;
+        std::shared_ptr<const GetLoadStateResponse> load_state_;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    EntryList::iterator
+    lookupLocked(const Key& key);
+
+    void
+    insertLocked(const Key& key, Entry&& entry);
+
+    void
+    eraseLocked(EntryList::iterator it);
+
+    static int64_t
+    nowMs();
+
+    mutable std::mutex mutex_;
+    MetadataCacheParam param_;
+    EntryList lru_;  // most recently used first
+    std::unordered_map<Key, EntryList::iterator, KeyHash> index_;
+    uint64_t generation_ = 0;
+
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t expirations_ = 0;
+    uint64_t invalidations_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+}  // namespace milvus
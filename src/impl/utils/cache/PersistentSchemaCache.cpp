@@ -0,0 +1,385 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./PersistentSchemaCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace milvus {
+
+namespace {
+
+constexpr char kMagic[4] = {'M', 'V', 'S', 'C'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderSize = sizeof(kMagic) + sizeof(uint32_t) * 2;
+
+std::mutex registry_mutex;
+std::unordered_map<std::string, std::weak_ptr<PersistentSchemaCache>> registry;
+
+std::vector<PersistentSchemaCachePtr>
+OpenedFiles() {
+    std::vector<PersistentSchemaCachePtr> files;
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto it = registry.begin(); it != registry.end();) {
+        auto file = it->second.lock();
+        if (file == nullptr) {
+            it = registry.erase(it);
+        } else {
+            files.emplace_back(std::move(file));
+            ++it;
+        }
+    }
+    return files;
+}
+
+// Bounds checked reads of one mapped file, every read fails once the end has been passed.
+class Reader {
+ public:
+    Reader(const char* data, size_t size) : pos_(data), end_(data + size) {
+    }
+
+    template <typename T>
+    bool
+    Read(T& value) {
+        if (static_cast<size_t>(end_ - pos_) < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool
+    ReadBytes(const char*& data, size_t& size) {
+        uint32_t length = 0;
+        if (!Read(length) || static_cast<size_t>(end_ - pos_) < length) {
+            return false;
+        }
+        data = pos_;
+        size = length;
+        pos_ += length;
+        return true;
+    }
+
+    bool
+    ReadString(std::string& value) {
+        const char* data = nullptr;
+        size_t size = 0;
+        if (!ReadBytes(data, size)) {
+            return false;
+        }
+        value.assign(data, size);
+        return true;
+    }
+
+ private:
+    const char* pos_;
+    const char* end_;
+};
+
+template <typename T>
+void
+WriteValue(std::ostream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void
+WriteBytes(std::ostream& out, const char* data, size_t size) {
+    WriteValue(out, static_cast<uint32_t>(size));
+    out.write(data, static_cast<std::streamsize>(size));
+}
+
+}  // namespace
+
+PersistentSchemaCache::FileView::~FileView() {
+#ifndef _WIN32
+    if (mapped_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+}
+
+PersistentSchemaCache::PersistentSchemaCache(std::string path) : path_(std::move(path)) {
+}
+
+PersistentSchemaCache::~PersistentSchemaCache() = default;
+
+PersistentSchemaCachePtr
+PersistentSchemaCache::Open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto& slot = registry[path];
+    auto file = slot.lock();
+    if (file != nullptr) {
+        return file;
+    }
+
+    file.reset(new PersistentSchemaCache(path));
+    auto view = mapFile(path);
+    if (view != nullptr) {
+        parseRecords(*view, file->records_);
+        file->views_.emplace_back(std::move(view));
+    }
+    slot = file;
+    return file;
+}
+
+void
+PersistentSchemaCache::InvalidateAll(const CollectionCacheKey& key) {
+    for (const auto& file : OpenedFiles()) {
+        file->Invalidate(key);
+    }
+}
+
+void
+PersistentSchemaCache::InvalidateDbAll(const CollectionCacheKey& prefix) {
+    for (const auto& file : OpenedFiles()) {
+        file->InvalidateDb(prefix);
+    }
+}
+
+void
+PersistentSchemaCache::ClearAll() {
+    for (const auto& file : OpenedFiles()) {
+        file->Clear();
+    }
+}
+
+const std::string&
+PersistentSchemaCache::Path() const {
+    return path_;
+}
+
+bool
+PersistentSchemaCache::Get(const CollectionCacheKey& key, uint64_t& update_time, std::string& payload) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = records_.find(key);
+    if (it == records_.end()) {
+        return false;
+    }
+    update_time = it->second.update_time_;
+    payload.assign(it->second.data_, it->second.size_);
+    return true;
+}
+
+void
+PersistentSchemaCache::Set(const CollectionCacheKey& key, uint64_t update_time, std::string payload) {
+    Record record;
+    record.update_time_ = update_time;
+    record.owned_ = std::make_shared<const std::string>(std::move(payload));
+    record.data_ = record.owned_->data();
+    record.size_ = record.owned_->size();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_[key] = std::move(record);
+    dirty_ = true;
+}
+
+void
+PersistentSchemaCache::Invalidate(const CollectionCacheKey& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.erase(key);
+    dropped_.push_back(key);
+    dirty_ = true;
+}
+
+void
+PersistentSchemaCache::InvalidateDb(const CollectionCacheKey& prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = records_.begin(); it != records_.end();) {
+        if (it->first.endpoint_ == prefix.endpoint_ && it->first.db_name_ == prefix.db_name_) {
+            it = records_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    dropped_.push_back({prefix.endpoint_, prefix.db_name_, ""});
+    dirty_ = true;
+}
+
+void
+PersistentSchemaCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.clear();
+    dropped_.clear();
+    cleared_ = true;
+    dirty_ = true;
+}
+
+size_t
+PersistentSchemaCache::Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_.size();
+}
+
+Status
+PersistentSchemaCache::Save() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!dirty_) {
+        return Status::OK();
+    }
+
+    // merge what other processes saved since this file was read
+    RecordMap merged = records_;
+    auto current = mapFile(path_);
+    if (current != nullptr) {
+        RecordMap saved;
+        parseRecords(*current, saved);
+        for (auto& pair : saved) {
+            if (isDroppedLocked(pair.first)) {
+                continue;
+            }
+            auto it = merged.find(pair.first);
+            if (it != merged.end() && it->second.update_time_ >= pair.second.update_time_) {
+                continue;
+            }
+            // the merged mapping is released below, so the payload is copied out of it
+            auto& record = pair.second;
+            record.owned_ = std::make_shared<const std::string>(record.data_, record.size_);
+            record.data_ = record.owned_->data();
+            merged[pair.first] = std::move(record);
+        }
+    }
+
+    // a unique name, several processes might save the same file at once
+    const auto tmp_path = path_ + ".tmp." + std::to_string(reinterpret_cast<uintptr_t>(this)) + "." +
+                          std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return {StatusCode::UNKNOWN_ERROR, "Failed to create schema cache file " + tmp_path};
+        }
+        out.write(kMagic, sizeof(kMagic));
+        WriteValue(out, kVersion);
+        WriteValue(out, static_cast<uint32_t>(merged.size()));
+        for (const auto& pair : merged) {
+            const auto& key = pair.first;
+            WriteBytes(out, key.endpoint_.data(), key.endpoint_.size());
+            WriteBytes(out, key.db_name_.data(), key.db_name_.size());
+            WriteBytes(out, key.collection_name_.data(), key.collection_name_.size());
+            WriteValue(out, pair.second.update_time_);
+            WriteBytes(out, pair.second.data_, pair.second.size_);
+        }
+        out.close();
+        if (!out) {
+            std::remove(tmp_path.c_str());
+            return {StatusCode::UNKNOWN_ERROR, "Failed to write schema cache file " + tmp_path};
+        }
+    }
+
+#ifdef _WIN32
+    // rename() does not replace an existing file on Windows
+    std::remove(path_.c_str());
+#endif
+    if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return {StatusCode::UNKNOWN_ERROR, "Failed to replace schema cache file " + path_};
+    }
+
+    records_ = std::move(merged);
+    dropped_.clear();
+    cleared_ = false;
+    dirty_ = false;
+    return Status::OK();
+}
+
+PersistentSchemaCache::FileViewPtr
+PersistentSchemaCache::mapFile(const std::string& path) {
+    auto view = std::make_shared<FileView>();
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kHeaderSize)) {
+        close(fd);
+        return nullptr;
+    }
+    void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the descriptor is closed, and after the file is replaced
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    view->data_ = static_cast<const char*>(data);
+    view->size_ = static_cast<size_t>(st.st_size);
+    view->mapped_ = true;
+#else
+    // a mapped file cannot be replaced on Windows, so the file is read instead
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return nullptr;
+    }
+    view->buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    if (view->buffer_.size() < kHeaderSize) {
+        return nullptr;
+    }
+    view->data_ = view->buffer_.data();
+    view->size_ = view->buffer_.size();
+#endif
+    return view;
+}
+
+void
+PersistentSchemaCache::parseRecords(const FileView& view, RecordMap& records) {
+    Reader reader(view.data_, view.size_);
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    uint32_t count = 0;
+    if (!reader.Read(magic) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || !reader.Read(version) ||
+        version != kVersion || !reader.Read(count)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        CollectionCacheKey key;
+        Record record;
+        if (!reader.ReadString(key.endpoint_) || !reader.ReadString(key.db_name_) ||
+            !reader.ReadString(key.collection_name_) || !reader.Read(record.update_time_) ||
+            !reader.ReadBytes(record.data_, record.size_)) {
+            return;
+        }
+        records[std::move(key)] = std::move(record);
+    }
+}
+
+bool
+PersistentSchemaCache::isDroppedLocked(const CollectionCacheKey& key) const {
+    if (cleared_) {
+        return true;
+    }
+    for (const auto& dropped : dropped_) {
+        if (dropped.endpoint_ == key.endpoint_ && dropped.db_name_ == key.db_name_ &&
+            (dropped.collection_name_.empty() || dropped.collection_name_ == key.collection_name_)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace milvus
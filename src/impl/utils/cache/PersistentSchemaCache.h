@@ -0,0 +1,143 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "./CollectionCacheKey.h"
+#include "milvus/Status.h"
+
+namespace milvus {
+
+// Serialized collection schemas kept in a file across processes, see ConnectParam::SetSchemaCacheFile().
+// The file is mapped once when it is opened and records are only indexed, a schema is copied out of the
+// mapping when it is first asked for. The payload of a record is opaque here, the client encodes it.
+//
+// The file is a local cache written in host byte order:
+//   header:  magic "MVSC" | uint32 version | uint32 record count
+//   record:  uint32 length + endpoint | uint32 length + db name | uint32 length + collection name |
+//            uint64 update time | uint32 length + payload
+// A file with a different header is ignored, a truncated file keeps the records before the damage.
+class PersistentSchemaCache {
+ public:
+    ~PersistentSchemaCache();
+
+    PersistentSchemaCache(const PersistentSchemaCache&) = delete;
+    PersistentSchemaCache&
+    operator=(const PersistentSchemaCache&) = delete;
+
+    // Clients of one process opening the same path share one instance, so that an invalidation by one
+    // client is seen by the others and the file is not written with diverging contents.
+    static std::shared_ptr<PersistentSchemaCache>
+    Open(const std::string& path);
+
+    // Forwarded by SchemaCache, a schema dropped from memory must not come back from any open file.
+    static void
+    InvalidateAll(const CollectionCacheKey& key);
+
+    static void
+    InvalidateDbAll(const CollectionCacheKey& prefix);
+
+    static void
+    ClearAll();
+
+    const std::string&
+    Path() const;
+
+    bool
+    Get(const CollectionCacheKey& key, uint64_t& update_time, std::string& payload) const;
+
+    void
+    Set(const CollectionCacheKey& key, uint64_t update_time, std::string payload);
+
+    void
+    Invalidate(const CollectionCacheKey& key);
+
+    void
+    InvalidateDb(const CollectionCacheKey& prefix);
+
+    void
+    Clear();
+
+    size_t
+    Size() const;
+
+    // Write the records back if any was changed since the file was opened or last saved. Records another
+    // process saved in the meantime are kept unless this process has invalidated them, and of two versions
+    // of one schema the one with the newer update time wins. The file is replaced by a rename, so a reader
+    // never maps a half written file.
+    Status
+    Save();
+
+ private:
+    explicit PersistentSchemaCache(std::string path);
+
+    struct Record {
+        uint64_t update_time_{0};
+        const char* data_{nullptr};
+        size_t size_{0};
+        // set when the payload is not in a mapping
+        std::shared_ptr<const std::string> owned_;
+    };
+
+    using RecordMap = std::unordered_map<CollectionCacheKey, Record, CollectionCacheKeyHash>;
+
+    // Contents of one file, mapped where the platform allows it.
+    struct FileView {
+        FileView() = default;
+        FileView(const FileView&) = delete;
+        FileView&
+        operator=(const FileView&) = delete;
+        ~FileView();
+
+        const char* data_{nullptr};
+        size_t size_{0};
+        bool mapped_{false};
+        std::string buffer_;
+    };
+
+    using FileViewPtr = std::shared_ptr<FileView>;
+
+    static FileViewPtr
+    mapFile(const std::string& path);
+
+    static void
+    parseRecords(const FileView& view, RecordMap& records);
+
+    bool
+    isDroppedLocked(const CollectionCacheKey& key) const;
+
+    const std::string path_;
+    mutable std::mutex mutex_;
+    RecordMap records_;
+    // every file a record points into, kept mapped until this instance goes away
+    std::vector<FileViewPtr> views_;
+    // what this process invalidated since the last save, an empty collection name stands for a database
+    std::vector<CollectionCacheKey> dropped_;
+    bool cleared_{false};
+    bool dirty_{false};
+};
+
+using PersistentSchemaCachePtr = std::shared_ptr<PersistentSchemaCache>;
+
+}  // namespace milvus
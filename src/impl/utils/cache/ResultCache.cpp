@@ -0,0 +1,226 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./ResultCache.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <chrono>
+#include <iterator>
+#include <utility>
+
+namespace milvus {
+
+ResultCache::ResultCache(CollectionTsCache& ts_cache, SchemaCache& schema_cache)
+    : ts_cache_(ts_cache), schema_cache_(schema_cache) {
+}
+
+void
+ResultCache::SetParam(const ResultCacheParam& param) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    param_ = param;
+    evictLocked(static_cast<size_t>(param_.CapacityBytes()));
+}
+
+ResultCacheParam
+ResultCache::Param() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return param_;
+}
+
+bool
+ResultCache::Accept(ConsistencyLevel level) const {
+    if (level != ConsistencyLevel::SESSION && level != ConsistencyLevel::BOUNDED &&
+        level != ConsistencyLevel::EVENTUALLY) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return param_.CapacityBytes() > 0;
+}
+
+ResultCache::Key
+ResultCache::MakeKey(const std::string& endpoint, const std::string& db_name, const std::string& collection_name,
+                     ConsistencyLevel level, const google::protobuf::Message& rpc_request) const {
+    Key key;
+    key.collection_ = CollectionCacheKey::Create(endpoint, db_name, collection_name);
+    key.level_ = level;
+    // take the snapshots before the rpc call, a write that happens during the call makes the entry stale
+    key.write_ts_ = ts_cache_.Get(endpoint, db_name, collection_name);
+    key.schema_generation_ = schema_cache_.Generation();
+
+    // map fields such as expr_template_values have no stable order unless serialized deterministically
+    key.canonical_ = key.collection_.endpoint_;
+    key.canonical_.push_back('\0');
+    key.canonical_ += rpc_request.GetDescriptor()->full_name();
+    key.canonical_.push_back('\0');
+    {
+        google::protobuf::io::StringOutputStream output(&key.canonical_);
+        google::protobuf::io::CodedOutputStream coded(&output);
+        coded.SetSerializationDeterministic(true);
+        rpc_request.SerializeToCodedStream(&coded);
+    }
+    key.hash_ = std::hash<std::string>{}(key.canonical_);
+    return key;
+}
+
+bool
+ResultCache::Get(const Key& key, SearchResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookupLocked(key);
+    if (it == lru_.end() || it->search_ == nullptr) {
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    response = *it->search_;
+    return true;
+}
+
+bool
+ResultCache::Get(const Key& key, QueryResponse& response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookupLocked(key);
+    if (it == lru_.end() || it->query_ == nullptr) {
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    response = *it->query_;
+    return true;
+}
+
+void
+ResultCache::Put(const Key& key, const SearchResponse& response, size_t response_bytes) {
+    if (!isCurrent(key)) {
+        return;
+    }
+    Entry entry;
+    entry.search_ = std::make_shared<const SearchResponse>(response);
+    entry.bytes_ = response_bytes;
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(key, std::move(entry));
+}
+
+void
+ResultCache::Put(const Key& key, const QueryResponse& response, size_t response_bytes) {
+    if (!isCurrent(key)) {
+        return;
+    }
+    Entry entry;
+    entry.query_ = std::make_shared<const QueryResponse>(response);
+    entry.bytes_ = response_bytes;
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertLocked(key, std::move(entry));
+}
+
+void
+ResultCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+ResultCacheStats
+ResultCache::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, evictions_, invalidations_, static_cast<uint64_t>(lru_.size()),
+            static_cast<uint64_t>(bytes_)};
+}
+
+ResultCache::EntryList::iterator
+ResultCache::lookupLocked(const Key& key) {
+    auto found = index_.find(key.hash_);
+    if (found == index_.end()) {
+        return lru_.end();
+    }
+    auto it = found->second;
+    if (it->canonical_ != key.canonical_) {
+        return lru_.end();
+    }
+
+    // an entry built before a newer write or a schema change is outdated, while an entry newer than
+    // the caller's snapshot is kept for later callers
+    if (it->write_ts_ < key.write_ts_ || it->schema_generation_ < key.schema_generation_ ||
+        (it->expire_at_ms_ > 0 && it->expire_at_ms_ <= nowMs())) {
+        eraseLocked(it);
+        ++invalidations_;
+        return lru_.end();
+    }
+    if (it->write_ts_ != key.write_ts_ || it->schema_generation_ != key.schema_generation_) {
+        return lru_.end();
+    }
+
+    lru_.splice(lru_.begin(), lru_, it);
+    return it;
+}
+
+void
+ResultCache::insertLocked(const Key& key, Entry&& entry) {
+    const auto capacity = static_cast<size_t>(param_.CapacityBytes());
+    entry.hash_ = key.hash_;
+    entry.canonical_ = key.canonical_;
+    entry.write_ts_ = key.write_ts_;
+    entry.schema_generation_ = key.schema_generation_;
+    entry.bytes_ += entry.canonical_.size() + sizeof(Entry);
+    if (key.level_ == ConsistencyLevel::BOUNDED || key.level_ == ConsistencyLevel::EVENTUALLY) {
+        entry.expire_at_ms_ = nowMs() + static_cast<int64_t>(param_.TtlMs());
+    }
+    if (entry.bytes_ > capacity) {
+        return;
+    }
+
+    auto found = index_.find(key.hash_);
+    if (found != index_.end()) {
+        eraseLocked(found->second);
+    }
+    evictLocked(capacity - entry.bytes_);
+
+    bytes_ += entry.bytes_;
+    lru_.push_front(std::move(entry));
+    index_[key.hash_] = lru_.begin();
+}
+
+void
+ResultCache::eraseLocked(EntryList::iterator it) {
+    bytes_ -= it->bytes_;
+    index_.erase(it->hash_);
+    lru_.erase(it);
+}
+
+void
+ResultCache::evictLocked(size_t capacity) {
+    while (!lru_.empty() && bytes_ > capacity) {
+        eraseLocked(std::prev(lru_.end()));
+        ++evictions_;
+    }
+}
+
+bool
+ResultCache::isCurrent(const Key& key) const {
+    return schema_cache_.Generation() == key.schema_generation_ &&
+           ts_cache_.Get(key.collection_.endpoint_, key.collection_.db_name_, key.collection_.collection_name_) ==
+               key.write_ts_;
+}
+
+int64_t
+ResultCache::nowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace milvus
@@ -0,0 +1,139 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "./CollectionCacheKey.h"
+#include "./CollectionTsCache.h"
+#include "./SchemaCache.h"
+#include "milvus/response/dql/QueryResponse.h"
+#include "milvus/response/dql/SearchResponse.h"
+#include "milvus/types/ConsistencyLevel.h"
+#include "milvus/types/ResultCacheParam.h"
+#include "milvus/types/ResultCacheStats.h"
+
+namespace milvus {
+
+// Per-client LRU cache of search/query results. Entries are keyed by the hash of the deterministic
+// serialization of the converted rpc request, so two requests share an entry only when the server
+// would receive exactly the same message. Each key carries the collection's latest write timestamp
+// and the schema cache generation observed before the rpc call, an entry built from an older
+// snapshot is dropped on lookup.
+class ResultCache {
+ public:
+    struct Key {
+        size_t hash_ = 0;
+        std::string canonical_;
+        CollectionCacheKey collection_;
+        ConsistencyLevel level_ = ConsistencyLevel::NONE;
+        uint64_t write_ts_ = 0;
+        uint64_t schema_generation_ = 0;
+    };
+
+    explicit ResultCache(CollectionTsCache& ts_cache = CollectionTsCache::GetInstance(),
+                         SchemaCache& schema_cache = SchemaCache::GetInstance());
+
+    void
+    SetParam(const ResultCacheParam& param);
+
+    ResultCacheParam
+    Param() const;
+
+    // STRONG reads must reach the server, and NONE follows the collection's default level which
+    // might be STRONG, so only SESSION/BOUNDED/EVENTUALLY reads are cached.
+    bool
+    Accept(ConsistencyLevel level) const;
+
+    Key
+    MakeKey(const std::string& endpoint, const std::string& db_name, const std::string& collection_name,
+            ConsistencyLevel level, const google::protobuf::Message& rpc_request) const;
+
+    bool
+    Get(const Key& key, SearchResponse& response);
+
+    bool
+    Get(const Key& key, QueryResponse& response);
+
+    void
+    Put(const Key& key, const SearchResponse& response, size_t response_bytes);
+
+    void
+    Put(const Key& key, const QueryResponse& response, size_t response_bytes);
+
+    void
+    Clear();
+
+    ResultCacheStats
+    Stats() const;
+
+ private:
+    struct Entry {
+        size_t hash_ = 0;
+        std::string canonical_;
+        uint64_t write_ts_ = 0;
+        uint64_t schema_generation_ = 0;
+        int64_t expire_at_ms_ = 0;  // 0 means never expire
+        size_t bytes_ = 0;
+        std::shared_ptr<const SearchResponse> search_;
+        std::shared_ptr<const QueryResponse> query_;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    EntryList::iterator
+    lookupLocked(const Key& key);
+
+    void
+    insertLocked(const Key& key, Entry&& entry);
+
+    void
+    eraseLocked(EntryList::iterator it);
+
+    void
+    evictLocked(size_t capacity);
+
+    bool
+    isCurrent(const Key& key) const;
+
+    static int64_t
+    nowMs();
+
+    CollectionTsCache& ts_cache_;
+    SchemaCache& schema_cache_;
+
+    mutable std::mutex mutex_;
+    ResultCacheParam param_;
+    EntryList lru_;  // most recently used first
+    std::unordered_map<size_t, EntryList::iterator> index_;
+    size_t bytes_ = 0;
+
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+    uint64_t invalidations_ = 0;
+};
+
+}  // namespace milvus
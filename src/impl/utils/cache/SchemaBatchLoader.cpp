@@ -0,0 +1,159 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./SchemaBatchLoader.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace milvus {
+
+constexpr size_t SchemaBatchLoader::default_max_batch;
+constexpr std::chrono::milliseconds SchemaBatchLoader::default_window;
+
+size_t
+SchemaBatchLoader::Batch::Add(const std::string& name) {
+    auto it = positions_.find(name);
+    if (it != positions_.end()) {
+        return it->second;
+    }
+    positions_.emplace(name, names_.size());
+    names_.push_back(name);
+    return names_.size() - 1;
+}
+
+SchemaBatchLoader::SchemaBatchLoader(SingleLoader single_loader, BatchLoader batch_loader, size_t max_batch,
+                                     std::chrono::microseconds window)
+    : single_loader_(std::move(single_loader)),
+      batch_loader_(std::move(batch_loader)),
+      max_batch_(std::max<size_t>(max_batch, 1)),
+      window_(window) {
+}
+
+Status
+SchemaBatchLoader::Load(const std::string& db_name, const std::string& collection_name, CollectionDescPtr& desc) {
+    if (!BatchSupported()) {
+        return single_loader_(db_name, collection_name, desc);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto& slot = pending_[db_name];
+    BatchPtr batch = slot;
+    Status status;
+    if (batch != nullptr) {
+        const auto position = batch->Add(collection_name);
+        if (batch->names_.size() >= max_batch_) {
+            cv_.notify_all();
+        }
+        cv_.wait(lock, [&batch]() { return batch->done_; });
+        status = batch->statuses_[position];
+        desc = batch->descs_[position];
+    } else {
+        batch = std::make_shared<Batch>();
+        slot = batch;
+        batch->Add(collection_name);
+        const auto deadline = std::chrono::steady_clock::now() + window_;
+        cv_.wait_until(lock, deadline,
+                       [this, &batch]() { return in_flight_ == 0 || batch->names_.size() >= max_batch_; });
+
+        // close the batch, later misses start the next one
+        auto it = pending_.find(db_name);
+        if (it != pending_.end() && it->second == batch) {
+            pending_.erase(it);
+        }
+        ++in_flight_;
+        lock.unlock();
+        run(db_name, *batch);
+        lock.lock();
+        --in_flight_;
+        batch->done_ = true;
+        cv_.notify_all();
+        status = batch->statuses_[0];
+        desc = batch->descs_[0];
+    }
+    lock.unlock();
+
+    if (status.Code() == StatusCode::NOT_SUPPORTED) {
+        return single_loader_(db_name, collection_name, desc);
+    }
+    return status;
+}
+
+void
+SchemaBatchLoader::LoadMany(const std::string& db_name, const std::vector<std::string>& names,
+                            std::vector<Status>& statuses, std::vector<CollectionDescPtr>& descs) {
+    statuses.assign(names.size(), Status::OK());
+    descs.assign(names.size(), nullptr);
+    for (size_t begin = 0; begin < names.size(); begin += max_batch_) {
+        Batch batch;
+        const auto end = std::min(begin + max_batch_, names.size());
+        batch.names_.assign(names.begin() + static_cast<std::ptrdiff_t>(begin),
+                            names.begin() + static_cast<std::ptrdiff_t>(end));
+        if (BatchSupported()) {
+            run(db_name, batch);
+        } else {
+            batch.statuses_.assign(batch.names_.size(), {StatusCode::NOT_SUPPORTED, ""});
+            batch.descs_.assign(batch.names_.size(), nullptr);
+        }
+        for (size_t i = 0; i < batch.names_.size(); ++i) {
+            if (batch.statuses_[i].Code() == StatusCode::NOT_SUPPORTED) {
+                batch.statuses_[i] = single_loader_(db_name, batch.names_[i], batch.descs_[i]);
+            }
+            statuses[begin + i] = std::move(batch.statuses_[i]);
+            descs[begin + i] = std::move(batch.descs_[i]);
+        }
+    }
+}
+
+bool
+SchemaBatchLoader::BatchSupported() const {
+    return batch_supported_.load(std::memory_order_relaxed);
+}
+
+// Never throws: the waiters of a batch only wake up once every name of it has a status.
+void
+SchemaBatchLoader::run(const std::string& db_name, Batch& batch) {
+    const auto count = batch.names_.size();
+    batch.statuses_.assign(count, Status::OK());
+    batch.descs_.assign(count, nullptr);
+
+    Status status;
+    try {
+        if (count == 1) {
+            batch.statuses_[0] = single_loader_(db_name, batch.names_[0], batch.descs_[0]);
+            return;
+        }
+        status = batch_loader_(db_name, batch.names_, batch.statuses_, batch.descs_);
+    } catch (const std::exception& e) {
+        status = {StatusCode::UNKNOWN_ERROR, "Schema loader failed: " + std::string(e.what())};
+    } catch (...) {
+        status = {StatusCode::UNKNOWN_ERROR, "Schema loader failed with unknown exception"};
+    }
+
+    if (status.Code() == StatusCode::NOT_SUPPORTED) {
+        batch_supported_.store(false, std::memory_order_relaxed);
+    }
+    if (status.IsOk() && (batch.statuses_.size() != count || batch.descs_.size() != count)) {
+        status = {StatusCode::UNKNOWN_ERROR, "Batch schema loader returned an incomplete result"};
+    }
+    if (!status.IsOk()) {
+        batch.statuses_.assign(count, status);
+        batch.descs_.assign(count, nullptr);
+    }
+}
+
+}  // namespace milvus
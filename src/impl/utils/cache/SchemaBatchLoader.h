@@ -0,0 +1,95 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "milvus/Status.h"
+#include "milvus/types/CollectionDesc.h"
+
+namespace milvus {
+
+// Turns schema cache misses of one client that arrive close together into one BatchDescribeCollection call.
+// A miss while no describe call of this client is in flight is sent at once, alone, so a lone miss pays no
+// extra latency. Misses arriving while one is in flight are queued per database and sent together when it
+// returns, at most one window after the first of them, or as soon as the batch is full.
+class SchemaBatchLoader {
+ public:
+    static constexpr size_t default_max_batch = 256;
+    static constexpr std::chrono::milliseconds default_window{2};
+
+    using SingleLoader =
+        std::function<Status(const std::string& db_name, const std::string& collection_name, CollectionDescPtr& desc)>;
+    // Fills one status and one desc per name. A NOT_SUPPORTED result means the server has no batch call, the
+    // loader then describes collections one at a time from then on.
+    using BatchLoader = std::function<Status(const std::string& db_name, const std::vector<std::string>& names,
+                                             std::vector<Status>& statuses, std::vector<CollectionDescPtr>& descs)>;
+
+    SchemaBatchLoader(SingleLoader single_loader, BatchLoader batch_loader, size_t max_batch = default_max_batch,
+                      std::chrono::microseconds window = default_window);
+
+    Status
+    Load(const std::string& db_name, const std::string& collection_name, CollectionDescPtr& desc);
+
+    // Describe all the names now, max_batch names per call, without waiting for other misses.
+    void
+    LoadMany(const std::string& db_name, const std::vector<std::string>& names, std::vector<Status>& statuses,
+             std::vector<CollectionDescPtr>& descs);
+
+    bool
+    BatchSupported() const;
+
+ private:
+    struct Batch {
+        std::vector<std::string> names_;
+        std::unordered_map<std::string, size_t> positions_;
+        std::vector<Status> statuses_;
+        std::vector<CollectionDescPtr> descs_;
+        bool done_{false};
+
+        size_t
+        Add(const std::string& name);
+    };
+
+    using BatchPtr = std::shared_ptr<Batch>;
+
+    void
+    run(const std::string& db_name, Batch& batch);
+
+    const SingleLoader single_loader_;
+    const BatchLoader batch_loader_;
+    const size_t max_batch_;
+    const std::chrono::microseconds window_;
+    std::atomic<bool> batch_supported_{true};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    // batches still open for more names, by database name
+    std::unordered_map<std::string, BatchPtr> pending_;
+    size_t in_flight_{0};
+};
+
+}  // namespace milvus
@@ -19,9 +19,12 @@
 #include <algorithm>
 #include <exception>
 
+#include "./PersistentSchemaCache.h"
+
 namespace milvus {
 
 SchemaCache::SchemaCache(size_t capacity) : capacity_(capacity) {
+    hand_ = ring_.end();
 }
 
 SchemaCache&
@@ -131,6 +134,7 @@ SchemaCache::Set(const std::string& endpoint, const std::string& db_name, const
     const auto key = CollectionCacheKey::Create(endpoint, db_name, collection_name);
     invalidateLoad(key);
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_release);
     setCacheNoLocked(key, std::move(desc));
 }
 
@@ -138,18 +142,25 @@ void
 SchemaCache::Invalidate(const std::string& endpoint, const std::string& db_name, const std::string& collection_name) {
     const auto key = CollectionCacheKey::Create(endpoint, db_name, collection_name);
     invalidateLoad(key);
+    PersistentSchemaCache::InvalidateAll(key);
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    cache_.erase(key);
+    generation_.fetch_add(1, std::memory_order_release);
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+        eraseLocked(it);
+    }
 }
 
 void
 SchemaCache::InvalidateDb(const std::string& endpoint, const std::string& db_name) {
     const auto prefix = CollectionCacheKey::Create(endpoint, db_name, "");
     invalidateDbLoads(prefix);
+    PersistentSchemaCache::InvalidateDbAll(prefix);
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_release);
     for (auto it = cache_.begin(); it != cache_.end();) {
         if (it->first.endpoint_ == prefix.endpoint_ && it->first.db_name_ == prefix.db_name_) {
-            it = cache_.erase(it);
+            it = eraseLocked(it);
         } else {
             ++it;
         }
@@ -159,8 +170,13 @@ SchemaCache::InvalidateDb(const std::string& endpoint, const std::string& db_nam
 void
 SchemaCache::Clear() {
     invalidateAllLoads();
+    PersistentSchemaCache::ClearAll();
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    generation_.fetch_add(1, std::memory_order_release);
     cache_.clear();
+    ring_.clear();
+    hand_ = ring_.end();
+    snapshot_.Invalidate();
 }
 
 size_t
@@ -169,15 +185,32 @@ SchemaCache::Size() const {
     return cache_.size();
 }
 
+uint64_t
+SchemaCache::Generation() const {
+    return generation_.load(std::memory_order_acquire);
+}
+
 bool
 SchemaCache::getCached(const CollectionCacheKey& key, CollectionDescPtr& desc) {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto it = cache_.find(key);
-    if (it == cache_.end()) {
-        return false;
+    auto cached = snapshot_.Find(key);
+    if (cached != nullptr) {
+        touch(*cached);
+        desc = (*cached)->desc_;
+        return true;
+    }
+
+    EntryPtr entry;
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        auto it = cache_.find(key);
+        if (it == cache_.end()) {
+            return false;
+        }
+        entry = it->second;
     }
-    touch(it->second);
-    desc = it->second->desc_;
+    touch(entry);
+    desc = entry->desc_;
+    snapshot_.Keep(key, std::move(entry));
     return true;
 }
 
@@ -185,13 +218,19 @@ void
 SchemaCache::setCacheNoLocked(const CollectionCacheKey& key, CollectionDescPtr desc) {
     auto it = cache_.find(key);
     if (it != cache_.end()) {
-        it->second->desc_ = std::move(desc);
-        touch(it->second);
+        // readers may hold the old entry outside the lock, so it is replaced rather than modified
+        auto entry = std::make_shared<Entry>(std::move(desc), it->second->ring_pos_);
+        touch(entry);
+        it->second = std::move(entry);
+        snapshot_.Invalidate();
         return;
     }
 
-    cache_.emplace(key, std::make_shared<Entry>(std::move(desc), nextAccess()));
-    evictIfNeededLocked();
+    // just behind the hand, so a new entry is the last one the hand reaches
+    const auto pos = ring_.insert(hand_, key);
+    auto entry = std::make_shared<Entry>(std::move(desc), pos);
+    cache_.emplace(key, entry);
+    evictIfNeededLocked(entry);
 }
 
 void
@@ -230,32 +269,41 @@ SchemaCache::invalidateAllLoads() {
     loading_.clear();
 }
 
-uint64_t
-SchemaCache::nextAccess() {
-    return access_sequence_.fetch_add(1, std::memory_order_relaxed) + 1;
-}
-
 void
 SchemaCache::touch(const EntryPtr& entry) {
-    const auto access = nextAccess();
-    auto previous = entry->last_access_.load(std::memory_order_relaxed);
-    while (previous < access && !entry->last_access_.compare_exchange_weak(previous, access, std::memory_order_relaxed,
-                                                                           std::memory_order_relaxed)) {
+    // a set bit is left alone, so a hot entry costs no write until the hand clears it again
+    if (!entry->referenced_.load(std::memory_order_relaxed)) {
+        entry->referenced_.store(true, std::memory_order_relaxed);
     }
 }
 
-void
-SchemaCache::evictIfNeededLocked() {
-    if (cache_.size() <= capacity_) {
-        return;
+SchemaCache::EntryMap::iterator
+SchemaCache::eraseLocked(EntryMap::iterator it) {
+    const auto pos = it->second->ring_pos_;
+    if (hand_ == pos) {
+        hand_ = ring_.erase(pos);
+    } else {
+        ring_.erase(pos);
     }
+    auto next = cache_.erase(it);
+    snapshot_.Invalidate();
+    return next;
+}
 
-    const auto oldest = std::min_element(cache_.begin(), cache_.end(), [](const auto& left, const auto& right) {
-        return left.second->last_access_.load(std::memory_order_relaxed) <
-               right.second->last_access_.load(std::memory_order_relaxed);
-    });
-    if (oldest != cache_.end()) {
-        cache_.erase(oldest);
+void
+SchemaCache::evictIfNeededLocked(const EntryPtr& inserted) {
+    // CLOCK: an entry read since the hand last passed gets a second chance, the first one that was
+    // not is evicted. Every bit is clear after one lap, so this ends within two laps.
+    while (cache_.size() > capacity_ && cache_.size() > 1) {
+        if (hand_ == ring_.end()) {
+            hand_ = ring_.begin();
+        }
+        auto it = cache_.find(*hand_);
+        if (it->second == inserted || it->second->referenced_.exchange(false, std::memory_order_relaxed)) {
+            ++hand_;
+            continue;
+        }
+        eraseLocked(it);
     }
 }
 
@@ -19,6 +19,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -27,6 +28,7 @@
 #include <utility>
 
 #include "./CollectionCacheKey.h"
+#include "./ThreadSnapshot.h"
 #include "milvus/Status.h"
 #include "milvus/types/CollectionDesc.h"
 
@@ -57,6 +59,7 @@ class SchemaCache {
     Set(const std::string& endpoint, const std::string& db_name, const std::string& collection_name,
         CollectionDescPtr desc);
 
+    // Invalidation also drops the schemas from every open persistent schema file, see PersistentSchemaCache.
     void
     Invalidate(const std::string& endpoint, const std::string& db_name, const std::string& collection_name);
 
@@ -69,13 +72,24 @@ class SchemaCache {
     size_t
     Size() const;
 
+    // Bumped whenever a schema is replaced or invalidated explicitly, so that caches derived from
+    // schemas (e.g. the result cache) can detect DDL changes without tracking each collection.
+    uint64_t
+    Generation() const;
+
  private:
+    // An entry is never modified once published: a refreshed schema is a new entry, so a reader
+    // holding an EntryPtr outside the lock always sees a complete desc.
     struct Entry {
-        Entry(CollectionDescPtr desc, uint64_t last_access) : desc_(std::move(desc)), last_access_(last_access) {
+        Entry(CollectionDescPtr desc, std::list<CollectionCacheKey>::iterator ring_pos)
+            : desc_(std::move(desc)), ring_pos_(ring_pos) {
         }
 
-        CollectionDescPtr desc_;
-        std::atomic<uint64_t> last_access_;
+        const CollectionDescPtr desc_;
+        // CLOCK reference bit, only written when it is clear, so hot entries are not written per read
+        std::atomic<bool> referenced_{false};
+        // position in ring_, guarded by mutex_
+        std::list<CollectionCacheKey>::iterator ring_pos_;
     };
 
     struct LoadState {
@@ -124,19 +138,26 @@ class SchemaCache {
     void
     invalidateAllLoads();
 
-    uint64_t
-    nextAccess();
+    using EntryMap = std::unordered_map<CollectionCacheKey, EntryPtr, CollectionCacheKeyHash>;
 
-    void
+    static void
     touch(const EntryPtr& entry);
 
+    EntryMap::iterator
+    eraseLocked(EntryMap::iterator it);
+
     void
-    evictIfNeededLocked();
+    evictIfNeededLocked(const EntryPtr& inserted);
 
     size_t capacity_;
     mutable std::shared_timed_mutex mutex_;
-    std::atomic<uint64_t> access_sequence_{0};
-    std::unordered_map<CollectionCacheKey, EntryPtr, CollectionCacheKeyHash> cache_;
+    std::atomic<uint64_t> generation_{0};
+    // Invalidated whenever an entry is removed or replaced, including by eviction.
+    ThreadSnapshot<EntryPtr> snapshot_;
+    EntryMap cache_;
+    // CLOCK eviction order, the hand sweeps it clearing reference bits until it finds a clear one
+    std::list<CollectionCacheKey> ring_;
+    std::list<CollectionCacheKey>::iterator hand_;
 
     std::mutex loading_mutex_;
     std::unordered_map<LoadKey, LoadStatePtr, LoadKeyHash> loading_;
@@ -0,0 +1,131 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "./CollectionCacheKey.h"
+
+namespace milvus {
+
+uint64_t
+NextThreadSnapshotId();
+
+// Per-thread copies of the shared entries of one cache. A thread finding an entry it has read before takes no lock
+// and writes no cache line other threads read. The cache calls Invalidate() whenever an entry is removed or replaced,
+// each thread then drops its copies on its next lookup. Adding an entry needs no invalidation.
+//
+// Find() reads the epoch before the caller reads the shared map, and Keep() files the entry under that epoch, so an
+// entry removed concurrently is at worst used once more by the lookup that raced with the removal.
+template <typename Value>
+class ThreadSnapshot {
+ public:
+    // copies one thread holds of one cache, a thread reading more entries than this replaces them one at a time
+    static constexpr size_t kCapacity = 1024;
+
+    ThreadSnapshot() : instance_id_(NextThreadSnapshotId()) {
+    }
+
+    ThreadSnapshot(const ThreadSnapshot&) = delete;
+    ThreadSnapshot&
+    operator=(const ThreadSnapshot&) = delete;
+
+    // The copy the calling thread holds, nullptr if it has none at the current epoch.
+    Value*
+    Find(const CollectionCacheKey& key) {
+        auto& local = localCopies();
+        const auto epoch = epoch_.load(std::memory_order_acquire);
+        if (local.instance_id_ == instance_id_ && local.epoch_ == epoch) {
+            auto it = local.index_.find(key);
+            if (it == local.index_.end()) {
+                return nullptr;
+            }
+            auto& copy = local.copies_[it->second];
+            copy.referenced_ = true;
+            return &copy.value_;
+        }
+        local.copies_.clear();
+        local.index_.clear();
+        local.hand_ = 0;
+        local.instance_id_ = instance_id_;
+        local.epoch_ = epoch;
+        return nullptr;
+    }
+
+    // Keep a value read from the shared map after Find() missed it. When the thread already holds kCapacity copies
+    // the CLOCK hand picks one not found since it last passed, and only that copy is replaced.
+    Value&
+    Keep(const CollectionCacheKey& key, Value value) {
+        auto& local = localCopies();
+        auto& copies = local.copies_;
+        if (copies.size() < kCapacity) {
+            local.index_.emplace(key, copies.size());
+            copies.push_back(Copy{key, std::move(value), false});
+            return copies.back().value_;
+        }
+
+        while (copies[local.hand_].referenced_) {
+            copies[local.hand_].referenced_ = false;
+            local.hand_ = (local.hand_ + 1) % copies.size();
+        }
+        const auto victim = local.hand_;
+        local.hand_ = (local.hand_ + 1) % copies.size();
+        local.index_.erase(copies[victim].key_);
+        local.index_.emplace(key, victim);
+        copies[victim] = Copy{key, std::move(value), false};
+        return copies[victim].value_;
+    }
+
+    void
+    Invalidate() {
+        epoch_.fetch_add(1, std::memory_order_release);
+    }
+
+ private:
+    struct Copy {
+        CollectionCacheKey key_;
+        Value value_;
+        // CLOCK reference bit, set by Find() and cleared as the hand passes
+        bool referenced_{false};
+    };
+
+    // the copies of one thread, for the cache it looked up last
+    struct LocalCopies {
+        uint64_t instance_id_{0};
+        uint64_t epoch_{0};
+        std::vector<Copy> copies_;
+        std::unordered_map<CollectionCacheKey, size_t, CollectionCacheKeyHash> index_;
+        size_t hand_{0};
+    };
+
+    static LocalCopies&
+    localCopies() {
+        static thread_local LocalCopies local;
+        return local;
+    }
+
+    // tells the copies of different caches apart, an address can be reused
+    const uint64_t instance_id_;
+    std::atomic<uint64_t> epoch_{0};
+};
+
+}  // namespace milvus
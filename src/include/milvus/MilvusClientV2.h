@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <future>
 
 #include "MilvusClientV2Session.h"
 #include "Status.h"
@@ -66,10 +67,14 @@
 #include "request/dml/DeleteRequest.h"
 #include "request/dml/InsertRequest.h"
 #include "request/dml/UpsertRequest.h"
+#include "request/dql/FederatedSearchRequest.h"
 #include "request/dql/GetRequest.h"
 #include "request/dql/HybridSearchRequest.h"
+#include "request/dql/MultiSearchRequest.h"
+#include "request/dql/ParallelScanRequest.h"
 #include "request/dql/QueryIteratorRequest.h"
 #include "request/dql/QueryRequest.h"
+#include "request/dql/QueryStreamRequest.h"
 #include "request/dql/SearchIteratorRequest.h"
 #include "request/dql/SearchRequest.h"
 #include "request/index/AlterIndexPropertiesRequest.h"
@@ -143,6 +148,7 @@
 #include "response/database/DescribeDatabaseResponse.h"
 #include "response/database/ListDatabasesResponse.h"
 #include "response/dml/DmlResponse.h"
+#include "response/dql/MultiSearchResponse.h"
 #include "response/dql/QueryResponse.h"
 #include "response/dql/SearchResponse.h"
 #include "response/index/DescribeIndexResponse.h"
@@ -176,12 +182,20 @@
 #include "response/utility/OptimizeResponse.h"
 #include "response/utility/RefreshExternalCollectionResponse.h"
 #include "response/utility/RunAnalyzerResponse.h"
+#include "types/AllocationStats.h"
 #include "types/ConnectParam.h"
 #include "types/Constants.h"
+#include "types/Executor.h"
+#include "types/ExecutorStats.h"
 #include "types/Iterator.h"
+#include "types/MetadataCacheParam.h"
+#include "types/MetadataCacheStats.h"
 #include "types/OptimizeTask.h"
+#include "types/ResultCacheParam.h"
+#include "types/ResultCacheStats.h"
 #include "types/RetryParam.h"
 #include "types/RoaringBitmap.h"
+#include "types/Tracer.h"
 
 /**
  *  @brief namespace milvus
@@ -204,6 +218,11 @@ namespace milvus {
  */
 class MILVUS_SDK_API MilvusClientV2 {
  public:
+    /**
+     * @brief Receives the final status of a call made by one of the asynchronous DML and DQL methods.
+     */
+    using AsyncDone = std::function<void(const Status&)>;
+
     virtual ~MilvusClientV2() = default;
 
     /**
@@ -214,6 +233,16 @@ class MILVUS_SDK_API MilvusClientV2 {
     static std::shared_ptr<MilvusClientV2>
     Create();
 
+    /**
+     * @brief Create a MilvusClientV2 instance whose background work runs on the given executor instead of
+     * Executor::Default().
+     *
+     * @param [in] executor the executor shared with other clients or owned by this one, nullptr means the default
+     * @return std::shared_ptr<MilvusClientV2>
+     */
+    static std::shared_ptr<MilvusClientV2>
+    Create(ExecutorPtr executor);
+
     /**
      * @brief Connect to Milvus server.
      *
@@ -246,6 +275,94 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     SetRetryParam(const RetryParam& retry_param) = 0;
 
+    /**
+     * @brief Register a tracer for the RPC calls of this client, a nullptr tracer removes it. Each call starts a
+     * span once its request is built, the headers injected by the span are sent with every attempt of the call.
+     * Without a tracer the calls are not traced.
+     *
+     *  @param [in] tracer the tracer, it is called from all threads using this client
+     */
+    virtual Status
+    SetTracer(const TracerPtr& tracer) = 0;
+
+    /**
+     * @brief Configure the client-side search/query result cache, the cache is disabled by default.
+     * Changing the parameters keeps the cached results that still fit in the new memory budget.
+     *
+     *  @param [in] param memory budget and time-to-live of the cache
+     */
+    virtual Status
+    SetResultCacheParam(const ResultCacheParam& param) = 0;
+
+    /**
+     * @brief Get hit/miss counters and memory usage of the client-side search/query result cache.
+     *
+     * @param [out] stats statistics of the cache
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetResultCacheStats(ResultCacheStats& stats) = 0;
+
+    /**
+     * @brief Configure the client-side cache of DescribeIndex(), ListIndexes(), ListPartitions() and GetLoadState(),
+     * the cache is disabled by default. See MetadataCacheParam for when cached entries are dropped.
+     *
+     * @param [in] param time-to-live and max number of entries of the cache
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    SetMetadataCacheParam(const MetadataCacheParam& param) = 0;
+
+    /**
+     * @brief Get hit/miss counters and the number of entries of the client-side metadata cache.
+     *
+     * @param [out] stats statistics of the cache
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetMetadataCacheStats(MetadataCacheStats& stats) = 0;
+
+    /**
+     * @brief Get the queue depth, task counters and latencies of the executor running the background work of this
+     * client. The executor may be shared, the statistics then cover the other clients as well.
+     *
+     * @param [out] stats statistics of the executor
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetExecutorStats(ExecutorStats& stats) = 0;
+
+    /**
+     * @brief Set the allocation counter of the SDK, it is shared by all the clients. Each API call then reads the
+     * counter before and after it runs and the difference is added to the statistics of the API, so the memory
+     * budget of a request can be checked with GetAllocationStats(). The tracking is off by default, an empty counter
+     * turns it off again. Setting a counter clears the statistics.
+     *
+     * @param [in] counter returns the bytes the calling thread has allocated so far
+     */
+    static void
+    SetAllocationCounter(AllocationCounter counter);
+
+    /**
+     * @brief Get the bytes allocated per API call since the allocation counter was set. The statistics cover all the
+     * clients of the process.
+     *
+     * @param [out] stats statistics of each API
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetAllocationStats(AllocationStats& stats) = 0;
+
+    /**
+     * @brief Get the executor running the background work of this client, the one given to Create() or
+     * Executor::Default().
+     *
+     * @param [out] executor the executor of this client
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetExecutor(ExecutorPtr& executor) = 0;
+
     /**
      * @brief Get the Milvus server version.
      *
@@ -332,6 +449,20 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     LoadCollection(const LoadCollectionRequest& request) = 0;
 
+    /**
+     * @brief Load a collection and wait for it in the background. The load request is sent before this returns,
+     * the loading progress is then polled by one thread shared by all clients, instead of the calling thread.
+     * The polling starts every few milliseconds and backs off to 500 milliseconds. The Sync() flag of the request
+     * is ignored, the TimeoutMs() of the request limits the wait.
+     *
+     * @param [in] request input parameters
+     * @param [out] done ready when the collection is loaded, the loading failed or timed out, valid only if the
+     * returned status is ok. A Disconnect() before that makes it ready with NOT_CONNECTED.
+     * @return Status the load request is accepted or not
+     */
+    virtual Status
+    LoadCollectionAsync(const LoadCollectionRequest& request, std::future<Status>& done) = 0;
+
     /**
      * @brief Refresh loaded collection data in query node.
      * This API loads newly generated segments without changing the collection load options.
@@ -373,6 +504,20 @@ class MILVUS_SDK_API MilvusClientV2 {
     BatchDescribeCollections(const BatchDescribeCollectionsRequest& request,
                              BatchDescribeCollectionsResponse& response) = 0;
 
+    /**
+     * @brief Load schemas of collections into the SDK schema cache, so that the first insert, upsert, search or
+     * query of each collection does not need its own DescribeCollection() call. Collections not cached yet are
+     * described by BatchDescribeCollection() calls, or one by one if the server does not support it.
+     * Note: schema cache misses of concurrent calls are also batched without calling this method, this method
+     * is for warming the cache before the workload starts, e.g. after startup or failover.
+     *
+     * @param [in] db_name database of the collections, empty means the current database
+     * @param [in] collection_names names of the collections
+     * @return Status the first failure if any collection could not be described, the others are still cached
+     */
+    virtual Status
+    PrefetchSchemas(const std::string& db_name, const std::vector<std::string>& collection_names) = 0;
+
     /**
      * @brief Describe replicas of a collection.
      *
@@ -575,6 +720,17 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     LoadPartitions(const LoadPartitionsRequest& request) = 0;
 
+    /**
+     * @brief Load partitions and wait for them in the background, see LoadCollectionAsync().
+     *
+     * @param [in] request input parameters
+     * @param [out] done ready when the partitions are loaded, the loading failed or timed out, valid only if the
+     * returned status is ok
+     * @return Status the load request is accepted or not
+     */
+    virtual Status
+    LoadPartitionsAsync(const LoadPartitionsRequest& request, std::future<Status>& done) = 0;
+
     /**
      * @brief Release specific partitions of a collection from query nodes.
      *
@@ -741,6 +897,18 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     CreateIndex(const CreateIndexRequest& request) = 0;
 
+    /**
+     * @brief Create indexes and wait for them to be built in the background, see LoadCollectionAsync().
+     * Unlike CreateIndex(), the TimeoutMs() of the request limits the wait for all the indexes together.
+     *
+     * @param [in] request input parameters
+     * @param [out] done ready when all the indexes are built, one failed or the wait timed out, valid only if
+     * the returned status is ok
+     * @return Status the create index requests are accepted or not
+     */
+    virtual Status
+    CreateIndexAsync(const CreateIndexRequest& request, std::future<Status>& done) = 0;
+
     /**
      * @brief Get index descriptions and parameters.
      *
@@ -799,6 +967,21 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Insert(const InsertRequest& request, InsertResponse& response) = 0;
 
+    /**
+     * @brief Insert data without blocking, see Insert(). The request is validated and converted on the calling thread,
+     * then sent without waiting for the reply. done is called once with the final status, from the thread that
+     * received the reply, the client, request and response must outlive it. A call retried by the RetryParam
+     * continues on the executor of the client. With ConnectParam::CallTimingEnabled() the timing of the call, see
+     * CallTiming, is set on the response before done is called. A call answered without an rpc has no timing.
+     *
+     * @param [in] request input parameters
+     * @param [out] response output results, filled before done is called
+     * @param [in] done called with the final status unless this returns an error
+     * @return Status error if the call could not be sent, done is then not called
+     */
+    virtual Status
+    InsertAsync(const InsertRequest& request, InsertResponse& response, AsyncDone done) = 0;
+
     /**
      * @brief Upsert entities of a collection.You can input column-based data or row-based data.
      *
@@ -809,6 +992,12 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Upsert(const UpsertRequest& request, UpsertResponse& response) = 0;
 
+    /**
+     * @brief Upsert entities without blocking, see Upsert() and InsertAsync().
+     */
+    virtual Status
+    UpsertAsync(const UpsertRequest& request, UpsertResponse& response, AsyncDone done) = 0;
+
     /**
      * @brief Delete entities by filtering expression or ID array.
      *
@@ -819,6 +1008,12 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Delete(const DeleteRequest& request, DeleteResponse& response) = 0;
 
+    /**
+     * @brief Delete entities without blocking, see Delete() and InsertAsync().
+     */
+    virtual Status
+    DeleteAsync(const DeleteRequest& request, DeleteResponse& response, AsyncDone done) = 0;
+
     /**
      * @brief Search a collection based on the given parameters and return results.
      *
@@ -829,6 +1024,39 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Search(const SearchRequest& request, SearchResponse& response) = 0;
 
+    /**
+     * @brief Search a collection without blocking, see Search() and InsertAsync().
+     */
+    virtual Status
+    SearchAsync(const SearchRequest& request, SearchResponse& response, AsyncDone done) = 0;
+
+    /**
+     * @brief Run a batch of independent searches, up to MultiSearchRequest::Concurrency() at the same time.
+     * The calling thread runs searches too, the others run on the executor of this client, never more of them
+     * than it has workers. Schema lookups needed by concurrent searches of the same collection are shared through
+     * the schema cache.
+     *
+     * @param [in] request the searches, concurrency, stop-on-error and deadline
+     * @param [out] response the status and response of each search, in the order of the requests
+     * @return Status OK if every search succeeded, otherwise the status of the first failed search
+     */
+    virtual Status
+    MultiSearch(const MultiSearchRequest& request, MultiSearchResponse& response) = 0;
+
+    /**
+     * @brief Search several collections or aliases with the same search and merge their results into one global
+     * top-k of each query, ranked by score in the direction of the metric. The hits of the collections are merged
+     * with a k-way heap and only the output fields of the merged hits are decoded. The collections are searched
+     * like the searches of MultiSearch(), by the calling thread and the executor of this client.
+     * Highlights, element offsets and recalls are not merged.
+     *
+     * @param [in] request the search, the collections and how many of them are searched at the same time
+     * @param [out] response the merged results
+     * @return Status operation successfully or not, the first failure of a collection fails the whole search
+     */
+    virtual Status
+    FederatedSearch(const FederatedSearchRequest& request, SearchResponse& response) = 0;
+
     /**
      * @brief Get SearchIterator object based on scalar field(s) by filtering expression.
      * Don't disconnect the MilvusClientV2 when the iterator is in using.
@@ -854,6 +1082,12 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     HybridSearch(const HybridSearchRequest& request, HybridSearchResponse& response) = 0;
 
+    /**
+     * @brief Hybrid search a collection without blocking, see HybridSearch() and InsertAsync().
+     */
+    virtual Status
+    HybridSearchAsync(const HybridSearchRequest& request, HybridSearchResponse& response, AsyncDone done) = 0;
+
     /**
      * @brief Query with a set of criteria, and results in a list of records that match the query exactly.
      *
@@ -864,6 +1098,12 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Query(const QueryRequest& request, QueryResponse& response) = 0;
 
+    /**
+     * @brief Query a collection without blocking, see Query() and InsertAsync().
+     */
+    virtual Status
+    QueryAsync(const QueryRequest& request, QueryResponse& response, AsyncDone done) = 0;
+
     /**
      * @brief Query with primary keys, and results in a list of records.
      *
@@ -874,6 +1114,12 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Get(const GetRequest& request, GetResponse& response) = 0;
 
+    /**
+     * @brief Get entities by primary keys without blocking, see Get() and InsertAsync().
+     */
+    virtual Status
+    GetAsync(const GetRequest& request, GetResponse& response, AsyncDone done) = 0;
+
     /**
      * @brief Get QueryIterator object based on scalar field(s) by filtering expression.
      * Don't disconnect the MilvusClientV2 when the iterator is in using.
@@ -887,6 +1133,32 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     QueryIterator(QueryIteratorRequest& request, QueryIteratorPtr& response) = 0;
 
+    /**
+     * @brief Query by filtering expression and deliver the rows to a callback batch by batch, so that large
+     * result sets can be processed with bounded memory. All batches read the same snapshot, the snapshot is
+     * selected by the first page according to the consistency level. The call returns when all rows are
+     * delivered or the callback returns an error.
+     *
+     * @param [in] request input parameters, see QueryStreamRequest for batch size and prefetch
+     * @param [in] on_batch callback to receive batches, called in the calling thread
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    QueryStream(const QueryStreamRequest& request, const QueryStreamCallback& on_batch) = 0;
+
+    /**
+     * @brief Scan a collection with several query iterators in parallel, each iterator reads a disjoint shard.
+     * All shards read the same snapshot, the snapshot is selected by the first shard according to the
+     * consistency level. The call returns when all shards are drained or the callback returns an error.
+     * Don't disconnect the MilvusClientV2 when the scan is in progress.
+     *
+     * @param [in] request input parameters, see ParallelScanRequest for how the collection is split
+     * @param [in] on_batch callback to receive batches, called concurrently by shard workers
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    ParallelScan(const ParallelScanRequest& request, const ParallelScanCallback& on_batch) = 0;
+
     /**
      * @brief Run analyzer. Return result tokens of analysis.
      * Milvus server supports this interface from v2.5.11.
@@ -913,6 +1185,18 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Flush(const FlushRequest& request) = 0;
 
+    /**
+     * @brief Flush insert buffer data into storage and wait for the segments to be persisted in the background,
+     * see LoadCollectionAsync(). The WaitFlushedMs() of the request limits the wait, zero means no limit.
+     *
+     * @param [in] request input parameters
+     * @param [out] done ready when the flushed segments are persisted or the wait timed out, valid only if the
+     * returned status is ok
+     * @return Status the flush request is accepted or not
+     */
+    virtual Status
+    FlushAsync(const FlushRequest& request, std::future<Status>& done) = 0;
+
     /**
      * @brief Flush all insert buffer data into storage.
      * It will check flush-all state in a loop to make sure the data persisted successfully.
@@ -1028,9 +1312,25 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     Compact(const CompactRequest& request, CompactResponse& response) = 0;
 
+    /**
+     * @brief Compact a collection and wait for the compaction to complete in the background, see
+     * LoadCollectionAsync(). The wait has no time limit.
+     *
+     * @param [in] request input parameters
+     * @param [out] response the compaction id, set before this returns
+     * @param [out] done ready when the compaction is completed or a plan failed, valid only if the returned
+     * status is ok
+     * @return Status the compact request is accepted or not
+     */
+    virtual Status
+    CompactAsync(const CompactRequest& request, CompactResponse& response, std::future<Status>& done) = 0;
+
     /**
      * @brief Optimize collection segments with a Java-style task object.
      *
+     * An asynchronous optimization is driven by the status polls all clients share, so it holds no thread while it
+     * waits for the server. Disconnect() fails it with NOT_CONNECTED.
+     *
      * @param [in] request input parameters
      * @param [out] task optimization task
      * @return Status operation successfully or not
@@ -1106,6 +1406,19 @@ class MILVUS_SDK_API MilvusClientV2 {
     virtual Status
     RestoreSnapshot(const RestoreSnapshotRequest& request, RestoreSnapshotResponse& response) = 0;
 
+    /**
+     * @brief Restore a snapshot and wait for the restore job in the background, see LoadCollectionAsync().
+     * The wait has no time limit.
+     *
+     * @param [in] request input parameters
+     * @param [out] response the restore job id, set before this returns
+     * @param [out] done ready when the restore job is completed or failed, valid only if the returned status is ok
+     * @return Status the restore request is accepted or not
+     */
+    virtual Status
+    RestoreSnapshotAsync(const RestoreSnapshotRequest& request, RestoreSnapshotResponse& response,
+                         std::future<Status>& done) = 0;
+
     /**
      * @brief Get restore snapshot job state.
      *
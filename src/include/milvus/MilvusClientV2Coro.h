@@ -0,0 +1,282 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Awaitable versions of the blocking MilvusClientV2 calls, for applications built with C++20 coroutines. The calls
+// of one rpc are sent with the asynchronous methods of the client, so any number of them can be awaited at once.
+// The header is empty unless the compiler supports coroutines, the C++14 API is not affected.
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define MILVUS_SDK_HAS_COROUTINES 1
+#endif
+#endif
+
+#ifdef MILVUS_SDK_HAS_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "MilvusClientV2.h"
+
+namespace milvus {
+
+/**
+ * @brief namespace of the coroutine API
+ */
+namespace coro {
+
+/**
+ * @brief Awaitable of an asynchronous MilvusClientV2 call, such as SearchAsync(). The awaiting coroutine is
+ * suspended without holding a thread, co_await yields the Status of the call. If the call could not be sent, the
+ * coroutine is not suspended and co_await yields the error.
+ *
+ * The coroutine resumes on the gRPC callback thread that received the reply, or on an executor worker if the call
+ * was retried, and runs there until its next suspension. A blocking call made after the co_await, such as a
+ * synchronous client method, blocks that gRPC completion thread and delays the replies of every other call. Move
+ * blocking follow-up work to an executor with co_await Await(client, ...), see StatusAwaitable.
+ */
+class CallbackAwaitable {
+ public:
+    using Send = std::function<Status(MilvusClientV2::AsyncDone)>;
+
+    explicit CallbackAwaitable(Send send) : send_(std::move(send)) {
+    }
+
+    bool
+    await_ready() const noexcept {
+        return false;
+    }
+
+    bool
+    await_suspend(std::coroutine_handle<> handle) {
+        // done may resume the coroutine, and destroy this awaitable, before send returns
+        auto send = std::move(send_);
+        auto* status = &status_;
+        Status sent;
+        try {
+            sent = send([status, handle](const Status& result) {
+                *status = result;
+                handle.resume();
+            });
+        } catch (const std::exception& e) {
+            sent = Status{StatusCode::UNKNOWN_ERROR, "Coroutine call failed: " + std::string(e.what())};
+        } catch (...) {
+            sent = Status{StatusCode::UNKNOWN_ERROR, "Coroutine call failed with unknown exception"};
+        }
+        if (!sent.IsOk()) {
+            status_ = std::move(sent);
+            return false;
+        }
+        return true;
+    }
+
+    Status
+    await_resume() {
+        return std::move(status_);
+    }
+
+ private:
+    Send send_;
+    Status status_;
+};
+
+/**
+ * @brief Awaitable running a blocking call on an Executor worker, for the calls made of several rpcs. The awaiting
+ * coroutine is suspended and resumed on the worker that ran the call, co_await yields the Status of the call.
+ * If the executor rejects the call, the coroutine is not suspended and co_await yields the rejection.
+ */
+class StatusAwaitable {
+ public:
+    using Call = std::function<Status()>;
+
+    /**
+     * @brief Constructor, a null executor runs the call inline on the awaiting thread.
+     */
+    StatusAwaitable(ExecutorPtr executor, Call call) : executor_(std::move(executor)), call_(std::move(call)) {
+    }
+
+    bool
+    await_ready() const noexcept {
+        return false;
+    }
+
+    bool
+    await_suspend(std::coroutine_handle<> handle) {
+        if (!executor_) {
+            status_ = invoke();
+            return false;
+        }
+        // the coroutine may be resumed, and this awaitable destroyed, before Submit() returns
+        auto executor = executor_;
+        auto status = executor->Submit([this, handle]() {
+            status_ = invoke();
+            handle.resume();
+        });
+        if (!status.IsOk()) {
+            status_ = std::move(status);
+            return false;
+        }
+        return true;
+    }
+
+    Status
+    await_resume() {
+        return std::move(status_);
+    }
+
+ private:
+    // an exception must not leave the coroutine suspended forever
+    Status
+    invoke() {
+        try {
+            return call_();
+        } catch (const std::exception& e) {
+            return {StatusCode::UNKNOWN_ERROR, "Coroutine call failed: " + std::string(e.what())};
+        } catch (...) {
+            return {StatusCode::UNKNOWN_ERROR, "Coroutine call failed with unknown exception"};
+        }
+    }
+
+    ExecutorPtr executor_;
+    Call call_;
+    Status status_;
+};
+
+/**
+ * @brief Run a call on the executor of a client, see MilvusClientV2::GetExecutor().
+ * The request and response must outlive the co_await, the client is kept alive by the awaitable.
+ */
+inline StatusAwaitable
+Await(const MilvusClientV2Ptr& client, StatusAwaitable::Call call) {
+    ExecutorPtr executor;
+    if (client) {
+        client->GetExecutor(executor);
+    }
+    return StatusAwaitable{std::move(executor), std::move(call)};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::Search(), sent with SearchAsync().
+ * The request and response must outlive the co_await, the client is kept alive by the awaitable.
+ */
+inline CallbackAwaitable
+Search(const MilvusClientV2Ptr& client, const SearchRequest& request, SearchResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->SearchAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::MultiSearch(), the worker running the call searches too, along with up to
+ * Concurrency() - 1 other workers of the executor.
+ */
+inline StatusAwaitable
+MultiSearch(const MilvusClientV2Ptr& client, const MultiSearchRequest& request, MultiSearchResponse& response) {
+    return Await(client, [client, &request, &response]() { return client->MultiSearch(request, response); });
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::FederatedSearch(), the worker running the call searches too, along with up to
+ * Concurrency() - 1 other workers of the executor.
+ */
+inline StatusAwaitable
+FederatedSearch(const MilvusClientV2Ptr& client, const FederatedSearchRequest& request, SearchResponse& response) {
+    return Await(client, [client, &request, &response]() { return client->FederatedSearch(request, response); });
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::HybridSearch(), sent with HybridSearchAsync().
+ */
+inline CallbackAwaitable
+HybridSearch(const MilvusClientV2Ptr& client, const HybridSearchRequest& request, HybridSearchResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->HybridSearchAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::Query(), sent with QueryAsync().
+ */
+inline CallbackAwaitable
+Query(const MilvusClientV2Ptr& client, const QueryRequest& request, QueryResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->QueryAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::Get(), sent with GetAsync().
+ */
+inline CallbackAwaitable
+Get(const MilvusClientV2Ptr& client, const GetRequest& request, GetResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->GetAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::Insert(), sent with InsertAsync().
+ */
+inline CallbackAwaitable
+Insert(const MilvusClientV2Ptr& client, const InsertRequest& request, InsertResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->InsertAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::Upsert(), sent with UpsertAsync().
+ */
+inline CallbackAwaitable
+Upsert(const MilvusClientV2Ptr& client, const UpsertRequest& request, UpsertResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->UpsertAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable MilvusClientV2::Delete(), sent with DeleteAsync().
+ */
+inline CallbackAwaitable
+Delete(const MilvusClientV2Ptr& client, const DeleteRequest& request, DeleteResponse& response) {
+    return CallbackAwaitable{[client, &request, &response](MilvusClientV2::AsyncDone done) {
+        return client->DeleteAsync(request, response, std::move(done));
+    }};
+}
+
+/**
+ * @brief Awaitable Iterator::Next(). An iterator is not thread-safe, do not await Next() of the same iterator
+ * twice at the same time.
+ *
+ * @param [in] executor the executor to run Next() on, usually the one of the client that created the iterator
+ */
+template <typename T>
+StatusAwaitable
+Next(const std::shared_ptr<Iterator<T>>& iterator, T& results, ExecutorPtr executor = Executor::Default()) {
+    return StatusAwaitable{std::move(executor), [iterator, &results]() { return iterator->Next(results); }};
+}
+
+}  // namespace coro
+
+}  // namespace milvus
+
+#endif  // MILVUS_SDK_HAS_COROUTINES
@@ -19,7 +19,9 @@
 #include <milvus/thirdparty/nlohmann/json.hpp>
 #include <unordered_map>
 
+#include "../../types/FilterTemplateArray.h"
 #include "../../types/IDArray.h"
+#include "../../types/IDsEncoding.h"
 #include "./DMLRequestBase.h"
 #include "milvus/Export.h"
 
@@ -72,12 +74,28 @@ class MILVUS_SDK_API DeleteRequest : public DMLRequestBase<DeleteRequest> {
      * A binary value (nlohmann::json::binary) is a client-built membership blob -- see
      * RoaringBitmapBuilder::BuildTemplate() for roaring_match, which is exact and therefore
      * permitted in a delete expression.
+     * The template replaces any json or typed template with the same key.
      */
     DeleteRequest&
     AddFilterTemplate(std::string key, nlohmann::json&& filter_template);
 
     /**
-     * @brief Set filter templates. Only take effect when filter is not empty.
+     * @brief Add a typed array filter template. Only take effect when filter is not empty.
+     * The values are encoded into the rpc request in bulk without building json nodes, prefer this
+     * overload for long lists. The template replaces any json or typed template with the same key.
+     */
+    DeleteRequest&
+    AddFilterTemplate(std::string key, FilterTemplateArray filter_template);
+
+    /**
+     * @brief Get typed array filter templates.
+     */
+    const std::unordered_map<std::string, FilterTemplateArray>&
+    TypedFilterTemplates() const;
+
+    /**
+     * @brief Set filter templates, typed array filter templates are cleared. Only take effect when filter is
+     * not empty.
      */
     void
     SetFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates);
@@ -118,10 +136,38 @@ class MILVUS_SDK_API DeleteRequest : public DMLRequestBase<DeleteRequest> {
     DeleteRequest&
     WithIDs(std::vector<std::string>&& id_array);
 
+    /**
+     * @brief Get the encoding of the id array, default is IDsEncoding::LIST.
+     */
+    IDsEncoding
+    GetIDsEncoding() const;
+
+    /**
+     * @brief Set the encoding of the id array.
+     * IDsEncoding::BLOOM_PREFILTER is not exact and is refused by Delete().
+     */
+    void
+    SetIDsEncoding(IDsEncoding encoding);
+
+    /**
+     * @brief Set the encoding of the id array.
+     * IDsEncoding::BLOOM_PREFILTER is not exact and is refused by Delete().
+     */
+    DeleteRequest&
+    WithIDsEncoding(IDsEncoding encoding);
+
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     std::string filter_;
     std::unordered_map<std::string, nlohmann::json> filter_templates_;
+    std::unordered_map<std::string, FilterTemplateArray> typed_filter_templates_;
     IDArray ids_;
+    IDsEncoding ids_encoding_{IDsEncoding::LIST};
 };
 
 }  // namespace milvus
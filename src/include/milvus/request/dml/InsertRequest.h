@@ -89,6 +89,12 @@ class MILVUS_SDK_API InsertRequest : public DMLRequestBase<InsertRequest> {
     InsertRequest&
     AddRowData(EntityRow&& row_data);
 
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     std::vector<FieldDataPtr> columns_data_;
     EntityRows rows_data_;
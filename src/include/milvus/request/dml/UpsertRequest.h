@@ -130,6 +130,12 @@ class MILVUS_SDK_API UpsertRequest : public InsertRequest {
     UpsertRequest&
     AddFieldOp(FieldPartialUpdateOp field_op);
 
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     bool partial_update_{false};
     std::vector<FieldPartialUpdateOp> field_ops_;
@@ -0,0 +1,109 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "./SearchRequest.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Used by MilvusClientV2::FederatedSearch()
+ *
+ * The search is sent to each collection of CollectionNames(), the collections are expected to have identical
+ * schemas, aliases are accepted. The collection name of the search request is ignored, its limit and offset
+ * apply to the merged results: each collection returns offset + limit hits and the merge skips the first offset.
+ * Scores of different collections are compared as they are, so they must come from the same metric.
+ */
+class MILVUS_SDK_API FederatedSearchRequest {
+ public:
+    /**
+     * @brief Constructor
+     */
+    FederatedSearchRequest() = default;
+
+    /**
+     * @brief Get the search sent to every collection.
+     */
+    const SearchRequest&
+    Request() const;
+
+    /**
+     * @brief Set the search sent to every collection. Search aggregation is not supported.
+     */
+    void
+    SetRequest(SearchRequest request);
+
+    /**
+     * @brief Set the search sent to every collection. Search aggregation is not supported.
+     */
+    FederatedSearchRequest&
+    WithRequest(SearchRequest request);
+
+    /**
+     * @brief Get the names or aliases of the collections.
+     */
+    const std::vector<std::string>&
+    CollectionNames() const;
+
+    /**
+     * @brief Set the names or aliases of the collections.
+     */
+    void
+    SetCollectionNames(std::vector<std::string>&& collection_names);
+
+    /**
+     * @brief Set the names or aliases of the collections.
+     */
+    FederatedSearchRequest&
+    WithCollectionNames(std::vector<std::string>&& collection_names);
+
+    /**
+     * @brief Add a collection name or alias.
+     */
+    FederatedSearchRequest&
+    AddCollectionName(const std::string& collection_name);
+
+    /**
+     * @brief Get the maximum number of collections searched at the same time.
+     */
+    size_t
+    Concurrency() const;
+
+    /**
+     * @brief Set the maximum number of collections searched at the same time, must be greater than 0.
+     */
+    void
+    SetConcurrency(size_t concurrency);
+
+    /**
+     * @brief Set the maximum number of collections searched at the same time, must be greater than 0.
+     */
+    FederatedSearchRequest&
+    WithConcurrency(size_t concurrency);
+
+ private:
+    SearchRequest request_;
+    std::vector<std::string> collection_names_;
+    size_t concurrency_{8};
+};
+
+}  // namespace milvus
@@ -19,6 +19,7 @@
 #include <unordered_map>
 
 #include "../../types/IDArray.h"
+#include "../../types/IDsEncoding.h"
 #include "./DQLRequestBase.h"
 #include "milvus/Export.h"
 
@@ -68,8 +69,35 @@ class MILVUS_SDK_API GetRequest : public DQLRequestBase<GetRequest> {
     GetRequest&
     WithIDs(std::vector<std::string>&& id_array);
 
+    /**
+     * @brief Get the encoding of the id array, default is IDsEncoding::LIST.
+     */
+    IDsEncoding
+    GetIDsEncoding() const;
+
+    /**
+     * @brief Set the encoding of the id array.
+     * IDsEncoding::AUTO picks the smallest encoding that is exact or safely rechecked, see IDsEncoding.
+     */
+    void
+    SetIDsEncoding(IDsEncoding encoding);
+
+    /**
+     * @brief Set the encoding of the id array.
+     * IDsEncoding::AUTO picks the smallest encoding that is exact or safely rechecked, see IDsEncoding.
+     */
+    GetRequest&
+    WithIDsEncoding(IDsEncoding encoding);
+
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     IDArray ids_;
+    IDsEncoding ids_encoding_{IDsEncoding::LIST};
 };
 
 }  // namespace milvus
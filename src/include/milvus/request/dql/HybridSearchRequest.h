@@ -217,6 +217,12 @@ class MILVUS_SDK_API HybridSearchRequest : public DQLRequestBase<HybridSearchReq
     HybridSearchRequest&
     WithStrictGroupSize(bool strict_group_size);
 
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     std::vector<SubSearchRequestPtr> sub_requests_;
     FunctionPtr function_;
@@ -0,0 +1,135 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "./SearchRequest.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Used by MilvusClientV2::MultiSearch()
+ *
+ * The searches are independent, each may target a different collection, partitions and filter. Up to
+ * Concurrency() of them run at the same time. A search that has not started when the deadline passes, or
+ * after a failure when StopOnError() is set, is not sent and reports why in its status.
+ */
+class MILVUS_SDK_API MultiSearchRequest {
+ public:
+    /**
+     * @brief Constructor
+     */
+    MultiSearchRequest() = default;
+
+    /**
+     * @brief Get the search requests.
+     */
+    const std::vector<SearchRequest>&
+    Requests() const;
+
+    /**
+     * @brief Set the search requests.
+     */
+    void
+    SetRequests(std::vector<SearchRequest>&& requests);
+
+    /**
+     * @brief Set the search requests.
+     */
+    MultiSearchRequest&
+    WithRequests(std::vector<SearchRequest>&& requests);
+
+    /**
+     * @brief Add a search request.
+     */
+    MultiSearchRequest&
+    AddRequest(SearchRequest&& request);
+
+    /**
+     * @brief Add a search request.
+     */
+    MultiSearchRequest&
+    AddRequest(const SearchRequest& request);
+
+    /**
+     * @brief Get the maximum number of searches running at the same time.
+     */
+    size_t
+    Concurrency() const;
+
+    /**
+     * @brief Set the maximum number of searches running at the same time, must be greater than 0.
+     */
+    void
+    SetConcurrency(size_t concurrency);
+
+    /**
+     * @brief Set the maximum number of searches running at the same time, must be greater than 0.
+     */
+    MultiSearchRequest&
+    WithConcurrency(size_t concurrency);
+
+    /**
+     * @brief Whether the searches not started yet are skipped once a search failed.
+     */
+    bool
+    StopOnError() const;
+
+    /**
+     * @brief Skip the searches not started yet once a search failed, default is false.
+     */
+    void
+    SetStopOnError(bool stop_on_error);
+
+    /**
+     * @brief Skip the searches not started yet once a search failed, default is false.
+     */
+    MultiSearchRequest&
+    WithStopOnError(bool stop_on_error);
+
+    /**
+     * @brief Get the deadline of the whole batch in milliseconds, 0 means no deadline.
+     */
+    uint64_t
+    TimeoutMs() const;
+
+    /**
+     * @brief Set the deadline of the whole batch in milliseconds, 0 means no deadline.
+     * A running search is given the remaining time as its rpc deadline, if it is shorter than the client one.
+     */
+    void
+    SetTimeoutMs(uint64_t timeout_ms);
+
+    /**
+     * @brief Set the deadline of the whole batch in milliseconds, 0 means no deadline.
+     * A running search is given the remaining time as its rpc deadline, if it is shorter than the client one.
+     */
+    MultiSearchRequest&
+    WithTimeoutMs(uint64_t timeout_ms);
+
+ private:
+    std::vector<SearchRequest> requests_;
+    size_t concurrency_{8};
+    bool stop_on_error_{false};
+    uint64_t timeout_ms_{0};
+};
+
+}  // namespace milvus
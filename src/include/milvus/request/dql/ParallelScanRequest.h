@@ -0,0 +1,121 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "../../types/IDArray.h"
+#include "../../types/QueryResults.h"
+#include "./QueryIteratorRequest.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Callback of MilvusClientV2::ParallelScan(), receives one batch of a shard.
+ * The callback is called concurrently by different shard workers, batches of the same shard are
+ * delivered in primary key order. Return a non-ok status to stop the whole scan.
+ */
+using ParallelScanCallback = std::function<Status(size_t shard_index, QueryResults& batch)>;
+
+/**
+ * @brief Used by MilvusClientV2::ParallelScan()
+ *
+ * The collection is split into disjoint shards, each shard is read by its own query iterator:
+ * - if primary key boundaries are set, by primary key ranges: [min, b0), [b0, b1), ..., [bn, max]
+ * - else if shard count is larger than 1 and the primary key is INT64, by "pk % shard_count"
+ * - else if no partition names are set, Concurrency() is larger than 1 and the primary key is INT64, by primary key
+ *   ranges of about the same row count, found before the scan with two queries ordered by the primary key and a
+ *   few count(*) queries, a server that cannot order a query falls back to partitions
+ * - else by partitions, the partition names of this request or all partitions of the collection
+ *
+ * Boundaries are preferable when the primary key distribution is known, since the server can skip
+ * segments outside the range. Limit and offset are not supported.
+ */
+class MILVUS_SDK_API ParallelScanRequest : public QueryIteratorRequest {
+ public:
+    /**
+     * @brief Constructor
+     */
+    ParallelScanRequest() = default;
+
+    /**
+     * @brief Get the maximum number of shards scanned at the same time.
+     */
+    size_t
+    Concurrency() const;
+
+    /**
+     * @brief Set the maximum number of shards scanned at the same time, must be greater than 0.
+     */
+    void
+    SetConcurrency(size_t concurrency);
+
+    /**
+     * @brief Set the maximum number of shards scanned at the same time, must be greater than 0.
+     */
+    ParallelScanRequest&
+    WithConcurrency(size_t concurrency);
+
+    /**
+     * @brief Get the shard count for INT64 primary key.
+     */
+    size_t
+    ShardCount() const;
+
+    /**
+     * @brief Set the shard count for INT64 primary key, each shard reads rows with "pk % shard_count == index".
+     * A negative key has a negative remainder, shard index also reads the remainder "index - shard_count".
+     */
+    void
+    SetShardCount(size_t shard_count);
+
+    /**
+     * @brief Set the shard count for INT64 primary key, each shard reads rows with "pk % shard_count == index".
+     * A negative key has a negative remainder, shard index also reads the remainder "index - shard_count".
+     */
+    ParallelScanRequest&
+    WithShardCount(size_t shard_count);
+
+    /**
+     * @brief Get the primary key boundaries.
+     */
+    const IDArray&
+    PkBoundaries() const;
+
+    /**
+     * @brief Set ascending primary key boundaries, n boundaries split the collection into n+1 shards.
+     * Integer boundaries require an INT64 primary key, string boundaries require a VARCHAR primary key.
+     */
+    void
+    SetPkBoundaries(IDArray boundaries);
+
+    /**
+     * @brief Set ascending primary key boundaries, n boundaries split the collection into n+1 shards.
+     * Integer boundaries require an INT64 primary key, string boundaries require a VARCHAR primary key.
+     */
+    ParallelScanRequest&
+    WithPkBoundaries(IDArray boundaries);
+
+ private:
+    size_t concurrency_{4};
+    size_t shard_count_{0};
+    IDArray pk_boundaries_;
+};
+
+}  // namespace milvus
@@ -22,7 +22,9 @@
 
 #include "./DQLRequestBase.h"
 #include "milvus/Export.h"
+#include "milvus/types/FilterTemplateArray.h"
 #include "milvus/types/IDArray.h"
+#include "milvus/types/IDsEncoding.h"
 #include "milvus/types/OrderByField.h"
 
 namespace milvus {
@@ -71,6 +73,26 @@ class MILVUS_SDK_API QueryRequest : public DQLRequestBase<QueryRequest> {
     QueryRequest&
     WithIDs(std::vector<std::string>&& id_array);
 
+    /**
+     * @brief Get the encoding of the id array, default is IDsEncoding::LIST.
+     */
+    IDsEncoding
+    GetIDsEncoding() const;
+
+    /**
+     * @brief Set the encoding of the id array.
+     * IDsEncoding::AUTO picks the smallest encoding that is exact or safely rechecked, see IDsEncoding.
+     */
+    void
+    SetIDsEncoding(IDsEncoding encoding);
+
+    /**
+     * @brief Set the encoding of the id array.
+     * IDsEncoding::AUTO picks the smallest encoding that is exact or safely rechecked, see IDsEncoding.
+     */
+    QueryRequest&
+    WithIDsEncoding(IDsEncoding encoding);
+
     /**
      * @brief Get filter expression.
      */
@@ -96,7 +118,7 @@ class MILVUS_SDK_API QueryRequest : public DQLRequestBase<QueryRequest> {
     FilterTemplates() const;
 
     /**
-     * @brief Set filter templates.
+     * @brief Set filter templates, typed array filter templates are cleared.
      * Read the doc for more info: https://milvus.io/docs/filtering-templating.md#Filter-Templating
      */
     void
@@ -112,11 +134,26 @@ class MILVUS_SDK_API QueryRequest : public DQLRequestBase<QueryRequest> {
      *     filterTemplate = {"age": 3, "city": ["beijing", "shanghai", ......]}
      * Valid value of a template can be:
      *     boolean, numeric, string, array.
+     * The template replaces any json or typed template with the same key.
      * Read the doc for more info: https://milvus.io/docs/filtering-templating.md#Filter-Templating
      */
     QueryRequest&
     AddFilterTemplate(std::string key, const nlohmann::json& filter_template);
 
+    /**
+     * @brief Add a typed array filter template. Only take effect when filter is not empty.
+     * The values are encoded into the rpc request in bulk without building json nodes, prefer this
+     * overload for long lists. The template replaces any json or typed template with the same key.
+     */
+    QueryRequest&
+    AddFilterTemplate(std::string key, FilterTemplateArray filter_template);
+
+    /**
+     * @brief Get typed array filter templates.
+     */
+    const std::unordered_map<std::string, FilterTemplateArray>&
+    TypedFilterTemplates() const;
+
     /**
      * @brief Set filter templates. Only take effect when filter is not empty.
      * Read the doc for more info: https://milvus.io/docs/filtering-templating.md#Filter-Templating
@@ -241,10 +278,18 @@ class MILVUS_SDK_API QueryRequest : public DQLRequestBase<QueryRequest> {
     QueryRequest&
     AddOrderByField(OrderByField order_by_field);
 
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     IDArray ids_;
+    IDsEncoding ids_encoding_{IDsEncoding::LIST};
     std::string filter_;
     std::unordered_map<std::string, nlohmann::json> filter_templates_;
+    std::unordered_map<std::string, FilterTemplateArray> typed_filter_templates_;
     std::unordered_map<std::string, std::string> extra_params_;
     std::vector<OrderByField> order_by_fields_;
 };
@@ -0,0 +1,48 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+
+#include "../../types/QueryResults.h"
+#include "./QueryIteratorRequest.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Callback of MilvusClientV2::QueryStream(), receives one batch of rows in primary key order.
+ * Return a non-ok status to stop the stream.
+ */
+using QueryStreamCallback = std::function<Status(QueryResults& batch)>;
+
+/**
+ * @brief Used by MilvusClientV2::QueryStream()
+ *
+ * The rows are fetched page by page, each page has at most BatchSize() rows and is delivered as one batch.
+ * By default one page is fetched in background while the callback is processing the current batch,
+ * set PrefetchDepth() to 0 to fetch pages on demand, or a larger value to buffer more pages.
+ */
+class MILVUS_SDK_API QueryStreamRequest : public QueryIteratorRequest {
+ public:
+    /**
+     * @brief Constructor
+     */
+    QueryStreamRequest();
+};
+
+}  // namespace milvus
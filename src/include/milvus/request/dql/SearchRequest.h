@@ -121,12 +121,21 @@ class MILVUS_SDK_API SearchRequest : public DQLRequestBase<SearchRequest>,
      *     filterTemplate = {"age": 3, "city": ["beijing", "shanghai", ......]}
      * Valid value of a template can be:
      *     boolean, numeric, string, array.
+     * The template replaces any json or typed template with the same key.
      *
      * Read the doc for more info: https://milvus.io/docs/filtering-templating.md#Filter-Templating
      */
     SearchRequest&
     AddFilterTemplate(std::string key, const nlohmann::json& filter_template);
 
+    /**
+     * @brief Add a typed array filter template. Only take effect when filter is not empty.
+     * The values are encoded into the rpc request in bulk without building json nodes, prefer this
+     * overload for long lists. The template replaces any json or typed template with the same key.
+     */
+    SearchRequest&
+    AddFilterTemplate(std::string key, FilterTemplateArray filter_template);
+
     /**
      * @brief Set filter templates. Only take effect when filter is not empty.
      * Read the doc for more info: https://milvus.io/docs/filtering-templating.md#Filter-Templating
@@ -349,6 +358,12 @@ class MILVUS_SDK_API SearchRequest : public DQLRequestBase<SearchRequest>,
     SearchRequest&
     AddOrderByField(OrderByField order_by_field);
 
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    size_t
+    MemoryUsage() const override;
+
     Status
     Validate() const;
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/AliasDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeAlias()
  */
-class MILVUS_SDK_API DescribeAliasResponse {
+class MILVUS_SDK_API DescribeAliasResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListAliases()
  */
-class MILVUS_SDK_API ListAliasesResponse {
+class MILVUS_SDK_API ListAliasesResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
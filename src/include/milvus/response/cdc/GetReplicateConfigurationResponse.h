@@ -16,12 +16,13 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/ReplicateConfiguration.h"
 
 namespace milvus {
 
-class MILVUS_SDK_API GetReplicateConfigurationResponse {
+class MILVUS_SDK_API GetReplicateConfigurationResponse : public ResponseBase {
  public:
     const ReplicateConfiguration&
     Configuration() const;
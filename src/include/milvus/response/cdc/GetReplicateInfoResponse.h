@@ -16,12 +16,13 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/ReplicateConfiguration.h"
 
 namespace milvus {
 
-class MILVUS_SDK_API GetReplicateInfoResponse {
+class MILVUS_SDK_API GetReplicateInfoResponse : public ResponseBase {
  public:
     const ReplicateCheckpoint&
     Checkpoint() const;
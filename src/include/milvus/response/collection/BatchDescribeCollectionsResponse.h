@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "../../types/CollectionDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::BatchDescribeCollections()
  */
-class MILVUS_SDK_API BatchDescribeCollectionsResponse {
+class MILVUS_SDK_API BatchDescribeCollectionsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "../../types/CollectionDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -28,7 +29,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeCollection()
  */
-class MILVUS_SDK_API DescribeCollectionResponse {
+class MILVUS_SDK_API DescribeCollectionResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "../../types/ReplicaInfo.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeReplicas()
  */
-class MILVUS_SDK_API DescribeReplicasResponse {
+class MILVUS_SDK_API DescribeReplicasResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/CollectionStat.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetCollectionStats()
  */
-class MILVUS_SDK_API GetCollectionStatsResponse {
+class MILVUS_SDK_API GetCollectionStatsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -19,6 +19,7 @@
 #include <cstdint>
 
 #include "../../types/LoadState.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetLoadState()
  */
-class MILVUS_SDK_API GetLoadStateResponse {
+class MILVUS_SDK_API GetLoadStateResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
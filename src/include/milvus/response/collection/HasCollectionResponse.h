@@ -16,13 +16,14 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 namespace milvus {
 
 /**
  * @brief Used by MilvusClientV2::CreateCollection()
  */
-class MILVUS_SDK_API HasCollectionResponse {
+class MILVUS_SDK_API HasCollectionResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
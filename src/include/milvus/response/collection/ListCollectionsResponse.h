@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "../../types/CollectionInfo.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -27,7 +28,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListCollections()
  */
-class MILVUS_SDK_API ListCollectionsResponse {
+class MILVUS_SDK_API ListCollectionsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
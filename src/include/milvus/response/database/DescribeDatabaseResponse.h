@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/DatabaseDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeDatabase()
  */
-class MILVUS_SDK_API DescribeDatabaseResponse {
+class MILVUS_SDK_API DescribeDatabaseResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/DmlResults.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Base class of dml requests
  */
-class MILVUS_SDK_API DmlResponse {
+class MILVUS_SDK_API DmlResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -0,0 +1,80 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../../Status.h"
+#include "../ResponseBase.h"
+#include "./SearchResponse.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Used by MilvusClientV2::MultiSearch(), the statuses and responses are in the order of the requests.
+ */
+class MILVUS_SDK_API MultiSearchResponse : public ResponseBase {
+ public:
+    /**
+     * @brief Constructor
+     */
+    MultiSearchResponse() = default;
+
+    /**
+     * @brief Get the status of each search.
+     */
+    const std::vector<Status>&
+    Statuses() const;
+
+    /**
+     * @brief Set the status of each search.
+     */
+    void
+    SetStatuses(std::vector<Status>&& statuses);
+
+    /**
+     * @brief Get the response of each search, the response of a failed search is empty.
+     */
+    const std::vector<SearchResponse>&
+    Responses() const;
+
+    /**
+     * @brief Get the response of each search, the response of a failed search is empty.
+     */
+    std::vector<SearchResponse>&
+    Responses();
+
+    /**
+     * @brief Set the response of each search.
+     */
+    void
+    SetResponses(std::vector<SearchResponse>&& responses);
+
+    /**
+     * @brief Number of searches that failed, were skipped or missed the deadline.
+     */
+    size_t
+    FailedCount() const;
+
+ private:
+    std::vector<Status> statuses_;
+    std::vector<SearchResponse> responses_;
+};
+
+}  // namespace milvus
@@ -19,6 +19,7 @@
 #include <cstdint>
 
 #include "../../types/QueryResults.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::Query()
  */
-class MILVUS_SDK_API QueryResponse {
+class MILVUS_SDK_API QueryResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -20,6 +20,7 @@
 
 #include "../../types/AggregationBucket.h"
 #include "../../types/SearchResults.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -27,7 +28,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::Search()
  */
-class MILVUS_SDK_API SearchResponse {
+class MILVUS_SDK_API SearchResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
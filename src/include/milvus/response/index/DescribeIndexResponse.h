@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "../../types/IndexDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeIndex()
  */
-class MILVUS_SDK_API DescribeIndexResponse {
+class MILVUS_SDK_API DescribeIndexResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/PartitionStat.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetPartitionStats()
  */
-class MILVUS_SDK_API GetPartitionStatsResponse {
+class MILVUS_SDK_API GetPartitionStatsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -16,13 +16,14 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 namespace milvus {
 
 /**
  * @brief Used by MilvusClientV2::HasPartition()
  */
-class MILVUS_SDK_API HasPartitionResponse {
+class MILVUS_SDK_API HasPartitionResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
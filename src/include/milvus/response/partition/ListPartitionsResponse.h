@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "../../types/PartitionInfo.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -27,7 +28,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListPartitions()
  */
-class MILVUS_SDK_API ListPartitionsResponse {
+class MILVUS_SDK_API ListPartitionsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/RoleDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeRole()
  */
-class MILVUS_SDK_API DescribeRoleResponse {
+class MILVUS_SDK_API DescribeRoleResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/UserDesc.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeUser()
  */
-class MILVUS_SDK_API DescribeUserResponse {
+class MILVUS_SDK_API DescribeUserResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/PrivilegeGroupInfo.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListPrivilegeGroups()
  */
-class MILVUS_SDK_API ListPrivilegeGroupsResponse {
+class MILVUS_SDK_API ListPrivilegeGroupsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
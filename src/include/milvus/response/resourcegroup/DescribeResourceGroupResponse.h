@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/ResourceGroupDesc.h"
 
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeResourceGroup()
  */
-class MILVUS_SDK_API DescribeResourceGroupResponse {
+class MILVUS_SDK_API DescribeResourceGroupResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -27,7 +28,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::DescribeSnapshot()
  */
-class MILVUS_SDK_API DescribeSnapshotResponse {
+class MILVUS_SDK_API DescribeSnapshotResponse : public ResponseBase {
  public:
     DescribeSnapshotResponse() = default;
 
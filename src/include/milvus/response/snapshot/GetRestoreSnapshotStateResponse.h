@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/RestoreSnapshotJobInfo.h"
 
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetRestoreSnapshotState()
  */
-class MILVUS_SDK_API GetRestoreSnapshotStateResponse {
+class MILVUS_SDK_API GetRestoreSnapshotStateResponse : public ResponseBase {
  public:
     GetRestoreSnapshotStateResponse() = default;
 
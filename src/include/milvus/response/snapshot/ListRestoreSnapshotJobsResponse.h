@@ -18,6 +18,7 @@
 
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/RestoreSnapshotJobInfo.h"
 
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListRestoreSnapshotJobs()
  */
-class MILVUS_SDK_API ListRestoreSnapshotJobsResponse {
+class MILVUS_SDK_API ListRestoreSnapshotJobsResponse : public ResponseBase {
  public:
     ListRestoreSnapshotJobsResponse() = default;
 
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListSnapshots()
  */
-class MILVUS_SDK_API ListSnapshotsResponse {
+class MILVUS_SDK_API ListSnapshotsResponse : public ResponseBase {
  public:
     ListSnapshotsResponse() = default;
 
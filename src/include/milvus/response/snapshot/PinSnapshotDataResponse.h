@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -25,7 +26,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::PinSnapshotData()
  */
-class MILVUS_SDK_API PinSnapshotDataResponse {
+class MILVUS_SDK_API PinSnapshotDataResponse : public ResponseBase {
  public:
     PinSnapshotDataResponse() = default;
 
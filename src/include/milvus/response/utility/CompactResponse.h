@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -25,7 +26,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::Compact()
  */
-class MILVUS_SDK_API CompactResponse {
+class MILVUS_SDK_API CompactResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -25,7 +26,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::FlushAll()
  */
-class MILVUS_SDK_API FlushAllResponse {
+class MILVUS_SDK_API FlushAllResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
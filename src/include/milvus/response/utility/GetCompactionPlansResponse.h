@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/CompactionPlan.h"
 
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetCompactionPlans()
  */
-class MILVUS_SDK_API GetCompactionPlansResponse {
+class MILVUS_SDK_API GetCompactionPlansResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/CompactionState.h"
 
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetCompactionState()
  */
-class MILVUS_SDK_API GetCompactionStateResponse {
+class MILVUS_SDK_API GetCompactionStateResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -23,7 +24,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetFlushAllState()
  */
-class MILVUS_SDK_API GetFlushAllStateResponse {
+class MILVUS_SDK_API GetFlushAllStateResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/RefreshExternalCollectionJobInfo.h"
 
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::GetRefreshExternalCollectionProgress()
  */
-class MILVUS_SDK_API GetRefreshExternalCollectionProgressResponse {
+class MILVUS_SDK_API GetRefreshExternalCollectionProgressResponse : public ResponseBase {
  public:
     GetRefreshExternalCollectionProgressResponse() = default;
 
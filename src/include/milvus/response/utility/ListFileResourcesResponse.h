@@ -18,6 +18,7 @@
 
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/FileResourceInfo.h"
 
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListFileResources()
  */
-class MILVUS_SDK_API ListFileResourcesResponse {
+class MILVUS_SDK_API ListFileResourcesResponse : public ResponseBase {
  public:
     ListFileResourcesResponse() = default;
 
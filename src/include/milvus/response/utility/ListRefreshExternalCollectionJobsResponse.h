@@ -18,6 +18,7 @@
 
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/RefreshExternalCollectionJobInfo.h"
 
@@ -26,7 +27,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::ListRefreshExternalCollectionJobs()
  */
-class MILVUS_SDK_API ListRefreshExternalCollectionJobsResponse {
+class MILVUS_SDK_API ListRefreshExternalCollectionJobsResponse : public ResponseBase {
  public:
     ListRefreshExternalCollectionJobsResponse() = default;
 
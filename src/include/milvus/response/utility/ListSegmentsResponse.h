@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 #include "milvus/types/SegmentInfo.h"
 
@@ -25,7 +26,7 @@ namespace milvus {
  * @brief Used by MilvusClientV2::ListPersistentSegments() and ListQuerySegments()
  */
 template <typename T>
-class ListSegmentsResponse {
+class ListSegmentsResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
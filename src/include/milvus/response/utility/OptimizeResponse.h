@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -27,7 +28,7 @@ namespace milvus {
 /**
  * @brief Result of MilvusClientV2::Optimize().
  */
-class MILVUS_SDK_API OptimizeResponse {
+class MILVUS_SDK_API OptimizeResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "../../types/AnalyzerResults.h"
+#include "../ResponseBase.h"
 #include "milvus/Export.h"
 
 namespace milvus {
@@ -24,7 +25,7 @@ namespace milvus {
 /**
  * @brief Used by MilvusClientV2::RunAnalyzer()
  */
-class MILVUS_SDK_API RunAnalyzerResponse {
+class MILVUS_SDK_API RunAnalyzerResponse : public ResponseBase {
  public:
     /**
      * @brief Constructor
@@ -0,0 +1,114 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Returns the bytes the calling thread has allocated so far, the difference of two readings on the same thread
+ * is what it allocated in between. The SDK does not replace operator new, the application supplies the counter, for
+ * example from a counting operator new or from the thread statistics of its allocator. It runs twice per call on the
+ * calling thread, it must be cheap and must not throw.
+ */
+using AllocationCounter = std::function<uint64_t(void)>;
+
+/**
+ * @brief Bytes allocated by the calls of one API, from the validation of the arguments to the processing of the
+ * response, retries included.
+ */
+class MILVUS_SDK_API ApiAllocationStats {
+ public:
+    ApiAllocationStats() = default;
+
+    /**
+     * @brief Constructor
+     */
+    ApiAllocationStats(std::string api, uint64_t calls, uint64_t total_bytes, uint64_t max_bytes);
+
+    /**
+     * @brief Name of the API, the rpc name such as "Search" or "Insert".
+     */
+    const std::string&
+    Api() const;
+
+    /**
+     * @brief Number of measured calls.
+     */
+    uint64_t
+    Calls() const;
+
+    /**
+     * @brief Bytes allocated by all the measured calls.
+     */
+    uint64_t
+    TotalBytes() const;
+
+    /**
+     * @brief Bytes allocated by the most expensive call.
+     */
+    uint64_t
+    MaxBytes() const;
+
+    /**
+     * @brief Average bytes allocated per call, 0 if there is no measured call.
+     */
+    double
+    MeanBytes() const;
+
+ private:
+    std::string api_;
+    uint64_t calls_{0};
+    uint64_t total_bytes_{0};
+    uint64_t max_bytes_{0};
+};
+
+/**
+ * @brief Per API allocation statistics of the SDK, returned by MilvusClientV2::GetAllocationStats().
+ */
+class MILVUS_SDK_API AllocationStats {
+ public:
+    AllocationStats() = default;
+
+    /**
+     * @brief Constructor
+     */
+    explicit AllocationStats(std::vector<ApiAllocationStats> apis);
+
+    /**
+     * @brief Statistics of each API called since the counter was set, ordered by API name.
+     */
+    const std::vector<ApiAllocationStats>&
+    Apis() const;
+
+    /**
+     * @brief Bytes allocated by the calls of all APIs.
+     */
+    uint64_t
+    TotalBytes() const;
+
+ private:
+    std::vector<ApiAllocationStats> apis_;
+};
+
+}  // namespace milvus
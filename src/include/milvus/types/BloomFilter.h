@@ -110,12 +110,30 @@ class MILVUS_SDK_API BloomFilterBuilder {
     BloomFilterBuilder&
     AddInt64s(const std::vector<int64_t>& values);
 
+    /**
+     * @brief Insert a whole vector of integer members on up to @a num_threads workers.
+     *
+     * The calling thread works alongside helpers from Executor::Default(). @a num_threads is capped
+     * at the hardware concurrency and at 16. Each worker owns a contiguous range of blocks, so the
+     * body is byte-identical to inserting the same members one at a time. A vector too short to
+     * amortise the hand-off is inserted on the calling thread.
+     */
+    BloomFilterBuilder&
+    AddInt64s(const std::vector<int64_t>& values, uint32_t num_threads);
+
     /**
      * @brief Insert a whole vector of string members.
      */
     BloomFilterBuilder&
     AddStrings(const std::vector<std::string>& values);
 
+    /**
+     * @brief Insert a whole vector of string members on up to @a num_threads workers, see
+     * AddInt64s(const std::vector<int64_t>&, uint32_t).
+     */
+    BloomFilterBuilder&
+    AddStrings(const std::vector<std::string>& values, uint32_t num_threads);
+
     /**
      * @brief The value domains recorded so far. Zero means nothing was inserted, and such a
      * filter matches no row.
@@ -149,6 +167,10 @@ class MILVUS_SDK_API BloomFilterBuilder {
     void
     addHash(uint64_t hash);
 
+    template <typename T>
+    void
+    addMembers(const std::vector<T>& values, uint32_t num_threads);
+
     std::vector<uint8_t> buf_;
     uint32_t num_blocks_{0};
     uint64_t n_declared_{0};
@@ -0,0 +1,105 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Where the time of one API call went, measured with std::chrono::steady_clock on the calling thread.
+ * Attached to the response of the call when ConnectParam::CallTimingEnabled() is true.
+ *
+ * The stages do not overlap, a schema lookup made while the request is converted or the response is decoded is
+ * charged to SCHEMA_LOOKUP only. The sum of the stages is close to Total(), the difference is the bookkeeping between
+ * the stages and work done before the call reached the server, such as a result cache lookup.
+ *
+ * A call that fans out to several searches, MultiSearch() or FederatedSearch(), times each search on the thread
+ * running it. MultiSearch() attaches that timing to the response of each search. The timing of the whole call sums
+ * the stages of its searches and lists their attempts in the order of the searches, while Total() is the wall time of
+ * the call, so the sum of the stages may exceed Total() when the searches overlap.
+ *
+ * An asynchronous call, such as SearchAsync(), is timed on the calling thread until the rpc is sent and on the thread
+ * completing it afterwards. The RPC stage of its first attempt runs from the send to the reply.
+ */
+class MILVUS_SDK_API CallTiming {
+ public:
+    using Duration = std::chrono::nanoseconds;
+
+    enum class Stage {
+        // checking the arguments of the request
+        VALIDATE = 0,
+        // getting the collection schema from the cache or with a DescribeCollection() call
+        SCHEMA_LOOKUP = 1,
+        // building the rpc request
+        CONVERT = 2,
+        // the rpc attempts, the time on the wire and in the server together
+        RPC = 3,
+        // sleeping between the attempts of a retried rpc
+        BACKOFF = 4,
+        // polling the server until a long operation is done
+        WAIT = 5,
+        // building the response from the rpc response
+        DECODE = 6,
+    };
+
+    static constexpr size_t kStageCount = 7;
+
+    CallTiming() = default;
+
+    /**
+     * @brief Time from the start to the end of the API call.
+     */
+    Duration
+    Total() const;
+
+    void
+    SetTotal(Duration total);
+
+    /**
+     * @brief Time spent in a stage.
+     */
+    Duration
+    Elapsed(Stage stage) const;
+
+    void
+    AddElapsed(Stage stage, Duration elapsed);
+
+    /**
+     * @brief Duration of each rpc attempt in order, more than one when the rpc was retried.
+     */
+    const std::vector<Duration>&
+    Attempts() const;
+
+    void
+    AddAttempt(Duration elapsed);
+
+ private:
+    Duration total_{0};
+    std::array<Duration, kStageCount> stages_{};
+    std::vector<Duration> attempts_;
+};
+
+using CallTimingPtr = std::shared_ptr<const CallTiming>;
+
+}  // namespace milvus
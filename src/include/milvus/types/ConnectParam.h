@@ -338,6 +338,48 @@ class MILVUS_SDK_API ConnectParam {
     ConnectParam&
     WithDbName(const std::string& db_name);
 
+    /**
+     * @brief Get path of the persistent schema cache file, empty means the file is not used.
+     */
+    const std::string&
+    SchemaCacheFile() const;
+
+    /**
+     * @brief Set path of the persistent schema cache file, empty means the file is not used.
+     * Collection schemas described by this client are saved into the file at Disconnect(), and the file is
+     * mapped at Connect() so that a new process can skip the DescribeCollection() call for each collection.
+     * A schema loaded from the file is trusted until the server rejects an insert or upsert with a schema
+     * mismatch error, or this client changes the collection. Clients of one process can share one file.
+     */
+    void
+    SetSchemaCacheFile(const std::string& path);
+
+    /**
+     * @brief Set path of the persistent schema cache file, empty means the file is not used.
+     * See SetSchemaCacheFile().
+     */
+    ConnectParam&
+    WithSchemaCacheFile(const std::string& path);
+
+    /**
+     * @brief Get whether the responses carry the timing of their calls.
+     */
+    bool
+    CallTimingEnabled() const;
+
+    /**
+     * @brief Set whether the responses carry the timing of their calls, see ResponseBase::Timing(). It is disabled by
+     * default, a disabled timing costs a thread local read per stage of a call.
+     */
+    void
+    SetCallTimingEnabled(bool enabled);
+
+    /**
+     * @brief Set whether the responses carry the timing of their calls, see SetCallTimingEnabled().
+     */
+    ConnectParam&
+    WithCallTimingEnabled(bool enabled);
+
  private:
     std::string uri_ = "http://localhost:19530";
 
@@ -357,6 +399,9 @@ class MILVUS_SDK_API ConnectParam {
     std::string username_;
     std::string token_;
     std::string db_name_;
+
+    std::string schema_cache_file_;
+    bool call_timing_{false};
 };
 
 }  // namespace milvus
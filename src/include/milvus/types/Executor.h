@@ -0,0 +1,88 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "../Status.h"
+#include "ExecutorStats.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+class Executor;
+
+using ExecutorPtr = std::shared_ptr<Executor>;
+
+/**
+ * @brief Thread pool running the background work of the SDK, such as asynchronous Optimize() tasks.
+ * Every worker owns a task queue, a worker that runs out of tasks takes the oldest task of another worker, so a task
+ * submitted from a worker stays on that worker unless another one is idle.
+ *
+ * Clients created by MilvusClientV2::Create() share Executor::Default(), pass an executor to
+ * MilvusClientV2::Create(ExecutorPtr) to size or isolate the pool of a client.
+ */
+class MILVUS_SDK_API Executor {
+ public:
+    using Task = std::function<void()>;
+
+    virtual ~Executor() = default;
+
+    /**
+     * @brief Create an executor with its own worker threads. The destructor runs the tasks still queued, then joins
+     * the workers.
+     *
+     * @param [in] worker_count number of worker threads, 0 means std::thread::hardware_concurrency()
+     * @return ExecutorPtr
+     */
+    static ExecutorPtr
+    Create(uint32_t worker_count = 0);
+
+    /**
+     * @brief The executor shared by clients created without one. It has hardware_concurrency() workers and at least
+     * two, and it is never destroyed, so a running task does not delay the exit of the process.
+     *
+     * @return ExecutorPtr
+     */
+    static ExecutorPtr
+    Default();
+
+    /**
+     * @brief Queue a task. An exception thrown by the task is caught and counted in ExecutorStats::Failed().
+     *
+     * @param [in] task the task to run
+     * @return Status fails if the executor is being destroyed and the caller is not one of its workers
+     */
+    virtual Status
+    Submit(Task task) = 0;
+
+    /**
+     * @brief Number of worker threads.
+     */
+    virtual uint32_t
+    WorkerCount() const = 0;
+
+    /**
+     * @brief Queue depth, task counters and latencies of the executor.
+     */
+    virtual ExecutorStats
+    Stats() const = 0;
+};
+
+}  // namespace milvus
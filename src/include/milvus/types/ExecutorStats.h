@@ -0,0 +1,125 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Statistics of an Executor, returned by Executor::Stats() and MilvusClientV2::GetExecutorStats().
+ * Latencies are in microseconds, the wait latency of a task is from Submit() until a worker starts it.
+ */
+class MILVUS_SDK_API ExecutorStats {
+ public:
+    ExecutorStats() = default;
+
+    /**
+     * @brief Constructor
+     */
+    ExecutorStats(uint32_t workers, uint64_t queue_depth, uint64_t max_queue_depth, uint64_t submitted,
+                  uint64_t completed, uint64_t stolen, uint64_t failed, uint64_t total_wait_us, uint64_t max_wait_us,
+                  uint64_t total_run_us);
+
+    /**
+     * @brief Number of worker threads.
+     */
+    uint32_t
+    Workers() const;
+
+    /**
+     * @brief Number of tasks submitted but not yet started.
+     */
+    uint64_t
+    QueueDepth() const;
+
+    /**
+     * @brief Highest number of tasks that were waiting at the same time.
+     */
+    uint64_t
+    MaxQueueDepth() const;
+
+    /**
+     * @brief Number of tasks accepted by Submit().
+     */
+    uint64_t
+    Submitted() const;
+
+    /**
+     * @brief Number of tasks that finished running, including the failed ones.
+     */
+    uint64_t
+    Completed() const;
+
+    /**
+     * @brief Number of tasks run by a worker other than the one they were queued on.
+     */
+    uint64_t
+    Stolen() const;
+
+    /**
+     * @brief Number of tasks that exited with an exception.
+     */
+    uint64_t
+    Failed() const;
+
+    /**
+     * @brief Sum of the wait latencies of the completed tasks.
+     */
+    uint64_t
+    TotalWaitUs() const;
+
+    /**
+     * @brief Highest wait latency of a task.
+     */
+    uint64_t
+    MaxWaitUs() const;
+
+    /**
+     * @brief Sum of the running time of the completed tasks.
+     */
+    uint64_t
+    TotalRunUs() const;
+
+    /**
+     * @brief Average wait latency of the completed tasks, 0 if there is no completed task.
+     */
+    double
+    MeanWaitUs() const;
+
+    /**
+     * @brief Average running time of the completed tasks, 0 if there is no completed task.
+     */
+    double
+    MeanRunUs() const;
+
+ private:
+    uint32_t workers_{0};
+    uint64_t queue_depth_{0};
+    uint64_t max_queue_depth_{0};
+    uint64_t submitted_{0};
+    uint64_t completed_{0};
+    uint64_t stolen_{0};
+    uint64_t failed_{0};
+    uint64_t total_wait_us_{0};
+    uint64_t max_wait_us_{0};
+    uint64_t total_run_us_{0};
+};
+
+}  // namespace milvus
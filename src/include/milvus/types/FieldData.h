@@ -60,6 +60,14 @@ class MILVUS_SDK_API Field {
     virtual void
     Reserve(size_t count) = 0;
 
+    /**
+     * @brief Approximate memory footprint in bytes, the object itself and the heap memory it owns.
+     * Vectors count their capacity, strings, nested vectors, sparse vectors and json values count their own
+     * allocations as well. Allocator overheads are not counted.
+     */
+    virtual size_t
+    MemoryUsage() const;
+
  protected:
     Field(std::string name, DataType data_type);
 
@@ -171,6 +179,12 @@ class FieldData : public Field {
     void
     Reserve(size_t count) final;
 
+    /**
+     * @brief Approximate memory footprint in bytes, the elements and the validity array included.
+     */
+    size_t
+    MemoryUsage() const override;
+
     /**
      * @brief Field elements array.
      */
@@ -0,0 +1,137 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DataType.h"
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief A typed array value for filter templates.
+ * Unlike nlohmann::json templates, the values are kept in a plain vector and encoded into the rpc request
+ * in bulk, which matters for long lists such as "id in {ids}" with many thousands of values.
+ * The values are immutable and shared between copies, so copying a request is cheap.
+ *
+ * Usage example:
+ *     request.WithFilter("id in {ids}").AddFilterTemplate("ids", FilterTemplateArray::Int64s(std::move(ids)));
+ */
+class MILVUS_SDK_API FilterTemplateArray {
+ public:
+    /**
+     * @brief Constructor, an empty INT64 array.
+     */
+    FilterTemplateArray();
+
+    /**
+     * @brief Build a boolean array.
+     */
+    static FilterTemplateArray
+    Bools(std::vector<bool> values);
+
+    /**
+     * @brief Build an integer array.
+     */
+    static FilterTemplateArray
+    Int64s(std::vector<int64_t> values);
+
+    /**
+     * @brief Build an integer array from a range, e.g. a part of a larger buffer.
+     */
+    static FilterTemplateArray
+    Int64s(const int64_t* data, size_t count);
+
+    /**
+     * @brief Build a floating point array.
+     */
+    static FilterTemplateArray
+    Doubles(std::vector<double> values);
+
+    /**
+     * @brief Build a floating point array from a range, e.g. a part of a larger buffer.
+     */
+    static FilterTemplateArray
+    Doubles(const double* data, size_t count);
+
+    /**
+     * @brief Build a string array.
+     */
+    static FilterTemplateArray
+    Strings(std::vector<std::string> values);
+
+    /**
+     * @brief Build a nested array, each element is an array.
+     */
+    static FilterTemplateArray
+    Arrays(std::vector<FilterTemplateArray> values);
+
+    /**
+     * @brief Element type: BOOL, INT64, DOUBLE, VARCHAR, or ARRAY for nested arrays.
+     */
+    DataType
+    ElementType() const;
+
+    /**
+     * @brief Number of elements.
+     */
+    size_t
+    Size() const;
+
+    /**
+     * @brief Boolean values, empty if the element type is not BOOL.
+     */
+    const std::vector<bool>&
+    BoolValues() const;
+
+    /**
+     * @brief Integer values, empty if the element type is not INT64.
+     */
+    const std::vector<int64_t>&
+    Int64Values() const;
+
+    /**
+     * @brief Floating point values, empty if the element type is not DOUBLE.
+     */
+    const std::vector<double>&
+    DoubleValues() const;
+
+    /**
+     * @brief String values, empty if the element type is not VARCHAR.
+     */
+    const std::vector<std::string>&
+    StringValues() const;
+
+    /**
+     * @brief Nested arrays, empty if the element type is not ARRAY.
+     */
+    const std::vector<FilterTemplateArray>&
+    ArrayValues() const;
+
+ private:
+    struct Values;
+    explicit FilterTemplateArray(std::shared_ptr<const Values> values);
+
+    std::shared_ptr<const Values> values_;
+};
+
+}  // namespace milvus
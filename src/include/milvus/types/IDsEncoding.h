@@ -0,0 +1,40 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace milvus {
+
+/**
+ * @brief How Get(), Query() and Delete() ship a primary-key id set to the server.
+ *
+ * LIST is the classic `pk in {ids}` template and works with every server version. The other
+ * encodings rely on the roaring_match/bloom_match expressions, so they need a server that
+ * supports them.
+ */
+enum class IDsEncoding {
+    // pick one from the id set statistics, see RoaringBitmapBuilder::Stats()
+    AUTO = 0,
+    // `pk in {ids}`, an int64 or string list
+    LIST = 1,
+    // `roaring_match(pk, {ids})`, exact, integer primary keys only
+    ROARING_BITMAP = 2,
+    // `bloom_match(pk, {ids})`, the false positives are removed from the results by the client,
+    // not permitted for Delete(), or for a Query() with limit, offset or count(*)
+    BLOOM_PREFILTER = 3,
+};
+
+}  // namespace milvus
@@ -19,6 +19,7 @@
 #include <memory>
 #include <vector>
 
+#include "IteratorPrefetchStats.h"
 #include "QueryResults.h"
 #include "SearchResults.h"
 #include "milvus/Export.h"
@@ -44,6 +45,15 @@ class Iterator {
      */
     virtual Status
     Next(T& results) = 0;
+
+    /**
+     * @brief Get prefetch statistics of this iterator.
+     * Prefetch is enabled by IteratorArguments::SetPrefetchDepth(), the statistics are all zero if it is disabled.
+     */
+    virtual IteratorPrefetchStats
+    PrefetchStats() const {
+        return {};
+    }
 };
 
 extern template class MILVUS_SDK_API Iterator<QueryResults>;
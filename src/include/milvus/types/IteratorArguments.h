@@ -71,8 +71,25 @@ class MILVUS_SDK_API IteratorArguments {
     Status
     SetPkSchema(const FieldSchema& schema);
 
+    /**
+     * @brief Get the prefetch depth.
+     */
+    int64_t
+    PrefetchDepth() const;
+
+    /**
+     * @brief Set the prefetch depth, the maximum number of pages fetched in background while the caller
+     * consumes the current batch. The default value is 0, means no prefetch.
+     * Buffered memory is bounded by the prefetch depth, each page holds roughly one batch. Outstanding
+     * work is cancelled when the iterator is destroyed. Not supported by the legacy search iterator for
+     * milvus server older than v2.5.2, the value is ignored in that case.
+     */
+    Status
+    SetPrefetchDepth(int64_t prefetch_depth);
+
  private:
     int64_t batch_size_{1000};
+    int64_t prefetch_depth_{0};
     int64_t collection_id_{0};
     FieldSchema pk_schema_;
 };
@@ -0,0 +1,75 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Prefetch statistics of an iterator, returned by Iterator::PrefetchStats().
+ * All counters are zero when prefetch is not enabled, see IteratorArguments::SetPrefetchDepth().
+ */
+class MILVUS_SDK_API IteratorPrefetchStats {
+ public:
+    IteratorPrefetchStats() = default;
+
+    /**
+     * @brief Constructor
+     */
+    IteratorPrefetchStats(uint64_t depth, uint64_t fetched_pages, uint64_t hits, uint64_t misses);
+
+    /**
+     * @brief The maximum number of buffered pages.
+     */
+    uint64_t
+    Depth() const;
+
+    /**
+     * @brief Number of pages fetched in background.
+     */
+    uint64_t
+    FetchedPages() const;
+
+    /**
+     * @brief Number of page requests served without waiting for an rpc call.
+     */
+    uint64_t
+    Hits() const;
+
+    /**
+     * @brief Number of page requests that waited for an rpc call in flight.
+     */
+    uint64_t
+    Misses() const;
+
+    /**
+     * @brief Ratio of page requests served by prefetched pages, 0 if no page was requested.
+     */
+    double
+    HitRatio() const;
+
+ private:
+    uint64_t depth_{0};
+    uint64_t fetched_pages_{0};
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+};
+
+}  // namespace milvus
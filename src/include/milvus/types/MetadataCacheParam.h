@@ -0,0 +1,80 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Parameters for the client-side metadata cache.
+ * The cache is disabled by default. When enabled, responses of DescribeIndex(), ListIndexes(), ListPartitions()
+ * and GetLoadState() are kept for TtlMs() milliseconds. An entry is dropped at once when this client changes
+ * the collection, e.g. by CreateIndex(), DropIndex(), CreatePartition(), LoadCollection() or ReleaseCollection().
+ * Changes made by other clients are seen after the entry expires. A collection that is still loading is never
+ * cached, and index build progress of a cached DescribeIndex() response can be up to TtlMs() old.
+ */
+class MILVUS_SDK_API MetadataCacheParam {
+ public:
+    MetadataCacheParam() = default;
+
+    /**
+     * @brief Get time-to-live of cached entries in milliseconds, 0 means the cache is disabled.
+     */
+    uint64_t
+    TtlMs() const;
+
+    /**
+     * @brief Set time-to-live of cached entries in milliseconds, 0 means the cache is disabled.
+     */
+    void
+    SetTtlMs(uint64_t ttl_ms);
+
+    /**
+     * @brief Set time-to-live of cached entries in milliseconds, 0 means the cache is disabled.
+     */
+    MetadataCacheParam&
+    WithTtlMs(uint64_t ttl_ms);
+
+    /**
+     * @brief Get the max number of cached entries.
+     */
+    uint64_t
+    MaxEntries() const;
+
+    /**
+     * @brief Set the max number of cached entries, the least recently used entries are dropped beyond it.
+     * @param max_entries the max number, must be greater than 0.
+     */
+    void
+    SetMaxEntries(uint64_t max_entries);
+
+    /**
+     * @brief Set the max number of cached entries, the least recently used entries are dropped beyond it.
+     * @param max_entries the max number, must be greater than 0.
+     */
+    MetadataCacheParam&
+    WithMaxEntries(uint64_t max_entries);
+
+ private:
+    uint64_t ttl_ms_ = 0;  // uints: millisecond
+    uint64_t max_entries_ = 4096;
+};
+
+}  // namespace milvus
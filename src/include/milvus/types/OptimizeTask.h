@@ -17,11 +17,9 @@
 #pragma once
 
 #include <condition_variable>
-#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <thread>
 #include <vector>
 
 #include "../Status.h"
@@ -92,11 +90,6 @@ class MILVUS_SDK_API OptimizeTask : public std::enable_shared_from_this<Optimize
  private:
     friend class MilvusClientV2Impl;
 
-    using Worker = std::function<Status(OptimizeResponse&)>;
-
-    Status
-    start(Worker worker);
-
     bool
     shouldCancel() const;
 
@@ -117,7 +110,6 @@ class MILVUS_SDK_API OptimizeTask : public std::enable_shared_from_this<Optimize
     Status status_;
     OptimizeResponse response_;
     std::vector<std::string> progress_history_;
-    std::thread worker_;
 };
 
 using OptimizeTaskPtr = std::shared_ptr<OptimizeTask>;
@@ -100,6 +100,12 @@ class MILVUS_SDK_API QueryResults {
     void
     Clear();
 
+    /**
+     * @brief Approximate memory footprint of the result in bytes, see Field::MemoryUsage().
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     std::vector<FieldDataPtr> output_fields_;
     std::set<std::string> output_names_;  // output_fields list specified by query()
@@ -0,0 +1,82 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Parameters for the client-side search/query result cache.
+ * The cache is disabled by default. When enabled, results of Search(), Query() and Get() with
+ * SESSION, BOUNDED or EVENTUALLY consistency level are kept in a per-client LRU cache. An entry
+ * is dropped once this client writes newer data into the collection, or the collection schema
+ * cached by SDK is invalidated. Entries of BOUNDED and EVENTUALLY reads also expire after TtlMs().
+ * Reads with STRONG consistency level or with the collection's default level are never cached.
+ */
+class MILVUS_SDK_API ResultCacheParam {
+ public:
+    ResultCacheParam() = default;
+
+    /**
+     * @brief Get memory budget of the cache in bytes, 0 means the cache is disabled.
+     */
+    uint64_t
+    CapacityBytes() const;
+
+    /**
+     * @brief Set memory budget of the cache in bytes, 0 means the cache is disabled.
+     * The budget is estimated from the serialized size of requests and server responses.
+     */
+    void
+    SetCapacityBytes(uint64_t capacity_bytes);
+
+    /**
+     * @brief Set memory budget of the cache in bytes, 0 means the cache is disabled.
+     * The budget is estimated from the serialized size of requests and server responses.
+     */
+    ResultCacheParam&
+    WithCapacityBytes(uint64_t capacity_bytes);
+
+    /**
+     * @brief Get time-to-live in milliseconds for results of BOUNDED and EVENTUALLY reads.
+     */
+    uint64_t
+    TtlMs() const;
+
+    /**
+     * @brief Set time-to-live in milliseconds for results of BOUNDED and EVENTUALLY reads.
+     * @param ttl_ms the time-to-live, must be greater than 0.
+     */
+    void
+    SetTtlMs(uint64_t ttl_ms);
+
+    /**
+     * @brief Set time-to-live in milliseconds for results of BOUNDED and EVENTUALLY reads.
+     * @param ttl_ms the time-to-live, must be greater than 0.
+     */
+    ResultCacheParam&
+    WithTtlMs(uint64_t ttl_ms);
+
+ private:
+    uint64_t capacity_bytes_ = 0;
+    uint64_t ttl_ms_ = 1000;  // uints: millisecond
+};
+
+}  // namespace milvus
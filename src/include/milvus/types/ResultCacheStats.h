@@ -0,0 +1,90 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "milvus/Export.h"
+
+namespace milvus {
+
+/**
+ * @brief Statistics of the client-side search/query result cache, returned by
+ * MilvusClientV2::GetResultCacheStats().
+ */
+class MILVUS_SDK_API ResultCacheStats {
+ public:
+    ResultCacheStats() = default;
+
+    /**
+     * @brief Constructor
+     */
+    ResultCacheStats(uint64_t hits, uint64_t misses, uint64_t evictions, uint64_t invalidations, uint64_t entries,
+                     uint64_t bytes);
+
+    /**
+     * @brief Number of reads served from the cache.
+     */
+    uint64_t
+    Hits() const;
+
+    /**
+     * @brief Number of cacheable reads that were sent to the server.
+     */
+    uint64_t
+    Misses() const;
+
+    /**
+     * @brief Number of entries dropped to keep the cache within its memory budget.
+     */
+    uint64_t
+    Evictions() const;
+
+    /**
+     * @brief Number of entries dropped because of newer writes, schema changes or expiration.
+     */
+    uint64_t
+    Invalidations() const;
+
+    /**
+     * @brief Number of entries currently in the cache.
+     */
+    uint64_t
+    Entries() const;
+
+    /**
+     * @brief Estimated memory usage of the cache in bytes.
+     */
+    uint64_t
+    Bytes() const;
+
+    /**
+     * @brief Ratio of hits among all cacheable reads, 0 if there is no cacheable read.
+     */
+    double
+    HitRatio() const;
+
+ private:
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+    uint64_t evictions_{0};
+    uint64_t invalidations_{0};
+    uint64_t entries_{0};
+    uint64_t bytes_{0};
+};
+
+}  // namespace milvus
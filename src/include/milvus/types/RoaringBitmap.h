@@ -180,6 +180,15 @@ class MILVUS_SDK_API RoaringBitmapBuilder {
     std::vector<uint8_t>
     Build() const;
 
+    /**
+     * @brief Same blob as Build(), with the container bodies encoded on up to @a num_threads
+     * workers: the calling thread and helpers from Executor::Default(), capped at the hardware
+     * concurrency and at 16. The bytes do not depend on the worker count; a set too small to
+     * amortise the hand-off is encoded on the calling thread.
+     */
+    std::vector<uint8_t>
+    Build(uint32_t num_threads) const;
+
     /**
      * @brief Same blob as Build(), wrapped as a JSON binary value so it can be handed to
      * QueryArguments::AddFilterTemplate(), SearchArguments::AddFilterTemplate() or
@@ -193,13 +202,22 @@ class MILVUS_SDK_API RoaringBitmapBuilder {
     nlohmann::json
     BuildTemplate() const;
 
+    /**
+     * @brief Same value as BuildTemplate(), built by Build(uint32_t).
+     */
+    nlohmann::json
+    BuildTemplate(uint32_t num_threads) const;
+
  private:
+    void
+    append(uint64_t key);
+
     void
     normalize() const;
 
     // The two's complement bit patterns of the members, sorted ascending as unsigned and
     // deduplicated lazily, so insertion stays O(1) per member and repeated Build() calls do not
-    // re-sort.
+    // re-sort. Members inserted in ascending order are kept normalized as they arrive.
     mutable std::vector<uint64_t> keys_;
     mutable bool normalized_{true};
 };
@@ -24,6 +24,7 @@
 #include "../Status.h"
 #include "Constants.h"
 #include "EmbeddingList.h"
+#include "FilterTemplateArray.h"
 #include "MetricType.h"
 #include "milvus/Export.h"
 
@@ -60,10 +61,19 @@ class MILVUS_SDK_API SearchRequestBase {
      *     filterTemplate = {"age": 3, "city": ["beijing", "shanghai", ......]}
      * Valid value of a template can be:
      *     boolean, numeric, string, array.
+     * The template replaces any json or typed template with the same key.
      */
     Status
     AddFilterTemplate(std::string key, const nlohmann::json& filter_template);
 
+    /**
+     * @brief Add a typed array filter template. Only take effect when filter is not empty.
+     * The values are encoded into the rpc request in bulk without building json nodes, prefer this
+     * overload for long lists. The template replaces any json or typed template with the same key.
+     */
+    Status
+    AddFilterTemplate(std::string key, FilterTemplateArray filter_template);
+
     /**
      * @brief Get filter templates.
      */
@@ -71,7 +81,13 @@ class MILVUS_SDK_API SearchRequestBase {
     FilterTemplates() const;
 
     /**
-     * @brief Set filter templates.
+     * @brief Get typed array filter templates.
+     */
+    const std::unordered_map<std::string, FilterTemplateArray>&
+    TypedFilterTemplates() const;
+
+    /**
+     * @brief Set filter templates, typed array filter templates are cleared.
      */
     Status
     SetFilterTemplates(std::unordered_map<std::string, nlohmann::json>&& filter_templates);
@@ -282,6 +298,12 @@ class MILVUS_SDK_API SearchRequestBase {
     Status
     Validate() const;
 
+    /**
+     * @brief Approximate memory footprint of the request in bytes, the data it carries included.
+     */
+    virtual size_t
+    MemoryUsage() const;
+
     ///////////////////////////////////////////////////////////////////////////////////////
     // deprecated methods
     /**
@@ -384,6 +406,7 @@ class MILVUS_SDK_API SearchRequestBase {
     int64_t limit_{10};
     std::string filter_expression_;
     std::unordered_map<std::string, nlohmann::json> filter_templates_;
+    std::unordered_map<std::string, FilterTemplateArray> typed_filter_templates_;
 
     ::milvus::MetricType metric_type_{::milvus::MetricType::DEFAULT};
 
@@ -46,6 +46,17 @@ struct MILVUS_SDK_API SingleResult {
      */
     SingleResult(const SingleResult& src);
 
+    /**
+     * @brief Move constructor
+     */
+    SingleResult(SingleResult&& src) noexcept;
+
+    SingleResult&
+    operator=(const SingleResult& src);
+
+    SingleResult&
+    operator=(SingleResult&& src) noexcept;
+
     /**
      * @brief Constructor
      * Note: this constructor might throw exception in the cases of:
@@ -144,6 +155,13 @@ struct MILVUS_SDK_API SingleResult {
     void
     Clear();
 
+    /**
+     * @brief Approximate memory footprint of the result in bytes, see Field::MemoryUsage().
+     * A field shared with other results is counted in each of them.
+     */
+    size_t
+    MemoryUsage() const;
+
     SingleResult&
     WithHighlightResults(std::vector<HighlightResults>&& highlight_results);
 
@@ -199,6 +217,12 @@ class MILVUS_SDK_API SearchResults {
     SearchResults&
     WithRecalls(std::vector<float>&& recalls);
 
+    /**
+     * @brief Approximate memory footprint of all the results in bytes, see SingleResult::MemoryUsage().
+     */
+    size_t
+    MemoryUsage() const;
+
  private:
     std::vector<SingleResult> nq_results_{};
     std::vector<float> recalls_{};
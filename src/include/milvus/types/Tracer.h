@@ -0,0 +1,178 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "milvus/Export.h"
+#include "milvus/Status.h"
+
+namespace milvus {
+
+/**
+ * @brief What a Tracer is told about one API call. The sizes of the response and the retries are only known when
+ * the span ends.
+ */
+class MILVUS_SDK_API SpanAttributes {
+ public:
+    SpanAttributes() = default;
+
+    /**
+     * @brief Name of the rpc, such as "Search" or "Insert".
+     */
+    const std::string&
+    RpcName() const;
+
+    void
+    SetRpcName(std::string rpc_name);
+
+    /**
+     * @brief Database of the call, empty for calls that are not bound to a database or use the default one.
+     */
+    const std::string&
+    DatabaseName() const;
+
+    void
+    SetDatabaseName(std::string db_name);
+
+    /**
+     * @brief Collection of the call, empty for calls that are not bound to a collection.
+     */
+    const std::string&
+    CollectionName() const;
+
+    void
+    SetCollectionName(std::string collection_name);
+
+    /**
+     * @brief Number of target vectors of a search, 0 for other calls.
+     */
+    int64_t
+    Nq() const;
+
+    void
+    SetNq(int64_t nq);
+
+    /**
+     * @brief Number of rows of an insert or upsert, 0 for other calls.
+     */
+    int64_t
+    Rows() const;
+
+    void
+    SetRows(int64_t rows);
+
+    /**
+     * @brief Serialized size of the rpc request in bytes.
+     */
+    uint64_t
+    RequestBytes() const;
+
+    void
+    SetRequestBytes(uint64_t bytes);
+
+    /**
+     * @brief Serialized size of the rpc response in bytes, 0 until the span ends.
+     */
+    uint64_t
+    ResponseBytes() const;
+
+    void
+    SetResponseBytes(uint64_t bytes);
+
+    /**
+     * @brief Number of rpc attempts after the first one, 0 until the span ends.
+     */
+    uint32_t
+    Retries() const;
+
+    void
+    SetRetries(uint32_t retries);
+
+ private:
+    std::string rpc_name_;
+    std::string db_name_;
+    std::string collection_name_;
+    int64_t nq_{0};
+    int64_t rows_{0};
+    uint64_t request_bytes_{0};
+    uint64_t response_bytes_{0};
+    uint32_t retries_{0};
+};
+
+/**
+ * @brief The span of one API call, created by Tracer::StartSpan(). Its methods are called on the thread of the call.
+ */
+class MILVUS_SDK_API Span {
+ public:
+    virtual ~Span() = default;
+
+    /**
+     * @brief Add the headers sent with each rpc attempt of the call, such as the W3C "traceparent" of the span, see
+     * Traceparent(). Header names must be lowercase. Called once, right after the span starts.
+     */
+    virtual void
+    InjectHeaders(std::unordered_map<std::string, std::string>& headers);
+
+    /**
+     * @brief Called once when the call ends, with the final attributes and the status of the call.
+     */
+    virtual void
+    End(const SpanAttributes& attributes, const Status& status) = 0;
+};
+
+using SpanPtr = std::unique_ptr<Span>;
+
+/**
+ * @brief Tracing hook of a client, see MilvusClientV2::SetTracer().
+ * A span starts once the rpc request of an API call is built and ends when the call returns, so it covers the rpc
+ * attempts, the backoff between them and the processing of the response. The tracer is called from every thread that
+ * uses the client and must be thread safe.
+ */
+class MILVUS_SDK_API Tracer {
+ public:
+    virtual ~Tracer() = default;
+
+    /**
+     * @brief Start the span of an API call, nullptr skips the call.
+     */
+    virtual SpanPtr
+    StartSpan(const SpanAttributes& attributes) = 0;
+};
+
+using TracerPtr = std::shared_ptr<Tracer>;
+
+/**
+ * @brief Name of the W3C trace context header.
+ */
+extern MILVUS_SDK_API const char* TRACEPARENT_HEADER;
+
+/**
+ * @brief Format a W3C traceparent header value "00-{trace_id}-{span_id}-{flags}".
+ *
+ * @param [in] trace_id 32 lowercase hex digits, not all zero
+ * @param [in] span_id 16 lowercase hex digits of the parent span, not all zero
+ * @param [in] sampled whether the trace is sampled
+ * @return the header value, empty if an id is malformed
+ */
+MILVUS_SDK_API std::string
+Traceparent(const std::string& trace_id, const std::string& span_id, bool sampled);
+
+}  // namespace milvus
@@ -0,0 +1,71 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "milvus/Export.h"
+#include "milvus/Status.h"
+#include "milvus/types/Function.h"
+#include "milvus/types/FunctionScore.h"
+#include "milvus/types/MetricType.h"
+#include "milvus/types/SearchResults.h"
+
+namespace milvus {
+
+/**
+ * @brief One ranked list for RerankResults(), typically the result of one query of Search() or a list built
+ * from an external engine. The result must outlive the RerankResults() call.
+ */
+struct MILVUS_SDK_API RerankInput {
+    const SingleResult* result = nullptr;
+    /**
+     * The metric of the scores, used to normalize them for weighted rerank. For DEFAULT the scores are
+     * min-max scaled, in their ranking direction.
+     */
+    MetricType metric_type = MetricType::DEFAULT;
+};
+
+/**
+ * @brief Rerank several ranked lists on the client with a RRFRerank or WeightedRerank function, the same
+ * functions HybridSearch() sends to the server, so that lists from different collections or engines can be
+ * fused.
+ *
+ * Hits are deduplicated by primary key, the lists must all use int or all use string primary keys. For weighted
+ * rerank the scores are normalized per metric type unless the params of the function set "norm_score" to
+ * false. The result has the primary key and score names of the first list, and keeps the output fields that
+ * all lists have, copied from the list where each primary key first appears.
+ *
+ * @param [in] ranker a RRFRerank or WeightedRerank function, a weighted one has one weight per list
+ * @param [in] inputs the ranked lists
+ * @param [in] limit the maximum number of hits to return
+ * @param [out] result the fused ranking
+ */
+MILVUS_SDK_API Status
+RerankResults(const FunctionPtr& ranker, const std::vector<RerankInput>& inputs, int64_t limit,
+              SingleResult& result);
+
+/**
+ * @brief Rerank several ranked lists on the client, the function score must hold one RRFRerank or
+ * WeightedRerank function. See the overload with FunctionPtr.
+ */
+MILVUS_SDK_API Status
+RerankResults(const FunctionScorePtr& function_score, const std::vector<RerankInput>& inputs, int64_t limit,
+              SingleResult& result);
+
+}  // namespace milvus
@@ -0,0 +1,258 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "milvus/types/CollectionSchema.h"
+#include "milvus/types/FieldData.h"
+#include "milvus/types/FieldSchema.h"
+#include "milvus/utils/FP16.h"
+
+namespace milvus {
+namespace bench {
+
+// Benchmarks take their data shape from the arguments: rows, vector dimension and whether every fourth row
+// is null. The generators are seeded, so every run measures the same data.
+struct DataShape {
+    size_t rows_ = 0;
+    size_t dim_ = 0;
+    bool nullable_ = false;
+};
+
+inline DataShape
+ShapeOf(const benchmark::State& state) {
+    DataShape shape;
+    shape.rows_ = static_cast<size_t>(state.range(0));
+    shape.dim_ = static_cast<size_t>(state.range(1));
+    shape.nullable_ = state.range(2) != 0;
+    return shape;
+}
+
+inline void
+ApplyShapeArgs(benchmark::internal::Benchmark* bench, const std::vector<int64_t>& dims) {
+    bench->ArgNames({"rows", "dim", "nullable"});
+    bench->ArgsProduct({{1000, 10000}, dims, {0, 1}});
+}
+
+inline void
+ScalarShapes(benchmark::internal::Benchmark* bench) {
+    ApplyShapeArgs(bench, {1});
+}
+
+inline void
+VectorShapes(benchmark::internal::Benchmark* bench) {
+    ApplyShapeArgs(bench, {128, 768});
+}
+
+inline bool
+IsNullRow(const DataShape& shape, size_t row) {
+    return shape.nullable_ && row % 4 == 3;
+}
+
+template <typename FieldDataT, typename Gen>
+FieldDataPtr
+MakeColumn(const std::string& name, const DataShape& shape, Gen gen) {
+    std::vector<typename FieldDataT::ElementT> data;
+    std::vector<bool> valid_data;
+    data.reserve(shape.rows_);
+    for (size_t i = 0; i < shape.rows_; ++i) {
+        const bool is_null = IsNullRow(shape, i);
+        data.emplace_back(is_null ? typename FieldDataT::ElementT{} : gen(i));
+        if (shape.nullable_) {
+            valid_data.push_back(!is_null);
+        }
+    }
+    return std::make_shared<FieldDataT>(name, std::move(data), std::move(valid_data));
+}
+
+inline std::vector<float>
+RandomFloats(std::mt19937& rng, size_t count) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> values(count);
+    for (auto& value : values) {
+        value = dist(rng);
+    }
+    return values;
+}
+
+// The schema of one generated field, vector fields use shape.dim_.
+inline FieldSchema
+MakeFieldSchema(const std::string& name, DataType data_type, const DataShape& shape,
+                DataType element_type = DataType::INT64) {
+    FieldSchema schema(name, data_type);
+    schema.SetNullable(shape.nullable_);
+    switch (data_type) {
+        case DataType::VARCHAR:
+        case DataType::TEXT:
+            schema.SetMaxLength(256);
+            break;
+        case DataType::ARRAY:
+            schema.SetElementType(element_type);
+            schema.SetMaxCapacity(16);
+            schema.SetMaxLength(64);
+            break;
+        case DataType::BINARY_VECTOR:
+        case DataType::FLOAT_VECTOR:
+        case DataType::FLOAT16_VECTOR:
+        case DataType::BFLOAT16_VECTOR:
+        case DataType::INT8_VECTOR:
+            schema.SetDimension(static_cast<uint32_t>(shape.dim_));
+            break;
+        default:
+            break;
+    }
+    return schema;
+}
+
+// A column of the given type, arrays use element_type.
+inline FieldDataPtr
+MakeFieldData(const std::string& name, DataType data_type, const DataShape& shape,
+              DataType element_type = DataType::INT64) {
+    std::mt19937 rng(static_cast<uint32_t>(shape.rows_ * 31 + shape.dim_));
+    const auto dim = shape.dim_;
+    switch (data_type) {
+        case DataType::BOOL:
+            return MakeColumn<BoolFieldData>(name, shape, [](size_t i) { return i % 2 == 0; });
+        case DataType::INT8:
+            return MakeColumn<Int8FieldData>(name, shape, [](size_t i) { return static_cast<int8_t>(i); });
+        case DataType::INT16:
+            return MakeColumn<Int16FieldData>(name, shape, [](size_t i) { return static_cast<int16_t>(i); });
+        case DataType::INT32:
+            return MakeColumn<Int32FieldData>(name, shape, [](size_t i) { return static_cast<int32_t>(i); });
+        case DataType::INT64:
+            return MakeColumn<Int64FieldData>(name, shape, [](size_t i) { return static_cast<int64_t>(i); });
+        case DataType::FLOAT:
+            return MakeColumn<FloatFieldData>(name, shape, [](size_t i) { return static_cast<float>(i) * 0.5f; });
+        case DataType::DOUBLE:
+            return MakeColumn<DoubleFieldData>(name, shape, [](size_t i) { return static_cast<double>(i) * 0.5; });
+        case DataType::VARCHAR:
+        case DataType::TEXT:
+            return MakeColumn<VarCharFieldData>(name, shape,
+                                                [](size_t i) { return "varchar value of row " + std::to_string(i); });
+        case DataType::GEOMETRY:
+            return MakeColumn<GeometryFieldData>(name, shape, [](size_t i) {
+                return "POINT (" + std::to_string(i % 180) + " " + std::to_string(i % 90) + ")";
+            });
+        case DataType::TIMESTAMPTZ:
+            return MakeColumn<TimestamptzFieldData>(name, shape, [](size_t i) {
+                return "2025-01-01T00:00:" + std::string(i % 60 < 10 ? "0" : "") + std::to_string(i % 60) + "Z";
+            });
+        case DataType::JSON:
+            return MakeColumn<JSONFieldData>(name, shape, [](size_t i) {
+                return nlohmann::json{{"id", i}, {"tag", "t" + std::to_string(i % 16)}, {"score", i * 0.25}};
+            });
+        case DataType::ARRAY:
+            if (element_type == DataType::VARCHAR) {
+                return MakeColumn<ArrayVarCharFieldData>(name, shape, [](size_t i) {
+                    std::vector<std::string> values;
+                    for (size_t k = 0; k < 8; ++k) {
+                        values.push_back("e" + std::to_string(i + k));
+                    }
+                    return values;
+                });
+            }
+            return MakeColumn<ArrayInt64FieldData>(name, shape, [](size_t i) {
+                std::vector<int64_t> values;
+                for (size_t k = 0; k < 8; ++k) {
+                    values.push_back(static_cast<int64_t>(i + k));
+                }
+                return values;
+            });
+        case DataType::BINARY_VECTOR:
+            return MakeColumn<BinaryVecFieldData>(name, shape, [dim, &rng](size_t) {
+                std::vector<uint8_t> bytes(dim / 8);
+                for (auto& byte : bytes) {
+                    byte = static_cast<uint8_t>(rng());
+                }
+                return bytes;
+            });
+        case DataType::FLOAT_VECTOR:
+            return MakeColumn<FloatVecFieldData>(name, shape, [dim, &rng](size_t) { return RandomFloats(rng, dim); });
+        case DataType::FLOAT16_VECTOR:
+            return MakeColumn<Float16VecFieldData>(
+                name, shape, [dim, &rng](size_t) { return ArrayF32toF16(RandomFloats(rng, dim)); });
+        case DataType::BFLOAT16_VECTOR:
+            return MakeColumn<BFloat16VecFieldData>(
+                name, shape, [dim, &rng](size_t) { return ArrayF32toBF16(RandomFloats(rng, dim)); });
+        case DataType::INT8_VECTOR:
+            return MakeColumn<Int8VecFieldData>(name, shape, [dim, &rng](size_t) {
+                std::vector<int8_t> values(dim);
+                for (auto& value : values) {
+                    value = static_cast<int8_t>(rng());
+                }
+                return values;
+            });
+        case DataType::SPARSE_FLOAT_VECTOR:
+            return MakeColumn<SparseFloatVecFieldData>(name, shape, [dim, &rng](size_t) {
+                std::map<uint32_t, float> values;
+                const auto nnz = std::min<size_t>(dim, 32);
+                while (values.size() < nnz) {
+                    values[static_cast<uint32_t>(rng() % (dim * 64))] = 0.5f;
+                }
+                return values;
+            });
+        default:
+            return nullptr;
+    }
+}
+
+// The schema and rows for CheckAndSetRowData(): a primary key, a float vector, a varchar, a json and an array.
+inline CollectionSchema
+MakeRowSchema(const DataShape& shape) {
+    CollectionSchema schema("bench");
+    schema.AddField(FieldSchema("id", DataType::INT64, "", true, false));
+    schema.AddField(MakeFieldSchema("vector", DataType::FLOAT_VECTOR, DataShape{shape.rows_, shape.dim_, false}));
+    schema.AddField(MakeFieldSchema("name", DataType::VARCHAR, shape));
+    schema.AddField(MakeFieldSchema("meta", DataType::JSON, shape));
+    schema.AddField(MakeFieldSchema("tags", DataType::ARRAY, shape, DataType::INT64));
+    return schema;
+}
+
+inline EntityRows
+MakeRows(const DataShape& shape) {
+    std::mt19937 rng(static_cast<uint32_t>(shape.rows_));
+    EntityRows rows;
+    rows.reserve(shape.rows_);
+    for (size_t i = 0; i < shape.rows_; ++i) {
+        EntityRow row;
+        row["id"] = static_cast<int64_t>(i);
+        row["vector"] = RandomFloats(rng, shape.dim_);
+        if (IsNullRow(shape, i)) {
+            row["name"] = nullptr;
+            row["meta"] = nullptr;
+            row["tags"] = nullptr;
+        } else {
+            row["name"] = "name of row " + std::to_string(i);
+            row["meta"] = nlohmann::json{{"id", i}, {"tag", "t" + std::to_string(i % 16)}};
+            row["tags"] = std::vector<int64_t>{static_cast<int64_t>(i), static_cast<int64_t>(i + 1)};
+        }
+        rows.emplace_back(std::move(row));
+    }
+    return rows;
+}
+
+}  // namespace bench
+}  // namespace milvus
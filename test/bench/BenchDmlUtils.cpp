@@ -0,0 +1,101 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "BenchData.h"
+#include "utils/DmlUtils.h"
+
+namespace {
+
+using milvus::DataType;
+using milvus::bench::ShapeOf;
+
+// Encode one generated column, the schema has only that field.
+void
+BM_CreateProtoFieldDatas(benchmark::State& state, DataType data_type, DataType element_type) {
+    const auto shape = ShapeOf(state);
+    milvus::CollectionSchema schema("bench");
+    schema.AddField(milvus::bench::MakeFieldSchema("field", data_type, shape, element_type));
+    const std::vector<milvus::FieldDataPtr> columns{
+        milvus::bench::MakeFieldData("field", data_type, shape, element_type)};
+
+    for (auto _ : state) {
+        std::vector<milvus::proto::schema::FieldData> rpc_fields;
+        auto status = milvus::CreateProtoFieldDatas(schema, columns, rpc_fields);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(rpc_fields.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+
+using milvus::bench::ScalarShapes;
+using milvus::bench::VectorShapes;
+
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, bool, DataType::BOOL, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, int8, DataType::INT8, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, int16, DataType::INT16, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, int32, DataType::INT32, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, int64, DataType::INT64, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, float, DataType::FLOAT, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, double, DataType::DOUBLE, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, varchar, DataType::VARCHAR, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, text, DataType::TEXT, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, geometry, DataType::GEOMETRY, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, timestamptz, DataType::TIMESTAMPTZ, DataType::UNKNOWN)
+    ->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, json, DataType::JSON, DataType::UNKNOWN)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, array_int64, DataType::ARRAY, DataType::INT64)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, array_varchar, DataType::ARRAY, DataType::VARCHAR)->Apply(ScalarShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, binary_vector, DataType::BINARY_VECTOR, DataType::UNKNOWN)
+    ->Apply(VectorShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, float_vector, DataType::FLOAT_VECTOR, DataType::UNKNOWN)
+    ->Apply(VectorShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, float16_vector, DataType::FLOAT16_VECTOR, DataType::UNKNOWN)
+    ->Apply(VectorShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, bfloat16_vector, DataType::BFLOAT16_VECTOR, DataType::UNKNOWN)
+    ->Apply(VectorShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, int8_vector, DataType::INT8_VECTOR, DataType::UNKNOWN)
+    ->Apply(VectorShapes);
+BENCHMARK_CAPTURE(BM_CreateProtoFieldDatas, sparse_vector, DataType::SPARSE_FLOAT_VECTOR, DataType::UNKNOWN)
+    ->Apply(VectorShapes);
+
+void
+BM_CheckAndSetRowData(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    const auto schema = milvus::bench::MakeRowSchema(shape);
+    const auto rows = milvus::bench::MakeRows(shape);
+
+    for (auto _ : state) {
+        std::vector<milvus::proto::schema::FieldData> rpc_fields;
+        auto status = milvus::CheckAndSetRowData(rows, schema, false, false, rpc_fields);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(rpc_fields.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+BENCHMARK(BM_CheckAndSetRowData)->Apply(VectorShapes);
+
+}  // namespace
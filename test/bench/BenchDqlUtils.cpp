@@ -0,0 +1,222 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "BenchData.h"
+#include "milvus/request/dql/SearchRequest.h"
+#include "milvus/types/QueryResults.h"
+#include "milvus/types/SearchResults.h"
+#include "utils/DmlUtils.h"
+#include "utils/DqlUtils.h"
+
+namespace {
+
+using milvus::DataType;
+using milvus::bench::DataShape;
+using milvus::bench::ShapeOf;
+using milvus::bench::VectorShapes;
+
+constexpr size_t kQueries = 10;
+
+// The output fields of the result benchmarks: a primary key, a float vector, a varchar and a json, only the
+// scalars follow shape.nullable_.
+std::vector<milvus::FieldDataPtr>
+MakeOutputFields(const DataShape& shape) {
+    const DataShape fixed_shape{shape.rows_, shape.dim_, false};
+    return {
+        milvus::bench::MakeFieldData("id", DataType::INT64, fixed_shape),
+        milvus::bench::MakeFieldData("vector", DataType::FLOAT_VECTOR, fixed_shape),
+        milvus::bench::MakeFieldData("name", DataType::VARCHAR, shape),
+        milvus::bench::MakeFieldData("meta", DataType::JSON, shape),
+    };
+}
+
+milvus::CollectionSchema
+MakeOutputSchema(const DataShape& shape) {
+    milvus::CollectionSchema schema("bench");
+    schema.AddField(milvus::FieldSchema("id", DataType::INT64, "", true, false));
+    schema.AddField(
+        milvus::bench::MakeFieldSchema("vector", DataType::FLOAT_VECTOR, DataShape{shape.rows_, shape.dim_, false}));
+    schema.AddField(milvus::bench::MakeFieldSchema("name", DataType::VARCHAR, shape));
+    schema.AddField(milvus::bench::MakeFieldSchema("meta", DataType::JSON, shape));
+    return schema;
+}
+
+milvus::Status
+EncodeOutputFields(const DataShape& shape,
+                   ::google::protobuf::RepeatedPtrField<milvus::proto::schema::FieldData>* fields_data) {
+    std::vector<milvus::proto::schema::FieldData> rpc_fields;
+    auto status = milvus::CreateProtoFieldDatas(MakeOutputSchema(shape), MakeOutputFields(shape), rpc_fields);
+    for (auto& rpc_field : rpc_fields) {
+        fields_data->Add(std::move(rpc_field));
+    }
+    return status;
+}
+
+// rows is the number of query vectors here
+void
+BM_ConvertSearchRequest(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    std::mt19937 rng(1);
+    milvus::SearchRequest request;
+    request.WithCollectionName("bench").WithAnnsField("vector").WithFilter("id > 0").WithLimit(10);
+    for (size_t i = 0; i < shape.rows_; ++i) {
+        request.AddFloatVector(milvus::bench::RandomFloats(rng, shape.dim_));
+    }
+
+    for (auto _ : state) {
+        milvus::proto::milvus::SearchRequest rpc_request;
+        auto status = milvus::ConvertSearchRequest<milvus::SearchRequest>(request, "default", rpc_request);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(rpc_request.placeholder_group().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+BENCHMARK(BM_ConvertSearchRequest)->ArgNames({"rows", "dim", "nullable"})->ArgsProduct({{1, 100}, {128, 768}, {0}});
+
+void
+BM_SetTargetVectors(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    const auto vectors =
+        milvus::bench::MakeFieldData("vector", DataType::FLOAT_VECTOR, DataShape{shape.rows_, shape.dim_, false});
+
+    for (auto _ : state) {
+        milvus::proto::milvus::SearchRequest rpc_request;
+        auto status = milvus::SetTargetVectors(vectors, &rpc_request);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(rpc_request.placeholder_group().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+BENCHMARK(BM_SetTargetVectors)->ArgNames({"rows", "dim", "nullable"})->ArgsProduct({{1, 100}, {128, 768}, {0}});
+
+// rows hits spread over kQueries queries
+void
+BM_ConvertSearchResults(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    milvus::proto::milvus::SearchResults rpc_results;
+    auto* data = rpc_results.mutable_results();
+    data->set_num_queries(kQueries);
+    data->set_top_k(static_cast<int64_t>(shape.rows_ / kQueries));
+    data->set_primary_field_name("id");
+    for (size_t q = 0; q < kQueries; ++q) {
+        data->add_topks(static_cast<int64_t>(shape.rows_ / kQueries));
+    }
+    for (size_t i = 0; i < shape.rows_; ++i) {
+        data->mutable_ids()->mutable_int_id()->add_data(static_cast<int64_t>(i));
+        data->add_scores(1.0f - static_cast<float>(i % (shape.rows_ / kQueries)) * 0.001f);
+    }
+    for (const auto* name : {"vector", "name", "meta"}) {
+        data->add_output_fields(name);
+    }
+    auto status = EncodeOutputFields(shape, data->mutable_fields_data());
+    if (!status.IsOk()) {
+        state.SkipWithError(status.Message().c_str());
+        return;
+    }
+
+    for (auto _ : state) {
+        milvus::SearchResults results;
+        status = milvus::ConvertSearchResults(rpc_results, "id", results);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(results.Results().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+BENCHMARK(BM_ConvertSearchResults)->Apply(VectorShapes);
+
+void
+BM_ConvertQueryResults(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    milvus::proto::milvus::QueryResults rpc_results;
+    for (const auto* name : {"id", "vector", "name", "meta"}) {
+        rpc_results.add_output_fields(name);
+    }
+    auto status = EncodeOutputFields(shape, rpc_results.mutable_fields_data());
+    if (!status.IsOk()) {
+        state.SkipWithError(status.Message().c_str());
+        return;
+    }
+
+    for (auto _ : state) {
+        milvus::QueryResults results;
+        status = milvus::ConvertQueryResults(rpc_results, results);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(results.GetRowCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+BENCHMARK(BM_ConvertQueryResults)->Apply(VectorShapes);
+
+void
+BM_GetRowsFromFieldsData(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    const auto fields = MakeOutputFields(shape);
+    const std::set<std::string> output_names{"id", "vector", "name", "meta"};
+
+    for (auto _ : state) {
+        milvus::EntityRows rows;
+        auto status = milvus::GetRowsFromFieldsData(fields, output_names, rows);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+}
+BENCHMARK(BM_GetRowsFromFieldsData)->Apply(VectorShapes);
+
+// copies the middle half of the rows, a page of an iterator
+void
+BM_CopyFieldsData(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    const auto fields = MakeOutputFields(shape);
+    const auto from = shape.rows_ / 4;
+    const auto to = shape.rows_ * 3 / 4;
+
+    for (auto _ : state) {
+        std::vector<milvus::FieldDataPtr> target;
+        auto status = milvus::CopyFieldsData(fields, from, to, target);
+        if (!status.IsOk()) {
+            state.SkipWithError(status.Message().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(target.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (to - from)));
+}
+BENCHMARK(BM_CopyFieldsData)->Apply(VectorShapes);
+
+}  // namespace
@@ -0,0 +1,225 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchData.h"
+#include "milvus/types/BloomFilter.h"
+#include "milvus/types/RoaringBitmap.h"
+#include "milvus/utils/FP16.h"
+#include "utils/IDsEncodingUtils.h"
+#include "utils/RerankUtils.h"
+
+namespace {
+
+using milvus::bench::DataShape;
+using milvus::bench::ShapeOf;
+
+std::vector<int64_t>
+MakeIds(size_t count, bool dense) {
+    std::mt19937_64 rng(count);
+    std::vector<int64_t> ids(count);
+    for (size_t i = 0; i < count; ++i) {
+        // dense ids fill bitmap containers, sparse ones spread over the int64 range
+        ids[i] = dense ? static_cast<int64_t>(i) : static_cast<int64_t>(rng() >> 1);
+    }
+    return ids;
+}
+
+void
+CountRowsAndValues(benchmark::State& state, const DataShape& shape) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.rows_));
+    state.counters["values"] = static_cast<double>(shape.rows_ * shape.dim_);
+}
+
+void
+BM_ArrayF32toF16(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    std::mt19937 rng(1);
+    const auto values = milvus::bench::RandomFloats(rng, shape.rows_ * shape.dim_);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(milvus::ArrayF32toF16(values));
+    }
+    CountRowsAndValues(state, shape);
+}
+
+void
+BM_ArrayF16toF32(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    std::mt19937 rng(1);
+    const auto values = milvus::ArrayF32toF16(milvus::bench::RandomFloats(rng, shape.rows_ * shape.dim_));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(milvus::ArrayF16toF32(values));
+    }
+    CountRowsAndValues(state, shape);
+}
+
+void
+BM_ArrayF32toBF16(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    std::mt19937 rng(1);
+    const auto values = milvus::bench::RandomFloats(rng, shape.rows_ * shape.dim_);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(milvus::ArrayF32toBF16(values));
+    }
+    CountRowsAndValues(state, shape);
+}
+
+void
+BM_ArrayBF16toF32(benchmark::State& state) {
+    const auto shape = ShapeOf(state);
+    std::mt19937 rng(1);
+    const auto values = milvus::ArrayF32toBF16(milvus::bench::RandomFloats(rng, shape.rows_ * shape.dim_));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(milvus::ArrayBF16toF32(values));
+    }
+    CountRowsAndValues(state, shape);
+}
+
+void
+FP16Shapes(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"rows", "dim", "nullable"});
+    bench->ArgsProduct({{1000, 10000}, {128, 768}, {0}});
+}
+
+BENCHMARK(BM_ArrayF32toF16)->Apply(FP16Shapes);
+BENCHMARK(BM_ArrayF16toF32)->Apply(FP16Shapes);
+BENCHMARK(BM_ArrayF32toBF16)->Apply(FP16Shapes);
+BENCHMARK(BM_ArrayBF16toF32)->Apply(FP16Shapes);
+
+void
+BM_BloomFilterBuilderInt64(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto threads = static_cast<uint32_t>(state.range(1));
+    const auto ids = MakeIds(count, false);
+    for (auto _ : state) {
+        milvus::BloomFilterBuilder builder(count);
+        builder.AddInt64s(ids, threads);
+        benchmark::DoNotOptimize(builder.Build());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_BloomFilterBuilderInt64)->ArgNames({"ids", "threads"})->ArgsProduct({{10000, 1000000}, {1, 4}});
+
+void
+BM_BloomFilterBuilderString(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (auto id : MakeIds(count, false)) {
+        keys.push_back("key-" + std::to_string(id));
+    }
+    for (auto _ : state) {
+        milvus::BloomFilterBuilder builder(count);
+        builder.AddStrings(keys);
+        benchmark::DoNotOptimize(builder.Build());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_BloomFilterBuilderString)->ArgNames({"keys"})->Arg(10000)->Arg(1000000);
+
+void
+BM_RoaringBitmapBuilder(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto ids = MakeIds(count, state.range(1) != 0);
+    for (auto _ : state) {
+        milvus::RoaringBitmapBuilder builder;
+        builder.AddInt64s(ids);
+        benchmark::DoNotOptimize(builder.Build());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_RoaringBitmapBuilder)->ArgNames({"ids", "dense"})->ArgsProduct({{10000, 1000000}, {0, 1}});
+
+// id sets of BM_BuildIDsFilter: dense, every seventh id, or sparse like snowflake ids
+std::vector<int64_t>
+MakeIdSet(size_t count, int64_t kind) {
+    if (kind == 2) {
+        return MakeIds(count, false);
+    }
+    auto ids = MakeIds(count, true);
+    if (kind == 1) {
+        for (auto& id : ids) {
+            id *= 7;
+        }
+    }
+    return ids;
+}
+
+// what each encoding costs over the id sets, so a change of the AUTO thresholds can be judged against numbers
+void
+BM_BuildIDsFilter(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const milvus::IDArray ids(MakeIdSet(count, state.range(1)));
+    const auto encoding = static_cast<milvus::IDsEncoding>(state.range(2));
+    milvus::IDsFilter filter;
+    for (auto _ : state) {
+        filter = milvus::IDsFilter();
+        benchmark::DoNotOptimize(milvus::BuildIDsFilter(ids, "id", "ids", encoding, false, filter));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+    state.counters["list_bytes"] = static_cast<double>(milvus::EstimateIDsListSize(ids));
+    state.counters["encoded_bytes"] = filter.encoding == milvus::IDsEncoding::LIST
+                                          ? static_cast<double>(milvus::EstimateIDsListSize(ids))
+                                          : static_cast<double>(filter.blob.get_binary().size());
+    state.counters["chosen"] = static_cast<double>(filter.encoding);
+}
+BENCHMARK(BM_BuildIDsFilter)
+    ->ArgNames({"ids", "set", "encoding"})
+    ->ArgsProduct({{200000},
+                   {0, 1, 2},
+                   {static_cast<int64_t>(milvus::IDsEncoding::ROARING_BITMAP),
+                    static_cast<int64_t>(milvus::IDsEncoding::BLOOM_PREFILTER),
+                    static_cast<int64_t>(milvus::IDsEncoding::AUTO)}});
+
+void
+BM_FuseRankedLists(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    milvus::RerankParams params;
+    if (state.range(1) != 0) {
+        params.strategy_ = milvus::RerankStrategy::WEIGHTED;
+        params.weights_ = {0.5f, 0.3f, 0.2f};
+    }
+    std::mt19937_64 rng(count);
+    std::vector<std::vector<int64_t>> ids(3);
+    std::vector<std::vector<float>> scores(3);
+    const milvus::MetricType metrics[] = {milvus::MetricType::COSINE, milvus::MetricType::BM25,
+                                          milvus::MetricType::DEFAULT};
+    std::vector<milvus::RerankList> lists;
+    for (size_t l = 0; l < ids.size(); ++l) {
+        for (size_t i = 0; i < count; ++i) {
+            ids[l].push_back(static_cast<int64_t>(rng() % (count * 2)));
+            scores[l].push_back(1.0f - static_cast<float>(i) / static_cast<float>(count));
+        }
+        milvus::RerankList list;
+        list.int_ids_ = &ids[l];
+        list.scores_ = &scores[l];
+        list.metric_type_ = metrics[l];
+        lists.push_back(list);
+    }
+    std::vector<milvus::FusedHit> hits;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(milvus::FuseRankedLists(params, lists, 100, hits));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count * lists.size()));
+}
+BENCHMARK(BM_FuseRankedLists)->ArgNames({"candidates", "weighted"})->ArgsProduct({{1000, 100000}, {0, 1}});
+
+}  // namespace
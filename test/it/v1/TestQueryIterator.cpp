@@ -189,6 +189,99 @@ TEST_F(MilvusMockedTest, QueryIterator) {
     }
 }
 
+TEST_F(MilvusMockedTest, QueryIteratorWithPrefetch) {
+    milvus::ConnectParam connect_param{"127.0.0.1", server_.ListenPort()};
+    client_->Connect(connect_param);
+
+    const std::string collection_name = "Foo";
+    milvus::CollectionSchema collection_schema(collection_name);
+    milvus::BuildCollectionSchema(collection_schema);
+
+    const int row_count = 2000;
+    std::vector<milvus::FieldDataPtr> fields_data;
+    milvus::BuildFieldsData(collection_schema, fields_data, row_count);
+
+    EXPECT_CALL(service_,
+                DescribeCollection(_, Property(&DescribeCollectionRequest::collection_name, collection_name), _))
+        .WillOnce([&](::grpc::ServerContext*, const DescribeCollectionRequest*, DescribeCollectionResponse* response) {
+            response->set_collectionid(100);
+            auto proto_schema = response->mutable_schema();
+            milvus::ConvertCollectionSchema(collection_schema, *proto_schema);
+            return ::grpc::Status{};
+        });
+
+    const uint64_t batch_size = 100;
+    const int64_t limit = 1250;
+    uint64_t current_poz = 0;
+    EXPECT_CALL(service_, Query(_, _, _))
+        .WillRepeatedly([&](::grpc::ServerContext*, const QueryRequest* request, QueryResults* response) {
+            for (const auto& pair : request->query_params()) {
+                if (pair.key() == milvus::LIMIT && pair.value() == "1") {
+                    response->set_session_ts(999999);
+                    return ::grpc::Status{};
+                }
+            }
+            EXPECT_EQ(request->guarantee_timestamp(), 999999);
+            if (current_poz > 0) {
+                EXPECT_EQ(request->expr(), " ( id >= 0 )  and " + std::string(milvus::T_PK_NAME) + " > " +
+                                               std::to_string(current_poz - 1));
+            }
+
+            // return one and a half batch, the iterator only keeps the first batch of each page
+            auto from = current_poz;
+            auto to = std::min<uint64_t>(from + batch_size + batch_size / 2, row_count);
+            current_poz = std::min<uint64_t>(from + batch_size, row_count);
+            if (from >= to) {
+                return ::grpc::Status{};
+            }
+
+            milvus::FieldDataPtr page_data;
+            auto status = milvus::CopyFieldData(fields_data.at(0), from, to, page_data);
+            EXPECT_TRUE(status.IsOk());
+            milvus::FieldDataSchema bridge(page_data, nullptr);
+            milvus::proto::schema::FieldData data;
+            status = milvus::CreateProtoFieldData(bridge, data);
+            EXPECT_TRUE(status.IsOk());
+            response->mutable_fields_data()->Add(std::move(data));
+            return ::grpc::Status{};
+        });
+
+    milvus::QueryIteratorArguments arguments{};
+    arguments.SetBatchSize(batch_size);
+    arguments.SetLimit(limit);
+    arguments.SetCollectionName(collection_name);
+    arguments.SetFilter("id >= 0");
+    arguments.AddOutputField(milvus::T_PK_NAME);
+    EXPECT_FALSE(arguments.SetPrefetchDepth(-1).IsOk());
+    EXPECT_TRUE(arguments.SetPrefetchDepth(3).IsOk());
+
+    milvus::QueryIteratorPtr iterator;
+    auto status = client_->QueryIterator(arguments, iterator);
+    ASSERT_TRUE(status.IsOk());
+
+    std::vector<int64_t> ids;
+    while (true) {
+        milvus::QueryResults batch_results;
+        status = iterator->Next(batch_results);
+        ASSERT_TRUE(status.IsOk());
+        if (batch_results.GetRowCount() == 0) {
+            break;
+        }
+        auto id_field = batch_results.OutputField<milvus::Int64FieldData>(milvus::T_PK_NAME);
+        ASSERT_NE(id_field, nullptr);
+        ids.insert(ids.end(), id_field->Data().begin(), id_field->Data().end());
+    }
+
+    auto expected = std::static_pointer_cast<milvus::Int64FieldData>(fields_data.at(0))->Data();
+    expected.resize(limit);
+    EXPECT_EQ(ids, expected);
+
+    auto stats = iterator->PrefetchStats();
+    EXPECT_EQ(stats.Depth(), 3);
+    EXPECT_GE(stats.FetchedPages(), static_cast<uint64_t>(limit / batch_size));
+    EXPECT_GT(stats.Hits() + stats.Misses(), 0);
+}
+
 TEST_F(MilvusMockedTest, QueryIteratorUsesExplicitDatabaseForSchemaAndQuery) {
     milvus::ConnectParam connect_param{"127.0.0.1", server_.ListenPort()};
     ASSERT_TRUE(client_->Connect(connect_param).IsOk());
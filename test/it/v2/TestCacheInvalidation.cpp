@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -475,3 +476,54 @@ TEST_F(UnconnectMilvusMockedTest, V2OptimizeDirectlyDescribesForInitializationAn
     EXPECT_EQ(cached->ID(), 100);
     milvus::SchemaCache::GetInstance().Invalidate(endpoint, "db", "collection");
 }
+
+TEST_F(UnconnectMilvusMockedTest, V2AsyncOptimizeWaitsForCompactionBetweenPolls) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+
+    EXPECT_CALL(service_, DescribeCollection(_, _, _))
+        .Times(2)
+        .WillRepeatedly([](::grpc::ServerContext*, const milvus::proto::milvus::DescribeCollectionRequest*,
+                           milvus::proto::milvus::DescribeCollectionResponse* response) {
+            response->set_collectionid(300);
+            return ::grpc::Status{};
+        });
+    EXPECT_CALL(service_, ManualCompaction(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const milvus::proto::milvus::ManualCompactionRequest*,
+                     milvus::proto::milvus::ManualCompactionResponse* response) {
+            response->set_compactionid(10);
+            return ::grpc::Status{};
+        });
+    // the first state poll finds the compaction running, the task waits for the next poll instead of a thread
+    EXPECT_CALL(service_, GetCompactionState(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const milvus::proto::milvus::GetCompactionStateRequest*,
+                     milvus::proto::milvus::GetCompactionStateResponse* response) {
+            response->set_state(milvus::proto::common::CompactionState::Executing);
+            return ::grpc::Status{};
+        })
+        .WillOnce([](::grpc::ServerContext*, const milvus::proto::milvus::GetCompactionStateRequest*,
+                     milvus::proto::milvus::GetCompactionStateResponse* response) {
+            response->set_state(milvus::proto::common::CompactionState::Completed);
+            return ::grpc::Status{};
+        });
+    EXPECT_CALL(service_, GetLoadState(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const milvus::proto::milvus::GetLoadStateRequest*,
+                     milvus::proto::milvus::GetLoadStateResponse* response) {
+            response->set_state(milvus::proto::common::LoadState::LoadStateNotLoad);
+            return ::grpc::Status{};
+        });
+
+    milvus::OptimizeTaskPtr task;
+    auto status = client->Optimize(
+        milvus::OptimizeRequest().WithDatabaseName("db").WithCollectionName("collection").WithAsync(true), task);
+    ASSERT_TRUE(status.IsOk());
+    ASSERT_NE(task, nullptr);
+
+    milvus::OptimizeResponse response;
+    status = task->GetResult(response, 10000);
+    EXPECT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_TRUE(task->IsDone());
+    EXPECT_EQ(response.CompactionID(), 10);
+    EXPECT_EQ(response.StatusText(), "success");
+    const auto history = task->ProgressHistory();
+    EXPECT_NE(std::find(history.begin(), history.end(), "waiting for compaction"), history.end());
+}
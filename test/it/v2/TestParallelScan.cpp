@@ -0,0 +1,366 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../mocks/MilvusMockedTest.h"
+#include "milvus/MilvusClientV2.h"
+#include "utils/Constants.h"
+#include "utils/cache/SchemaCache.h"
+
+using ::milvus::StatusCode;
+using ::testing::_;
+
+namespace {
+
+const char* kScanCollection = "parallel_scan_foo";
+const uint64_t kScanSessionTs = 999999;
+
+milvus::MilvusClientV2Ptr
+CreateConnectedClient(testing::StrictMock<milvus::MilvusMockedService>& service, uint16_t port) {
+    EXPECT_CALL(service, Connect(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const milvus::proto::milvus::ConnectRequest*,
+                     milvus::proto::milvus::ConnectResponse*) { return ::grpc::Status{}; });
+
+    auto client = milvus::MilvusClientV2::Create();
+    auto status = client->Connect(milvus::ConnectParam{"127.0.0.1", port});
+    EXPECT_TRUE(status.IsOk());
+    return client;
+}
+
+void
+ExpectDescribeScanCollection(testing::StrictMock<milvus::MilvusMockedService>& service) {
+    EXPECT_CALL(service, DescribeCollection(_, _, _))
+        .WillRepeatedly([](::grpc::ServerContext*, const milvus::proto::milvus::DescribeCollectionRequest*,
+                           milvus::proto::milvus::DescribeCollectionResponse* response) {
+            response->set_collectionid(100);
+            auto* field = response->mutable_schema()->add_fields();
+            field->set_name("id");
+            field->set_data_type(milvus::proto::schema::DataType::Int64);
+            field->set_is_primary_key(true);
+            return ::grpc::Status{};
+        });
+}
+
+int64_t
+QueryLimit(const milvus::proto::milvus::QueryRequest& request) {
+    for (const auto& pair : request.query_params()) {
+        if (pair.key() == milvus::LIMIT) {
+            return std::stoll(pair.value());
+        }
+    }
+    return -1;
+}
+
+void
+FillIds(milvus::proto::milvus::QueryResults* response, int64_t from, int64_t to) {
+    auto* field = response->add_fields_data();
+    field->set_field_name("id");
+    field->set_type(milvus::proto::schema::DataType::Int64);
+    auto* data = field->mutable_scalars()->mutable_long_data();
+    for (auto id = from; id < to; ++id) {
+        data->add_data(id);
+    }
+}
+
+void
+CollectIds(const milvus::QueryResults& batch, std::mutex& mutex, std::vector<int64_t>& ids) {
+    auto field = batch.OutputField<milvus::Int64FieldData>("id");
+    ASSERT_NE(field, nullptr);
+    std::lock_guard<std::mutex> lock(mutex);
+    ids.insert(ids.end(), field->Data().begin(), field->Data().end());
+}
+
+}  // namespace
+
+TEST_F(UnconnectMilvusMockedTest, ParallelScanByPkBoundaries) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    ExpectDescribeScanCollection(service_);
+
+    std::atomic<int> probe_count{0};
+    EXPECT_CALL(service_, Query(_, _, _))
+        .WillRepeatedly([&probe_count](::grpc::ServerContext*, const milvus::proto::milvus::QueryRequest* request,
+                                       milvus::proto::milvus::QueryResults* response) {
+            if (QueryLimit(*request) == 1) {
+                // only the first shard fetches the session ts
+                ++probe_count;
+                EXPECT_EQ(request->guarantee_timestamp(), 0u);
+                response->set_session_ts(kScanSessionTs);
+                return ::grpc::Status{};
+            }
+
+            // other shards are pinned to the same snapshot
+            EXPECT_EQ(request->guarantee_timestamp(), kScanSessionTs);
+            const auto& expr = request->expr();
+            if (expr.find("id > ") != std::string::npos) {
+                // the iterator asks for the next page
+                return ::grpc::Status{};
+            }
+
+            const auto& templates = request->expr_template_values();
+            const bool has_lower = templates.count("scan_shard_lower") > 0;
+            const bool has_upper = templates.count("scan_shard_upper") > 0;
+            EXPECT_EQ(has_lower, expr.find("id >= {scan_shard_lower}") != std::string::npos);
+            EXPECT_EQ(has_upper, expr.find("id < {scan_shard_upper}") != std::string::npos);
+            EXPECT_EQ(expr.find("(flag > 0) and ("), 0);
+            if (!has_lower) {
+                EXPECT_EQ(templates.at("scan_shard_upper").int64_val(), 10);
+                FillIds(response, 0, 10);
+            } else if (has_upper) {
+                EXPECT_EQ(templates.at("scan_shard_lower").int64_val(), 10);
+                EXPECT_EQ(templates.at("scan_shard_upper").int64_val(), 20);
+                FillIds(response, 10, 20);
+            } else {
+                EXPECT_EQ(templates.at("scan_shard_lower").int64_val(), 20);
+                FillIds(response, 20, 25);
+            }
+            return ::grpc::Status{};
+        });
+
+    auto request = milvus::ParallelScanRequest()
+                       .WithPkBoundaries(milvus::IDArray(std::vector<int64_t>{10, 20}))
+                       .WithConcurrency(2);
+    request.WithCollectionName(kScanCollection).WithFilter("flag > 0").AddOutputField("id");
+    request.SetBatchSize(100);
+
+    std::mutex mutex;
+    std::vector<int64_t> ids;
+    std::vector<size_t> shards;
+    auto status = client->ParallelScan(request, [&](size_t shard_index, milvus::QueryResults& batch) {
+        CollectIds(batch, mutex, ids);
+        std::lock_guard<std::mutex> lock(mutex);
+        shards.push_back(shard_index);
+        return milvus::Status::OK();
+    });
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(probe_count.load(), 1);
+
+    std::sort(ids.begin(), ids.end());
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 25; ++i) {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(ids, expected);
+    std::sort(shards.begin(), shards.end());
+    EXPECT_EQ(shards, (std::vector<size_t>{0, 1, 2}));
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
+
+TEST_F(UnconnectMilvusMockedTest, ParallelScanByShardCountKeepsNegativeKeys) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    ExpectDescribeScanCollection(service_);
+
+    EXPECT_CALL(service_, Query(_, _, _))
+        .WillRepeatedly([](::grpc::ServerContext*, const milvus::proto::milvus::QueryRequest* request,
+                           milvus::proto::milvus::QueryResults* response) {
+            if (QueryLimit(*request) == 1) {
+                response->set_session_ts(kScanSessionTs);
+                return ::grpc::Status{};
+            }
+            const auto& expr = request->expr();
+            if (expr.find("id > ") != std::string::npos) {
+                return ::grpc::Status{};
+            }
+
+            // evaluate "id % 3 == r" terms like the server, the remainder keeps the sign of the key
+            static const std::string term = "id % 3 == ";
+            std::vector<int64_t> remainders;
+            for (auto pos = expr.find(term); pos != std::string::npos; pos = expr.find(term, pos + 1)) {
+                remainders.push_back(std::stoll(expr.substr(pos + term.size())));
+            }
+            EXPECT_FALSE(remainders.empty());
+            auto* field = response->add_fields_data();
+            field->set_field_name("id");
+            field->set_type(milvus::proto::schema::DataType::Int64);
+            auto* data = field->mutable_scalars()->mutable_long_data();
+            for (int64_t id = -7; id <= 7; ++id) {
+                if (std::find(remainders.begin(), remainders.end(), id % 3) != remainders.end()) {
+                    data->add_data(id);
+                }
+            }
+            return ::grpc::Status{};
+        });
+
+    auto request = milvus::ParallelScanRequest().WithShardCount(3).WithConcurrency(3);
+    request.WithCollectionName(kScanCollection).AddOutputField("id");
+    request.SetBatchSize(100);
+
+    std::mutex mutex;
+    std::vector<int64_t> ids;
+    auto status = client->ParallelScan(request, [&](size_t, milvus::QueryResults& batch) {
+        CollectIds(batch, mutex, ids);
+        return milvus::Status::OK();
+    });
+    EXPECT_TRUE(status.IsOk());
+
+    std::sort(ids.begin(), ids.end());
+    std::vector<int64_t> expected;
+    for (int64_t id = -7; id <= 7; ++id) {
+        expected.push_back(id);
+    }
+    EXPECT_EQ(ids, expected);
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
+
+TEST_F(UnconnectMilvusMockedTest, ParallelScanSplitsPkRangeByRowCount) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    ExpectDescribeScanCollection(service_);
+
+    // one partition of the keys 0 ... 999
+    const int64_t row_count = 1000;
+    EXPECT_CALL(service_, Query(_, _, _))
+        .WillRepeatedly([row_count](::grpc::ServerContext*, const milvus::proto::milvus::QueryRequest* request,
+                                    milvus::proto::milvus::QueryResults* response) {
+            const auto& expr = request->expr();
+            const auto& output_fields = request->output_fields();
+            if (std::find(output_fields.begin(), output_fields.end(), "count(*)") != output_fields.end()) {
+                int64_t count = row_count;
+                const auto pos = expr.find("id < ");
+                if (pos != std::string::npos) {
+                    count = std::max<int64_t>(0, std::min(row_count, std::stoll(expr.substr(pos + 5))));
+                }
+                auto* field = response->add_fields_data();
+                field->set_field_name("count(*)");
+                field->set_type(milvus::proto::schema::DataType::Int64);
+                field->mutable_scalars()->mutable_long_data()->add_data(count);
+                return ::grpc::Status{};
+            }
+            for (const auto& pair : request->query_params()) {
+                if (pair.key() == milvus::ORDER_BY_FIELDS) {
+                    // the smallest or the largest key
+                    const auto first = pair.value() == "id:asc" ? 0 : row_count - 1;
+                    FillIds(response, first, first + 1);
+                    return ::grpc::Status{};
+                }
+            }
+            if (QueryLimit(*request) == 1) {
+                response->set_session_ts(kScanSessionTs);
+                return ::grpc::Status{};
+            }
+            if (expr.find("id > ") != std::string::npos) {
+                return ::grpc::Status{};
+            }
+            const auto& templates = request->expr_template_values();
+            int64_t from = 0;
+            int64_t to = row_count;
+            if (templates.count("scan_shard_lower") > 0) {
+                from = std::max<int64_t>(0, templates.at("scan_shard_lower").int64_val());
+            }
+            if (templates.count("scan_shard_upper") > 0) {
+                to = std::min(row_count, templates.at("scan_shard_upper").int64_val());
+            }
+            FillIds(response, from, std::max(from, to));
+            return ::grpc::Status{};
+        });
+
+    auto request = milvus::ParallelScanRequest().WithConcurrency(4);
+    request.WithCollectionName(kScanCollection).AddOutputField("id");
+    request.SetBatchSize(100);
+
+    std::mutex mutex;
+    std::vector<int64_t> ids;
+    std::vector<size_t> shard_rows(4, 0);
+    auto status = client->ParallelScan(request, [&](size_t shard_index, milvus::QueryResults& batch) {
+        CollectIds(batch, mutex, ids);
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_LT(shard_index, shard_rows.size());
+        if (shard_index < shard_rows.size()) {
+            shard_rows[shard_index] += batch.GetRowCount();
+        }
+        return milvus::Status::OK();
+    });
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+
+    std::sort(ids.begin(), ids.end());
+    std::vector<int64_t> expected;
+    for (int64_t id = 0; id < row_count; ++id) {
+        expected.push_back(id);
+    }
+    EXPECT_EQ(ids, expected);
+    // each range is within a quarter of a shard of the ideal 250 rows
+    for (auto rows : shard_rows) {
+        EXPECT_GE(rows, 250 - 2 * 62);
+        EXPECT_LE(rows, 250 + 2 * 62);
+    }
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
+
+TEST_F(UnconnectMilvusMockedTest, ParallelScanByPartitionsStopsOnCallbackError) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    ExpectDescribeScanCollection(service_);
+
+    EXPECT_CALL(service_, Query(_, _, _))
+        .WillRepeatedly([](::grpc::ServerContext*, const milvus::proto::milvus::QueryRequest* request,
+                           milvus::proto::milvus::QueryResults* response) {
+            if (QueryLimit(*request) == 1) {
+                response->set_session_ts(kScanSessionTs);
+                return ::grpc::Status{};
+            }
+            EXPECT_EQ(request->partition_names_size(), 1);
+            if (request->expr().find("id > ") == std::string::npos) {
+                FillIds(response, 0, 5);
+            }
+            return ::grpc::Status{};
+        });
+
+    auto request = milvus::ParallelScanRequest().WithConcurrency(1);
+    request.WithCollectionName(kScanCollection).AddOutputField("id");
+    request.AddPartitionName("p1");
+    request.AddPartitionName("p2");
+
+    int calls = 0;
+    auto status = client->ParallelScan(request, [&calls](size_t, milvus::QueryResults&) {
+        ++calls;
+        return milvus::Status{StatusCode::UNKNOWN_ERROR, "stop"};
+    });
+    EXPECT_EQ(status.Code(), StatusCode::UNKNOWN_ERROR);
+    EXPECT_EQ(status.Message(), "stop");
+    EXPECT_EQ(calls, 1);
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
+
+TEST_F(UnconnectMilvusMockedTest, ParallelScanInvalidArguments) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    auto on_batch = [](size_t, milvus::QueryResults&) { return milvus::Status::OK(); };
+
+    auto request = milvus::ParallelScanRequest();
+    request.WithCollectionName(kScanCollection);
+    EXPECT_EQ(client->ParallelScan(request, nullptr).Code(), StatusCode::INVALID_ARGUMENT);
+
+    request.SetLimit(10);
+    EXPECT_EQ(client->ParallelScan(request, on_batch).Code(), StatusCode::INVALID_ARGUMENT);
+
+    request.SetLimit(-1);
+    ExpectDescribeScanCollection(service_);
+    request.SetPkBoundaries(milvus::IDArray(std::vector<int64_t>{20, 10}));
+    EXPECT_EQ(client->ParallelScan(request, on_batch).Code(), StatusCode::INVALID_ARGUMENT);
+
+    request.SetPkBoundaries(milvus::IDArray(std::vector<std::string>{"a"}));
+    EXPECT_EQ(client->ParallelScan(request, on_batch).Code(), StatusCode::INVALID_ARGUMENT);
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
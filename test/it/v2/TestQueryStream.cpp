@@ -0,0 +1,143 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../mocks/MilvusMockedTest.h"
+#include "milvus/MilvusClientV2.h"
+#include "utils/Constants.h"
+#include "utils/cache/SchemaCache.h"
+
+using ::milvus::StatusCode;
+using ::testing::_;
+
+namespace {
+
+const char* kStreamCollection = "query_stream_foo";
+const int64_t kStreamRows = 5;
+
+milvus::MilvusClientV2Ptr
+CreateConnectedClient(testing::StrictMock<milvus::MilvusMockedService>& service, uint16_t port) {
+    EXPECT_CALL(service, Connect(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const milvus::proto::milvus::ConnectRequest*,
+                     milvus::proto::milvus::ConnectResponse*) { return ::grpc::Status{}; });
+
+    auto client = milvus::MilvusClientV2::Create();
+    auto status = client->Connect(milvus::ConnectParam{"127.0.0.1", port});
+    EXPECT_TRUE(status.IsOk());
+    return client;
+}
+
+// serve rows [0, kStreamRows) page by page, the iterator moves the cursor by "id > last"
+void
+ExpectStreamQueries(testing::StrictMock<milvus::MilvusMockedService>& service) {
+    EXPECT_CALL(service, DescribeCollection(_, _, _))
+        .WillRepeatedly([](::grpc::ServerContext*, const milvus::proto::milvus::DescribeCollectionRequest*,
+                           milvus::proto::milvus::DescribeCollectionResponse* response) {
+            response->set_collectionid(100);
+            auto* field = response->mutable_schema()->add_fields();
+            field->set_name("id");
+            field->set_data_type(milvus::proto::schema::DataType::Int64);
+            field->set_is_primary_key(true);
+            return ::grpc::Status{};
+        });
+    EXPECT_CALL(service, Query(_, _, _))
+        .WillRepeatedly([](::grpc::ServerContext*, const milvus::proto::milvus::QueryRequest* request,
+                           milvus::proto::milvus::QueryResults* response) {
+            int64_t limit = 0;
+            for (const auto& pair : request->query_params()) {
+                if (pair.key() == milvus::LIMIT) {
+                    limit = std::stoll(pair.value());
+                }
+            }
+            if (limit == 1) {
+                response->set_session_ts(999999);
+                return ::grpc::Status{};
+            }
+            EXPECT_EQ(request->guarantee_timestamp(), 999999u);
+
+            int64_t from = 0;
+            const auto& expr = request->expr();
+            auto pos = expr.find("id > ");
+            if (pos != std::string::npos) {
+                from = std::stoll(expr.substr(pos + 5)) + 1;
+            }
+            auto* field = response->add_fields_data();
+            field->set_field_name("id");
+            field->set_type(milvus::proto::schema::DataType::Int64);
+            auto* data = field->mutable_scalars()->mutable_long_data();
+            for (auto id = from; id < std::min(from + limit, kStreamRows); ++id) {
+                data->add_data(id);
+            }
+            return ::grpc::Status{};
+        });
+}
+
+milvus::QueryStreamRequest
+CreateStreamRequest() {
+    milvus::QueryStreamRequest request;
+    request.WithCollectionName(kStreamCollection).AddOutputField("id");
+    request.SetBatchSize(2);
+    return request;
+}
+
+}  // namespace
+
+TEST_F(UnconnectMilvusMockedTest, QueryStreamDeliversBatches) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    ExpectStreamQueries(service_);
+
+    std::vector<int64_t> ids;
+    std::vector<uint64_t> batch_sizes;
+    auto status = client->QueryStream(CreateStreamRequest(), [&](milvus::QueryResults& batch) {
+        auto field = batch.OutputField<milvus::Int64FieldData>("id");
+        EXPECT_NE(field, nullptr);
+        if (field != nullptr) {
+            ids.insert(ids.end(), field->Data().begin(), field->Data().end());
+        }
+        batch_sizes.push_back(batch.GetRowCount());
+        return milvus::Status::OK();
+    });
+    EXPECT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(ids, (std::vector<int64_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(batch_sizes, (std::vector<uint64_t>{2, 2, 1}));
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
+
+TEST_F(UnconnectMilvusMockedTest, QueryStreamStopsOnCallbackError) {
+    auto client = CreateConnectedClient(service_, server_.ListenPort());
+    ExpectStreamQueries(service_);
+
+    auto request = CreateStreamRequest();
+    request.SetPrefetchDepth(0);
+    int calls = 0;
+    auto status = client->QueryStream(request, [&calls](milvus::QueryResults&) {
+        ++calls;
+        return milvus::Status{StatusCode::UNKNOWN_ERROR, "stop"};
+    });
+    EXPECT_EQ(status.Code(), StatusCode::UNKNOWN_ERROR);
+    EXPECT_EQ(calls, 1);
+
+    EXPECT_EQ(client->QueryStream(request, nullptr).Code(), StatusCode::INVALID_ARGUMENT);
+
+    milvus::SchemaCache::GetInstance().Clear();
+}
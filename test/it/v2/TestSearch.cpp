@@ -16,11 +16,22 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "../mocks/MilvusMockedTest.h"
 #include "milvus/MilvusClientV2.h"
+#include "utils/Constants.h"
 
 using ::milvus::StatusCode;
 using ::testing::_;
@@ -28,12 +39,13 @@ using ::testing::_;
 namespace {
 
 std::shared_ptr<milvus::MilvusClientV2>
-CreateConnectedV2Client(testing::StrictMock<::milvus::MilvusMockedService>& service, uint16_t port) {
+CreateConnectedV2Client(testing::StrictMock<::milvus::MilvusMockedService>& service, uint16_t port,
+                        milvus::ExecutorPtr executor = nullptr) {
     EXPECT_CALL(service, Connect(_, _, _))
         .WillOnce([](::grpc::ServerContext*, const ::milvus::proto::milvus::ConnectRequest*,
                      ::milvus::proto::milvus::ConnectResponse*) { return ::grpc::Status{}; });
 
-    auto client = milvus::MilvusClientV2::Create();
+    auto client = milvus::MilvusClientV2::Create(std::move(executor));
     milvus::ConnectParam connect_param{"127.0.0.1", port};
     auto status = client->Connect(connect_param);
     EXPECT_TRUE(status.IsOk());
@@ -242,3 +254,383 @@ TEST_F(UnconnectMilvusMockedTest, SearchAggregationConversionFailureLeavesRespon
     EXPECT_EQ(response.ScannedTotalBytes(), 103);
     EXPECT_FLOAT_EQ(response.CacheHitRatio(), 0.5f);
 }
+
+TEST_F(UnconnectMilvusMockedTest, SearchAsyncOutnumbersExecutorWorkers) {
+    // a single worker, the searches in flight must not hold it
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort(), milvus::Executor::Create(1));
+
+    constexpr int kSearches = 4;
+    std::mutex mutex;
+    std::condition_variable arrived_cv;
+    int arrived = 0;
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(kSearches)
+        .WillRepeatedly([&](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest*,
+                            ::milvus::proto::milvus::SearchResults* response) {
+            // answer once every search is in flight
+            std::unique_lock<std::mutex> lock(mutex);
+            ++arrived;
+            arrived_cv.notify_all();
+            EXPECT_TRUE(arrived_cv.wait_for(lock, std::chrono::seconds(10), [&] { return arrived == kSearches; }));
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    auto request = CreateV2SearchRequest();
+    std::vector<milvus::SearchResponse> responses(kSearches);
+    std::vector<std::promise<milvus::Status>> dones(kSearches);
+    for (int i = 0; i < kSearches; ++i) {
+        auto& done = dones[i];
+        auto status = client->SearchAsync(request, responses[i],
+                                          [&done](const milvus::Status& result) { done.set_value(result); });
+        EXPECT_TRUE(status.IsOk());
+    }
+    for (int i = 0; i < kSearches; ++i) {
+        EXPECT_TRUE(dones[i].get_future().get().IsOk());
+        EXPECT_EQ(responses[i].SessionTs(), 123456u);
+        EXPECT_EQ(responses[i].Results().Results().size(), 1);
+    }
+}
+
+TEST_F(UnconnectMilvusMockedTest, SearchAsyncRejectsEmptyDone) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+    auto request = CreateV2SearchRequest();
+    milvus::SearchResponse response;
+    EXPECT_EQ(client->SearchAsync(request, response, nullptr).Code(), StatusCode::INVALID_ARGUMENT);
+}
+
+TEST_F(UnconnectMilvusMockedTest, MultiSearchKeepsInputOrder) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(3)
+        .WillRepeatedly([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest* request,
+                           ::milvus::proto::milvus::SearchResults* response) {
+            if (request->collection_name() == "b") {
+                response->mutable_status()->set_code(::milvus::proto::common::ErrorCode::UnexpectedError);
+                response->mutable_status()->set_reason("search b failed");
+                return ::grpc::Status{};
+            }
+            FillMinimalV2SearchResults(response);
+            response->set_session_ts(request->collection_name() == "a" ? 1 : 3);
+            return ::grpc::Status{};
+        });
+
+    milvus::MultiSearchRequest request;
+    request.WithConcurrency(3)
+        .AddRequest(CreateV2SearchRequest().WithCollectionName("a"))
+        .AddRequest(CreateV2SearchRequest().WithCollectionName("b"))
+        .AddRequest(CreateV2SearchRequest().WithCollectionName("c"));
+    milvus::MultiSearchResponse response;
+    auto status = client->MultiSearch(request, response);
+
+    EXPECT_FALSE(status.IsOk());
+    EXPECT_NE(status.Message().find("search b failed"), std::string::npos);
+    ASSERT_EQ(response.Statuses().size(), 3);
+    ASSERT_EQ(response.Responses().size(), 3);
+    EXPECT_TRUE(response.Statuses().at(0).IsOk());
+    EXPECT_FALSE(response.Statuses().at(1).IsOk());
+    EXPECT_TRUE(response.Statuses().at(2).IsOk());
+    EXPECT_EQ(response.Responses().at(0).SessionTs(), 1u);
+    EXPECT_EQ(response.Responses().at(2).SessionTs(), 3u);
+    EXPECT_EQ(response.FailedCount(), 1);
+}
+
+TEST_F(UnconnectMilvusMockedTest, MultiSearchIsCappedByExecutorWorkers) {
+    // the calling thread and the only worker
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort(), milvus::Executor::Create(1));
+
+    std::atomic<int> in_flight{0};
+    std::atomic<int> max_in_flight{0};
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(6)
+        .WillRepeatedly([&](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest*,
+                            ::milvus::proto::milvus::SearchResults* response) {
+            const int now = ++in_flight;
+            int seen = max_in_flight.load();
+            while (now > seen && !max_in_flight.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            --in_flight;
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    milvus::MultiSearchRequest request;
+    request.WithConcurrency(6);
+    for (int i = 0; i < 6; ++i) {
+        request.AddRequest(CreateV2SearchRequest());
+    }
+    milvus::MultiSearchResponse response;
+    auto status = client->MultiSearch(request, response);
+
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(response.Responses().size(), 6);
+    EXPECT_LE(max_in_flight.load(), 2);
+}
+
+TEST_F(UnconnectMilvusMockedTest, MultiSearchTimesEachSearch) {
+    EXPECT_CALL(service_, Connect(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const ::milvus::proto::milvus::ConnectRequest*,
+                     ::milvus::proto::milvus::ConnectResponse*) { return ::grpc::Status{}; });
+    auto client = milvus::MilvusClientV2::Create();
+    milvus::ConnectParam connect_param{"127.0.0.1", server_.ListenPort()};
+    connect_param.SetCallTimingEnabled(true);
+    ASSERT_TRUE(client->Connect(connect_param).IsOk());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(3)
+        .WillRepeatedly([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest*,
+                           ::milvus::proto::milvus::SearchResults* response) {
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    milvus::MultiSearchRequest request;
+    request.WithConcurrency(3);
+    for (int i = 0; i < 3; ++i) {
+        request.AddRequest(CreateV2SearchRequest());
+    }
+    milvus::MultiSearchResponse response;
+    auto status = client->MultiSearch(request, response);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+
+    // every search is timed, wherever it ran, and the batch sums them
+    milvus::CallTiming::Duration rpc_sum{0};
+    for (const auto& item : response.Responses()) {
+        ASSERT_NE(item.Timing(), nullptr);
+        EXPECT_EQ(item.Timing()->Attempts().size(), 1);
+        rpc_sum += item.Timing()->Elapsed(milvus::CallTiming::Stage::RPC);
+    }
+    ASSERT_NE(response.Timing(), nullptr);
+    EXPECT_EQ(response.Timing()->Attempts().size(), 3);
+    EXPECT_EQ(response.Timing()->Elapsed(milvus::CallTiming::Stage::RPC), rpc_sum);
+}
+
+TEST_F(UnconnectMilvusMockedTest, SearchAsyncSetsTimingBeforeDone) {
+    EXPECT_CALL(service_, Connect(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const ::milvus::proto::milvus::ConnectRequest*,
+                     ::milvus::proto::milvus::ConnectResponse*) { return ::grpc::Status{}; });
+    auto client = milvus::MilvusClientV2::Create();
+    milvus::ConnectParam connect_param{"127.0.0.1", server_.ListenPort()};
+    connect_param.SetCallTimingEnabled(true);
+    ASSERT_TRUE(client->Connect(connect_param).IsOk());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest*,
+                     ::milvus::proto::milvus::SearchResults* response) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    auto request = CreateV2SearchRequest();
+    milvus::SearchResponse response;
+    std::promise<milvus::CallTimingPtr> timing;
+    auto status = client->SearchAsync(request, response, [&response, &timing](const milvus::Status& result) {
+        EXPECT_TRUE(result.IsOk());
+        timing.set_value(response.Timing());
+    });
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+
+    // the reply is charged to the rpc stage although it arrived on another thread
+    auto result = timing.get_future().get();
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->Attempts().size(), 1);
+    EXPECT_GE(result->Elapsed(milvus::CallTiming::Stage::RPC), std::chrono::milliseconds(5));
+    EXPECT_LE(result->Elapsed(milvus::CallTiming::Stage::RPC), result->Total());
+}
+
+TEST_F(UnconnectMilvusMockedTest, MultiSearchStopOnError) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest*,
+                     ::milvus::proto::milvus::SearchResults* response) {
+            response->mutable_status()->set_code(::milvus::proto::common::ErrorCode::UnexpectedError);
+            response->mutable_status()->set_reason("first failed");
+            return ::grpc::Status{};
+        });
+
+    milvus::MultiSearchRequest request;
+    request.WithConcurrency(1).WithStopOnError(true);
+    for (int i = 0; i < 4; ++i) {
+        request.AddRequest(CreateV2SearchRequest());
+    }
+    milvus::MultiSearchResponse response;
+    auto status = client->MultiSearch(request, response);
+
+    EXPECT_FALSE(status.IsOk());
+    EXPECT_NE(status.Message().find("first failed"), std::string::npos);
+    ASSERT_EQ(response.Statuses().size(), 4);
+    for (size_t i = 1; i < 4; ++i) {
+        EXPECT_EQ(response.Statuses().at(i).Code(), StatusCode::UNKNOWN_ERROR);
+    }
+    EXPECT_EQ(response.FailedCount(), 4);
+}
+
+TEST_F(UnconnectMilvusMockedTest, MultiSearchDeadline) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .WillOnce([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest*,
+                     ::milvus::proto::milvus::SearchResults* response) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    milvus::MultiSearchRequest request;
+    request.WithConcurrency(1).WithTimeoutMs(100).AddRequest(CreateV2SearchRequest()).AddRequest(
+        CreateV2SearchRequest());
+    milvus::MultiSearchResponse response;
+    auto status = client->MultiSearch(request, response);
+
+    // the running search is cut by its rpc deadline, the next one is not sent
+    EXPECT_EQ(status.Code(), StatusCode::TIMEOUT);
+    ASSERT_EQ(response.Statuses().size(), 2);
+    EXPECT_EQ(response.Statuses().at(0).Code(), StatusCode::TIMEOUT);
+    EXPECT_EQ(response.Statuses().at(1).Code(), StatusCode::TIMEOUT);
+}
+
+TEST_F(UnconnectMilvusMockedTest, MultiSearchEmpty) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+
+    milvus::MultiSearchRequest request;
+    milvus::MultiSearchResponse response;
+    EXPECT_TRUE(client->MultiSearch(request, response).IsOk());
+    EXPECT_TRUE(response.Statuses().empty());
+    EXPECT_TRUE(response.Responses().empty());
+}
+
+TEST_F(UnconnectMilvusMockedTest, FederatedSearchMergesCollections) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(2)
+        .WillRepeatedly([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest* request,
+                           ::milvus::proto::milvus::SearchResults* response) {
+            const bool is_a = request->collection_name() == "a";
+            // each collection is asked for offset + limit hits from the start
+            for (const auto& pair : request->search_params()) {
+                if (pair.key() == milvus::TOPK) {
+                    EXPECT_EQ(pair.value(), "3");
+                } else if (pair.key() == milvus::OFFSET) {
+                    EXPECT_EQ(pair.value(), "0");
+                }
+            }
+            response->mutable_status()->set_code(milvus::proto::common::ErrorCode::Success);
+            response->set_session_ts(is_a ? 5 : 7);
+            auto* results = response->mutable_results();
+            results->set_num_queries(1);
+            results->set_primary_field_name("id");
+            results->mutable_topks()->Add(2);
+            results->mutable_ids()->mutable_int_id()->add_data(is_a ? 1 : 11);
+            results->mutable_ids()->mutable_int_id()->add_data(is_a ? 2 : 12);
+            results->mutable_scores()->Add(is_a ? 0.9f : 0.8f);
+            results->mutable_scores()->Add(is_a ? 0.3f : 0.7f);
+            return ::grpc::Status{};
+        });
+
+    auto search = CreateV2SearchRequest().WithLimit(2).WithOffset(1);
+    milvus::FederatedSearchRequest request;
+    request.WithRequest(search).AddCollectionName("a").AddCollectionName("b");
+    milvus::SearchResponse response;
+    auto status = client->FederatedSearch(request, response);
+
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(response.SessionTs(), 7u);
+    ASSERT_EQ(response.Results().Results().size(), 1);
+    const auto& result = response.Results().Results().at(0);
+    EXPECT_EQ(result.Ids().IntIDArray(), std::vector<int64_t>({11, 12}));
+    EXPECT_EQ(result.Scores(), std::vector<float>({0.8f, 0.7f}));
+}
+
+namespace {
+
+// records the collection of each ended span, and sends a traceparent with each rpc
+class CollectionTracer : public milvus::Tracer {
+ public:
+    class CollectionSpan : public milvus::Span {
+     public:
+        explicit CollectionSpan(CollectionTracer& tracer) : tracer_(tracer) {
+        }
+
+        void
+        InjectHeaders(std::unordered_map<std::string, std::string>& headers) override {
+            headers[milvus::TRACEPARENT_HEADER] =
+                milvus::Traceparent("0af7651916cd43dd8448eb211c80319c", "b7ad6b7169203331", true);
+        }
+
+        void
+        End(const milvus::SpanAttributes& attributes, const milvus::Status&) override {
+            std::lock_guard<std::mutex> lock(tracer_.mutex_);
+            tracer_.collections_.insert(attributes.CollectionName());
+        }
+
+     private:
+        CollectionTracer& tracer_;
+    };
+
+    milvus::SpanPtr
+    StartSpan(const milvus::SpanAttributes& attributes) override {
+        if (attributes.RpcName() != "Search") {
+            return nullptr;
+        }
+        return milvus::SpanPtr(new CollectionSpan(*this));
+    }
+
+    std::mutex mutex_;
+    std::set<std::string> collections_;
+};
+
+}  // namespace
+
+TEST_F(UnconnectMilvusMockedTest, FederatedSearchTracesEachCollection) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+    auto tracer = std::make_shared<CollectionTracer>();
+    client->SetTracer(tracer);
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(2)
+        .WillRepeatedly([](::grpc::ServerContext* context, const ::milvus::proto::milvus::SearchRequest*,
+                           ::milvus::proto::milvus::SearchResults* response) {
+            EXPECT_EQ(context->client_metadata().count(milvus::TRACEPARENT_HEADER), 1);
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    milvus::FederatedSearchRequest request;
+    request.WithRequest(CreateV2SearchRequest()).AddCollectionName("a").AddCollectionName("b");
+    milvus::SearchResponse response;
+    auto status = client->FederatedSearch(request, response);
+
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(tracer->collections_, std::set<std::string>({"a", "b"}));
+}
+
+TEST_F(UnconnectMilvusMockedTest, FederatedSearchFailure) {
+    auto client = CreateConnectedV2Client(service_, server_.ListenPort());
+
+    EXPECT_CALL(service_, Search(_, _, _))
+        .Times(2)
+        .WillRepeatedly([](::grpc::ServerContext*, const ::milvus::proto::milvus::SearchRequest* request,
+                           ::milvus::proto::milvus::SearchResults* response) {
+            if (request->collection_name() == "b") {
+                response->mutable_status()->set_code(::milvus::proto::common::ErrorCode::UnexpectedError);
+                response->mutable_status()->set_reason("search b failed");
+                return ::grpc::Status{};
+            }
+            FillMinimalV2SearchResults(response);
+            return ::grpc::Status{};
+        });
+
+    milvus::FederatedSearchRequest request;
+    request.WithRequest(CreateV2SearchRequest()).WithCollectionNames({"a", "b"});
+    milvus::SearchResponse response;
+    auto status = client->FederatedSearch(request, response);
+    EXPECT_FALSE(status.IsOk());
+    EXPECT_NE(status.Message().find("collection b"), std::string::npos);
+
+    EXPECT_FALSE(client->FederatedSearch(milvus::FederatedSearchRequest(), response).IsOk());
+}
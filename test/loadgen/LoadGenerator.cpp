@@ -0,0 +1,393 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LoadGenerator.h"
+
+#include <sys/resource.h>
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+
+#include "../it/mocks/MilvusMockedServer.h"
+#include "milvus/MilvusClientV2.h"
+
+namespace milvus {
+namespace loadgen {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* const kCollection = "loadgen";
+
+int64_t
+ThreadCpuNs() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+double
+ProcessCpuSeconds() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+// the requests are built once and shared by all threads, the client only reads them
+struct Requests {
+    InsertRequest insert_;
+    SearchRequest search_;
+    QueryRequest query_;
+    GetRequest get_;
+};
+
+std::unique_ptr<Requests>
+BuildRequests(const LoadOptions& options) {
+    const auto& service = options.service_;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    auto random_vector = [&rng, &dist, &service]() {
+        std::vector<float> vector(service.dim_);
+        for (auto& value : vector) {
+            value = dist(rng);
+        }
+        return vector;
+    };
+
+    std::vector<int64_t> ids(options.insert_rows_);
+    std::vector<std::vector<float>> vectors(options.insert_rows_);
+    std::vector<std::string> payloads(options.insert_rows_, std::string(service.payload_bytes_, 'x'));
+    for (uint32_t i = 0; i < options.insert_rows_; ++i) {
+        ids[i] = static_cast<int64_t>(i);
+        vectors[i] = random_vector();
+    }
+
+    auto requests = std::make_unique<Requests>();
+    requests->insert_.WithCollectionName(kCollection)
+        .WithColumnsData({std::make_shared<Int64FieldData>("id", std::move(ids)),
+                          std::make_shared<FloatVecFieldData>("vector", std::move(vectors)),
+                          std::make_shared<VarCharFieldData>("payload", std::move(payloads))});
+
+    requests->search_.WithCollectionName(kCollection).WithAnnsField("vector").WithLimit(service.topk_);
+    requests->search_.AddOutputField("payload");
+    for (uint32_t i = 0; i < service.nq_; ++i) {
+        requests->search_.AddFloatVector(random_vector());
+    }
+
+    requests->query_.WithCollectionName(kCollection).WithFilter("id >= 0").WithLimit(service.query_rows_);
+    requests->query_.WithOutputFields({"id", "payload"});
+
+    std::vector<int64_t> get_ids(options.get_ids_);
+    for (uint32_t i = 0; i < options.get_ids_; ++i) {
+        get_ids[i] = static_cast<int64_t>(i);
+    }
+    requests->get_.WithCollectionName(kCollection).WithIDs(std::move(get_ids));
+    requests->get_.WithOutputFields({"id", "payload"});
+    return requests;
+}
+
+Status
+Call(MilvusClientV2& client, const Requests& requests, OpType op) {
+    switch (op) {
+        case OpType::INSERT: {
+            InsertResponse response;
+            return client.Insert(requests.insert_, response);
+        }
+        case OpType::SEARCH: {
+            SearchResponse response;
+            return client.Search(requests.search_, response);
+        }
+        case OpType::QUERY: {
+            QueryResponse response;
+            return client.Query(requests.query_, response);
+        }
+        case OpType::GET: {
+            GetResponse response;
+            return client.Get(requests.get_, response);
+        }
+    }
+    return Status{StatusCode::INVALID_ARGUMENT, "Unknown operation"};
+}
+
+// what one worker thread measured, merged after the run
+struct WorkerStats {
+    std::array<std::vector<int64_t>, kOpTypeCount> latency_ns_;
+    std::array<int64_t, kOpTypeCount> cpu_ns_{};
+    std::array<uint64_t, kOpTypeCount> failures_{};
+};
+
+void
+RunWorker(MilvusClientV2& client, const Requests& requests, const LoadOptions& options, uint32_t index,
+          Clock::time_point start, Clock::time_point end, WorkerStats& stats) {
+    std::mt19937 rng(index + 1);
+    std::discrete_distribution<size_t> pick(options.mix_.begin(), options.mix_.end());
+
+    // each thread takes every threads-th slot of the global schedule
+    const bool paced = options.qps_ > 0.0;
+    const auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(paced ? options.threads_ / options.qps_ : 0.0));
+    auto next = start + interval * index / options.threads_;
+
+    while (true) {
+        auto begin = Clock::now();
+        if (paced) {
+            if (next >= end) {
+                break;
+            }
+            std::this_thread::sleep_until(next);
+            begin = next;
+            next += interval;
+        } else if (begin >= end) {
+            break;
+        }
+
+        const auto op = pick(rng);
+        const auto cpu_begin = ThreadCpuNs();
+        auto status = Call(client, requests, static_cast<OpType>(op));
+        stats.cpu_ns_[op] += ThreadCpuNs() - cpu_begin;
+        const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
+        stats.latency_ns_[op].push_back(latency.count());
+        if (!status.IsOk()) {
+            ++stats.failures_[op];
+        }
+    }
+}
+
+// nearest-rank percentile of sorted samples, in microseconds
+double
+Percentile(const std::vector<int64_t>& sorted, double percent) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(sorted.size())));
+    rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+    return static_cast<double>(sorted[rank - 1]) / 1000.0;
+}
+
+const CallCounter&
+ServerCounter(const LoadService& service, OpType op) {
+    switch (op) {
+        case OpType::INSERT:
+            return service.InsertCalls();
+        case OpType::SEARCH:
+            return service.SearchCalls();
+        case OpType::QUERY:
+            return service.QueryCalls();
+        default:
+            return service.GetCalls();
+    }
+}
+
+}  // namespace
+
+const char*
+OpTypeName(OpType op) {
+    switch (op) {
+        case OpType::INSERT:
+            return "insert";
+        case OpType::SEARCH:
+            return "search";
+        case OpType::QUERY:
+            return "query";
+        case OpType::GET:
+            return "get";
+    }
+    return "unknown";
+}
+
+Status
+RunLoad(const LoadOptions& options, LoadReport& report) {
+    if (options.threads_ == 0 || options.clients_ == 0) {
+        return Status{StatusCode::INVALID_ARGUMENT, "Threads and clients must be positive"};
+    }
+    uint64_t total_weight = 0;
+    for (auto weight : options.mix_) {
+        total_weight += weight;
+    }
+    if (total_weight == 0) {
+        return Status{StatusCode::INVALID_ARGUMENT, "The operation mix has no positive weight"};
+    }
+
+    LoadService service(options.service_);
+    MilvusMockedServer server(service);
+    server.Start();
+
+    const auto requests = BuildRequests(options);
+    const auto retry = RetryParam()
+                           .WithMaxRetryTimes(options.max_retry_times_)
+                           .WithInitialBackOffMs(options.initial_backoff_ms_);
+    std::vector<MilvusClientV2Ptr> clients;
+    for (uint32_t i = 0; i < options.clients_; ++i) {
+        auto client = MilvusClientV2::Create();
+        auto status = client->Connect(ConnectParam{"127.0.0.1", server.ListenPort()});
+        if (status.IsOk()) {
+            status = client->SetRetryParam(retry);
+        }
+        if (!status.IsOk()) {
+            server.Stop();
+            return status;
+        }
+        // the first call of a client fetches the collection schema, keep it out of the measurement
+        for (size_t op = 0; op < kOpTypeCount; ++op) {
+            if (options.mix_[op] > 0) {
+                Call(*client, *requests, static_cast<OpType>(op));
+            }
+        }
+        clients.push_back(client);
+    }
+
+    std::array<uint64_t, kOpTypeCount> rpc_base{};
+    std::array<uint64_t, kOpTypeCount> injected_base{};
+    for (size_t op = 0; op < kOpTypeCount; ++op) {
+        const auto& counter = ServerCounter(service, static_cast<OpType>(op));
+        rpc_base[op] = counter.calls_.load();
+        injected_base[op] = counter.injected_errors_.load();
+    }
+
+    std::vector<WorkerStats> stats(options.threads_);
+    std::vector<std::thread> workers;
+    const auto cpu_begin = ProcessCpuSeconds();
+    const auto start = Clock::now() + std::chrono::milliseconds(10);
+    const auto end = start + std::chrono::seconds(options.duration_s_);
+    for (uint32_t i = 0; i < options.threads_; ++i) {
+        workers.emplace_back(RunWorker, std::ref(*clients[i % clients.size()]), std::cref(*requests),
+                             std::cref(options), i, start, end, std::ref(stats[i]));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    report.elapsed_s_ = elapsed;
+    report.process_cpu_s_ = ProcessCpuSeconds() - cpu_begin;
+
+    report.ops_.clear();
+    for (size_t op = 0; op < kOpTypeCount; ++op) {
+        if (options.mix_[op] == 0) {
+            continue;
+        }
+        std::vector<int64_t> latencies;
+        OpReport item;
+        item.op_ = static_cast<OpType>(op);
+        int64_t cpu_ns = 0;
+        for (const auto& worker : stats) {
+            latencies.insert(latencies.end(), worker.latency_ns_[op].begin(), worker.latency_ns_[op].end());
+            cpu_ns += worker.cpu_ns_[op];
+            item.failures_ += worker.failures_[op];
+        }
+        std::sort(latencies.begin(), latencies.end());
+        item.calls_ = latencies.size();
+        const auto& counter = ServerCounter(service, item.op_);
+        item.rpc_calls_ = counter.calls_.load() - rpc_base[op];
+        item.injected_errors_ = counter.injected_errors_.load() - injected_base[op];
+        item.throughput_ = static_cast<double>(item.calls_) / elapsed;
+        item.p50_us_ = Percentile(latencies, 50.0);
+        item.p90_us_ = Percentile(latencies, 90.0);
+        item.p99_us_ = Percentile(latencies, 99.0);
+        item.p999_us_ = Percentile(latencies, 99.9);
+        item.max_us_ = latencies.empty() ? 0.0 : static_cast<double>(latencies.back()) / 1000.0;
+        item.cpu_us_per_call_ = item.calls_ == 0 ? 0.0 : static_cast<double>(cpu_ns) / 1000.0 / item.calls_;
+        report.ops_.push_back(item);
+    }
+
+    for (auto& client : clients) {
+        client->Disconnect();
+    }
+    server.Stop();
+    return Status::OK();
+}
+
+std::string
+FormatReport(const LoadReport& report) {
+    std::string text;
+    char line[256];
+    const char* const header = "%-8s %10s %8s %10s %9s %11s %10s %10s %10s %10s %10s %12s\n";
+    const char* const row = "%-8s %10llu %8llu %10llu %9llu %11.1f %10.1f %10.1f %10.1f %10.1f %10.1f %12.1f\n";
+    std::snprintf(line, sizeof(line), header, "op", "calls", "failures", "rpcs", "injected", "calls/s", "p50(us)",
+                  "p90(us)", "p99(us)", "p999(us)", "max(us)", "cpu/call(us)");
+    text += line;
+    uint64_t total_calls = 0;
+    for (const auto& item : report.ops_) {
+        std::snprintf(line, sizeof(line), row, OpTypeName(item.op_), static_cast<unsigned long long>(item.calls_),
+                      static_cast<unsigned long long>(item.failures_),
+                      static_cast<unsigned long long>(item.rpc_calls_),
+                      static_cast<unsigned long long>(item.injected_errors_), item.throughput_, item.p50_us_,
+                      item.p90_us_, item.p99_us_, item.p999_us_, item.max_us_, item.cpu_us_per_call_);
+        text += line;
+        total_calls += item.calls_;
+    }
+    std::snprintf(line, sizeof(line), "total %llu calls in %.2f s, %.1f calls/s, process cpu %.2f s\n",
+                  static_cast<unsigned long long>(total_calls), report.elapsed_s_,
+                  report.elapsed_s_ > 0.0 ? static_cast<double>(total_calls) / report.elapsed_s_ : 0.0,
+                  report.process_cpu_s_);
+    text += line;
+    return text;
+}
+
+nlohmann::json
+ReportToJson(const LoadOptions& options, const LoadReport& report) {
+    nlohmann::json mix;
+    for (size_t op = 0; op < kOpTypeCount; ++op) {
+        mix[OpTypeName(static_cast<OpType>(op))] = options.mix_[op];
+    }
+    nlohmann::json json = {
+        {"options",
+         {{"threads", options.threads_},
+          {"clients", options.clients_},
+          {"qps", options.qps_},
+          {"duration_s", options.duration_s_},
+          {"mix", mix},
+          {"insert_rows", options.insert_rows_},
+          {"get_ids", options.get_ids_},
+          {"dim", options.service_.dim_},
+          {"payload_bytes", options.service_.payload_bytes_},
+          {"nq", options.service_.nq_},
+          {"topk", options.service_.topk_},
+          {"query_rows", options.service_.query_rows_},
+          {"delay_us", options.service_.delay_us_},
+          {"error_rate", options.service_.error_rate_}}},
+        {"elapsed_s", report.elapsed_s_},
+        {"process_cpu_s", report.process_cpu_s_},
+    };
+    auto& ops = json["ops"];
+    ops = nlohmann::json::array();
+    for (const auto& item : report.ops_) {
+        ops.push_back({{"op", OpTypeName(item.op_)},
+                       {"calls", item.calls_},
+                       {"failures", item.failures_},
+                       {"rpc_calls", item.rpc_calls_},
+                       {"injected_errors", item.injected_errors_},
+                       {"throughput", item.throughput_},
+                       {"p50_us", item.p50_us_},
+                       {"p90_us", item.p90_us_},
+                       {"p99_us", item.p99_us_},
+                       {"p999_us", item.p999_us_},
+                       {"max_us", item.max_us_},
+                       {"cpu_us_per_call", item.cpu_us_per_call_}});
+    }
+    return json;
+}
+
+}  // namespace loadgen
+}  // namespace milvus
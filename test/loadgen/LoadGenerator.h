@@ -0,0 +1,108 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <milvus/thirdparty/nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "LoadService.h"
+#include "milvus/Status.h"
+
+namespace milvus {
+namespace loadgen {
+
+enum class OpType {
+    INSERT = 0,
+    SEARCH = 1,
+    QUERY = 2,
+    GET = 3,
+};
+
+constexpr size_t kOpTypeCount = 4;
+
+const char*
+OpTypeName(OpType op);
+
+/**
+ * @brief Parameters of one load run, the service options shape the server side.
+ */
+struct LoadOptions {
+    // worker threads, each one issues its calls synchronously
+    uint32_t threads_{4};
+    // MilvusClientV2 instances the threads share round-robin, each client owns one channel
+    uint32_t clients_{1};
+    // target calls per second over all threads, 0 issues the next call as soon as the last one returns
+    double qps_{0.0};
+    uint32_t duration_s_{10};
+    // relative weights of insert, search, query and get, indexed by OpType
+    std::array<uint32_t, kOpTypeCount> mix_{{1, 4, 1, 1}};
+    // rows of each insert and ids of each get
+    uint32_t insert_rows_{100};
+    uint32_t get_ids_{10};
+    uint64_t max_retry_times_{75};
+    uint64_t initial_backoff_ms_{10};
+    ServiceOptions service_;
+};
+
+/**
+ * @brief Measurements of one operation type. Latencies are in microseconds.
+ */
+struct OpReport {
+    OpType op_{OpType::INSERT};
+    uint64_t calls_{0};
+    uint64_t failures_{0};
+    // calls the server received, more than calls_ when the client retried
+    uint64_t rpc_calls_{0};
+    uint64_t injected_errors_{0};
+    double throughput_{0.0};
+    double p50_us_{0.0};
+    double p90_us_{0.0};
+    double p99_us_{0.0};
+    double p999_us_{0.0};
+    double max_us_{0.0};
+    double cpu_us_per_call_{0.0};
+};
+
+struct LoadReport {
+    double elapsed_s_{0.0};
+    // cpu of the whole process, the in-process server included
+    double process_cpu_s_{0.0};
+    std::vector<OpReport> ops_;
+};
+
+/**
+ * @brief Start a MilvusMockedServer hosting a LoadService, drive it with MilvusClientV2 as the options describe and
+ * measure each call.
+ *
+ * With a target qps the calls follow a fixed schedule and a latency is taken from the scheduled start, so a slow call
+ * also counts against the calls queued behind it. The cpu of a call is the cpu time of the calling thread, work that
+ * gRPC hands to its own threads is not included.
+ */
+Status
+RunLoad(const LoadOptions& options, LoadReport& report);
+
+std::string
+FormatReport(const LoadReport& report);
+
+nlohmann::json
+ReportToJson(const LoadOptions& options, const LoadReport& report);
+
+}  // namespace loadgen
+}  // namespace milvus
@@ -0,0 +1,186 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LoadService.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace milvus {
+namespace loadgen {
+
+namespace {
+
+constexpr int64_t kCollectionID = 1000;
+
+void
+SetRateLimited(proto::common::Status* status) {
+    // the legacy code of milvus v2.2 and the code of v2.3, the sdk retries both
+    status->set_error_code(proto::common::ErrorCode::RateLimit);
+    status->set_code(8);
+    status->set_reason("rate limit injected by the load generator");
+}
+
+void
+FillOutputFields(size_t rows, uint32_t payload_bytes, bool with_id,
+                 ::google::protobuf::RepeatedPtrField<proto::schema::FieldData>* fields_data) {
+    if (with_id) {
+        auto* id = fields_data->Add();
+        id->set_field_name("id");
+        id->set_field_id(100);
+        id->set_type(proto::schema::DataType::Int64);
+        auto* ids = id->mutable_scalars()->mutable_long_data()->mutable_data();
+        for (size_t i = 0; i < rows; ++i) {
+            ids->Add(static_cast<int64_t>(i));
+        }
+    }
+    auto* payload = fields_data->Add();
+    payload->set_field_name("payload");
+    payload->set_field_id(102);
+    payload->set_type(proto::schema::DataType::VarChar);
+    auto* strings = payload->mutable_scalars()->mutable_string_data()->mutable_data();
+    const std::string value(payload_bytes, 'x');
+    for (size_t i = 0; i < rows; ++i) {
+        *strings->Add() = value;
+    }
+}
+
+}  // namespace
+
+LoadService::LoadService(const ServiceOptions& options) : options_(options) {
+    // id: int64 primary key, vector: float vector, payload: varchar
+    describe_response_.set_collectionid(kCollectionID);
+    describe_response_.set_collection_name("loadgen");
+    auto* schema = describe_response_.mutable_schema();
+    schema->set_name("loadgen");
+    auto* id = schema->add_fields();
+    id->set_fieldid(100);
+    id->set_name("id");
+    id->set_data_type(proto::schema::DataType::Int64);
+    id->set_is_primary_key(true);
+    auto* vector = schema->add_fields();
+    vector->set_fieldid(101);
+    vector->set_name("vector");
+    vector->set_data_type(proto::schema::DataType::FloatVector);
+    auto* dim = vector->add_type_params();
+    dim->set_key("dim");
+    dim->set_value(std::to_string(options_.dim_));
+    auto* payload = schema->add_fields();
+    payload->set_fieldid(102);
+    payload->set_name("payload");
+    payload->set_data_type(proto::schema::DataType::VarChar);
+    auto* max_length = payload->add_type_params();
+    max_length->set_key("max_length");
+    max_length->set_value(std::to_string(options_.payload_bytes_ + 1));
+
+    const size_t hits = static_cast<size_t>(options_.nq_) * options_.topk_;
+    auto* results = search_response_.mutable_results();
+    results->set_num_queries(options_.nq_);
+    results->set_top_k(options_.topk_);
+    results->set_primary_field_name("id");
+    results->add_output_fields("payload");
+    for (uint32_t q = 0; q < options_.nq_; ++q) {
+        results->add_topks(options_.topk_);
+        for (uint32_t k = 0; k < options_.topk_; ++k) {
+            results->mutable_ids()->mutable_int_id()->add_data(static_cast<int64_t>(k));
+            results->add_scores(1.0f - static_cast<float>(k) * 0.001f);
+        }
+    }
+    // the primary keys of the hits travel in ids
+    FillOutputFields(hits, options_.payload_bytes_, false, results->mutable_fields_data());
+
+    query_response_.set_collection_name("loadgen");
+    query_response_.add_output_fields("id");
+    query_response_.add_output_fields("payload");
+    FillOutputFields(options_.query_rows_, options_.payload_bytes_, true, query_response_.mutable_fields_data());
+}
+
+bool
+LoadService::Admit(CallCounter& counter) {
+    counter.calls_++;
+    if (options_.delay_us_ > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(options_.delay_us_));
+    }
+    if (options_.error_rate_ <= 0.0) {
+        return true;
+    }
+    double draw = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(rng_mutex_);
+        draw = std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+    }
+    if (draw >= options_.error_rate_) {
+        return true;
+    }
+    counter.injected_errors_++;
+    return false;
+}
+
+::grpc::Status
+LoadService::Connect(::grpc::ServerContext*, const proto::milvus::ConnectRequest*, proto::milvus::ConnectResponse*) {
+    return ::grpc::Status{};
+}
+
+::grpc::Status
+LoadService::DescribeCollection(::grpc::ServerContext*, const proto::milvus::DescribeCollectionRequest*,
+                                proto::milvus::DescribeCollectionResponse* response) {
+    *response = describe_response_;
+    return ::grpc::Status{};
+}
+
+::grpc::Status
+LoadService::Insert(::grpc::ServerContext*, const proto::milvus::InsertRequest* request,
+                    proto::milvus::MutationResult* response) {
+    if (!Admit(insert_calls_)) {
+        SetRateLimited(response->mutable_status());
+        return ::grpc::Status{};
+    }
+    auto* ids = response->mutable_ids()->mutable_int_id()->mutable_data();
+    ids->Reserve(static_cast<int>(request->num_rows()));
+    for (uint32_t i = 0; i < request->num_rows(); ++i) {
+        ids->Add(static_cast<int64_t>(i));
+    }
+    response->set_insert_cnt(request->num_rows());
+    response->set_timestamp(1);
+    return ::grpc::Status{};
+}
+
+::grpc::Status
+LoadService::Search(::grpc::ServerContext*, const proto::milvus::SearchRequest*,
+                    proto::milvus::SearchResults* response) {
+    if (!Admit(search_calls_)) {
+        SetRateLimited(response->mutable_status());
+        return ::grpc::Status{};
+    }
+    *response = search_response_;
+    return ::grpc::Status{};
+}
+
+::grpc::Status
+LoadService::Query(::grpc::ServerContext*, const proto::milvus::QueryRequest* request,
+                   proto::milvus::QueryResults* response) {
+    auto& counter = request->expr_template_values().empty() ? query_calls_ : get_calls_;
+    if (!Admit(counter)) {
+        SetRateLimited(response->mutable_status());
+        return ::grpc::Status{};
+    }
+    *response = query_response_;
+    return ::grpc::Status{};
+}
+
+}  // namespace loadgen
+}  // namespace milvus
@@ -0,0 +1,125 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <random>
+
+#include "../it/mocks/MilvusMockedService.h"
+
+namespace milvus {
+namespace loadgen {
+
+/**
+ * @brief Shapes of the canned responses and the faults injected by LoadService.
+ */
+struct ServiceOptions {
+    // dimension of the "vector" field in the collection schema
+    uint32_t dim_{128};
+    // bytes of the "payload" varchar returned per hit or row
+    uint32_t payload_bytes_{64};
+    // search targets of each search request, and hits returned per target
+    uint32_t nq_{1};
+    uint32_t topk_{10};
+    // rows returned by each query or get
+    uint32_t query_rows_{100};
+    // added to every Insert, Search and Query call before it answers
+    uint32_t delay_us_{0};
+    // fraction of Insert, Search and Query calls answered with a rate limit error, the client retries them
+    double error_rate_{0.0};
+};
+
+/**
+ * @brief Number of calls one rpc received and how many of them were failed on purpose.
+ */
+struct CallCounter {
+    std::atomic<uint64_t> calls_{0};
+    std::atomic<uint64_t> injected_errors_{0};
+};
+
+/**
+ * @brief A MilvusService which answers Insert, Search and Query from canned responses, so that MilvusMockedServer
+ * can serve a load test without expectations. The handlers override the mocked methods directly since a gmock
+ * action takes a global lock on each call, which would serialize the server.
+ */
+class LoadService : public MilvusMockedService {
+ public:
+    explicit LoadService(const ServiceOptions& options);
+
+    ::grpc::Status
+    Connect(::grpc::ServerContext*, const proto::milvus::ConnectRequest*, proto::milvus::ConnectResponse*) override;
+
+    ::grpc::Status
+    DescribeCollection(::grpc::ServerContext*, const proto::milvus::DescribeCollectionRequest*,
+                       proto::milvus::DescribeCollectionResponse* response) override;
+
+    ::grpc::Status
+    Insert(::grpc::ServerContext*, const proto::milvus::InsertRequest* request,
+           proto::milvus::MutationResult* response) override;
+
+    ::grpc::Status
+    Search(::grpc::ServerContext*, const proto::milvus::SearchRequest* request,
+           proto::milvus::SearchResults* response) override;
+
+    ::grpc::Status
+    Query(::grpc::ServerContext*, const proto::milvus::QueryRequest* request,
+          proto::milvus::QueryResults* response) override;
+
+    const CallCounter&
+    InsertCalls() const {
+        return insert_calls_;
+    }
+
+    const CallCounter&
+    SearchCalls() const {
+        return search_calls_;
+    }
+
+    const CallCounter&
+    QueryCalls() const {
+        return query_calls_;
+    }
+
+    // a get arrives as a query whose ids are passed as a filter template
+    const CallCounter&
+    GetCalls() const {
+        return get_calls_;
+    }
+
+ private:
+    // counts the call and sleeps for the injected delay, returns false if this call should fail
+    bool
+    Admit(CallCounter& counter);
+
+    ServiceOptions options_;
+    proto::milvus::DescribeCollectionResponse describe_response_;
+    proto::milvus::SearchResults search_response_;
+    proto::milvus::QueryResults query_response_;
+
+    std::mutex rng_mutex_;
+    std::mt19937_64 rng_{0};
+
+    CallCounter insert_calls_;
+    CallCounter search_calls_;
+    CallCounter query_calls_;
+    CallCounter get_calls_;
+};
+
+}  // namespace loadgen
+}  // namespace milvus
@@ -0,0 +1,169 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "LoadGenerator.h"
+
+namespace {
+
+using milvus::loadgen::kOpTypeCount;
+using milvus::loadgen::LoadOptions;
+using milvus::loadgen::OpType;
+using milvus::loadgen::OpTypeName;
+
+const char* const kUsage = R"(Usage: loadgen-sdk [--name=value ...]
+
+Drives MilvusClientV2 against an in-process mocked server and reports throughput, latency percentiles and
+client cpu of each operation.
+
+  --threads=4          worker threads
+  --clients=1          clients shared by the threads, each client owns one channel
+  --qps=0              target calls per second over all threads, 0 runs without pacing
+  --duration=10        seconds to run
+  --mix=insert:1,search:4,query:1,get:1
+                       relative weight of each operation
+  --insert-rows=100    rows of each insert
+  --get-ids=10         ids of each get
+  --dim=128            dimension of the float vector field
+  --payload-bytes=64   bytes of the varchar field sent by insert and returned by search/query/get
+  --nq=1               target vectors of each search
+  --topk=10            hits returned per search target
+  --query-rows=100     rows returned by each query or get
+  --delay-us=0         server delay added to each insert/search/query call
+  --error-rate=0       fraction of server calls answered with a rate limit error, the client retries them
+  --max-retries=75     max retry times of the clients
+  --backoff-ms=10      initial retry backoff of the clients
+  --json=PATH          also write the report as json to PATH
+)";
+
+bool
+ParseMix(const std::string& text, LoadOptions& options) {
+    options.mix_.fill(0);
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const auto colon = item.find(':');
+        if (colon == std::string::npos) {
+            return false;
+        }
+        const auto name = item.substr(0, colon);
+        bool found = false;
+        for (size_t op = 0; op < kOpTypeCount; ++op) {
+            if (name == OpTypeName(static_cast<OpType>(op))) {
+                options.mix_[op] = static_cast<uint32_t>(std::stoul(item.substr(colon + 1)));
+                found = true;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+ParseArg(const std::string& name, const std::string& value, LoadOptions& options, std::string& json_path) {
+    auto& service = options.service_;
+    if (name == "threads") {
+        options.threads_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "clients") {
+        options.clients_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "qps") {
+        options.qps_ = std::stod(value);
+    } else if (name == "duration") {
+        options.duration_s_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "mix") {
+        return ParseMix(value, options);
+    } else if (name == "insert-rows") {
+        options.insert_rows_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "get-ids") {
+        options.get_ids_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "dim") {
+        service.dim_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "payload-bytes") {
+        service.payload_bytes_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "nq") {
+        service.nq_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "topk") {
+        service.topk_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "query-rows") {
+        service.query_rows_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "delay-us") {
+        service.delay_us_ = static_cast<uint32_t>(std::stoul(value));
+    } else if (name == "error-rate") {
+        service.error_rate_ = std::stod(value);
+    } else if (name == "max-retries") {
+        options.max_retry_times_ = std::stoull(value);
+    } else if (name == "backoff-ms") {
+        options.initial_backoff_ms_ = std::stoull(value);
+    } else if (name == "json") {
+        json_path = value;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int
+main(int argc, char** argv) {
+    LoadOptions options;
+    std::string json_path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            std::cout << kUsage;
+            return EXIT_SUCCESS;
+        }
+        const auto equal = arg.find('=');
+        bool ok = arg.compare(0, 2, "--") == 0 && equal != std::string::npos;
+        if (ok) {
+            try {
+                ok = ParseArg(arg.substr(2, equal - 2), arg.substr(equal + 1), options, json_path);
+            } catch (const std::exception&) {
+                ok = false;
+            }
+        }
+        if (!ok) {
+            std::cerr << "Invalid argument: " << arg << "\n\n" << kUsage;
+            return EXIT_FAILURE;
+        }
+    }
+
+    milvus::loadgen::LoadReport report;
+    auto status = milvus::loadgen::RunLoad(options, report);
+    if (!status.IsOk()) {
+        std::cerr << "Load run failed: " << status.Message() << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << milvus::loadgen::FormatReport(report);
+
+    if (!json_path.empty()) {
+        std::ofstream file(json_path);
+        file << milvus::loadgen::ReportToJson(options, report).dump(4) << std::endl;
+        if (!file) {
+            std::cerr << "Unable to write " << json_path << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
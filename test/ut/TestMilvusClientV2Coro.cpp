@@ -0,0 +1,245 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "milvus/MilvusClientV2Coro.h"
+
+#ifdef MILVUS_SDK_HAS_COROUTINES
+
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A fire-and-forget coroutine, enough to drive an awaitable from a test.
+struct Detached {
+    struct promise_type {
+        Detached
+        get_return_object() {
+            return {};
+        }
+        std::suspend_never
+        initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never
+        final_suspend() noexcept {
+            return {};
+        }
+        void
+        return_void() {
+        }
+        void
+        unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+struct Outcome {
+    milvus::Status status_;
+    std::thread::id call_thread_;
+    std::thread::id resume_thread_;
+};
+
+Detached
+Await(milvus::ExecutorPtr executor, std::function<milvus::Status()> call, std::promise<Outcome>& done) {
+    Outcome outcome;
+    outcome.status_ = co_await milvus::coro::StatusAwaitable{
+        std::move(executor), [&outcome, call]() {
+            outcome.call_thread_ = std::this_thread::get_id();
+            return call();
+        }};
+    outcome.resume_thread_ = std::this_thread::get_id();
+    done.set_value(outcome);
+}
+
+// an iterator of plain integers keeps the test free of server-side result types
+class CountingIterator : public milvus::Iterator<int> {
+ public:
+    milvus::Status
+    Next(int& results) override {
+        results = ++calls_;
+        return {milvus::StatusCode::OK, "batch"};
+    }
+
+    int calls_ = 0;
+};
+
+Detached
+AwaitNext(std::shared_ptr<milvus::Iterator<int>> iterator, milvus::ExecutorPtr executor,
+          std::promise<milvus::Status>& done) {
+    int results = 0;
+    auto status = co_await milvus::coro::Next(iterator, results, std::move(executor));
+    EXPECT_EQ(results, 1);
+    done.set_value(status);
+}
+
+// holds the done callbacks as the callback stub would, until the test answers them
+class PendingCalls {
+ public:
+    milvus::coro::CallbackAwaitable
+    Send() {
+        return milvus::coro::CallbackAwaitable{[this](milvus::MilvusClientV2::AsyncDone done) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            dones_.emplace_back(std::move(done));
+            return milvus::Status::OK();
+        }};
+    }
+
+    std::vector<milvus::MilvusClientV2::AsyncDone>
+    Take() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::move(dones_);
+    }
+
+ private:
+    std::mutex mutex_;
+    std::vector<milvus::MilvusClientV2::AsyncDone> dones_;
+};
+
+Detached
+AwaitPending(PendingCalls& calls, std::atomic<int>& resumed) {
+    auto status = co_await calls.Send();
+    EXPECT_TRUE(status.IsOk());
+    ++resumed;
+}
+
+Detached
+AwaitCallback(milvus::coro::CallbackAwaitable awaitable, std::promise<Outcome>& done) {
+    Outcome outcome;
+    outcome.status_ = co_await std::move(awaitable);
+    outcome.resume_thread_ = std::this_thread::get_id();
+    done.set_value(outcome);
+}
+
+}  // namespace
+
+TEST(MilvusClientV2CoroTest, CallbackAwaitsOutnumberWorkers) {
+    // no executor at all, every await is parked on its done callback
+    constexpr int kAwaits = 32;
+    PendingCalls calls;
+    std::atomic<int> resumed{0};
+    for (int i = 0; i < kAwaits; ++i) {
+        AwaitPending(calls, resumed);
+    }
+    auto dones = calls.Take();
+    ASSERT_EQ(dones.size(), kAwaits);
+    EXPECT_EQ(resumed, 0);
+
+    // the completion queue threads answer them concurrently
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&dones, t]() {
+            for (size_t i = t; i < dones.size(); i += 4) {
+                dones[i](milvus::Status::OK());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(resumed, kAwaits);
+}
+
+TEST(MilvusClientV2CoroTest, CallbackResumesOnTheCompletingThread) {
+    PendingCalls calls;
+    std::promise<Outcome> done;
+    auto future = done.get_future();
+    AwaitCallback(calls.Send(), done);
+
+    auto dones = calls.Take();
+    ASSERT_EQ(dones.size(), 1);
+    std::thread::id completing;
+    std::thread thread([&]() {
+        completing = std::this_thread::get_id();
+        dones[0](milvus::Status{milvus::StatusCode::TIMEOUT, "late"});
+    });
+    thread.join();
+
+    const auto outcome = future.get();
+    EXPECT_EQ(outcome.status_.Code(), milvus::StatusCode::TIMEOUT);
+    EXPECT_EQ(outcome.resume_thread_, completing);
+}
+
+TEST(MilvusClientV2CoroTest, CallbackSendErrorDoesNotSuspend) {
+    std::promise<Outcome> done;
+    auto future = done.get_future();
+    AwaitCallback(milvus::coro::CallbackAwaitable{[](milvus::MilvusClientV2::AsyncDone) {
+                      return milvus::Status{milvus::StatusCode::NOT_CONNECTED, "no stub"};
+                  }},
+                  done);
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    const auto outcome = future.get();
+    EXPECT_EQ(outcome.status_.Code(), milvus::StatusCode::NOT_CONNECTED);
+    EXPECT_EQ(outcome.resume_thread_, std::this_thread::get_id());
+}
+
+TEST(MilvusClientV2CoroTest, ResumesOnTheWorkerThatRanTheCall) {
+    auto executor = milvus::Executor::Create(1);
+    std::promise<Outcome> done;
+    auto future = done.get_future();
+    Await(executor, []() { return milvus::Status{milvus::StatusCode::TIMEOUT, "late"}; }, done);
+
+    const auto outcome = future.get();
+    EXPECT_EQ(outcome.status_.Code(), milvus::StatusCode::TIMEOUT);
+    EXPECT_NE(outcome.call_thread_, std::this_thread::get_id());
+    EXPECT_EQ(outcome.resume_thread_, outcome.call_thread_);
+}
+
+TEST(MilvusClientV2CoroTest, NullExecutorRunsInline) {
+    std::promise<Outcome> done;
+    auto future = done.get_future();
+    Await(nullptr, []() { return milvus::Status::OK(); }, done);
+
+    // completed before Await() returned, on this thread
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    const auto outcome = future.get();
+    EXPECT_TRUE(outcome.status_.IsOk());
+    EXPECT_EQ(outcome.resume_thread_, std::this_thread::get_id());
+}
+
+TEST(MilvusClientV2CoroTest, ExceptionBecomesStatus) {
+    auto executor = milvus::Executor::Create(1);
+    std::promise<Outcome> done;
+    auto future = done.get_future();
+    Await(executor, []() -> milvus::Status { throw std::runtime_error("boom"); }, done);
+
+    const auto outcome = future.get();
+    EXPECT_EQ(outcome.status_.Code(), milvus::StatusCode::UNKNOWN_ERROR);
+    EXPECT_NE(outcome.status_.Message().find("boom"), std::string::npos);
+}
+
+TEST(MilvusClientV2CoroTest, IteratorNext) {
+    auto executor = milvus::Executor::Create(1);
+    auto iterator = std::make_shared<CountingIterator>();
+    std::promise<milvus::Status> done;
+    auto future = done.get_future();
+    AwaitNext(iterator, executor, done);
+
+    EXPECT_EQ(future.get().Message(), "batch");
+    EXPECT_EQ(iterator->calls_, 1);
+}
+
+#endif  // MILVUS_SDK_HAS_COROUTINES
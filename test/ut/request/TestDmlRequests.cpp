@@ -136,6 +136,22 @@ TEST_F(DeleteRequestTest, GettersAndSetters) {
     std::vector<std::string> str_ids{"a", "b", "c"};
     req3.WithIDs(std::move(str_ids));
     EXPECT_FALSE(req3.IDs().StrIDArray().empty());
+
+    EXPECT_EQ(req3.GetIDsEncoding(), milvus::IDsEncoding::LIST);
+    req3.SetIDsEncoding(milvus::IDsEncoding::ROARING_BITMAP);
+    EXPECT_EQ(req3.GetIDsEncoding(), milvus::IDsEncoding::ROARING_BITMAP);
+}
+
+TEST_F(DeleteRequestTest, FilterTemplateReplacesSameKey) {
+    milvus::DeleteRequest req;
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({1, 2}));
+    req.AddFilterTemplate("ids", nlohmann::json{7, 8});
+    EXPECT_TRUE(req.TypedFilterTemplates().empty());
+    EXPECT_EQ(req.FilterTemplates().at("ids"), (nlohmann::json{7, 8}));
+
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({3}));
+    EXPECT_TRUE(req.FilterTemplates().empty());
+    EXPECT_EQ(req.TypedFilterTemplates().size(), 1);
 }
 
 TEST_F(DeleteRequestTest, AllMethods) {
@@ -266,3 +282,28 @@ TEST_F(InsertRequestTest, DMLRequestBaseMethods) {
     req2.SetRowsData(std::move(rows));
     EXPECT_EQ(req2.RowsData().size(), 1);
 }
+
+TEST_F(InsertRequestTest, MemoryUsage) {
+    milvus::InsertRequest req;
+    const auto empty_bytes = req.MemoryUsage();
+    EXPECT_GE(empty_bytes, sizeof(milvus::InsertRequest));
+
+    auto field_data = std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>(1000, 1));
+    req.AddColumnData(field_data);
+    EXPECT_GE(req.MemoryUsage(), empty_bytes + field_data->MemoryUsage());
+
+    // a column added twice is counted once
+    const auto one_column_bytes = req.MemoryUsage();
+    req.AddColumnData(field_data);
+    EXPECT_LT(req.MemoryUsage(), one_column_bytes + field_data->MemoryUsage());
+
+    milvus::InsertRequest row_req;
+    milvus::EntityRow row;
+    row["name"] = std::string(1000, 'a');
+    row_req.AddRowData(std::move(row));
+    EXPECT_GE(row_req.MemoryUsage(), empty_bytes + 1000);
+
+    milvus::UpsertRequest upsert;
+    upsert.AddColumnData(field_data);
+    EXPECT_GE(upsert.MemoryUsage(), sizeof(milvus::UpsertRequest) + field_data->MemoryUsage());
+}
@@ -46,6 +46,9 @@ TEST_F(QueryRequestTest, GettersAndSetters) {
     string_id_req.WithIDs(std::vector<std::string>{"a", "b"});
     EXPECT_FALSE(string_id_req.IDs().IsIntegerID());
     EXPECT_EQ(string_id_req.IDs().StrIDArray(), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(string_id_req.GetIDsEncoding(), milvus::IDsEncoding::LIST);
+    string_id_req.WithIDsEncoding(milvus::IDsEncoding::BLOOM_PREFILTER);
+    EXPECT_EQ(string_id_req.GetIDsEncoding(), milvus::IDsEncoding::BLOOM_PREFILTER);
 
     req.WithLimit(100);
     EXPECT_EQ(req.Limit(), 100);
@@ -122,6 +125,21 @@ TEST_F(QueryRequestTest, DQLRequestBaseMethods) {
     EXPECT_EQ(req.CollectionName(), "another_coll");
 }
 
+TEST_F(QueryRequestTest, FilterTemplateReplacesSameKey) {
+    milvus::QueryRequest req;
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({1, 2}));
+    req.AddFilterTemplate("ids", nlohmann::json{7, 8});
+    EXPECT_TRUE(req.TypedFilterTemplates().empty());
+    EXPECT_EQ(req.FilterTemplates().at("ids"), (nlohmann::json{7, 8}));
+
+    req.AddFilterTemplate("ids", nlohmann::json{9});
+    EXPECT_EQ(req.FilterTemplates().at("ids"), nlohmann::json{9});
+
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({3}));
+    EXPECT_TRUE(req.FilterTemplates().empty());
+    EXPECT_EQ(req.TypedFilterTemplates().size(), 1);
+}
+
 class GetRequestTest : public ::testing::Test {};
 
 TEST_F(GetRequestTest, GettersAndSetters) {
@@ -148,6 +166,10 @@ TEST_F(GetRequestTest, GettersAndSetters) {
 
     req.WithConsistencyLevel(milvus::ConsistencyLevel::SESSION);
     EXPECT_EQ(req.GetConsistencyLevel(), milvus::ConsistencyLevel::SESSION);
+
+    EXPECT_EQ(req.GetIDsEncoding(), milvus::IDsEncoding::LIST);
+    req.WithIDsEncoding(milvus::IDsEncoding::AUTO);
+    EXPECT_EQ(req.GetIDsEncoding(), milvus::IDsEncoding::AUTO);
 }
 
 TEST_F(GetRequestTest, DQLRequestBaseMethods) {
@@ -270,6 +292,21 @@ TEST_F(SearchRequestTest, GettersAndSetters) {
     EXPECT_NE(req2.TargetVectors(), nullptr);
 }
 
+TEST_F(SearchRequestTest, FilterTemplateReplacesSameKey) {
+    milvus::SearchRequest req;
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({1, 2}));
+    req.AddFilterTemplate("ids", nlohmann::json{7, 8});
+    EXPECT_TRUE(req.TypedFilterTemplates().empty());
+    EXPECT_EQ(req.FilterTemplates().at("ids"), (nlohmann::json{7, 8}));
+
+    req.AddFilterTemplate("ids", nlohmann::json{9});
+    EXPECT_EQ(req.FilterTemplates().at("ids"), nlohmann::json{9});
+
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({3}));
+    EXPECT_TRUE(req.FilterTemplates().empty());
+    EXPECT_EQ(req.TypedFilterTemplates().size(), 1);
+}
+
 TEST_F(SearchRequestTest, IDs) {
     milvus::SearchRequest int_req;
     auto& int_ref = int_req.WithIDs({1, 2, 3});
@@ -704,6 +741,25 @@ TEST_F(HybridSearchRequestTest, WithStrictGroupSize) {
     EXPECT_EQ(&ref, &req);
 }
 
+TEST_F(HybridSearchRequestTest, MemoryUsage) {
+    milvus::HybridSearchRequest req;
+    const auto empty_bytes = req.MemoryUsage();
+    EXPECT_GE(empty_bytes, sizeof(milvus::HybridSearchRequest));
+
+    auto sub = std::make_shared<milvus::SubSearchRequest>();
+    sub->WithFloatVectors(std::vector<std::vector<float>>(10, std::vector<float>(128, 0.5f)));
+    EXPECT_GE(sub->MemoryUsage(), 10 * 128 * sizeof(float));
+
+    req.AddSubRequest(sub);
+    EXPECT_GE(req.MemoryUsage(), empty_bytes + sub->MemoryUsage());
+
+    milvus::SearchRequest search;
+    const auto empty_search_bytes = search.MemoryUsage();
+    search.WithFloatVectors(std::vector<std::vector<float>>(10, std::vector<float>(128, 0.5f)));
+    search.WithFilter(std::string(1000, 'a'));
+    EXPECT_GE(search.MemoryUsage(), empty_search_bytes + 10 * 128 * sizeof(float) + 1000);
+}
+
 class QueryIteratorRequestTest : public ::testing::Test {};
 
 TEST_F(QueryIteratorRequestTest, SetReduceStopForBest) {
@@ -717,3 +773,85 @@ TEST_F(QueryIteratorRequestTest, SetReduceStopForBest) {
     EXPECT_TRUE(req.ReduceStopForBest());
     EXPECT_EQ(&ref, &req);
 }
+
+class ParallelScanRequestTest : public ::testing::Test {};
+
+TEST_F(ParallelScanRequestTest, GettersAndSetters) {
+    milvus::ParallelScanRequest req;
+    EXPECT_EQ(req.Concurrency(), 4);
+    EXPECT_EQ(req.ShardCount(), 0);
+    EXPECT_EQ(req.PkBoundaries().GetRowCount(), 0);
+    EXPECT_EQ(req.Limit(), -1);
+
+    req.SetConcurrency(0);
+    EXPECT_EQ(req.Concurrency(), 4);
+
+    auto& ref = req.WithConcurrency(8).WithShardCount(16).WithPkBoundaries(milvus::IDArray(std::vector<int64_t>{5}));
+    EXPECT_EQ(&ref, &req);
+    EXPECT_EQ(req.Concurrency(), 8);
+    EXPECT_EQ(req.ShardCount(), 16);
+    EXPECT_EQ(req.PkBoundaries().IntIDArray(), std::vector<int64_t>{5});
+}
+
+class MultiSearchRequestTest : public ::testing::Test {};
+
+TEST_F(MultiSearchRequestTest, GettersAndSetters) {
+    milvus::MultiSearchRequest req;
+    EXPECT_TRUE(req.Requests().empty());
+    EXPECT_EQ(req.Concurrency(), 8);
+    EXPECT_FALSE(req.StopOnError());
+    EXPECT_EQ(req.TimeoutMs(), 0);
+
+    req.SetConcurrency(0);
+    EXPECT_EQ(req.Concurrency(), 8);
+
+    milvus::SearchRequest search;
+    search.SetCollectionName("a");
+    auto& ref = req.WithConcurrency(2).WithStopOnError(true).WithTimeoutMs(500).AddRequest(search).AddRequest(
+        milvus::SearchRequest().WithCollectionName("b"));
+    EXPECT_EQ(&ref, &req);
+    EXPECT_EQ(req.Concurrency(), 2);
+    EXPECT_TRUE(req.StopOnError());
+    EXPECT_EQ(req.TimeoutMs(), 500);
+    ASSERT_EQ(req.Requests().size(), 2);
+    EXPECT_EQ(req.Requests().at(0).CollectionName(), "a");
+    EXPECT_EQ(req.Requests().at(1).CollectionName(), "b");
+
+    req.SetRequests(std::vector<milvus::SearchRequest>{});
+    EXPECT_TRUE(req.Requests().empty());
+}
+
+class FederatedSearchRequestTest : public ::testing::Test {};
+
+TEST_F(FederatedSearchRequestTest, GettersAndSetters) {
+    milvus::FederatedSearchRequest req;
+    EXPECT_TRUE(req.CollectionNames().empty());
+    EXPECT_EQ(req.Concurrency(), 8);
+
+    req.SetConcurrency(0);
+    EXPECT_EQ(req.Concurrency(), 8);
+
+    auto& ref = req.WithConcurrency(3)
+                    .WithRequest(milvus::SearchRequest().WithLimit(5))
+                    .WithCollectionNames({"a", "b"})
+                    .AddCollectionName("c");
+    EXPECT_EQ(&ref, &req);
+    EXPECT_EQ(req.Concurrency(), 3);
+    EXPECT_EQ(req.Request().Limit(), 5);
+    EXPECT_EQ(req.CollectionNames(), std::vector<std::string>({"a", "b", "c"}));
+
+    req.SetCollectionNames({});
+    EXPECT_TRUE(req.CollectionNames().empty());
+}
+
+class QueryStreamRequestTest : public ::testing::Test {};
+
+TEST_F(QueryStreamRequestTest, DefaultPrefetch) {
+    milvus::QueryStreamRequest req;
+    EXPECT_EQ(req.PrefetchDepth(), 1);
+    EXPECT_EQ(req.Limit(), -1);
+
+    auto status = req.SetPrefetchDepth(0);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(req.PrefetchDepth(), 0);
+}
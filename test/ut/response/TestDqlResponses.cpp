@@ -68,3 +68,24 @@ TEST_F(SearchResponseTest, SetterAndGetter) {
     ASSERT_EQ(resp.AggregationBuckets().at(0).size(), 1);
     EXPECT_EQ(resp.AggregationBuckets().at(0).at(0).count, 7);
 }
+
+class MultiSearchResponseTest : public ::testing::Test {};
+
+TEST_F(MultiSearchResponseTest, SetterAndGetter) {
+    milvus::MultiSearchResponse resp;
+    EXPECT_TRUE(resp.Statuses().empty());
+    EXPECT_TRUE(resp.Responses().empty());
+    EXPECT_EQ(resp.FailedCount(), 0);
+
+    std::vector<milvus::Status> statuses{milvus::Status::OK(), milvus::Status{milvus::StatusCode::TIMEOUT, "late"}};
+    std::vector<milvus::SearchResponse> responses(2);
+    responses[0].SetSessionTs(100);
+    resp.SetStatuses(std::move(statuses));
+    resp.SetResponses(std::move(responses));
+
+    ASSERT_EQ(resp.Statuses().size(), 2);
+    EXPECT_EQ(resp.Statuses().at(1).Code(), milvus::StatusCode::TIMEOUT);
+    ASSERT_EQ(resp.Responses().size(), 2);
+    EXPECT_EQ(resp.Responses().at(0).SessionTs(), 100u);
+    EXPECT_EQ(resp.FailedCount(), 1);
+}
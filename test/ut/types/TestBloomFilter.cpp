@@ -132,6 +132,38 @@ TEST(BloomFilterTest, BatchInsertMatchesOneAtATime) {
     EXPECT_EQ(one_by_one.Build(), batched.Build());
 }
 
+// Large enough to take the batched and the threaded paths, which one-at-a-time inserts never reach.
+TEST(BloomFilterTest, ThreadedInsertMatchesOneAtATime) {
+    std::vector<int64_t> numbers(200000);
+    for (size_t i = 0; i < numbers.size(); i++) {
+        numbers[i] = static_cast<int64_t>(i * 2654435761ULL);
+    }
+    std::vector<std::string> words(100000);
+    for (size_t i = 0; i < words.size(); i++) {
+        words[i] = "member-" + std::to_string(i * 7919);
+    }
+
+    milvus::BloomFilterBuilder one_by_one(numbers.size() + words.size(), 0.001);
+    for (auto value : numbers) {
+        one_by_one.AddInt64(value);
+    }
+    for (const auto& value : words) {
+        one_by_one.AddString(value);
+    }
+    const auto expected = one_by_one.Build();
+
+    for (uint32_t threads : {1u, 2u, 3u, 8u}) {
+        milvus::BloomFilterBuilder threaded(numbers.size() + words.size(), 0.001);
+        threaded.AddInt64s(numbers, threads).AddStrings(words, threads);
+        EXPECT_EQ(expected, threaded.Build()) << threads << " threads";
+    }
+
+    // more threads than blocks is clamped, not an error
+    milvus::BloomFilterBuilder tiny(1, 0.05);
+    tiny.AddInt64s(numbers, 64);
+    EXPECT_EQ(1u, tiny.NumBlocks());
+}
+
 TEST(BloomFilterTest, BuildsATemplateReadyBinaryValue) {
     nlohmann::json value;
     auto status = milvus::BloomFilterTemplate(std::vector<std::string>{"alice", "bob", "小明"}, 0.01, value);
@@ -170,3 +170,27 @@ TEST_F(ConnectParamTest, WithTlsBuilder) {
     EXPECT_EQ(ref3.Key(), "key");
     EXPECT_EQ(ref3.CaCert(), "ca");
 }
+
+TEST_F(ConnectParamTest, SchemaCacheFile) {
+    milvus::ConnectParam param{"http://localhost:19530"};
+    EXPECT_TRUE(param.SchemaCacheFile().empty());
+
+    param.SetSchemaCacheFile("/tmp/schemas.bin");
+    EXPECT_EQ(param.SchemaCacheFile(), "/tmp/schemas.bin");
+
+    milvus::ConnectParam copied;
+    copied = param.WithSchemaCacheFile("schemas.bin");
+    EXPECT_EQ(copied.SchemaCacheFile(), "schemas.bin");
+}
+
+TEST_F(ConnectParamTest, CallTimingEnabled) {
+    milvus::ConnectParam param{"http://localhost:19530"};
+    EXPECT_FALSE(param.CallTimingEnabled());
+
+    param.SetCallTimingEnabled(true);
+    EXPECT_TRUE(param.CallTimingEnabled());
+
+    auto& ref = param.WithCallTimingEnabled(false);
+    EXPECT_FALSE(ref.CallTimingEnabled());
+    EXPECT_EQ(&ref, &param);
+}
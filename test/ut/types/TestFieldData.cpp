@@ -715,3 +715,26 @@ TEST_F(FieldDataTest, Int8VecFieldData) {
     auto& vd = data.ValidData();
     EXPECT_EQ(vd.size(), 2);
 }
+
+TEST_F(FieldDataTest, MemoryUsage) {
+    milvus::Int64FieldData empty{"id"};
+    EXPECT_GE(empty.MemoryUsage(), sizeof(milvus::Int64FieldData));
+
+    milvus::Int64FieldData ids{"id", std::vector<int64_t>(1000, 1)};
+    EXPECT_GE(ids.MemoryUsage(), empty.MemoryUsage() + 1000 * sizeof(int64_t));
+
+    // the validity bits of a nullable field are counted as well
+    milvus::Int64FieldData nullable_ids{"id", std::vector<int64_t>(1000, 1), std::vector<bool>(1000, true)};
+    EXPECT_GT(nullable_ids.MemoryUsage(), ids.MemoryUsage());
+
+    // each vector of a vector field owns its buffer
+    milvus::FloatVecFieldData vectors{"vector", std::vector<std::vector<float>>(10, std::vector<float>(128, 0.5f))};
+    EXPECT_GE(vectors.MemoryUsage(), 10 * (sizeof(std::vector<float>) + 128 * sizeof(float)));
+
+    // strings longer than the inline buffer are counted
+    milvus::VarCharFieldData texts{"text", std::vector<std::string>(10, std::string(1000, 'a'))};
+    EXPECT_GE(texts.MemoryUsage(), 10 * 1000);
+
+    const milvus::Field& field = texts;
+    EXPECT_EQ(field.MemoryUsage(), texts.MemoryUsage());
+}
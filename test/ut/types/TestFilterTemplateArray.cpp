@@ -0,0 +1,68 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "milvus/types/FilterTemplateArray.h"
+
+class FilterTemplateArrayTest : public ::testing::Test {};
+
+TEST_F(FilterTemplateArrayTest, Default) {
+    milvus::FilterTemplateArray array;
+    EXPECT_EQ(array.ElementType(), milvus::DataType::INT64);
+    EXPECT_EQ(array.Size(), 0);
+    EXPECT_TRUE(array.Int64Values().empty());
+    EXPECT_TRUE(array.StringValues().empty());
+}
+
+TEST_F(FilterTemplateArrayTest, TypedValues) {
+    auto bools = milvus::FilterTemplateArray::Bools({true, false, true});
+    EXPECT_EQ(bools.ElementType(), milvus::DataType::BOOL);
+    EXPECT_EQ(bools.Size(), 3);
+    EXPECT_EQ(bools.BoolValues(), (std::vector<bool>{true, false, true}));
+    EXPECT_TRUE(bools.Int64Values().empty());
+
+    const int64_t buffer[] = {1, 2, 3, 4};
+    auto ints = milvus::FilterTemplateArray::Int64s(buffer + 1, 2);
+    EXPECT_EQ(ints.ElementType(), milvus::DataType::INT64);
+    EXPECT_EQ(ints.Int64Values(), (std::vector<int64_t>{2, 3}));
+
+    const double doubles_buffer[] = {0.5, 1.5};
+    auto doubles = milvus::FilterTemplateArray::Doubles(doubles_buffer, 2);
+    EXPECT_EQ(doubles.ElementType(), milvus::DataType::DOUBLE);
+    EXPECT_EQ(doubles.DoubleValues(), (std::vector<double>{0.5, 1.5}));
+
+    auto strings = milvus::FilterTemplateArray::Strings({"a", "b"});
+    EXPECT_EQ(strings.ElementType(), milvus::DataType::VARCHAR);
+    EXPECT_EQ(strings.StringValues(), (std::vector<std::string>{"a", "b"}));
+
+    auto nested = milvus::FilterTemplateArray::Arrays({ints, strings});
+    EXPECT_EQ(nested.ElementType(), milvus::DataType::ARRAY);
+    ASSERT_EQ(nested.Size(), 2);
+    EXPECT_EQ(nested.ArrayValues().at(1).StringValues(), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST_F(FilterTemplateArrayTest, CopiesShareValues) {
+    std::vector<int64_t> ids(1000, 7);
+    const auto* data = ids.data();
+    auto array = milvus::FilterTemplateArray::Int64s(std::move(ids));
+    auto copy = array;
+    EXPECT_EQ(array.Int64Values().data(), data);
+    EXPECT_EQ(copy.Int64Values().data(), data);
+}
@@ -52,6 +52,35 @@ TEST_F(QueryIteratorArgumentsTest, SetPkSchema) {
     EXPECT_EQ(args.PkSchema().Name(), "pk");
 }
 
+TEST_F(QueryIteratorArgumentsTest, PrefetchDepth) {
+    milvus::QueryIteratorArguments args;
+    EXPECT_EQ(args.PrefetchDepth(), 0);
+
+    EXPECT_TRUE(args.SetPrefetchDepth(4).IsOk());
+    EXPECT_EQ(args.PrefetchDepth(), 4);
+
+    EXPECT_FALSE(args.SetPrefetchDepth(-1).IsOk());
+    EXPECT_FALSE(args.SetPrefetchDepth(65).IsOk());
+    EXPECT_EQ(args.PrefetchDepth(), 4);
+
+    milvus::QueryIteratorRequest request;
+    EXPECT_TRUE(request.SetPrefetchDepth(2).IsOk());
+    EXPECT_EQ(request.PrefetchDepth(), 2);
+}
+
+TEST_F(QueryIteratorArgumentsTest, PrefetchStats) {
+    milvus::IteratorPrefetchStats empty;
+    EXPECT_EQ(empty.Depth(), 0u);
+    EXPECT_DOUBLE_EQ(empty.HitRatio(), 0.0);
+
+    milvus::IteratorPrefetchStats stats(2, 5, 3, 1);
+    EXPECT_EQ(stats.Depth(), 2u);
+    EXPECT_EQ(stats.FetchedPages(), 5u);
+    EXPECT_EQ(stats.Hits(), 3u);
+    EXPECT_EQ(stats.Misses(), 1u);
+    EXPECT_DOUBLE_EQ(stats.HitRatio(), 0.75);
+}
+
 TEST_F(QueryIteratorArgumentsTest, ReduceStopForBest) {
     milvus::QueryIteratorArguments args;
     EXPECT_TRUE(args.ReduceStopForBest());
@@ -79,3 +79,19 @@ TEST_F(QueryResultsTest, Clear) {
     results.Clear();
     EXPECT_EQ(results.OutputFields().size(), 0);
 }
+
+TEST_F(QueryResultsTest, MemoryUsage) {
+    auto int_field = std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>(1000, 1));
+    auto str_field = std::make_shared<milvus::VarCharFieldData>("name", std::vector<std::string>(100, "a long name"));
+
+    milvus::QueryResults results(std::vector<milvus::FieldDataPtr>{int_field, str_field}, {"id", "name"});
+    EXPECT_GE(results.MemoryUsage(),
+              sizeof(milvus::QueryResults) + int_field->MemoryUsage() + str_field->MemoryUsage());
+
+    // a field listed twice is counted once
+    milvus::QueryResults twice(std::vector<milvus::FieldDataPtr>{int_field, int_field}, {"id"});
+    EXPECT_LT(twice.MemoryUsage(), sizeof(milvus::QueryResults) + 2 * int_field->MemoryUsage());
+
+    results.Clear();
+    EXPECT_LT(results.MemoryUsage(), int_field->MemoryUsage());
+}
@@ -0,0 +1,55 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "milvus/MilvusClientV2.h"
+
+class ResultCacheParamTest : public ::testing::Test {};
+
+TEST_F(ResultCacheParamTest, DefaultValues) {
+    milvus::ResultCacheParam param;
+    EXPECT_EQ(param.CapacityBytes(), 0u);
+    EXPECT_EQ(param.TtlMs(), 1000u);
+}
+
+TEST_F(ResultCacheParamTest, WithValues) {
+    milvus::ResultCacheParam param;
+    auto& ref = param.WithCapacityBytes(1024).WithTtlMs(50);
+    EXPECT_EQ(&ref, &param);
+    EXPECT_EQ(param.CapacityBytes(), 1024u);
+    EXPECT_EQ(param.TtlMs(), 50u);
+
+    param.SetTtlMs(0);
+    EXPECT_EQ(param.TtlMs(), 50u);
+    param.SetCapacityBytes(0);
+    EXPECT_EQ(param.CapacityBytes(), 0u);
+}
+
+TEST_F(ResultCacheParamTest, Stats) {
+    milvus::ResultCacheStats empty;
+    EXPECT_EQ(empty.Hits(), 0u);
+    EXPECT_DOUBLE_EQ(empty.HitRatio(), 0.0);
+
+    milvus::ResultCacheStats stats(3, 1, 2, 4, 5, 6);
+    EXPECT_EQ(stats.Hits(), 3u);
+    EXPECT_EQ(stats.Misses(), 1u);
+    EXPECT_EQ(stats.Evictions(), 2u);
+    EXPECT_EQ(stats.Invalidations(), 4u);
+    EXPECT_EQ(stats.Entries(), 5u);
+    EXPECT_EQ(stats.Bytes(), 6u);
+    EXPECT_DOUBLE_EQ(stats.HitRatio(), 0.75);
+}
@@ -16,9 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <milvus/thirdparty/nlohmann/json.hpp>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -254,6 +256,58 @@ TEST(RoaringBitmapTest, CollapsesDuplicatesAndIgnoresInputOrder) {
     EXPECT_EQ(6u, repeated.Cardinality());
 }
 
+namespace {
+
+// Mixed containers in several high groups: dense runs, a bitmap-sized block, sparse strays and
+// negative members, large enough to take the radix sort and the threaded body write.
+std::vector<int64_t>
+MixedMembers() {
+    std::vector<int64_t> members;
+    for (int64_t i = 0; i < 300000; i++) {
+        members.push_back((1LL << 40) + i);
+    }
+    for (int64_t i = 0; i < 200000; i++) {
+        members.push_back((7LL << 32) + i * 3);
+    }
+    for (int64_t i = 0; i < 50000; i++) {
+        members.push_back(-1 - i * 1000003);
+    }
+    return members;
+}
+
+}  // namespace
+
+TEST(RoaringBitmapTest, SortPathsAndThreadsYieldTheSameBytes) {
+    auto members = MixedMembers();
+    std::vector<int64_t> shuffled = members;
+    std::mt19937_64 rng(42);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    // duplicates on top of the shuffle
+    shuffled.insert(shuffled.end(), members.begin(), members.begin() + 1000);
+
+    // the reference: std::sort in unsigned order, then members streamed in already normalized
+    std::vector<uint64_t> keys(members.begin(), members.end());
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    milvus::RoaringBitmapBuilder streamed;
+    for (const auto key : keys) {
+        streamed.AddInt64(static_cast<int64_t>(key));
+        streamed.AddInt64(static_cast<int64_t>(key));
+    }
+    ASSERT_EQ(keys.size(), streamed.Cardinality());
+    const auto expected = streamed.Build();
+
+    milvus::RoaringBitmapBuilder radix;
+    radix.AddInt64s(shuffled);
+    EXPECT_EQ(keys.size(), radix.Cardinality());
+    EXPECT_EQ(expected, radix.Build());
+
+    for (uint32_t threads : {2u, 3u, 8u, 1000u}) {
+        EXPECT_EQ(expected, radix.Build(threads)) << threads << " threads";
+    }
+    EXPECT_EQ(nlohmann::json::binary(expected), radix.BuildTemplate(4));
+}
+
 TEST(RoaringBitmapTest, BuildsAnEmptyBitmap) {
     milvus::RoaringBitmapBuilder builder;
     const auto blob = builder.Build();
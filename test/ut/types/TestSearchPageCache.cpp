@@ -0,0 +1,122 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "milvus/types/FieldData.h"
+#include "milvus/types/SearchResults.h"
+#include "types/SearchPageCache.h"
+
+namespace {
+
+const std::set<std::string> kOutputFields{"id", "score"};
+
+milvus::SingleResultPtr
+MakePage(int64_t from, int64_t to) {
+    std::vector<int64_t> ids;
+    std::vector<float> scores;
+    for (auto i = from; i < to; ++i) {
+        ids.push_back(i);
+        scores.push_back(static_cast<float>(i));
+    }
+    std::vector<milvus::FieldDataPtr> fields;
+    fields.emplace_back(std::make_shared<milvus::Int64FieldData>("id", std::move(ids)));
+    fields.emplace_back(std::make_shared<milvus::FloatFieldData>("score", std::move(scores)));
+    return std::make_shared<milvus::SingleResult>("id", "score", std::move(fields), kOutputFields);
+}
+
+std::vector<int64_t>
+PageIds(const milvus::SingleResult& page) {
+    auto ids = page.OutputField<milvus::Int64FieldData>("id");
+    return ids == nullptr ? std::vector<int64_t>{} : ids->Data();
+}
+
+}  // namespace
+
+class SearchPageCacheTest : public ::testing::Test {};
+
+TEST_F(SearchPageCacheTest, CountAndEmptyPages) {
+    milvus::SearchPageCache cache;
+    EXPECT_EQ(cache.Count(), 0);
+
+    cache.Push(nullptr);
+    cache.Push(MakePage(0, 0));
+    EXPECT_EQ(cache.Count(), 0);
+
+    cache.Push(MakePage(0, 3));
+    cache.Push(MakePage(3, 8));
+    EXPECT_EQ(cache.Count(), 8);
+
+    milvus::SingleResult page;
+    auto status = cache.Fetch(kOutputFields, 2, page);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(cache.Count(), 6);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Count(), 0);
+    milvus::SingleResult empty;
+    status = cache.Fetch(kOutputFields, 2, empty);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(empty.GetRowCount(), 0);
+}
+
+TEST_F(SearchPageCacheTest, WholePageIsMoved) {
+    milvus::SearchPageCache cache;
+    auto source = MakePage(0, 4);
+    auto source_ids = source->OutputField("id");
+    cache.Push(source);
+
+    milvus::SingleResult page;
+    auto status = cache.Fetch(kOutputFields, 4, page);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(page.OutputField("id"), source_ids);
+    EXPECT_EQ(PageIds(page), (std::vector<int64_t>{0, 1, 2, 3}));
+    EXPECT_EQ(cache.Count(), 0);
+}
+
+TEST_F(SearchPageCacheTest, PartialFetchKeepsOffset) {
+    milvus::SearchPageCache cache;
+    auto first = MakePage(0, 5);
+    auto first_ids = first->OutputField("id");
+    cache.Push(first);
+    cache.Push(MakePage(5, 7));
+
+    // the rows left in the head page are not copied
+    milvus::SingleResult page;
+    auto status = cache.Fetch(kOutputFields, 2, page);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(PageIds(page), (std::vector<int64_t>{0, 1}));
+    EXPECT_EQ(first->OutputField("id"), first_ids);
+    EXPECT_EQ(first_ids->Count(), 5);
+
+    page.Clear();
+    status = cache.Fetch(kOutputFields, 2, page);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(PageIds(page), (std::vector<int64_t>{2, 3}));
+
+    // the tail of the head page and the next page in one batch
+    page.Clear();
+    status = cache.Fetch(kOutputFields, 10, page);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(PageIds(page), (std::vector<int64_t>{4, 5, 6}));
+    EXPECT_EQ(page.Scores().size(), 3);
+    EXPECT_EQ(cache.Count(), 0);
+}
@@ -51,6 +51,17 @@ TEST_F(SearchResultsTest, GeneralTesting) {
     EXPECT_EQ(1, results.Results().size());
 }
 
+TEST_F(SearchResultsTest, MemoryUsage) {
+    auto pk = std::make_shared<milvus::Int64FieldData>("pk", std::vector<int64_t>(100, 1));
+    auto score = std::make_shared<milvus::FloatFieldData>("score", std::vector<float>(100, 0.5f));
+    milvus::SingleResult single{"pk", "score", std::vector<milvus::FieldDataPtr>{pk, score}, {}};
+    EXPECT_GE(single.MemoryUsage(), sizeof(milvus::SingleResult) + pk->MemoryUsage() + score->MemoryUsage());
+
+    std::vector<milvus::SingleResult> result_array{single, single};
+    milvus::SearchResults results(std::move(result_array));
+    EXPECT_GE(results.MemoryUsage(), sizeof(milvus::SearchResults) + 2 * single.MemoryUsage());
+}
+
 TEST_F(SearchResultsTest, RecallsAndWithRecalls) {
     milvus::SearchResults results;
     EXPECT_TRUE(results.Recalls().empty());
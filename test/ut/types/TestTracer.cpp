@@ -0,0 +1,64 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "milvus/types/Tracer.h"
+
+class TracerTest : public ::testing::Test {};
+
+TEST_F(TracerTest, SpanAttributes) {
+    milvus::SpanAttributes attributes;
+    EXPECT_TRUE(attributes.RpcName().empty());
+    EXPECT_EQ(attributes.Nq(), 0);
+    EXPECT_EQ(attributes.Retries(), 0);
+
+    attributes.SetRpcName("Search");
+    attributes.SetDatabaseName("db");
+    attributes.SetCollectionName("coll");
+    attributes.SetNq(3);
+    attributes.SetRows(10);
+    attributes.SetRequestBytes(100);
+    attributes.SetResponseBytes(200);
+    attributes.SetRetries(2);
+    EXPECT_EQ(attributes.RpcName(), "Search");
+    EXPECT_EQ(attributes.DatabaseName(), "db");
+    EXPECT_EQ(attributes.CollectionName(), "coll");
+    EXPECT_EQ(attributes.Nq(), 3);
+    EXPECT_EQ(attributes.Rows(), 10);
+    EXPECT_EQ(attributes.RequestBytes(), 100);
+    EXPECT_EQ(attributes.ResponseBytes(), 200);
+    EXPECT_EQ(attributes.Retries(), 2);
+}
+
+TEST_F(TracerTest, Traceparent) {
+    const std::string trace_id = "4bf92f3577b34da6a3ce929d0e0e4736";
+    const std::string span_id = "00f067aa0ba902b7";
+    EXPECT_STREQ(milvus::TRACEPARENT_HEADER, "traceparent");
+    EXPECT_EQ(milvus::Traceparent(trace_id, span_id, true), "00-" + trace_id + "-" + span_id + "-01");
+    EXPECT_EQ(milvus::Traceparent(trace_id, span_id, false), "00-" + trace_id + "-" + span_id + "-00");
+}
+
+TEST_F(TracerTest, TraceparentMalformedIds) {
+    const std::string trace_id = "4bf92f3577b34da6a3ce929d0e0e4736";
+    const std::string span_id = "00f067aa0ba902b7";
+    EXPECT_TRUE(milvus::Traceparent("4bf92f3577b34da6", span_id, true).empty());
+    EXPECT_TRUE(milvus::Traceparent(trace_id, "00f067aa", true).empty());
+    EXPECT_TRUE(milvus::Traceparent("4BF92F3577B34DA6A3CE929D0E0E4736", span_id, true).empty());
+    EXPECT_TRUE(milvus::Traceparent(trace_id, "00f067aa0ba902bz", true).empty());
+    EXPECT_TRUE(milvus::Traceparent(std::string(32, '0'), span_id, true).empty());
+    EXPECT_TRUE(milvus::Traceparent(trace_id, std::string(16, '0'), true).empty());
+}
@@ -0,0 +1,108 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "milvus.pb.h"
+#include "utils/AllocationTracker.h"
+
+namespace {
+
+// stands in for the per thread counter of a counting operator new
+thread_local uint64_t allocated_bytes = 0;
+
+uint64_t
+AllocatedBytes() {
+    return allocated_bytes;
+}
+
+}  // namespace
+
+class AllocationTrackerTest : public ::testing::Test {
+ protected:
+    void
+    TearDown() override {
+        milvus::AllocationTracker::GetInstance().SetCounter(nullptr);
+    }
+};
+
+TEST_F(AllocationTrackerTest, OffWithoutCounter) {
+    auto& tracker = milvus::AllocationTracker::GetInstance();
+    tracker.SetCounter(nullptr);
+    EXPECT_EQ(tracker.Counter(), nullptr);
+    {
+        milvus::AllocationScope scope(milvus::proto::milvus::SearchRequest::descriptor());
+        allocated_bytes += 100;
+    }
+    EXPECT_TRUE(tracker.Stats().Apis().empty());
+}
+
+TEST_F(AllocationTrackerTest, RecordsBytesPerApi) {
+    auto& tracker = milvus::AllocationTracker::GetInstance();
+    tracker.SetCounter(AllocatedBytes);
+    ASSERT_NE(tracker.Counter(), nullptr);
+
+    {
+        milvus::AllocationScope scope(milvus::proto::milvus::SearchRequest::descriptor());
+        allocated_bytes += 100;
+    }
+    {
+        milvus::AllocationScope scope(milvus::proto::milvus::SearchRequest::descriptor());
+        allocated_bytes += 300;
+    }
+    {
+        milvus::AllocationScope scope(milvus::proto::milvus::InsertRequest::descriptor());
+        allocated_bytes += 50;
+    }
+
+    auto stats = tracker.Stats();
+    ASSERT_EQ(stats.Apis().size(), 2);
+    EXPECT_EQ(stats.TotalBytes(), 450);
+
+    const auto& insert = stats.Apis().at(0);
+    EXPECT_EQ(insert.Api(), "Insert");
+    EXPECT_EQ(insert.Calls(), 1);
+    EXPECT_EQ(insert.TotalBytes(), 50);
+
+    const auto& search = stats.Apis().at(1);
+    EXPECT_EQ(search.Api(), "Search");
+    EXPECT_EQ(search.Calls(), 2);
+    EXPECT_EQ(search.TotalBytes(), 400);
+    EXPECT_EQ(search.MaxBytes(), 300);
+    EXPECT_DOUBLE_EQ(search.MeanBytes(), 200.0);
+}
+
+TEST_F(AllocationTrackerTest, SettingCounterClearsStats) {
+    auto& tracker = milvus::AllocationTracker::GetInstance();
+    tracker.SetCounter(AllocatedBytes);
+    {
+        milvus::AllocationScope scope(milvus::proto::milvus::QueryRequest::descriptor());
+        allocated_bytes += 10;
+    }
+    EXPECT_EQ(tracker.Stats().Apis().size(), 1);
+
+    tracker.SetCounter(AllocatedBytes);
+    EXPECT_TRUE(tracker.Stats().Apis().empty());
+    EXPECT_EQ(tracker.Stats().TotalBytes(), 0);
+}
+
+TEST_F(AllocationTrackerTest, EmptyStats) {
+    milvus::ApiAllocationStats stats;
+    EXPECT_EQ(stats.Calls(), 0);
+    EXPECT_DOUBLE_EQ(stats.MeanBytes(), 0.0);
+}
@@ -0,0 +1,205 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "milvus/response/alias/ListAliasesResponse.h"
+#include "utils/CallTimer.h"
+
+namespace {
+
+using Stage = milvus::CallTiming::Stage;
+
+void
+SleepMs(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+}  // namespace
+
+TEST(CallTimerTest, DisabledLeavesNoTiming) {
+    milvus::ListAliasesResponse response;
+    {
+        milvus::CallTimer call_timer(false, response);
+        milvus::StageTimer stage_timer(Stage::RPC);
+    }
+    EXPECT_EQ(response.Timing(), nullptr);
+
+    // a stage outside any call is not recorded
+    milvus::StageTimer stage_timer(Stage::RPC);
+}
+
+TEST(CallTimerTest, StagesAndAttempts) {
+    milvus::ListAliasesResponse response;
+    {
+        milvus::CallTimer call_timer(true, response);
+        {
+            milvus::StageTimer stage_timer(Stage::VALIDATE);
+        }
+        {
+            milvus::StageTimer stage_timer(Stage::BACKOFF);
+            for (int i = 0; i < 2; ++i) {
+                {
+                    milvus::StageTimer attempt(Stage::RPC);
+                    SleepMs(5);
+                }
+                SleepMs(5);
+            }
+        }
+        {
+            milvus::StageTimer stage_timer(Stage::DECODE);
+            SleepMs(2);
+        }
+    }
+
+    auto timing = response.Timing();
+    ASSERT_NE(timing, nullptr);
+    EXPECT_EQ(timing->Attempts().size(), 2);
+    EXPECT_GE(timing->Elapsed(Stage::RPC), std::chrono::milliseconds(10));
+    EXPECT_GE(timing->Elapsed(Stage::BACKOFF), std::chrono::milliseconds(10));
+    EXPECT_GE(timing->Elapsed(Stage::DECODE), std::chrono::milliseconds(2));
+    EXPECT_EQ(timing->Elapsed(Stage::WAIT).count(), 0);
+
+    // the stages do not overlap
+    milvus::CallTiming::Duration sum{0};
+    for (size_t i = 0; i < milvus::CallTiming::kStageCount; ++i) {
+        sum += timing->Elapsed(static_cast<Stage>(i));
+    }
+    EXPECT_LE(sum, timing->Total());
+    EXPECT_EQ(timing->Attempts().at(0) + timing->Attempts().at(1), timing->Elapsed(Stage::RPC));
+}
+
+TEST(CallTimerTest, SchemaLookupTakesNestedStages) {
+    milvus::ListAliasesResponse response;
+    {
+        milvus::CallTimer call_timer(true, response);
+        milvus::StageTimer convert(Stage::CONVERT);
+        {
+            milvus::StageTimer lookup(Stage::SCHEMA_LOOKUP);
+            // the stages of the DescribeCollection() call made by the lookup
+            milvus::StageTimer rpc(Stage::RPC);
+            SleepMs(5);
+        }
+    }
+
+    auto timing = response.Timing();
+    ASSERT_NE(timing, nullptr);
+    EXPECT_GE(timing->Elapsed(Stage::SCHEMA_LOOKUP), std::chrono::milliseconds(5));
+    EXPECT_LT(timing->Elapsed(Stage::CONVERT), std::chrono::milliseconds(5));
+    EXPECT_EQ(timing->Elapsed(Stage::RPC).count(), 0);
+    EXPECT_TRUE(timing->Attempts().empty());
+}
+
+TEST(CallTimerTest, OnlyOutermostCallIsTimed) {
+    milvus::ListAliasesResponse outer;
+    milvus::ListAliasesResponse inner;
+    {
+        milvus::CallTimer outer_timer(true, outer);
+        {
+            milvus::CallTimer inner_timer(true, inner);
+            milvus::StageTimer rpc(Stage::RPC);
+        }
+    }
+    EXPECT_NE(outer.Timing(), nullptr);
+    EXPECT_EQ(inner.Timing(), nullptr);
+    EXPECT_EQ(outer.Timing()->Attempts().size(), 1);
+}
+
+TEST(CallTimerTest, FanOutSumsSubCallsOfAllThreads) {
+    milvus::ListAliasesResponse response;
+    std::vector<milvus::ListAliasesResponse> parts(3);
+    {
+        milvus::FanOutTimer fan_out_timer(true, response);
+        ASSERT_TRUE(fan_out_timer.Enabled());
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < parts.size(); ++i) {
+            threads.emplace_back([&fan_out_timer, &parts, i]() {
+                milvus::CallTimer call_timer(fan_out_timer.Enabled(), parts[i]);
+                milvus::StageTimer rpc(Stage::RPC);
+                SleepMs(5);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& part : parts) {
+            fan_out_timer.Add(part);
+        }
+    }
+
+    auto timing = response.Timing();
+    ASSERT_NE(timing, nullptr);
+    EXPECT_EQ(timing->Attempts().size(), parts.size());
+    milvus::CallTiming::Duration rpc_sum{0};
+    for (const auto& part : parts) {
+        ASSERT_NE(part.Timing(), nullptr);
+        EXPECT_EQ(part.Timing()->Attempts().size(), 1);
+        rpc_sum += part.Timing()->Elapsed(Stage::RPC);
+    }
+    EXPECT_EQ(timing->Elapsed(Stage::RPC), rpc_sum);
+    EXPECT_GE(timing->Total(), std::chrono::milliseconds(5));
+}
+
+TEST(CallTimerTest, FanOutInsideTimedCallIsNotTimed) {
+    milvus::ListAliasesResponse outer;
+    milvus::ListAliasesResponse response;
+    {
+        milvus::CallTimer outer_timer(true, outer);
+        milvus::FanOutTimer fan_out_timer(true, response);
+        EXPECT_FALSE(fan_out_timer.Enabled());
+    }
+    EXPECT_NE(outer.Timing(), nullptr);
+    EXPECT_EQ(response.Timing(), nullptr);
+}
+
+TEST(CallTimerTest, DetachedCallFinishesOnAnotherThread) {
+    milvus::ListAliasesResponse response;
+    std::unique_ptr<milvus::CallTimer> call_timer(new milvus::CallTimer(true, response));
+    {
+        milvus::StageTimer convert(Stage::CONVERT);
+    }
+    call_timer->Detach(Stage::RPC);
+
+    // the calling thread times another call while the first one is in flight
+    milvus::ListAliasesResponse other;
+    {
+        milvus::CallTimer other_timer(true, other);
+    }
+    EXPECT_NE(other.Timing(), nullptr);
+
+    std::thread([&call_timer]() {
+        SleepMs(5);
+        call_timer->Attach();
+        {
+            milvus::StageTimer decode(Stage::DECODE);
+            SleepMs(2);
+        }
+        call_timer.reset();
+    }).join();
+
+    auto timing = response.Timing();
+    ASSERT_NE(timing, nullptr);
+    ASSERT_EQ(timing->Attempts().size(), 1);
+    EXPECT_EQ(timing->Attempts().at(0), timing->Elapsed(Stage::RPC));
+    EXPECT_GE(timing->Elapsed(Stage::RPC), std::chrono::milliseconds(5));
+    EXPECT_GE(timing->Elapsed(Stage::DECODE), std::chrono::milliseconds(2));
+    EXPECT_EQ(other.Timing()->Attempts().size(), 0);
+}
@@ -0,0 +1,169 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/cache/CollectionTsCache.h"
+#include "utils/cache/ThreadSnapshot.h"
+
+TEST(CollectionTsCacheContentionTest, RemovedSlotIsNotReused) {
+    milvus::CollectionTsCache cache;
+    cache.Set("endpoint", "db", "collection", 100);
+    EXPECT_EQ(cache.Get("endpoint", "db", "collection"), 100);
+
+    // this thread's snapshot holds the slot, the removal must still be seen by its next call
+    cache.Invalidate("endpoint", "db", "collection");
+    EXPECT_EQ(cache.Get("endpoint", "db", "collection"), 0);
+    cache.Set("endpoint", "db", "collection", 50);
+    EXPECT_EQ(cache.Get("endpoint", "db", "collection"), 50);
+
+    // a renamed collection keeps its slot raised in place
+    cache.Set("endpoint", "db", "renamed", 10);
+    EXPECT_EQ(cache.Get("endpoint", "db", "renamed"), 10);
+    cache.Move("endpoint", "db", "collection", "db", "renamed");
+    EXPECT_EQ(cache.Get("endpoint", "db", "renamed"), 50);
+    EXPECT_EQ(cache.Get("endpoint", "db", "collection"), 0);
+
+    // snapshots of two caches on one thread do not mix
+    milvus::CollectionTsCache other;
+    EXPECT_EQ(other.Get("endpoint", "db", "renamed"), 0);
+    EXPECT_EQ(cache.Get("endpoint", "db", "renamed"), 50);
+}
+
+TEST(CollectionTsCacheContentionTest, ReadersNeverSeeTimestampGoBack) {
+    milvus::CollectionTsCache cache;
+    constexpr int kCollections = 8;
+    constexpr uint64_t kWritesPerThread = 20000;
+    std::vector<std::string> names;
+    for (int i = 0; i < kCollections; ++i) {
+        names.push_back("c" + std::to_string(i));
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> bad_reads{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&cache, &names, &stop, &bad_reads]() {
+            std::vector<uint64_t> last(kCollections, 0);
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < kCollections; ++i) {
+                    auto ts = cache.Get("endpoint", "db", names[i]);
+                    if (ts < last[i]) {
+                        bad_reads.fetch_add(1);
+                    }
+                    last[i] = ts;
+                }
+            }
+        });
+    }
+
+    // writers interleave stale and fresh timestamps, only the fresh ones may move a slot
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&cache, &names, t]() {
+            for (uint64_t n = 1; n <= kWritesPerThread; ++n) {
+                const auto& name = names[(n + t) % kCollections];
+                cache.Set("endpoint", "db", name, n * 4 + t);
+                cache.Set("endpoint", "db", name, n);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(bad_reads.load(), 0);
+    for (int i = 0; i < kCollections; ++i) {
+        EXPECT_GE(cache.Get("endpoint", "db", names[i]), (kWritesPerThread - kCollections) * 4);
+    }
+    EXPECT_EQ(cache.Size(), kCollections);
+}
+
+// More collections than a thread keeps copies of, so readers and writers replace their copies the whole time.
+// Timestamps still only move forward, and once the writers are done every slot holds the largest one written.
+TEST(CollectionTsCacheContentionTest, TimestampsStayMonotonicPastTheSnapshotCapacity) {
+    milvus::CollectionTsCache cache;
+    constexpr int kCollections = static_cast<int>(milvus::ThreadSnapshot<int>::kCapacity) + 512;
+    constexpr int kWriters = 4;
+    constexpr uint64_t kWritesPerThread = 20000;
+    std::vector<std::string> names;
+    for (int i = 0; i < kCollections; ++i) {
+        names.push_back("c" + std::to_string(i));
+        cache.Set("endpoint", "db", names.back(), 1);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> misses{0};
+    std::atomic<int> bad_reads{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&, t]() {
+            std::vector<uint64_t> last(kCollections, 0);
+            for (uint64_t n = 0; !stop.load(std::memory_order_relaxed); ++n) {
+                const auto i = static_cast<int>((n * 7 + t) % kCollections);
+                const auto ts = cache.Get("endpoint", "db", names[i]);
+                if (ts == 0) {
+                    misses.fetch_add(1);
+                } else if (ts < last[i]) {
+                    bad_reads.fetch_add(1);
+                }
+                last[i] = ts;
+            }
+        });
+    }
+
+    // each writer records the largest timestamp it wrote per collection
+    std::vector<std::vector<uint64_t>> written(kWriters, std::vector<uint64_t>(kCollections, 1));
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kWriters; ++t) {
+        writers.emplace_back([&, t]() {
+            for (uint64_t n = 1; n <= kWritesPerThread; ++n) {
+                const auto i = static_cast<int>((n * 13 + t) % kCollections);
+                const auto ts = n * kWriters + t;
+                cache.Set("endpoint", "db", names[i], ts);
+                written[t][i] = std::max(written[t][i], ts);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(misses.load(), 0);
+    EXPECT_EQ(bad_reads.load(), 0);
+    for (int i = 0; i < kCollections; ++i) {
+        uint64_t expected = 1;
+        for (const auto& one : written) {
+            expected = std::max(expected, one[i]);
+        }
+        EXPECT_EQ(cache.Get("endpoint", "db", names[i]), expected) << names[i];
+    }
+    EXPECT_EQ(cache.Size(), kCollections);
+}
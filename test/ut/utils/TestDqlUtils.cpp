@@ -28,7 +28,7 @@
 #include "milvus/types/SearchArguments.h"
 #include "milvus/types/SearchResults.h"
 #include "milvus/utils/FP16.h"
-#include "types/SearchIteratorImpl.h"
+#include "types/SearchPageCache.h"
 #include "utils/Constants.h"
 #include "utils/DqlUtils.h"
 #include "utils/cache/CollectionTsCache.h"
@@ -328,6 +328,81 @@ TEST_F(DqlUtilsTest, DecodeTextFieldData) {
     EXPECT_EQ(rows[1]["body"], "second");
 }
 
+TEST_F(DqlUtilsTest, ConvertQueryResultsReleasesColumns) {
+    milvus::proto::milvus::QueryResults rpc_results;
+    auto* ids = rpc_results.add_fields_data();
+    ids->set_field_name("id");
+    ids->set_type(milvus::proto::schema::DataType::Int64);
+    ids->mutable_scalars()->mutable_long_data()->add_data(1);
+    ids->mutable_scalars()->mutable_long_data()->add_data(2);
+    auto* names = rpc_results.add_fields_data();
+    names->set_field_name("name");
+    names->set_type(milvus::proto::schema::DataType::VarChar);
+    names->mutable_scalars()->mutable_string_data()->add_data("a");
+    names->mutable_scalars()->mutable_string_data()->add_data("b");
+    rpc_results.add_output_fields("id");
+    rpc_results.add_output_fields("name");
+
+    // the const overload keeps the columns
+    milvus::QueryResults copied;
+    auto status = milvus::ConvertQueryResults(rpc_results, copied);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(copied.GetRowCount(), 2);
+    EXPECT_TRUE(rpc_results.fields_data(0).has_scalars());
+    EXPECT_TRUE(rpc_results.fields_data(1).has_scalars());
+
+    milvus::QueryResults results;
+    status = milvus::ConvertQueryResults(std::move(rpc_results), results);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(results.GetRowCount(), 2);
+    auto names_field = results.OutputField<milvus::VarCharFieldData>("name");
+    ASSERT_NE(names_field, nullptr);
+    EXPECT_EQ(names_field->Value(1), "b");
+
+    // the decoded columns are released from the rpc results
+    ASSERT_EQ(rpc_results.fields_data_size(), 2);
+    EXPECT_FALSE(rpc_results.fields_data(0).has_scalars());
+    EXPECT_FALSE(rpc_results.fields_data(1).has_scalars());
+}
+
+TEST_F(DqlUtilsTest, RecheckQueryResultIDs) {
+    std::vector<milvus::FieldDataPtr> fields{
+        std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>{1, 2, 3, 4, 5}),
+        std::make_shared<milvus::VarCharFieldData>("name", std::vector<std::string>{"a", "b", "c", "d", "e"}),
+    };
+    milvus::QueryResults results(fields, std::set<std::string>{"id", "name"});
+
+    // 2 and 4 are false positives of the bloom prefilter
+    milvus::IDArray ids(std::vector<int64_t>{1, 3, 5, 7});
+    auto status = milvus::RecheckQueryResultIDs(ids, "id", results);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    ASSERT_EQ(results.GetRowCount(), 3);
+    auto id_field = results.OutputField<milvus::Int64FieldData>("id");
+    ASSERT_NE(id_field, nullptr);
+    EXPECT_EQ(id_field->Data(), (std::vector<int64_t>{1, 3, 5}));
+    auto name_field = results.OutputField<milvus::VarCharFieldData>("name");
+    ASSERT_NE(name_field, nullptr);
+    EXPECT_EQ(name_field->Data(), (std::vector<std::string>{"a", "c", "e"}));
+    EXPECT_EQ(results.OutputFieldNames().size(), 2);
+
+    // the source columns are not touched
+    EXPECT_EQ(fields[0]->Count(), 5);
+
+    // nothing to drop
+    milvus::IDArray all(std::vector<int64_t>{1, 3, 5});
+    status = milvus::RecheckQueryResultIDs(all, "id", results);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(results.GetRowCount(), 3);
+
+    // a string id array does not match an integer primary key
+    milvus::IDArray strs(std::vector<std::string>{"1"});
+    status = milvus::RecheckQueryResultIDs(strs, "id", results);
+    EXPECT_FALSE(status.IsOk());
+
+    status = milvus::RecheckQueryResultIDs(all, "pk", results);
+    EXPECT_FALSE(status.IsOk());
+}
+
 TEST_F(DqlUtilsTest, DecodeArrayOfTextFieldData) {
     milvus::proto::schema::FieldData array_proto;
     array_proto.set_field_name("paragraphs");
@@ -516,13 +591,12 @@ TEST_F(DqlUtilsTest, SearchIteratorPagingPreservesNullableVectorValidity) {
         return std::make_shared<milvus::SingleResult>("id", "score", std::move(fields), output_fields);
     };
 
-    std::list<milvus::SingleResultPtr> cache;
-    cache.emplace_back(make_result({1}, {0.9f}, {{1.0f, 2.0f}}, {true}));
-    cache.emplace_back(make_result({2, 3, 4}, {0.8f, 0.7f, 0.6f}, {{}, {3.0f, 4.0f}, {}}, {false, true, false}));
+    milvus::SearchPageCache cache;
+    cache.Push(make_result({1}, {0.9f}, {{1.0f, 2.0f}}, {true}));
+    cache.Push(make_result({2, 3, 4}, {0.8f, 0.7f, 0.6f}, {{}, {3.0f, 4.0f}, {}}, {false, true, false}));
 
     milvus::SingleResult page;
-    auto status =
-        milvus::SearchIteratorImpl<milvus::SearchIteratorRequest>::FetchPageFromCache(cache, output_fields, 3, page);
+    auto status = cache.Fetch(output_fields, 3, page);
     ASSERT_TRUE(status.IsOk()) << status.Message();
     ASSERT_EQ(page.GetRowCount(), 3);
     auto page_vectors = page.OutputField<milvus::FloatVecFieldData>("vector");
@@ -532,10 +606,9 @@ TEST_F(DqlUtilsTest, SearchIteratorPagingPreservesNullableVectorValidity) {
     EXPECT_TRUE(page_vectors->IsNull(1));
     EXPECT_THAT(page_vectors->Value(2), ElementsAre(3.0f, 4.0f));
 
-    ASSERT_EQ(cache.size(), 1);
+    ASSERT_EQ(cache.Count(), 1);
     milvus::SingleResult next_page;
-    status = milvus::SearchIteratorImpl<milvus::SearchIteratorRequest>::FetchPageFromCache(cache, output_fields, 1,
-                                                                                           next_page);
+    status = cache.Fetch(output_fields, 1, next_page);
     ASSERT_TRUE(status.IsOk()) << status.Message();
     auto next_vectors = next_page.OutputField<milvus::FloatVecFieldData>("vector");
     ASSERT_NE(next_vectors, nullptr);
@@ -621,6 +694,62 @@ TEST_F(DqlUtilsTest, ConvertFilterTemplatesEmpty) {
     EXPECT_EQ(rpc_templates.size(), 0);
 }
 
+TEST_F(DqlUtilsTest, ConvertTypedFilterTemplates) {
+#if defined(_WIN32) && defined(MILVUS_SDK_SHARED)
+    GTEST_SKIP() << "protobuf Map cannot be safely mutated across Windows DLL boundary";
+#endif
+
+    std::unordered_map<std::string, milvus::FilterTemplateArray> templates;
+    templates["ids"] = milvus::FilterTemplateArray::Int64s({1, 2, 3});
+    templates["names"] = milvus::FilterTemplateArray::Strings({"a", "b"});
+    templates["flags"] = milvus::FilterTemplateArray::Bools({true, false});
+    templates["scores"] = milvus::FilterTemplateArray::Doubles({0.5});
+    templates["pairs"] = milvus::FilterTemplateArray::Arrays(
+        {milvus::FilterTemplateArray::Int64s({1, 2}), milvus::FilterTemplateArray::Int64s({3})});
+
+    ::google::protobuf::Map<std::string, milvus::proto::schema::TemplateValue> rpc_templates;
+    auto status = milvus::ConvertFilterTemplates(templates, &rpc_templates);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(rpc_templates.size(), 5);
+
+    EXPECT_THAT(rpc_templates["ids"].array_val().long_data().data(), ElementsAre(1, 2, 3));
+    EXPECT_THAT(rpc_templates["names"].array_val().string_data().data(), ElementsAre("a", "b"));
+    EXPECT_THAT(rpc_templates["flags"].array_val().bool_data().data(), ElementsAre(true, false));
+    EXPECT_THAT(rpc_templates["scores"].array_val().double_data().data(), ElementsAre(0.5));
+    const auto& pairs = rpc_templates["pairs"].array_val().array_data();
+    ASSERT_EQ(pairs.data_size(), 2);
+    EXPECT_THAT(pairs.data(0).long_data().data(), ElementsAre(1, 2));
+    EXPECT_THAT(pairs.data(1).long_data().data(), ElementsAre(3));
+
+    // nested json arrays are encoded the same way
+    std::unordered_map<std::string, nlohmann::json> json_templates;
+    json_templates["pairs"] = nlohmann::json::array({nlohmann::json::array({1, 2}), nlohmann::json::array({3})});
+    ::google::protobuf::Map<std::string, milvus::proto::schema::TemplateValue> json_rpc_templates;
+    status = milvus::ConvertFilterTemplates(json_templates, &json_rpc_templates);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(json_rpc_templates["pairs"].SerializeAsString(), rpc_templates["pairs"].SerializeAsString());
+}
+
+TEST_F(DqlUtilsTest, ConvertQueryRequestTypedTemplateOverridesJson) {
+    milvus::QueryRequest req;
+    req.WithCollectionName("test_coll").WithFilter("id in {ids}");
+    req.AddFilterTemplate("ids", nlohmann::json{7, 8});
+    req.AddFilterTemplate("ids", milvus::FilterTemplateArray::Int64s({1, 2, 3}));
+    EXPECT_TRUE(req.FilterTemplates().empty());
+    ASSERT_EQ(req.TypedFilterTemplates().size(), 1);
+
+    milvus::proto::milvus::QueryRequest rpc_request;
+    auto status = milvus::ConvertQueryRequest(req, "db", rpc_request);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    const auto& rpc_templates = rpc_request.expr_template_values();
+    ASSERT_EQ(rpc_templates.count("ids"), 1);
+    EXPECT_THAT(rpc_templates.at("ids").array_val().long_data().data(), ElementsAre(1, 2, 3));
+
+    // setting json templates replaces all templates
+    req.SetFilterTemplates({});
+    EXPECT_TRUE(req.TypedFilterTemplates().empty());
+}
+
 TEST_F(DqlUtilsTest, ConvertSearchRequestV2) {
     // test ConvertSearchRequest<SearchRequest> template instantiation
     milvus::SearchRequest req;
@@ -1506,3 +1635,46 @@ TEST_F(DqlUtilsTest, AggregationBucketsRejectUnaccountedBuckets) {
     EXPECT_FALSE(status.IsOk());
     EXPECT_EQ(status.Code(), milvus::StatusCode::INVALID_ARGUMENT);
 }
+
+TEST_F(DqlUtilsTest, MergeSearchResultsAcrossCollections) {
+    auto fill = [](milvus::proto::milvus::SearchResults& rpc_results, const std::vector<int64_t>& ids,
+                   const std::vector<float>& scores) {
+        auto* result_data = rpc_results.mutable_results();
+        result_data->set_num_queries(1);
+        result_data->add_topks(static_cast<int64_t>(ids.size()));
+        result_data->set_primary_field_name("id");
+        result_data->add_output_fields("age");
+        auto* age_field = result_data->add_fields_data();
+        age_field->set_field_name("age");
+        age_field->set_type(milvus::proto::schema::DataType::Int64);
+        for (size_t i = 0; i < ids.size(); ++i) {
+            result_data->mutable_ids()->mutable_int_id()->add_data(ids[i]);
+            result_data->add_scores(scores[i]);
+            age_field->mutable_scalars()->mutable_long_data()->add_data(ids[i] * 10);
+        }
+    };
+    milvus::proto::milvus::SearchResults shard0;
+    milvus::proto::milvus::SearchResults shard1;
+    fill(shard0, {1, 2, 3}, {0.9f, 0.5f, 0.1f});
+    fill(shard1, {11, 12}, {0.8f, 0.7f});
+
+    milvus::SearchResults results;
+    auto status = milvus::MergeSearchResults({&shard0, &shard1}, "id", milvus::MetricType::COSINE, 1, 3, results);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    ASSERT_EQ(results.Results().size(), 1u);
+    const auto& result = results.Results().at(0);
+    EXPECT_EQ(result.Ids().IntIDArray(), std::vector<int64_t>({11, 12, 2}));
+    EXPECT_EQ(result.Scores(), std::vector<float>({0.8f, 0.7f, 0.5f}));
+    auto ages = result.OutputField<milvus::Int64FieldData>("age");
+    ASSERT_NE(ages, nullptr);
+    EXPECT_EQ(ages->Data(), std::vector<int64_t>({110, 120, 20}));
+
+    status = milvus::MergeSearchResults({&shard0, &shard1}, "id", milvus::MetricType::DEFAULT, 0, 2, results);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(results.Results().at(0).Ids().IntIDArray(), std::vector<int64_t>({1, 11}));
+
+    milvus::proto::milvus::SearchResults two_queries;
+    two_queries.mutable_results()->set_num_queries(2);
+    status = milvus::MergeSearchResults({&shard0, &two_queries}, "id", milvus::MetricType::IP, 0, 2, results);
+    EXPECT_FALSE(status.IsOk());
+}
@@ -0,0 +1,129 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "milvus/types/BloomFilter.h"
+#include "milvus/types/RoaringBitmap.h"
+#include "utils/IDsEncodingUtils.h"
+
+namespace {
+
+std::vector<int64_t>
+DenseIDs(int64_t start, size_t count) {
+    std::vector<int64_t> ids(count);
+    for (size_t i = 0; i < count; ++i) {
+        ids[i] = start + static_cast<int64_t>(i);
+    }
+    return ids;
+}
+
+// snowflake-like ids, one or two per high container, the worst case for a roaring bitmap
+std::vector<int64_t>
+SparseIDs(size_t count) {
+    std::mt19937_64 rng(20260718);
+    std::vector<int64_t> ids(count);
+    for (auto& id : ids) {
+        id = static_cast<int64_t>(rng() >> 1);
+    }
+    return ids;
+}
+
+}  // namespace
+
+class IDsEncodingUtilsTest : public ::testing::Test {};
+
+TEST_F(IDsEncodingUtilsTest, ListByDefault) {
+    milvus::IDArray ids(DenseIDs(0, 10000));
+    milvus::IDsFilter filter;
+    auto status = milvus::BuildIDsFilter(ids, "id", "ids", milvus::IDsEncoding::LIST, false, filter);
+    ASSERT_TRUE(status.IsOk());
+    EXPECT_EQ(filter.encoding, milvus::IDsEncoding::LIST);
+    EXPECT_EQ(filter.expression, "id in {ids}");
+    EXPECT_EQ(filter.list.Int64Values().size(), 10000);
+    EXPECT_FALSE(filter.NeedRecheck());
+
+    milvus::IDArray str_ids(std::vector<std::string>{"a", "b"});
+    status = milvus::BuildIDsFilter(str_ids, "key", "ids", milvus::IDsEncoding::AUTO, false, filter);
+    ASSERT_TRUE(status.IsOk());
+    EXPECT_EQ(filter.encoding, milvus::IDsEncoding::LIST);
+    EXPECT_EQ(filter.expression, "key in {ids}");
+    EXPECT_EQ(filter.list.StringValues().size(), 2);
+}
+
+TEST_F(IDsEncodingUtilsTest, AutoPicksRoaringForDenseIDs) {
+    // a short list stays a list even if it is dense
+    milvus::IDArray few(DenseIDs(100, milvus::IDsEncodingMinAutoCount - 1));
+    milvus::IDsFilter filter;
+    ASSERT_TRUE(milvus::BuildIDsFilter(few, "id", "ids", milvus::IDsEncoding::AUTO, true, filter).IsOk());
+    EXPECT_EQ(filter.encoding, milvus::IDsEncoding::LIST);
+
+    milvus::IDArray dense(DenseIDs(1000000, 100000));
+    ASSERT_TRUE(milvus::BuildIDsFilter(dense, "id", "ids", milvus::IDsEncoding::AUTO, true, filter).IsOk());
+    EXPECT_EQ(filter.encoding, milvus::IDsEncoding::ROARING_BITMAP);
+    EXPECT_EQ(filter.expression, "roaring_match(id, {ids})");
+    ASSERT_TRUE(filter.blob.is_binary());
+    EXPECT_LT(filter.blob.get_binary().size() * 10, milvus::EstimateIDsListSize(dense));
+    EXPECT_FALSE(filter.NeedRecheck());
+
+    // the blob is the one RoaringBitmapTemplate() builds
+    nlohmann::json expected;
+    ASSERT_TRUE(milvus::RoaringBitmapTemplate(dense.IntIDArray(), expected).IsOk());
+    EXPECT_EQ(filter.blob, expected);
+}
+
+TEST_F(IDsEncodingUtilsTest, AutoKeepsListForSparseIDs) {
+    milvus::IDArray sparse(SparseIDs(20000));
+    milvus::IDsFilter filter;
+    ASSERT_TRUE(milvus::BuildIDsFilter(sparse, "id", "ids", milvus::IDsEncoding::AUTO, false, filter).IsOk());
+    EXPECT_EQ(filter.encoding, milvus::IDsEncoding::LIST);
+    EXPECT_EQ(filter.expression, "id in {ids}");
+}
+
+TEST_F(IDsEncodingUtilsTest, ExplicitEncodings) {
+    milvus::IDArray str_ids(std::vector<std::string>{"a", "b", "c"});
+    milvus::IDsFilter filter;
+    auto status = milvus::BuildIDsFilter(str_ids, "key", "ids", milvus::IDsEncoding::ROARING_BITMAP, false, filter);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::INVALID_ARGUMENT);
+
+    // a bloom prefilter cannot back a delete
+    status = milvus::BuildIDsFilter(str_ids, "key", "ids", milvus::IDsEncoding::BLOOM_PREFILTER, true, filter);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::INVALID_ARGUMENT);
+
+    status = milvus::BuildIDsFilter(str_ids, "key", "ids", milvus::IDsEncoding::BLOOM_PREFILTER, false, filter);
+    ASSERT_TRUE(status.IsOk());
+    EXPECT_EQ(filter.expression, "bloom_match(key, {ids})");
+    EXPECT_TRUE(filter.NeedRecheck());
+    nlohmann::json expected;
+    ASSERT_TRUE(milvus::BloomFilterTemplate(str_ids.StrIDArray(), milvus::BloomFilterDefaultFPR, expected).IsOk());
+    EXPECT_EQ(filter.blob, expected);
+
+    milvus::IDArray int_ids(std::vector<int64_t>{7, 3, 5});
+    status = milvus::BuildIDsFilter(int_ids, "id", "ids", milvus::IDsEncoding::ROARING_BITMAP, true, filter);
+    ASSERT_TRUE(status.IsOk());
+    EXPECT_EQ(filter.expression, "roaring_match(id, {ids})");
+    EXPECT_TRUE(filter.blob.is_binary());
+}
+
+TEST_F(IDsEncodingUtilsTest, EstimateListSize) {
+    EXPECT_EQ(milvus::EstimateIDsListSize(milvus::IDArray(std::vector<int64_t>{1, 127, 128, -1})), 1 + 1 + 2 + 10);
+    EXPECT_EQ(milvus::EstimateIDsListSize(milvus::IDArray(std::vector<std::string>{"ab", ""})), 4 + 2);
+}
@@ -0,0 +1,171 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "utils/cache/MetadataCache.h"
+
+namespace {
+
+milvus::DescribeIndexResponse
+MakeIndexResponse(const std::string& index_name) {
+    milvus::IndexDesc desc;
+    desc.SetIndexName(index_name);
+    desc.SetFieldName("vector");
+    milvus::DescribeIndexResponse response;
+    response.SetDescs({desc});
+    return response;
+}
+
+milvus::GetLoadStateResponse
+MakeLoadStateResponse(milvus::LoadState state) {
+    milvus::GetLoadStateResponse response;
+    response.SetState(state);
+    return response;
+}
+
+}  // namespace
+
+class MetadataCacheTest : public ::testing::Test {
+ protected:
+    milvus::MetadataCache cache_;
+
+    void
+    SetUp() override {
+        cache_.SetParam(milvus::MetadataCacheParam().WithTtlMs(60000));
+    }
+
+    milvus::MetadataCache::Key
+    MakeKey(const std::string& collection, milvus::MetadataCache::Kind kind = milvus::MetadataCache::Kind::INDEXES,
+            const std::string& db = "db") {
+        return cache_.MakeKey("localhost:19530", db, collection, kind, "");
+    }
+};
+
+TEST_F(MetadataCacheTest, DisabledByDefault) {
+    milvus::MetadataCache cache;
+    EXPECT_FALSE(cache.Enabled());
+    auto key = cache.MakeKey("localhost:19530", "db", "coll", milvus::MetadataCache::Kind::INDEXES, "");
+    cache.Put(key, MakeIndexResponse("idx"));
+
+    milvus::DescribeIndexResponse response;
+    EXPECT_FALSE(cache.Get(key, response));
+    EXPECT_EQ(cache.Stats().Entries(), 0u);
+}
+
+TEST_F(MetadataCacheTest, HitAfterPut) {
+    milvus::DescribeIndexResponse response;
+    EXPECT_FALSE(cache_.Get(MakeKey("coll"), response));
+
+    cache_.Put(MakeKey("coll"), MakeIndexResponse("idx"));
+    ASSERT_TRUE(cache_.Get(MakeKey("coll"), response));
+    ASSERT_EQ(response.Descs().size(), 1u);
+    EXPECT_EQ(response.Descs()[0].IndexName(), "idx");
+
+    // the kind and the details are part of the key
+    milvus::GetLoadStateResponse load_state;
+    EXPECT_FALSE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::LOAD_STATE), load_state));
+    auto other = cache_.MakeKey("localhost:19530", "db", "coll", milvus::MetadataCache::Kind::INDEXES, "idx2");
+    EXPECT_FALSE(cache_.Get(other, response));
+
+    cache_.Put(MakeKey("coll", milvus::MetadataCache::Kind::LOAD_STATE),
+               MakeLoadStateResponse(milvus::LoadState::LOAD_STATE_LOADED));
+    ASSERT_TRUE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::LOAD_STATE), load_state));
+    EXPECT_EQ(load_state.State(), milvus::LoadState::LOAD_STATE_LOADED);
+
+    milvus::ListPartitionsResponse partitions;
+    EXPECT_FALSE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::PARTITIONS), partitions));
+    partitions.SetPartitionNames({"_default", "p1"});
+    cache_.Put(MakeKey("coll", milvus::MetadataCache::Kind::PARTITIONS), partitions);
+    milvus::ListPartitionsResponse cached;
+    ASSERT_TRUE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::PARTITIONS), cached));
+    EXPECT_EQ(cached.PartitionsNames().size(), 2u);
+
+    auto stats = cache_.Stats();
+    EXPECT_EQ(stats.Hits(), 3u);
+    EXPECT_EQ(stats.Misses(), 4u);
+    EXPECT_EQ(stats.Entries(), 3u);
+}
+
+TEST_F(MetadataCacheTest, ExpireByTtl) {
+    cache_.SetParam(milvus::MetadataCacheParam().WithTtlMs(20));
+    cache_.Put(MakeKey("coll"), MakeIndexResponse("idx"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    milvus::DescribeIndexResponse response;
+    EXPECT_FALSE(cache_.Get(MakeKey("coll"), response));
+    auto stats = cache_.Stats();
+    EXPECT_EQ(stats.Expirations(), 1u);
+    EXPECT_EQ(stats.Entries(), 0u);
+}
+
+TEST_F(MetadataCacheTest, Invalidate) {
+    cache_.Put(MakeKey("coll"), MakeIndexResponse("idx"));
+    cache_.Put(MakeKey("coll", milvus::MetadataCache::Kind::LOAD_STATE),
+               MakeLoadStateResponse(milvus::LoadState::LOAD_STATE_LOADED));
+    cache_.Put(MakeKey("other"), MakeIndexResponse("idx"));
+    cache_.Put(MakeKey("coll", milvus::MetadataCache::Kind::INDEXES, "db2"), MakeIndexResponse("idx"));
+
+    cache_.Invalidate("localhost:19530", "db", "coll");
+    milvus::DescribeIndexResponse response;
+    milvus::GetLoadStateResponse load_state;
+    EXPECT_FALSE(cache_.Get(MakeKey("coll"), response));
+    EXPECT_FALSE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::LOAD_STATE), load_state));
+    EXPECT_TRUE(cache_.Get(MakeKey("other"), response));
+    EXPECT_EQ(cache_.Stats().Invalidations(), 2u);
+
+    cache_.InvalidateDb("localhost:19530", "db");
+    EXPECT_FALSE(cache_.Get(MakeKey("other"), response));
+    EXPECT_TRUE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::INDEXES, "db2"), response));
+
+    cache_.Clear();
+    EXPECT_FALSE(cache_.Get(MakeKey("coll", milvus::MetadataCache::Kind::INDEXES, "db2"), response));
+}
+
+TEST_F(MetadataCacheTest, DropPutRacingWithInvalidate) {
+    // the key is taken before the rpc call, the collection is changed while the call is in flight
+    auto key = MakeKey("coll");
+    cache_.Invalidate("localhost:19530", "db", "coll");
+    cache_.Put(key, MakeIndexResponse("stale"));
+
+    milvus::DescribeIndexResponse response;
+    EXPECT_FALSE(cache_.Get(MakeKey("coll"), response));
+
+    cache_.Put(MakeKey("coll"), MakeIndexResponse("fresh"));
+    ASSERT_TRUE(cache_.Get(MakeKey("coll"), response));
+    EXPECT_EQ(response.Descs()[0].IndexName(), "fresh");
+}
+
+TEST_F(MetadataCacheTest, EvictLeastRecentlyUsed) {
+    cache_.SetParam(milvus::MetadataCacheParam().WithTtlMs(60000).WithMaxEntries(2));
+    cache_.Put(MakeKey("a"), MakeIndexResponse("idx"));
+    cache_.Put(MakeKey("b"), MakeIndexResponse("idx"));
+
+    milvus::DescribeIndexResponse response;
+    EXPECT_TRUE(cache_.Get(MakeKey("a"), response));
+    cache_.Put(MakeKey("c"), MakeIndexResponse("idx"));
+
+    EXPECT_TRUE(cache_.Get(MakeKey("a"), response));
+    EXPECT_FALSE(cache_.Get(MakeKey("b"), response));
+    EXPECT_TRUE(cache_.Get(MakeKey("c"), response));
+    auto stats = cache_.Stats();
+    EXPECT_EQ(stats.Evictions(), 1u);
+    EXPECT_EQ(stats.Entries(), 2u);
+}
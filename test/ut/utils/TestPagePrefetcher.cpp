@@ -0,0 +1,148 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "utils/PagePrefetcher.h"
+
+TEST(PagePrefetcherTest, DeliversPagesInOrder) {
+    int next_page = 0;
+    milvus::PagePrefetcher<int> prefetcher(2, [&next_page](int& page, bool& last) {
+        page = next_page++;
+        last = next_page == 10;
+        return milvus::Status::OK();
+    });
+    prefetcher.Start();
+
+    std::vector<int> pages;
+    while (true) {
+        int page = -1;
+        bool end = false;
+        auto status = prefetcher.Next(page, end);
+        ASSERT_TRUE(status.IsOk());
+        if (end) {
+            break;
+        }
+        pages.push_back(page);
+    }
+    EXPECT_EQ(pages, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    auto stats = prefetcher.Stats();
+    EXPECT_EQ(stats.Depth(), 2);
+    EXPECT_EQ(stats.FetchedPages(), 10);
+    EXPECT_EQ(stats.Hits() + stats.Misses(), 10);
+}
+
+TEST(PagePrefetcherTest, BoundsBufferedPages) {
+    std::atomic<int> fetched{0};
+    milvus::PagePrefetcher<int> prefetcher(3, [&fetched](int& page, bool& last) {
+        page = fetched++;
+        return milvus::Status::OK();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(fetched.load(), 0);
+    prefetcher.Start();
+
+    // the worker stops once the buffer is full
+    for (int i = 0; i < 100 && fetched.load() < 3; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(fetched.load(), 3);
+
+    int page = -1;
+    bool end = true;
+    EXPECT_TRUE(prefetcher.Next(page, end).IsOk());
+    EXPECT_FALSE(end);
+    EXPECT_EQ(page, 0);
+    EXPECT_EQ(prefetcher.Stats().Hits(), 1);
+
+    for (int i = 0; i < 100 && fetched.load() < 4; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(fetched.load(), 4);
+}
+
+TEST(PagePrefetcherTest, ReturnsErrorAfterBufferedPages) {
+    int next_page = 0;
+    milvus::PagePrefetcher<int> prefetcher(4, [&next_page](int& page, bool& last) {
+        if (next_page == 2) {
+            return milvus::Status{milvus::StatusCode::RPC_FAILED, "broken"};
+        }
+        page = next_page++;
+        return milvus::Status::OK();
+    });
+    prefetcher.Start();
+
+    int page = -1;
+    bool end = false;
+    EXPECT_TRUE(prefetcher.Next(page, end).IsOk());
+    EXPECT_EQ(page, 0);
+    EXPECT_TRUE(prefetcher.Next(page, end).IsOk());
+    EXPECT_EQ(page, 1);
+
+    auto status = prefetcher.Next(page, end);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::RPC_FAILED);
+    EXPECT_TRUE(end);
+}
+
+TEST(PagePrefetcherTest, StopCancelsOutstandingWork) {
+    std::atomic<int> fetched{0};
+    auto prefetcher = std::make_shared<milvus::PagePrefetcher<int>>(1, [&fetched](int& page, bool& last) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        page = fetched++;
+        return milvus::Status::OK();
+    });
+    prefetcher->Start();
+
+    int page = -1;
+    bool end = false;
+    EXPECT_TRUE(prefetcher->Next(page, end).IsOk());
+    prefetcher->Stop();
+    EXPECT_TRUE(prefetcher->Stopping());
+    auto fetched_after_stop = fetched.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(fetched.load(), fetched_after_stop);
+    prefetcher.reset();
+}
+
+TEST(PagePrefetcherTest, StartAfterStopDoesNothing) {
+    std::atomic<int> fetched{0};
+    milvus::PagePrefetcher<int> prefetcher(2, [&fetched](int& page, bool& last) {
+        page = fetched++;
+        return milvus::Status::OK();
+    });
+    prefetcher.Stop();
+    prefetcher.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(fetched.load(), 0);
+}
+
+TEST(PagePrefetcherTest, NonStandardExceptionBecomesStatus) {
+    milvus::PagePrefetcher<int> prefetcher(2, [](int&, bool&) -> milvus::Status { throw 42; });
+    prefetcher.Start();
+
+    int page = -1;
+    bool end = false;
+    auto status = prefetcher.Next(page, end);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::UNKNOWN_ERROR);
+    EXPECT_TRUE(end);
+}
@@ -0,0 +1,238 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "milvus.pb.h"
+#include "utils/TypeUtils.h"
+#include "utils/cache/PersistentSchemaCache.h"
+#include "utils/cache/SchemaCache.h"
+
+namespace {
+
+class PersistentSchemaCacheTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        path_ = ::testing::TempDir() + "milvus_schema_cache_" + info->name();
+        std::remove(path_.c_str());
+    }
+
+    void
+    TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+    // another spelling of the same file is opened as another instance, the way another process would
+    std::string
+    otherProcessPath() const {
+        const auto slash = path_.rfind('/');
+        return path_.substr(0, slash + 1) + "./" + path_.substr(slash + 1);
+    }
+
+    static milvus::CollectionCacheKey
+    key(const std::string& collection_name) {
+        return milvus::CollectionCacheKey::Create("localhost:19530", "db", collection_name);
+    }
+
+    static std::string
+    get(const milvus::PersistentSchemaCachePtr& file, const std::string& collection_name,
+        uint64_t* update_time = nullptr) {
+        uint64_t ts = 0;
+        std::string payload;
+        if (!file->Get(key(collection_name), ts, payload)) {
+            return "<missing>";
+        }
+        if (update_time != nullptr) {
+            *update_time = ts;
+        }
+        return payload;
+    }
+
+    std::string path_;
+};
+
+}  // namespace
+
+TEST_F(PersistentSchemaCacheTest, SavedRecordsAreMappedByTheNextOpen) {
+    {
+        auto file = milvus::PersistentSchemaCache::Open(path_);
+        EXPECT_EQ(file->Size(), 0);
+        EXPECT_EQ(milvus::PersistentSchemaCache::Open(path_), file);
+
+        file->Set(key("a"), 100, "schema-a");
+        file->Set(key("b"), 200, std::string("schema\0b", 8));
+        EXPECT_TRUE(file->Save().IsOk());
+    }
+
+    auto file = milvus::PersistentSchemaCache::Open(path_);
+    EXPECT_EQ(file->Size(), 2);
+    uint64_t update_time = 0;
+    EXPECT_EQ(get(file, "a", &update_time), "schema-a");
+    EXPECT_EQ(update_time, 100);
+    EXPECT_EQ(get(file, "b", &update_time), std::string("schema\0b", 8));
+    EXPECT_EQ(update_time, 200);
+    EXPECT_EQ(get(file, "c"), "<missing>");
+
+    // saving an unchanged cache does not touch the file
+    std::remove(path_.c_str());
+    EXPECT_TRUE(file->Save().IsOk());
+    EXPECT_FALSE(std::ifstream(path_).good());
+}
+
+TEST_F(PersistentSchemaCacheTest, SaveMergesRecordsOfOtherProcesses) {
+    auto first = milvus::PersistentSchemaCache::Open(path_);
+    first->Set(key("a"), 100, "a-1");
+    first->Set(key("b"), 100, "b-1");
+    first->Set(key("c"), 100, "c-1");
+    EXPECT_TRUE(first->Save().IsOk());
+
+    auto second = milvus::PersistentSchemaCache::Open(otherProcessPath());
+    EXPECT_NE(second, first);
+    EXPECT_EQ(second->Size(), 3);
+    second->Invalidate(key("a"));
+    second->Set(key("d"), 100, "d-2");
+
+    // the first process refreshes b and c, only c has really changed on the server
+    first->Set(key("b"), 100, "b-1-again");
+    first->Set(key("c"), 300, "c-3");
+    first->Set(key("e"), 100, "e-1");
+    EXPECT_TRUE(first->Save().IsOk());
+    second->Set(key("b"), 100, "b-2");
+    EXPECT_TRUE(second->Save().IsOk());
+
+    first.reset();
+    second.reset();
+    auto file = milvus::PersistentSchemaCache::Open(path_);
+    EXPECT_EQ(get(file, "a"), "<missing>");
+    EXPECT_EQ(get(file, "b"), "b-2");
+    EXPECT_EQ(get(file, "c"), "c-3");
+    EXPECT_EQ(get(file, "d"), "d-2");
+    EXPECT_EQ(get(file, "e"), "e-1");
+    EXPECT_EQ(file->Size(), 4);
+}
+
+TEST_F(PersistentSchemaCacheTest, DescribedSchemasMergeByUpdateTime) {
+    // each process keeps the schema it described, as describeCollection() persists it
+    auto describe = [](uint64_t update_timestamp, const std::string& description, std::string& payload) {
+        milvus::proto::milvus::DescribeCollectionResponse rpc_response;
+        rpc_response.set_collectionid(1);
+        rpc_response.set_update_timestamp(update_timestamp);
+        rpc_response.mutable_schema()->set_name("a");
+        rpc_response.mutable_schema()->set_description(description);
+        milvus::CollectionDesc desc;
+        EXPECT_TRUE(milvus::ConvertDescribeCollectionResponse(rpc_response, desc).IsOk());
+        milvus::SerializeCollectionDesc(desc, payload);
+        return desc.UpdateTime();
+    };
+
+    auto first = milvus::PersistentSchemaCache::Open(path_);
+    auto second = milvus::PersistentSchemaCache::Open(otherProcessPath());
+
+    // the second process describes the altered schema, the first one still holds the older schema
+    std::string newer;
+    const auto newer_time = describe(300, "altered", newer);
+    EXPECT_EQ(newer_time, 300);
+    second->Set(key("a"), newer_time, newer);
+    EXPECT_TRUE(second->Save().IsOk());
+
+    std::string older;
+    const auto older_time = describe(200, "original", older);
+    EXPECT_EQ(older_time, 200);
+    first->Set(key("a"), older_time, older);
+    EXPECT_TRUE(first->Save().IsOk());
+
+    first.reset();
+    second.reset();
+    uint64_t update_time = 0;
+    const auto payload = get(milvus::PersistentSchemaCache::Open(path_), "a", &update_time);
+    EXPECT_EQ(update_time, 300);
+    milvus::CollectionDesc desc;
+    ASSERT_TRUE(milvus::ParseCollectionDesc(payload, desc).IsOk());
+    EXPECT_EQ(desc.Schema().Description(), "altered");
+    EXPECT_EQ(desc.UpdateTime(), 300);
+}
+
+TEST_F(PersistentSchemaCacheTest, SchemaCacheInvalidationReachesOpenFiles) {
+    auto file = milvus::PersistentSchemaCache::Open(path_);
+    file->Set(key("a"), 0, "a");
+    file->Set(key("b"), 0, "b");
+    file->Set(milvus::CollectionCacheKey::Create("localhost:19530", "other", "a"), 0, "other-a");
+    file->Set(milvus::CollectionCacheKey::Create("localhost:19531", "db", "a"), 0, "other-endpoint-a");
+
+    milvus::SchemaCache cache;
+    cache.Invalidate("http://localhost:19530", "db", "a");
+    EXPECT_EQ(get(file, "a"), "<missing>");
+    EXPECT_EQ(get(file, "b"), "b");
+
+    cache.InvalidateDb("localhost:19530", "db");
+    EXPECT_EQ(get(file, "b"), "<missing>");
+    EXPECT_EQ(file->Size(), 2);
+
+    EXPECT_TRUE(file->Save().IsOk());
+    cache.Clear();
+    EXPECT_EQ(file->Size(), 0);
+    EXPECT_TRUE(file->Save().IsOk());
+    file.reset();
+    EXPECT_EQ(milvus::PersistentSchemaCache::Open(path_)->Size(), 0);
+}
+
+TEST_F(PersistentSchemaCacheTest, DamagedFilesAreNotTrusted) {
+    {
+        auto file = milvus::PersistentSchemaCache::Open(path_);
+        file->Set(key("a"), 1, "a");
+        file->Set(key("b"), 2, "b");
+        EXPECT_TRUE(file->Save().IsOk());
+    }
+
+    std::string content;
+    {
+        std::ifstream in(path_, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(content.size(), 12);
+
+    // a truncated file keeps the records before the damage
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        out.write(content.data(), static_cast<std::streamsize>(content.size() - 1));
+    }
+    EXPECT_EQ(milvus::PersistentSchemaCache::Open(path_)->Size(), 1);
+
+    // a file of another format or version is ignored
+    content[4] = 9;
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+    EXPECT_EQ(milvus::PersistentSchemaCache::Open(path_)->Size(), 0);
+
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        out << "not a schema cache";
+    }
+    auto file = milvus::PersistentSchemaCache::Open(path_);
+    EXPECT_EQ(file->Size(), 0);
+    file->Set(key("a"), 1, "a");
+    EXPECT_TRUE(file->Save().IsOk());
+    file.reset();
+    EXPECT_EQ(get(milvus::PersistentSchemaCache::Open(path_), "a"), "a");
+}
@@ -0,0 +1,90 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "milvus/utils/Rerank.h"
+
+namespace {
+milvus::SingleResult
+MakeResult(const std::vector<int64_t>& ids, const std::vector<float>& scores, const std::vector<std::string>& tags) {
+    std::vector<milvus::FieldDataPtr> fields{
+        std::make_shared<milvus::Int64FieldData>("id", ids),
+        std::make_shared<milvus::FloatFieldData>("score", scores),
+    };
+    std::set<std::string> output_names;
+    if (!tags.empty()) {
+        fields.emplace_back(std::make_shared<milvus::VarCharFieldData>("tag", tags));
+        output_names.insert("tag");
+    }
+    return milvus::SingleResult("id", "score", std::move(fields), output_names);
+}
+}  // namespace
+
+class RerankTest : public ::testing::Test {};
+
+TEST_F(RerankTest, RRFKeepsSharedFields) {
+    auto dense = MakeResult({1, 2}, {0.9f, 0.8f}, {"d1", "d2"});
+    auto sparse = MakeResult({2, 3}, {5.0f, 4.0f}, {"s2", "s3"});
+    std::vector<milvus::RerankInput> inputs{{&dense, milvus::MetricType::COSINE}, {&sparse, milvus::MetricType::BM25}};
+
+    milvus::SingleResult result;
+    auto status = milvus::RerankResults(std::make_shared<milvus::RRFRerank>(60), inputs, 2, result);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(result.Ids().IntIDArray(), std::vector<int64_t>({2, 1}));
+    ASSERT_EQ(result.Scores().size(), 2u);
+    EXPECT_FLOAT_EQ(result.Scores().at(0), 1.0f / 62 + 1.0f / 61);
+    auto tags = result.OutputField<milvus::VarCharFieldData>("tag");
+    ASSERT_NE(tags, nullptr);
+    EXPECT_EQ(tags->Data(), std::vector<std::string>({"d2", "d1"}));
+
+    // the inputs are not touched by the copy of their fields
+    EXPECT_EQ(dense.OutputField<milvus::VarCharFieldData>("tag")->Count(), 2u);
+}
+
+TEST_F(RerankTest, WeightedWithExternalList) {
+    auto dense = MakeResult({1, 2}, {1.0f, 0.0f}, {"d1", "d2"});
+    auto external = MakeResult({3, 2}, {10.0f, 20.0f}, {});
+    std::vector<milvus::RerankInput> inputs{{&dense, milvus::MetricType::COSINE}, {&external}};
+
+    milvus::SingleResult result;
+    auto status = milvus::RerankResults(std::make_shared<milvus::WeightedRerank>(std::vector<float>{0.5f, 0.5f}),
+                                        inputs, 10, result);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    // 1: 0.5, 2: 0.25 + 0.5 * 0, 3: 0.5 * 1, the external list ranks the smaller first
+    EXPECT_EQ(result.Ids().IntIDArray(), std::vector<int64_t>({1, 3, 2}));
+    EXPECT_EQ(result.OutputField("tag"), nullptr);
+}
+
+TEST_F(RerankTest, InvalidArguments) {
+    auto dense = MakeResult({1}, {1.0f}, {});
+    std::vector<milvus::RerankInput> inputs{{&dense, milvus::MetricType::IP}};
+    milvus::SingleResult result;
+
+    EXPECT_FALSE(milvus::RerankResults(milvus::FunctionPtr(), inputs, 10, result).IsOk());
+    EXPECT_FALSE(milvus::RerankResults(std::make_shared<milvus::RRFRerank>(), inputs, 0, result).IsOk());
+    EXPECT_FALSE(milvus::RerankResults(std::make_shared<milvus::RRFRerank>(), {{nullptr}}, 10, result).IsOk());
+
+    auto function_score = std::make_shared<milvus::FunctionScore>();
+    EXPECT_FALSE(milvus::RerankResults(function_score, inputs, 10, result).IsOk());
+    function_score->AddFunction(std::make_shared<milvus::RRFRerank>());
+    EXPECT_TRUE(milvus::RerankResults(function_score, inputs, 10, result).IsOk());
+}
@@ -0,0 +1,182 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "milvus/types/Function.h"
+#include "utils/RerankUtils.h"
+
+using milvus::FusedHit;
+using milvus::MetricType;
+using milvus::RerankList;
+using milvus::RerankParams;
+using milvus::RerankStrategy;
+
+namespace {
+RerankList
+IntList(const std::vector<int64_t>& ids, const std::vector<float>& scores, MetricType metric_type) {
+    RerankList list;
+    list.int_ids_ = &ids;
+    list.scores_ = &scores;
+    list.metric_type_ = metric_type;
+    return list;
+}
+}  // namespace
+
+class RerankUtilsTest : public ::testing::Test {};
+
+TEST_F(RerankUtilsTest, ParseRerankFunction) {
+    RerankParams params;
+    auto status = milvus::ParseRerankFunction(milvus::RRFRerank(10), 3, params);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(params.strategy_, RerankStrategy::RRF);
+    EXPECT_EQ(params.k_, 10);
+
+    status = milvus::ParseRerankFunction(milvus::WeightedRerank({0.2f, 0.8f}), 2, params);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_EQ(params.strategy_, RerankStrategy::WEIGHTED);
+    EXPECT_EQ(params.weights_, std::vector<float>({0.2f, 0.8f}));
+    EXPECT_TRUE(params.norm_score_);
+
+    milvus::WeightedRerank no_norm({0.5f});
+    no_norm.AddParam("params", R"({"weights": [0.5], "norm_score": false})");
+    status = milvus::ParseRerankFunction(no_norm, 1, params);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_FALSE(params.norm_score_);
+
+    EXPECT_FALSE(milvus::ParseRerankFunction(milvus::WeightedRerank({0.2f, 0.8f}), 3, params).IsOk());
+    EXPECT_FALSE(milvus::ParseRerankFunction(milvus::WeightedRerank({1.5f}), 1, params).IsOk());
+    EXPECT_FALSE(milvus::ParseRerankFunction(milvus::RRFRerank(0), 1, params).IsOk());
+    auto status_boost = milvus::ParseRerankFunction(milvus::BoostRerank("boost"), 1, params);
+    EXPECT_EQ(status_boost.Code(), milvus::StatusCode::NOT_SUPPORTED);
+}
+
+TEST_F(RerankUtilsTest, NormalizeScores) {
+    const std::vector<float> scores{-1.0f, 0.0f, 1.0f};
+    std::vector<float> normalized(scores.size());
+
+    milvus::NormalizeScores(MetricType::COSINE, scores.data(), scores.size(), normalized.data());
+    EXPECT_EQ(normalized, std::vector<float>({0.0f, 0.5f, 1.0f}));
+
+    milvus::NormalizeScores(MetricType::IP, scores.data(), scores.size(), normalized.data());
+    EXPECT_FLOAT_EQ(normalized[0], 0.25f);
+    EXPECT_FLOAT_EQ(normalized[1], 0.5f);
+    EXPECT_FLOAT_EQ(normalized[2], 0.75f);
+
+    milvus::NormalizeScores(MetricType::L2, scores.data() + 1, 2, normalized.data());
+    EXPECT_FLOAT_EQ(normalized[0], 1.0f);
+    EXPECT_FLOAT_EQ(normalized[1], 0.5f);
+
+    milvus::NormalizeScores(MetricType::BM25, scores.data() + 2, 1, normalized.data());
+    EXPECT_FLOAT_EQ(normalized[0], 0.5f);
+
+    // an external engine ranking with smaller first
+    const std::vector<float> ranks{1.0f, 2.0f, 5.0f};
+    milvus::NormalizeScores(MetricType::DEFAULT, ranks.data(), ranks.size(), normalized.data());
+    EXPECT_FLOAT_EQ(normalized[0], 1.0f);
+    EXPECT_FLOAT_EQ(normalized[1], 0.75f);
+    EXPECT_FLOAT_EQ(normalized[2], 0.0f);
+}
+
+TEST_F(RerankUtilsTest, PkIndex) {
+    milvus::PkIndex int_index(2);
+    bool inserted = false;
+    for (int64_t key = 0; key < 1000; ++key) {
+        EXPECT_EQ(int_index.Insert(key * 1024, inserted), static_cast<size_t>(key));
+        EXPECT_TRUE(inserted);
+    }
+    EXPECT_EQ(int_index.Insert(512 * 1024, inserted), 512u);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(int_index.Size(), 1000u);
+
+    const std::vector<std::string> keys{"a", "b", "a"};
+    milvus::PkIndex str_index(keys.size());
+    EXPECT_EQ(str_index.Insert(keys[0], inserted), 0u);
+    EXPECT_EQ(str_index.Insert(keys[1], inserted), 1u);
+    EXPECT_EQ(str_index.Insert(keys[2], inserted), 0u);
+    EXPECT_FALSE(inserted);
+}
+
+TEST_F(RerankUtilsTest, FuseRRF) {
+    const std::vector<int64_t> dense_ids{1, 2, 3};
+    const std::vector<float> dense_scores{0.9f, 0.8f, 0.7f};
+    const std::vector<int64_t> sparse_ids{3, 4, 1, 3};
+    const std::vector<float> sparse_scores{9.0f, 8.0f, 7.0f, 6.0f};
+    const std::vector<RerankList> lists{IntList(dense_ids, dense_scores, MetricType::COSINE),
+                                        IntList(sparse_ids, sparse_scores, MetricType::BM25)};
+
+    RerankParams params;
+    params.k_ = 60;
+    std::vector<FusedHit> hits;
+    auto status = milvus::FuseRankedLists(params, lists, 10, hits);
+    ASSERT_TRUE(status.IsOk());
+    ASSERT_EQ(hits.size(), 4u);
+    // 1: 1/61 + 1/63, 3: 1/63 + 1/61 tie broken by first seen, 2: 1/62, 4: 1/62
+    EXPECT_EQ(dense_ids[hits[0].row_], 1);
+    EXPECT_EQ(hits[0].list_, 0u);
+    EXPECT_EQ(dense_ids[hits[1].row_], 3);
+    EXPECT_FLOAT_EQ(hits[0].score_, 1.0f / 61 + 1.0f / 63);
+    EXPECT_EQ(hits[2].list_, 0u);
+    EXPECT_EQ(hits[3].list_, 1u);
+    EXPECT_EQ(sparse_ids[hits[3].row_], 4);
+
+    status = milvus::FuseRankedLists(params, lists, 1, hits);
+    ASSERT_TRUE(status.IsOk());
+    EXPECT_EQ(hits.size(), 1u);
+}
+
+TEST_F(RerankUtilsTest, FuseWeighted) {
+    const std::vector<int64_t> dense_ids{1, 2};
+    const std::vector<float> dense_scores{1.0f, -1.0f};
+    const std::vector<int64_t> l2_ids{2, 3};
+    const std::vector<float> l2_scores{0.0f, 1.0f};
+    const std::vector<RerankList> lists{IntList(dense_ids, dense_scores, MetricType::COSINE),
+                                        IntList(l2_ids, l2_scores, MetricType::L2)};
+
+    RerankParams params;
+    params.strategy_ = RerankStrategy::WEIGHTED;
+    params.weights_ = {0.5f, 0.5f};
+    std::vector<FusedHit> hits;
+    auto status = milvus::FuseRankedLists(params, lists, 10, hits);
+    ASSERT_TRUE(status.IsOk());
+    ASSERT_EQ(hits.size(), 3u);
+    // 1: 0.5 * 1, 2: 0.5 * 0 + 0.5 * 1, 3: 0.5 * 0.5
+    EXPECT_FLOAT_EQ(hits[0].score_, 0.5f);
+    EXPECT_FLOAT_EQ(hits[1].score_, 0.5f);
+    EXPECT_EQ(hits[1].list_, 0u);
+    EXPECT_EQ(hits[1].row_, 1u);
+    EXPECT_FLOAT_EQ(hits[2].score_, 0.25f);
+
+    params.weights_ = {1.0f};
+    EXPECT_FALSE(milvus::FuseRankedLists(params, lists, 10, hits).IsOk());
+}
+
+TEST_F(RerankUtilsTest, FuseRejectsMixedKeys) {
+    const std::vector<int64_t> int_ids{1};
+    const std::vector<std::string> str_ids{"1"};
+    const std::vector<float> scores{1.0f};
+    RerankList str_list;
+    str_list.str_ids_ = &str_ids;
+    str_list.scores_ = &scores;
+    const std::vector<RerankList> lists{IntList(int_ids, scores, MetricType::IP), str_list};
+
+    std::vector<FusedHit> hits;
+    EXPECT_FALSE(milvus::FuseRankedLists(RerankParams{}, lists, 10, hits).IsOk());
+}
@@ -0,0 +1,186 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/wrappers.pb.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "utils/cache/ResultCache.h"
+
+namespace {
+
+google::protobuf::StringValue
+MakeRequest(const std::string& value) {
+    google::protobuf::StringValue request;
+    request.set_value(value);
+    return request;
+}
+
+milvus::QueryResponse
+MakeQueryResponse(uint64_t session_ts) {
+    milvus::QueryResponse response;
+    response.SetSessionTs(session_ts);
+    return response;
+}
+
+}  // namespace
+
+class ResultCacheTest : public ::testing::Test {
+ protected:
+    milvus::CollectionTsCache ts_cache_;
+    milvus::SchemaCache schema_cache_;
+    milvus::ResultCache cache_{ts_cache_, schema_cache_};
+
+    void
+    SetUp() override {
+        cache_.SetParam(milvus::ResultCacheParam().WithCapacityBytes(1 << 20).WithTtlMs(60000));
+    }
+
+    milvus::ResultCache::Key
+    MakeKey(const std::string& value, milvus::ConsistencyLevel level = milvus::ConsistencyLevel::SESSION) {
+        return cache_.MakeKey("localhost:19530", "db", "coll", level, MakeRequest(value));
+    }
+};
+
+TEST_F(ResultCacheTest, DisabledByDefaultAndSkipsStrongReads) {
+    milvus::ResultCache cache{ts_cache_, schema_cache_};
+    EXPECT_FALSE(cache.Accept(milvus::ConsistencyLevel::SESSION));
+
+    EXPECT_TRUE(cache_.Accept(milvus::ConsistencyLevel::SESSION));
+    EXPECT_TRUE(cache_.Accept(milvus::ConsistencyLevel::BOUNDED));
+    EXPECT_TRUE(cache_.Accept(milvus::ConsistencyLevel::EVENTUALLY));
+    EXPECT_FALSE(cache_.Accept(milvus::ConsistencyLevel::STRONG));
+    EXPECT_FALSE(cache_.Accept(milvus::ConsistencyLevel::NONE));
+}
+
+TEST_F(ResultCacheTest, HitAfterPut) {
+    milvus::QueryResponse response;
+    auto key = MakeKey("filter");
+    EXPECT_FALSE(cache_.Get(key, response));
+
+    cache_.Put(key, MakeQueryResponse(100), 64);
+    EXPECT_TRUE(cache_.Get(MakeKey("filter"), response));
+    EXPECT_EQ(response.SessionTs(), 100);
+    EXPECT_FALSE(cache_.Get(MakeKey("other"), response));
+
+    // search and query results never share an entry
+    milvus::SearchResponse search_response;
+    EXPECT_FALSE(cache_.Get(key, search_response));
+
+    auto stats = cache_.Stats();
+    EXPECT_EQ(stats.Hits(), 1);
+    EXPECT_EQ(stats.Misses(), 3);
+    EXPECT_EQ(stats.Entries(), 1);
+    EXPECT_GT(stats.Bytes(), 64);
+    EXPECT_DOUBLE_EQ(stats.HitRatio(), 0.25);
+}
+
+TEST_F(ResultCacheTest, KeyIsCanonical) {
+    google::protobuf::Struct first;
+    google::protobuf::Struct second;
+    for (int i = 0; i < 16; ++i) {
+        (*first.mutable_fields())["k" + std::to_string(i)].set_number_value(i);
+        (*second.mutable_fields())["k" + std::to_string(15 - i)].set_number_value(15 - i);
+    }
+    auto first_key = cache_.MakeKey("http://localhost:19530", "", "coll", milvus::ConsistencyLevel::SESSION, first);
+    auto second_key =
+        cache_.MakeKey("localhost:19530", "default", "coll", milvus::ConsistencyLevel::SESSION, second);
+    EXPECT_EQ(first_key.canonical_, second_key.canonical_);
+    EXPECT_EQ(first_key.hash_, second_key.hash_);
+
+    auto other_endpoint = cache_.MakeKey("remote:19530", "", "coll", milvus::ConsistencyLevel::SESSION, first);
+    EXPECT_NE(first_key.canonical_, other_endpoint.canonical_);
+}
+
+TEST_F(ResultCacheTest, InvalidatedByNewerWrite) {
+    milvus::QueryResponse response;
+    ts_cache_.Set("localhost:19530", "db", "coll", 100);
+    cache_.Put(MakeKey("filter"), MakeQueryResponse(1), 64);
+    EXPECT_TRUE(cache_.Get(MakeKey("filter"), response));
+
+    ts_cache_.Set("localhost:19530", "db", "other", 200);
+    EXPECT_TRUE(cache_.Get(MakeKey("filter"), response));
+
+    ts_cache_.Set("localhost:19530", "db", "coll", 101);
+    EXPECT_FALSE(cache_.Get(MakeKey("filter"), response));
+    EXPECT_EQ(cache_.Stats().Invalidations(), 1);
+    EXPECT_EQ(cache_.Stats().Entries(), 0);
+
+    // a write between building the key and storing the result makes the result unusable
+    auto key = MakeKey("filter");
+    ts_cache_.Set("localhost:19530", "db", "coll", 102);
+    cache_.Put(key, MakeQueryResponse(1), 64);
+    EXPECT_EQ(cache_.Stats().Entries(), 0);
+}
+
+TEST_F(ResultCacheTest, InvalidatedBySchemaChange) {
+    milvus::QueryResponse response;
+    cache_.Put(MakeKey("filter"), MakeQueryResponse(1), 64);
+    EXPECT_TRUE(cache_.Get(MakeKey("filter"), response));
+
+    schema_cache_.Invalidate("localhost:19530", "db", "coll");
+    EXPECT_FALSE(cache_.Get(MakeKey("filter"), response));
+    EXPECT_EQ(cache_.Stats().Invalidations(), 1);
+}
+
+TEST_F(ResultCacheTest, ExpiresBoundedAndEventuallyReads) {
+    cache_.SetParam(milvus::ResultCacheParam().WithCapacityBytes(1 << 20).WithTtlMs(1));
+    cache_.Put(MakeKey("session", milvus::ConsistencyLevel::SESSION), MakeQueryResponse(1), 64);
+    cache_.Put(MakeKey("bounded", milvus::ConsistencyLevel::BOUNDED), MakeQueryResponse(1), 64);
+    cache_.Put(MakeKey("eventually", milvus::ConsistencyLevel::EVENTUALLY), MakeQueryResponse(1), 64);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    milvus::QueryResponse response;
+    EXPECT_TRUE(cache_.Get(MakeKey("session", milvus::ConsistencyLevel::SESSION), response));
+    EXPECT_FALSE(cache_.Get(MakeKey("bounded", milvus::ConsistencyLevel::BOUNDED), response));
+    EXPECT_FALSE(cache_.Get(MakeKey("eventually", milvus::ConsistencyLevel::EVENTUALLY), response));
+    EXPECT_EQ(cache_.Stats().Invalidations(), 2);
+}
+
+TEST_F(ResultCacheTest, EvictsLeastRecentlyUsedWithinBudget) {
+    const auto entry_bytes = [this](const std::string& value) {
+        milvus::ResultCache probe{ts_cache_, schema_cache_};
+        probe.SetParam(milvus::ResultCacheParam().WithCapacityBytes(1 << 20));
+        probe.Put(probe.MakeKey("localhost:19530", "db", "coll", milvus::ConsistencyLevel::SESSION, MakeRequest(value)),
+                  MakeQueryResponse(1), 1000);
+        return probe.Stats().Bytes();
+    };
+    cache_.SetParam(milvus::ResultCacheParam().WithCapacityBytes(entry_bytes("a") * 2));
+
+    milvus::QueryResponse response;
+    cache_.Put(MakeKey("a"), MakeQueryResponse(1), 1000);
+    cache_.Put(MakeKey("b"), MakeQueryResponse(2), 1000);
+    EXPECT_TRUE(cache_.Get(MakeKey("a"), response));
+    cache_.Put(MakeKey("c"), MakeQueryResponse(3), 1000);
+
+    EXPECT_TRUE(cache_.Get(MakeKey("a"), response));
+    EXPECT_FALSE(cache_.Get(MakeKey("b"), response));
+    EXPECT_TRUE(cache_.Get(MakeKey("c"), response));
+    EXPECT_EQ(cache_.Stats().Evictions(), 1);
+    EXPECT_LE(cache_.Stats().Bytes(), entry_bytes("a") * 2);
+
+    // an entry larger than the whole budget is not cached
+    cache_.Put(MakeKey("huge"), MakeQueryResponse(4), 1 << 20);
+    EXPECT_FALSE(cache_.Get(MakeKey("huge"), response));
+
+    cache_.SetParam(milvus::ResultCacheParam());
+    EXPECT_EQ(cache_.Stats().Entries(), 0);
+    EXPECT_EQ(cache_.Stats().Bytes(), 0);
+}
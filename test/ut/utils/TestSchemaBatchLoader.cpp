@@ -0,0 +1,235 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/cache/SchemaBatchLoader.h"
+
+namespace {
+
+milvus::CollectionDescPtr
+MakeDesc(const std::string& name) {
+    auto desc = std::make_shared<milvus::CollectionDesc>();
+    milvus::CollectionSchema schema(name);
+    desc->SetSchema(std::move(schema));
+    return desc;
+}
+
+// Counts the calls of both loaders, and can hold the single loader until released.
+struct FakeServer {
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool hold_single_{false};
+    bool single_entered_{false};
+    bool batch_supported_{true};
+    std::vector<std::string> single_calls_;
+    std::vector<std::vector<std::string>> batch_calls_;
+
+    std::unique_ptr<milvus::SchemaBatchLoader>
+    MakeLoader(size_t max_batch, std::chrono::microseconds window) {
+        return std::make_unique<milvus::SchemaBatchLoader>(
+            [this](const std::string&, const std::string& name, milvus::CollectionDescPtr& desc) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                single_calls_.push_back(name);
+                single_entered_ = true;
+                cv_.notify_all();
+                cv_.wait(lock, [this]() { return !hold_single_; });
+                if (name == "missing") {
+                    return milvus::Status{milvus::StatusCode::SERVER_FAILED, "collection not found"};
+                }
+                desc = MakeDesc(name);
+                return milvus::Status::OK();
+            },
+            [this](const std::string&, const std::vector<std::string>& names, std::vector<milvus::Status>& statuses,
+                   std::vector<milvus::CollectionDescPtr>& descs) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                batch_calls_.push_back(names);
+                cv_.notify_all();
+                if (!batch_supported_) {
+                    return milvus::Status{milvus::StatusCode::NOT_SUPPORTED, "no batch"};
+                }
+                for (size_t i = 0; i < names.size(); ++i) {
+                    if (names[i] == "missing") {
+                        statuses[i] = {milvus::StatusCode::SERVER_FAILED, "collection not found"};
+                    } else {
+                        descs[i] = MakeDesc(names[i]);
+                    }
+                }
+                return milvus::Status::OK();
+            },
+            max_batch, window);
+    }
+
+    void
+    HoldSingle() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hold_single_ = true;
+    }
+
+    void
+    WaitSingleEntered() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return single_entered_; });
+    }
+
+    void
+    WaitBatchCalls(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this, count]() { return batch_calls_.size() >= count; });
+    }
+
+    void
+    ReleaseSingle() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hold_single_ = false;
+        cv_.notify_all();
+    }
+};
+
+}  // namespace
+
+TEST(SchemaBatchLoaderTest, LoneMissIsDescribedAtOnce) {
+    FakeServer server;
+    auto loader = server.MakeLoader(8, std::chrono::seconds(10));
+
+    milvus::CollectionDescPtr desc;
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(loader->Load("db", "a", desc).IsOk());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    ASSERT_NE(desc, nullptr);
+    EXPECT_EQ(desc->CollectionName(), "a");
+    EXPECT_EQ(server.single_calls_, std::vector<std::string>{"a"});
+    EXPECT_TRUE(server.batch_calls_.empty());
+
+    EXPECT_EQ(loader->Load("db", "missing", desc).Code(), milvus::StatusCode::SERVER_FAILED);
+}
+
+TEST(SchemaBatchLoaderTest, MissesDuringACallShareOneBatch) {
+    FakeServer server;
+    auto loader = server.MakeLoader(4, std::chrono::seconds(1));
+    server.HoldSingle();
+
+    std::thread first([&loader]() {
+        milvus::CollectionDescPtr desc;
+        EXPECT_TRUE(loader->Load("db", "first", desc).IsOk());
+    });
+    server.WaitSingleEntered();
+
+    // the first call is still in flight, so these are sent together once four names are queued
+    const std::vector<std::string> names{"a", "b", "c", "missing"};
+    std::vector<milvus::Status> statuses(names.size());
+    std::vector<milvus::CollectionDescPtr> descs(names.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < names.size(); ++i) {
+        threads.emplace_back(
+            [&loader, &names, &statuses, &descs, i]() { statuses[i] = loader->Load("db", names[i], descs[i]); });
+    }
+    // release the first call before joining, a miss left out of the batch must not wait on it forever
+    server.WaitBatchCalls(1);
+    server.ReleaseSingle();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    first.join();
+
+    ASSERT_EQ(server.batch_calls_.size(), 1);
+    EXPECT_EQ(server.batch_calls_[0].size(), 4);
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (names[i] == "missing") {
+            EXPECT_EQ(statuses[i].Code(), milvus::StatusCode::SERVER_FAILED);
+        } else {
+            EXPECT_TRUE(statuses[i].IsOk());
+            ASSERT_NE(descs[i], nullptr);
+            EXPECT_EQ(descs[i]->CollectionName(), names[i]);
+        }
+    }
+    EXPECT_EQ(server.single_calls_, std::vector<std::string>{"first"});
+}
+
+TEST(SchemaBatchLoaderTest, QueuedMissWaitsAtMostOneWindow) {
+    FakeServer server;
+    auto loader = server.MakeLoader(64, std::chrono::milliseconds(20));
+    server.HoldSingle();
+
+    std::thread first([&loader]() {
+        milvus::CollectionDescPtr desc;
+        loader->Load("db", "first", desc);
+    });
+    server.WaitSingleEntered();
+
+    // the first call never returns before this one is sent, the window sends it alone
+    std::thread second([&loader]() {
+        milvus::CollectionDescPtr desc;
+        loader->Load("db", "second", desc);
+    });
+    {
+        std::unique_lock<std::mutex> lock(server.mutex_);
+        server.cv_.wait(lock, [&server]() { return server.single_calls_.size() == 2; });
+    }
+    server.ReleaseSingle();
+    second.join();
+    first.join();
+    EXPECT_EQ(server.single_calls_, (std::vector<std::string>{"first", "second"}));
+    EXPECT_TRUE(server.batch_calls_.empty());
+}
+
+TEST(SchemaBatchLoaderTest, FallsBackWhenTheServerHasNoBatchCall) {
+    FakeServer server;
+    server.batch_supported_ = false;
+    auto loader = server.MakeLoader(2, std::chrono::seconds(10));
+
+    std::vector<milvus::Status> statuses;
+    std::vector<milvus::CollectionDescPtr> descs;
+    loader->LoadMany("db", {"a", "b", "missing"}, statuses, descs);
+    EXPECT_FALSE(loader->BatchSupported());
+    ASSERT_EQ(statuses.size(), 3);
+    EXPECT_TRUE(statuses[0].IsOk());
+    EXPECT_TRUE(statuses[1].IsOk());
+    EXPECT_EQ(statuses[2].Code(), milvus::StatusCode::SERVER_FAILED);
+    EXPECT_EQ(descs[1]->CollectionName(), "b");
+
+    // the first chunk found out, the second chunk and later misses do not ask again
+    EXPECT_EQ(server.batch_calls_.size(), 1);
+    EXPECT_EQ(server.single_calls_, (std::vector<std::string>{"a", "b", "missing"}));
+
+    milvus::CollectionDescPtr desc;
+    EXPECT_TRUE(loader->Load("db", "c", desc).IsOk());
+    EXPECT_EQ(server.batch_calls_.size(), 1);
+}
+
+TEST(SchemaBatchLoaderTest, LoadManySplitsIntoBatches) {
+    FakeServer server;
+    auto loader = server.MakeLoader(2, std::chrono::seconds(10));
+
+    std::vector<milvus::Status> statuses;
+    std::vector<milvus::CollectionDescPtr> descs;
+    loader->LoadMany("db", {"a", "b", "c", "missing", "e"}, statuses, descs);
+    ASSERT_EQ(server.batch_calls_.size(), 2);
+    EXPECT_EQ(server.batch_calls_[0], (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(server.batch_calls_[1], (std::vector<std::string>{"c", "missing"}));
+    EXPECT_EQ(server.single_calls_, std::vector<std::string>{"e"});
+    EXPECT_EQ(statuses[3].Code(), milvus::StatusCode::SERVER_FAILED);
+    EXPECT_EQ(descs[4]->CollectionName(), "e");
+}
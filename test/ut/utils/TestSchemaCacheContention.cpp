@@ -0,0 +1,172 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/cache/SchemaCache.h"
+#include "utils/cache/ThreadSnapshot.h"
+
+namespace {
+
+milvus::CollectionDescPtr
+MakeCollectionDesc(int64_t id) {
+    auto desc = std::make_shared<milvus::CollectionDesc>();
+    desc->SetID(id);
+    return desc;
+}
+
+// Collection i only ever holds ids i * 1000000 + version, so a reader can tell a torn or misrouted
+// entry from a stale one.
+constexpr int64_t kIdStride = 1000000;
+
+}  // namespace
+
+TEST(SchemaCacheContentionTest, ClockGivesReadEntriesASecondChance) {
+    milvus::SchemaCache cache(3);
+    cache.Set("endpoint", "db", "a", MakeCollectionDesc(1));
+    cache.Set("endpoint", "db", "b", MakeCollectionDesc(2));
+    cache.Set("endpoint", "db", "c", MakeCollectionDesc(3));
+
+    milvus::CollectionDescPtr desc;
+    ASSERT_TRUE(cache.Get("endpoint", "db", "a", desc));
+    ASSERT_TRUE(cache.Get("endpoint", "db", "c", desc));
+
+    // b is the only entry not read since it was inserted
+    cache.Set("endpoint", "db", "d", MakeCollectionDesc(4));
+    EXPECT_FALSE(cache.Get("endpoint", "db", "b", desc));
+    EXPECT_TRUE(cache.Get("endpoint", "db", "a", desc));
+    EXPECT_TRUE(cache.Get("endpoint", "db", "c", desc));
+    EXPECT_TRUE(cache.Get("endpoint", "db", "d", desc));
+    EXPECT_EQ(cache.Size(), 3);
+}
+
+TEST(SchemaCacheContentionTest, ReadersSeeReplacementsAndInvalidations) {
+    milvus::SchemaCache cache;
+    constexpr int kCollections = 8;
+    for (int i = 0; i < kCollections; ++i) {
+        cache.Set("endpoint", "db", "c" + std::to_string(i), MakeCollectionDesc(i * kIdStride));
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> bad_reads{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t) {
+        readers.emplace_back([&cache, &stop, &bad_reads, t]() {
+            milvus::CollectionDescPtr desc;
+            for (uint64_t n = 0; !stop.load(std::memory_order_relaxed); ++n) {
+                const int i = static_cast<int>((n + t) % kCollections);
+                if (cache.Get("endpoint", "db", "c" + std::to_string(i), desc) &&
+                    (desc == nullptr || desc->ID() / kIdStride != i)) {
+                    bad_reads.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    // the writer replaces and drops entries under the readers
+    for (int64_t version = 1; version < 2000; ++version) {
+        const int i = static_cast<int>(version % kCollections);
+        const auto name = "c" + std::to_string(i);
+        if (version % 3 == 0) {
+            cache.Invalidate("endpoint", "db", name);
+        } else {
+            cache.Set("endpoint", "db", name, MakeCollectionDesc(i * kIdStride + version));
+        }
+    }
+
+    // once the writer is done every reader sees the final state
+    cache.Set("endpoint", "db", "c0", MakeCollectionDesc(42));
+    milvus::CollectionDescPtr desc;
+    ASSERT_TRUE(cache.Get("endpoint", "db", "c0", desc));
+    EXPECT_EQ(desc->ID(), 42);
+
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(bad_reads.load(), 0);
+}
+
+// More collections than a thread keeps copies of, so the readers replace their copies the whole time. The writer
+// only replaces entries, so every read hits, and a reader never sees a collection go back to an older version.
+TEST(SchemaCacheContentionTest, ReadersPastTheSnapshotCapacitySeeCurrentValues) {
+    constexpr int kCollections = static_cast<int>(milvus::ThreadSnapshot<milvus::CollectionDescPtr>::kCapacity) + 512;
+    milvus::SchemaCache cache;
+    std::vector<std::string> names;
+    for (int i = 0; i < kCollections; ++i) {
+        names.push_back("c" + std::to_string(i));
+        cache.Set("endpoint", "db", names.back(), MakeCollectionDesc(i * kIdStride));
+    }
+
+    // written by the writer only, read by the readers after stop
+    std::vector<int64_t> last_version(kCollections, 0);
+    std::atomic<bool> stop{false};
+    std::atomic<int> misses{0};
+    std::atomic<int> bad_reads{0};
+    std::atomic<int> stale_reads{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&, t]() {
+            std::vector<int64_t> seen(kCollections, 0);
+            auto read = [&](int i) {
+                milvus::CollectionDescPtr desc;
+                if (!cache.Get("endpoint", "db", names[i], desc)) {
+                    misses.fetch_add(1);
+                    return;
+                }
+                if (desc == nullptr || desc->ID() / kIdStride != i) {
+                    bad_reads.fetch_add(1);
+                    return;
+                }
+                const auto version = desc->ID() % kIdStride;
+                if (version < seen[i]) {
+                    stale_reads.fetch_add(1);
+                }
+                seen[i] = version;
+            };
+            for (uint64_t n = 0; !stop.load(); ++n) {
+                read(static_cast<int>((n * 7 + t) % kCollections));
+            }
+            // every write is done, one more pass must see the last version of each collection
+            for (int i = 0; i < kCollections; ++i) {
+                read(i);
+                if (seen[i] != last_version[i]) {
+                    stale_reads.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (int64_t version = 1; version < 20000; ++version) {
+        const int i = static_cast<int>((version * 13) % kCollections);
+        cache.Set("endpoint", "db", names[i], MakeCollectionDesc(i * kIdStride + version));
+        last_version[i] = version;
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(misses.load(), 0);
+    EXPECT_EQ(bad_reads.load(), 0);
+    EXPECT_EQ(stale_reads.load(), 0);
+}
@@ -0,0 +1,252 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils/StatusWaiter.h"
+
+namespace {
+
+// A query reporting done on its n-th call.
+milvus::StatusWaiter::QueryFunction
+DoneAfter(int calls, std::shared_ptr<std::atomic<int>> counter) {
+    return [calls, counter](milvus::Progress& progress, uint64_t) {
+        progress.total_ = static_cast<uint32_t>(calls);
+        progress.finished_ = static_cast<uint32_t>(++(*counter));
+        return milvus::Status::OK();
+    };
+}
+
+}  // namespace
+
+TEST(StatusWaiterTest, IntervalBacksOff) {
+    EXPECT_EQ(milvus::StatusWaiter::NextIntervalMs(5, 500), 10);
+    EXPECT_EQ(milvus::StatusWaiter::NextIntervalMs(160, 500), 320);
+    EXPECT_EQ(milvus::StatusWaiter::NextIntervalMs(320, 500), 500);
+    EXPECT_EQ(milvus::StatusWaiter::NextIntervalMs(500, 500), 500);
+    EXPECT_EQ(milvus::StatusWaiter::NextIntervalMs(1, 1), 1);
+}
+
+TEST(StatusWaiterTest, ShortOperationIsSeenDoneEarly) {
+    milvus::StatusWaiter waiter;
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    std::vector<milvus::Progress> progresses;
+    milvus::ProgressMonitor monitor{10};
+    monitor.SetCallbackFunc([&progresses](milvus::Progress& progress) { progresses.push_back(progress); });
+
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_TRUE(waiter.Await(this, DoneAfter(3, counter), monitor).IsOk());
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    // polled after 5, 10 and 20 milliseconds, rather than after 500 milliseconds three times
+    EXPECT_LT(elapsed, std::chrono::milliseconds(400));
+    EXPECT_EQ(counter->load(), 3);
+    ASSERT_EQ(progresses.size(), 3);
+    EXPECT_EQ(progresses.back().finished_, 3);
+    EXPECT_EQ(waiter.Pending(), 0);
+}
+
+TEST(StatusWaiterTest, NoWaitDoesNotPoll) {
+    milvus::StatusWaiter waiter;
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    auto done = waiter.Submit(this, DoneAfter(3, counter), milvus::ProgressMonitor::NoWait());
+    ASSERT_EQ(done.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(done.get().IsOk());
+    EXPECT_EQ(counter->load(), 0);
+}
+
+TEST(StatusWaiterTest, ErrorAndTimeout) {
+    milvus::StatusWaiter waiter;
+    auto failed = waiter.Submit(
+        this,
+        [](milvus::Progress&, uint64_t) { return milvus::Status{milvus::StatusCode::SERVER_FAILED, "index failed"}; },
+        milvus::ProgressMonitor{10});
+
+    milvus::ProgressMonitor monitor{1};
+    monitor.SetCheckInterval(100);
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    auto timeout = waiter.Submit(this, DoneAfter(1000, counter), monitor);
+
+    EXPECT_EQ(failed.get().Code(), milvus::StatusCode::SERVER_FAILED);
+    EXPECT_EQ(timeout.get().Code(), milvus::StatusCode::TIMEOUT);
+    // 5, 10, 20, 40, 80, then every 100 milliseconds until the last poll at the deadline
+    EXPECT_GE(counter->load(), 10);
+    EXPECT_LE(counter->load(), 16);
+}
+
+TEST(StatusWaiterTest, SettleDelaysTheResult) {
+    milvus::StatusWaiter waiter;
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    auto done = waiter.Submit(this, DoneAfter(1, counter), milvus::ProgressMonitor{10}, 200);
+    EXPECT_EQ(done.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    EXPECT_TRUE(done.get().IsOk());
+    EXPECT_EQ(counter->load(), 1);
+}
+
+TEST(StatusWaiterTest, CancelResolvesOnlyTheOwner) {
+    milvus::StatusWaiter waiter;
+    int owner_a = 0;
+    int owner_b = 0;
+    auto never = [](milvus::Progress& progress, uint64_t) {
+        progress.total_ = 1;
+        return milvus::Status::OK();
+    };
+    auto a = waiter.Submit(&owner_a, never, milvus::ProgressMonitor::Forever());
+    auto b = waiter.Submit(&owner_b, never, milvus::ProgressMonitor::Forever());
+    EXPECT_EQ(waiter.Pending(), 2);
+
+    waiter.Cancel(&owner_a);
+    EXPECT_EQ(a.get().Code(), milvus::StatusCode::NOT_CONNECTED);
+    EXPECT_EQ(b.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    EXPECT_EQ(waiter.Pending(), 1);
+
+    waiter.Cancel(&owner_b);
+    EXPECT_EQ(b.get().Code(), milvus::StatusCode::NOT_CONNECTED);
+    EXPECT_EQ(waiter.Pending(), 0);
+}
+
+TEST(StatusWaiterTest, ManyWaitsShareFewThreads) {
+    milvus::StatusWaiter waiter;
+    constexpr int kWaits = 300;
+    std::vector<std::future<milvus::Status>> futures;
+    std::vector<std::shared_ptr<std::atomic<int>>> counters;
+    for (int i = 0; i < kWaits; ++i) {
+        counters.push_back(std::make_shared<std::atomic<int>>(0));
+        futures.push_back(waiter.Submit(this, DoneAfter(1 + i % 5, counters.back()), milvus::ProgressMonitor{10}));
+    }
+    for (int i = 0; i < kWaits; ++i) {
+        EXPECT_TRUE(futures[i].get().IsOk());
+        EXPECT_EQ(counters[i]->load(), 1 + i % 5);
+    }
+    EXPECT_EQ(waiter.Pending(), 0);
+}
+
+TEST(StatusWaiterTest, StalledPollDoesNotHoldUpOtherWaits) {
+    milvus::StatusWaiter waiter;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::atomic<int> stalled_polls{0};
+    auto stalled = [released, &stalled_polls](milvus::Progress& progress, uint64_t) {
+        ++stalled_polls;
+        released.wait();
+        progress.total_ = 1;
+        progress.finished_ = 1;
+        return milvus::Status::OK();
+    };
+    auto blocked = waiter.Submit(&waiter, stalled, milvus::ProgressMonitor{10});
+
+    // the timer thread only hands polls over, so the other wait is polled while the first rpc hangs
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    EXPECT_TRUE(waiter.Submit(this, DoneAfter(3, counter), milvus::ProgressMonitor{10}).get().IsOk());
+    EXPECT_EQ(counter->load(), 3);
+    EXPECT_EQ(blocked.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+
+    release.set_value();
+    EXPECT_TRUE(blocked.get().IsOk());
+    EXPECT_EQ(stalled_polls.load(), 1);
+}
+
+TEST(StatusWaiterTest, ThrowingQueryFailsTheWait) {
+    milvus::StatusWaiter waiter;
+    auto throwing = [](milvus::Progress&, uint64_t) -> milvus::Status { throw std::runtime_error("broken"); };
+    EXPECT_EQ(waiter.Submit(this, throwing, milvus::ProgressMonitor{10}).get().Code(),
+              milvus::StatusCode::UNKNOWN_ERROR);
+    EXPECT_EQ(waiter.Pending(), 0);
+}
+
+TEST(StatusWaiterTest, WatchCallsDoneOnAPollWorker) {
+    milvus::StatusWaiter waiter;
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    std::promise<std::pair<milvus::Status, std::thread::id>> finished;
+    waiter.Watch(this, DoneAfter(2, counter), milvus::ProgressMonitor{10}, [&finished](const milvus::Status& status) {
+        finished.set_value(std::make_pair(status, std::this_thread::get_id()));
+    });
+    auto result = finished.get_future().get();
+    EXPECT_TRUE(result.first.IsOk());
+    EXPECT_NE(result.second, std::this_thread::get_id());
+    EXPECT_EQ(counter->load(), 2);
+
+    // a cancelled wait still calls done
+    std::promise<milvus::Status> cancelled;
+    auto never = [](milvus::Progress& progress, uint64_t) {
+        progress.total_ = 1;
+        return milvus::Status::OK();
+    };
+    waiter.Watch(this, never, milvus::ProgressMonitor::Forever(),
+                 [&cancelled](const milvus::Status& status) { cancelled.set_value(status); });
+    waiter.Cancel(this);
+    EXPECT_EQ(cancelled.get_future().get().Code(), milvus::StatusCode::NOT_CONNECTED);
+}
+
+TEST(StatusWaiterTest, PollRpcIsBoundedByTheWait) {
+    milvus::StatusWaiter waiter;
+    std::vector<uint64_t> timeouts;
+    auto query = [&timeouts](milvus::Progress& progress, uint64_t rpc_timeout_ms) {
+        timeouts.push_back(rpc_timeout_ms);
+        progress.total_ = 1;
+        return milvus::Status::OK();
+    };
+    EXPECT_EQ(waiter.Submit(this, query, milvus::ProgressMonitor{1}).get().Code(), milvus::StatusCode::TIMEOUT);
+    ASSERT_FALSE(timeouts.empty());
+    EXPECT_LE(timeouts.front(), 1000);
+    EXPECT_GE(timeouts.front(), 900);
+    for (size_t i = 1; i < timeouts.size(); ++i) {
+        EXPECT_LE(timeouts[i], timeouts[i - 1]);
+        EXPECT_GE(timeouts[i], 1);
+    }
+
+    timeouts.clear();
+    EXPECT_EQ(waiter.Submit(this, query, milvus::ProgressMonitor::Forever()).wait_for(std::chrono::milliseconds(50)),
+              std::future_status::timeout);
+    waiter.Cancel(this);
+    ASSERT_FALSE(timeouts.empty());
+    EXPECT_EQ(timeouts.front(), milvus::StatusWaiter::max_poll_ms);
+}
+
+TEST(StatusWaiterTest, CallbackRunsOnTheWaitingThread) {
+    milvus::StatusWaiter waiter;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::thread::id callback_thread;
+    milvus::ProgressMonitor slow{10};
+    slow.SetCallbackFunc([&callback_thread, released](milvus::Progress&) {
+        callback_thread = std::this_thread::get_id();
+        released.wait();
+    });
+    auto blocked = std::async(std::launch::async, [&waiter, &slow] {
+        return std::make_pair(waiter.Await(&waiter, DoneAfter(1, std::make_shared<std::atomic<int>>(0)), slow),
+                              std::this_thread::get_id());
+    });
+
+    // the callback above blocks its own caller, other waits still finish
+    auto counter = std::make_shared<std::atomic<int>>(0);
+    EXPECT_TRUE(waiter.Await(this, DoneAfter(3, counter), milvus::ProgressMonitor{10}).IsOk());
+    EXPECT_EQ(counter->load(), 3);
+
+    release.set_value();
+    auto result = blocked.get();
+    EXPECT_TRUE(result.first.IsOk());
+    EXPECT_EQ(callback_thread, result.second);
+}
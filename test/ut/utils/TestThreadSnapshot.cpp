@@ -0,0 +1,86 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include "utils/cache/ThreadSnapshot.h"
+
+namespace {
+
+milvus::CollectionCacheKey
+Key(const std::string& collection_name) {
+    return milvus::CollectionCacheKey::Create("localhost:19530", "db", collection_name);
+}
+
+}  // namespace
+
+TEST(ThreadSnapshotTest, KeepsCopiesUntilInvalidated) {
+    milvus::ThreadSnapshot<int> snapshot;
+    EXPECT_EQ(snapshot.Find(Key("a")), nullptr);
+    EXPECT_EQ(snapshot.Keep(Key("a"), 1), 1);
+
+    auto found = snapshot.Find(Key("a"));
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, 1);
+    EXPECT_EQ(snapshot.Find(Key("b")), nullptr);
+
+    snapshot.Invalidate();
+    EXPECT_EQ(snapshot.Find(Key("a")), nullptr);
+}
+
+TEST(ThreadSnapshotTest, CopiesArePerThreadAndPerInstance) {
+    milvus::ThreadSnapshot<int> first;
+    milvus::ThreadSnapshot<int> second;
+    first.Find(Key("a"));
+    first.Keep(Key("a"), 1);
+
+    std::thread other([&first]() { EXPECT_EQ(first.Find(Key("a")), nullptr); });
+    other.join();
+    ASSERT_NE(first.Find(Key("a")), nullptr);
+
+    // a thread keeps the copies of the instance it looked up last
+    EXPECT_EQ(second.Find(Key("a")), nullptr);
+    EXPECT_EQ(first.Find(Key("a")), nullptr);
+}
+
+TEST(ThreadSnapshotTest, ReplacesOneCopyWhenFull) {
+    milvus::ThreadSnapshot<int> snapshot;
+    const size_t capacity = milvus::ThreadSnapshot<int>::kCapacity;
+    snapshot.Find(Key("c0"));
+    for (size_t i = 0; i < capacity; ++i) {
+        snapshot.Keep(Key("c" + std::to_string(i)), static_cast<int>(i));
+    }
+
+    // c0 was found again, so the hand passes it and replaces c1, the first copy not found since
+    ASSERT_NE(snapshot.Find(Key("c0")), nullptr);
+    EXPECT_EQ(snapshot.Keep(Key("new"), -1), -1);
+    EXPECT_EQ(snapshot.Find(Key("c1")), nullptr);
+
+    auto found = snapshot.Find(Key("c0"));
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, 0);
+    for (size_t i = 2; i < capacity; ++i) {
+        found = snapshot.Find(Key("c" + std::to_string(i)));
+        ASSERT_NE(found, nullptr) << i;
+        EXPECT_EQ(*found, static_cast<int>(i));
+    }
+    found = snapshot.Find(Key("new"));
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, -1);
+}
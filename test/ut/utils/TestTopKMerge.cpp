@@ -0,0 +1,98 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "utils/TopKMerge.h"
+
+using milvus::MergedHit;
+using milvus::RankedList;
+
+namespace {
+std::vector<std::pair<size_t, size_t>>
+Flatten(const std::vector<MergedHit>& hits) {
+    std::vector<std::pair<size_t, size_t>> flat;
+    for (const auto& hit : hits) {
+        flat.emplace_back(hit.list_, hit.position_);
+    }
+    return flat;
+}
+}  // namespace
+
+class TopKMergeTest : public ::testing::Test {};
+
+TEST_F(TopKMergeTest, MergeLargerFirst) {
+    const std::vector<float> a{0.9f, 0.5f, 0.1f};
+    const std::vector<float> b{0.8f, 0.7f};
+    const std::vector<RankedList> lists{{a.data(), a.size()}, {b.data(), b.size()}};
+
+    auto hits = milvus::MergeRankedLists(lists, 0, 10, true);
+    std::vector<std::pair<size_t, size_t>> expected{{0, 0}, {1, 0}, {1, 1}, {0, 1}, {0, 2}};
+    EXPECT_EQ(Flatten(hits), expected);
+}
+
+TEST_F(TopKMergeTest, MergeSmallerFirst) {
+    const std::vector<float> a{0.1f, 0.5f};
+    const std::vector<float> b{0.2f, 0.3f, 0.9f};
+    const std::vector<RankedList> lists{{a.data(), a.size()}, {b.data(), b.size()}};
+
+    auto hits = milvus::MergeRankedLists(lists, 0, 3, false);
+    std::vector<std::pair<size_t, size_t>> expected{{0, 0}, {1, 0}, {1, 1}};
+    EXPECT_EQ(Flatten(hits), expected);
+}
+
+TEST_F(TopKMergeTest, MergeOffsetAndLimit) {
+    const std::vector<float> a{0.9f, 0.5f, 0.1f};
+    const std::vector<float> b{0.8f, 0.7f};
+    const std::vector<RankedList> lists{{a.data(), a.size()}, {b.data(), b.size()}};
+
+    auto hits = milvus::MergeRankedLists(lists, 2, 2, true);
+    std::vector<std::pair<size_t, size_t>> expected{{1, 1}, {0, 1}};
+    EXPECT_EQ(Flatten(hits), expected);
+
+    EXPECT_TRUE(milvus::MergeRankedLists(lists, 5, 2, true).empty());
+    EXPECT_TRUE(milvus::MergeRankedLists(lists, 0, 0, true).empty());
+}
+
+TEST_F(TopKMergeTest, MergeTiesByListThenPosition) {
+    const std::vector<float> a{0.5f, 0.5f};
+    const std::vector<float> b{0.5f};
+    const std::vector<RankedList> lists{{b.data(), 0}, {a.data(), a.size()}, {b.data(), b.size()}};
+
+    auto hits = milvus::MergeRankedLists(lists, 0, 10, true);
+    std::vector<std::pair<size_t, size_t>> expected{{1, 0}, {1, 1}, {2, 0}};
+    EXPECT_EQ(Flatten(hits), expected);
+}
+
+TEST_F(TopKMergeTest, LargerScoreFirst) {
+    const std::vector<float> ascending{0.1f, 0.1f, 0.3f};
+    const std::vector<float> descending{0.3f, 0.1f};
+    const std::vector<float> flat{0.2f, 0.2f};
+    const std::vector<RankedList> ascending_lists{{flat.data(), flat.size()}, {ascending.data(), ascending.size()}};
+    const std::vector<RankedList> descending_lists{{descending.data(), descending.size()}};
+    const std::vector<RankedList> flat_lists{{flat.data(), flat.size()}};
+
+    EXPECT_FALSE(milvus::LargerScoreFirst(milvus::MetricType::L2, descending_lists));
+    EXPECT_FALSE(milvus::LargerScoreFirst(milvus::MetricType::HAMMING, descending_lists));
+    EXPECT_TRUE(milvus::LargerScoreFirst(milvus::MetricType::IP, ascending_lists));
+    EXPECT_TRUE(milvus::LargerScoreFirst(milvus::MetricType::COSINE, ascending_lists));
+    EXPECT_FALSE(milvus::LargerScoreFirst(milvus::MetricType::DEFAULT, ascending_lists));
+    EXPECT_TRUE(milvus::LargerScoreFirst(milvus::MetricType::DEFAULT, descending_lists));
+    EXPECT_TRUE(milvus::LargerScoreFirst(milvus::MetricType::DEFAULT, flat_lists));
+}
@@ -0,0 +1,150 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "milvus.pb.h"
+#include "utils/TraceScope.h"
+
+namespace {
+
+struct SpanRecord {
+    milvus::SpanAttributes start_;
+    milvus::SpanAttributes end_;
+    milvus::Status status_;
+    bool ended_{false};
+};
+
+class RecordingSpan : public milvus::Span {
+ public:
+    explicit RecordingSpan(std::shared_ptr<SpanRecord> record) : record_(std::move(record)) {
+    }
+
+    void
+    InjectHeaders(std::unordered_map<std::string, std::string>& headers) override {
+        headers[milvus::TRACEPARENT_HEADER] =
+            milvus::Traceparent("4bf92f3577b34da6a3ce929d0e0e4736", "00f067aa0ba902b7", true);
+    }
+
+    void
+    End(const milvus::SpanAttributes& attributes, const milvus::Status& status) override {
+        record_->end_ = attributes;
+        record_->status_ = status;
+        record_->ended_ = true;
+    }
+
+ private:
+    std::shared_ptr<SpanRecord> record_;
+};
+
+class RecordingTracer : public milvus::Tracer {
+ public:
+    milvus::SpanPtr
+    StartSpan(const milvus::SpanAttributes& attributes) override {
+        if (skip_) {
+            return nullptr;
+        }
+        record_ = std::make_shared<SpanRecord>();
+        record_->start_ = attributes;
+        return milvus::SpanPtr(new RecordingSpan(record_));
+    }
+
+    bool skip_{false};
+    std::shared_ptr<SpanRecord> record_;
+};
+
+}  // namespace
+
+class TraceScopeTest : public ::testing::Test {};
+
+TEST_F(TraceScopeTest, NoTracer) {
+    milvus::proto::milvus::SearchRequest request;
+    milvus::proto::milvus::SearchResults response;
+    milvus::Status status;
+    milvus::TraceScope scope(nullptr, request, response, status);
+    scope.OnAttempt();
+    EXPECT_EQ(scope.Headers(), nullptr);
+}
+
+TEST_F(TraceScopeTest, RecordsSpan) {
+    auto tracer = std::make_shared<RecordingTracer>();
+    milvus::proto::milvus::SearchRequest request;
+    request.set_db_name("db");
+    request.set_collection_name("coll");
+    request.set_nq(3);
+    milvus::proto::milvus::SearchResults response;
+    milvus::Status status;
+    {
+        milvus::TraceScope scope(tracer, request, response, status);
+        ASSERT_NE(tracer->record_, nullptr);
+        const auto& start = tracer->record_->start_;
+        EXPECT_EQ(start.RpcName(), "Search");
+        EXPECT_EQ(start.DatabaseName(), "db");
+        EXPECT_EQ(start.CollectionName(), "coll");
+        EXPECT_EQ(start.Nq(), 3);
+        EXPECT_EQ(start.RequestBytes(), request.ByteSizeLong());
+
+        const auto* headers = scope.Headers();
+        ASSERT_NE(headers, nullptr);
+        EXPECT_EQ(headers->at(milvus::TRACEPARENT_HEADER), "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01");
+
+        scope.OnAttempt();
+        scope.OnAttempt();
+        scope.OnAttempt();
+        response.set_collection_name("coll");
+        status = milvus::Status{milvus::StatusCode::TIMEOUT, "timeout"};
+        EXPECT_FALSE(tracer->record_->ended_);
+    }
+    const auto& record = *tracer->record_;
+    EXPECT_TRUE(record.ended_);
+    EXPECT_EQ(record.end_.Retries(), 2);
+    EXPECT_EQ(record.end_.ResponseBytes(), response.ByteSizeLong());
+    EXPECT_GT(record.end_.ResponseBytes(), 0);
+    EXPECT_EQ(record.status_.Code(), milvus::StatusCode::TIMEOUT);
+}
+
+TEST_F(TraceScopeTest, InsertRows) {
+    auto tracer = std::make_shared<RecordingTracer>();
+    milvus::proto::milvus::InsertRequest request;
+    request.set_num_rows(10);
+    milvus::proto::milvus::MutationResult response;
+    milvus::Status status;
+    {
+        milvus::TraceScope scope(tracer, request, response, status);
+        scope.OnAttempt();
+    }
+    ASSERT_NE(tracer->record_, nullptr);
+    EXPECT_EQ(tracer->record_->end_.RpcName(), "Insert");
+    EXPECT_EQ(tracer->record_->end_.Rows(), 10);
+    EXPECT_EQ(tracer->record_->end_.Nq(), 0);
+    EXPECT_EQ(tracer->record_->end_.Retries(), 0);
+    EXPECT_TRUE(tracer->record_->status_.IsOk());
+}
+
+TEST_F(TraceScopeTest, TracerSkipsCall) {
+    auto tracer = std::make_shared<RecordingTracer>();
+    tracer->skip_ = true;
+    milvus::proto::milvus::SearchRequest request;
+    milvus::proto::milvus::SearchResults response;
+    milvus::Status status;
+    milvus::TraceScope scope(tracer, request, response, status);
+    EXPECT_EQ(scope.Headers(), nullptr);
+}
@@ -0,0 +1,160 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "utils/WorkStealingExecutor.h"
+
+TEST(WorkStealingExecutorTest, RunsEveryTask) {
+    milvus::WorkStealingExecutor executor{4};
+    EXPECT_EQ(executor.WorkerCount(), 4);
+
+    const int count = 1000;
+    std::atomic<int> ran{0};
+    std::vector<std::future<void>> dones;
+    for (int i = 0; i < count; ++i) {
+        auto promise = std::make_shared<std::promise<void>>();
+        dones.emplace_back(promise->get_future());
+        EXPECT_TRUE(executor.Submit([&ran, promise]() {
+                                ++ran;
+                                promise->set_value();
+                            })
+                        .IsOk());
+    }
+    for (auto& done : dones) {
+        done.wait();
+    }
+    EXPECT_EQ(ran.load(), count);
+
+    const auto stats = executor.Stats();
+    EXPECT_EQ(stats.Workers(), 4);
+    EXPECT_EQ(stats.Submitted(), count);
+    EXPECT_GE(stats.MaxQueueDepth(), 1);
+    EXPECT_EQ(stats.Failed(), 0);
+}
+
+TEST(WorkStealingExecutorTest, RejectsEmptyTask) {
+    milvus::WorkStealingExecutor executor{1};
+    EXPECT_EQ(executor.Submit(nullptr).Code(), milvus::StatusCode::INVALID_ARGUMENT);
+}
+
+TEST(WorkStealingExecutorTest, IdleWorkerStealsFromBusyOne) {
+    milvus::WorkStealingExecutor executor{2};
+
+    // the first task queues its children on its own deque and blocks, only the other worker can run them
+    const int children = 16;
+    std::atomic<int> ran{0};
+    std::promise<void> all_ran;
+    std::promise<void> parent_done;
+    ASSERT_TRUE(executor
+                    .Submit([&]() {
+                        for (int i = 0; i < children; ++i) {
+                            executor.Submit([&]() {
+                                if (++ran == children) {
+                                    all_ran.set_value();
+                                }
+                            });
+                        }
+                        all_ran.get_future().wait();
+                        parent_done.set_value();
+                    })
+                    .IsOk());
+    parent_done.get_future().wait();
+    EXPECT_EQ(ran.load(), children);
+    EXPECT_GE(executor.Stats().Stolen(), children);
+}
+
+TEST(WorkStealingExecutorTest, ThrowingTaskIsCountedAndWorkerSurvives) {
+    milvus::WorkStealingExecutor executor{1};
+    executor.Submit([]() { throw std::runtime_error("boom"); });
+    std::promise<void> done;
+    executor.Submit([&done]() { done.set_value(); });
+    done.get_future().wait();
+
+    // the counters of a task are updated after it returns
+    while (executor.Stats().Completed() < 2) {
+        std::this_thread::yield();
+    }
+    const auto stats = executor.Stats();
+    EXPECT_EQ(stats.Failed(), 1);
+    EXPECT_EQ(stats.QueueDepth(), 0);
+}
+
+TEST(WorkStealingExecutorTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> ran{0};
+    {
+        milvus::WorkStealingExecutor executor{1};
+        std::mutex mutex;
+        std::unique_lock<std::mutex> hold(mutex);
+        // the worker blocks on the first task, the rest stay queued until the executor is destroyed
+        executor.Submit([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++ran;
+        });
+        for (int i = 0; i < 10; ++i) {
+            executor.Submit([&ran]() { ++ran; });
+        }
+        EXPECT_GE(executor.Stats().QueueDepth(), 10);
+        hold.unlock();
+    }
+    EXPECT_EQ(ran.load(), 11);
+}
+
+TEST(WorkStealingExecutorTest, TaskMayDropLastReference) {
+    auto executor = milvus::Executor::Create(2);
+    std::promise<void> done;
+    auto holder = std::make_shared<milvus::ExecutorPtr>(executor);
+    executor->Submit([holder, &done]() {
+        holder->reset();
+        done.set_value();
+    });
+    executor.reset();
+    done.get_future().wait();
+}
+
+TEST(WorkStealingExecutorTest, LatencyIsMeasured) {
+    milvus::WorkStealingExecutor executor{1};
+    std::promise<void> done;
+    executor.Submit([&done]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        done.set_value();
+    });
+    done.get_future().wait();
+    while (executor.Stats().Completed() < 1) {
+        std::this_thread::yield();
+    }
+    const auto stats = executor.Stats();
+    EXPECT_GE(stats.TotalRunUs(), 4000);
+    EXPECT_GE(stats.MeanRunUs(), 4000.0);
+    EXPECT_LE(stats.MaxWaitUs(), stats.TotalWaitUs());
+}
+
+TEST(WorkStealingExecutorTest, DefaultExecutorIsShared) {
+    auto first = milvus::Executor::Default();
+    auto second = milvus::Executor::Default();
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_GE(first->WorkerCount(), 2);
+}